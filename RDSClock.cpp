@@ -0,0 +1,107 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This is the code file for the RDS CT clock service.
+ * See the header file for better function documentation.
+ */
+
+#include "RDSClock.h"
+
+void RDSClock::reset(void) {
+    _valid = false;
+    _lastutc = 0;
+    _drift = 0;
+    _offset = 0;
+    anchor(0, 0);
+}
+
+void RDSClock::anchor(uint32_t utc, uint32_t timestamp) {
+    _anchorutc = utc;
+    _anchorts = timestamp;
+    _intercept = 0;
+    _bias = 0;
+    _lag = 0;
+    _n = 0;
+    _sx = _sy = _sxx = _sxy = 0;
+}
+
+bool RDSClock::update(uint32_t utc, int16_t offset, uint32_t timestamp) {
+    //RDS CT only ever marks minute edges.
+    if(!utc || utc % 60)
+        return false;
+    if(_valid && utc == _lastutc)
+        return false;
+
+    _offset = offset;
+    _lastutc = utc;
+    if(!_valid || utc < _anchorutc ||
+       utc - _anchorutc >= RDS_CLOCK_MAX_BASELINE) {
+        //Keep the drift estimate across re-anchoring, it's still good.
+        anchor(utc, timestamp);
+        _valid = true;
+    };
+
+    //Use integer arithmetic at all costs, Arduino lacks an FPU. x is the time
+    //since the anchor in s, y is how far the local counter deviates from
+    //that, in ms.
+    int32_t x = utc - _anchorutc;
+    int32_t y = (int32_t)((uint32_t)(timestamp - _anchorts) - x * 1000UL);
+
+    if(_n) {
+        int32_t error = y - _intercept - _bias -
+                        (int32_t)((int64_t)x * _drift / 1000);
+
+        if(error > RDS_CLOCK_STEP_MS || error < -RDS_CLOCK_STEP_MS) {
+            anchor(utc, timestamp);
+            x = y = 0;
+        };
+    };
+
+    _n++;
+    _sx += x;
+    _sy += y;
+    _sxx += (int64_t)x * x;
+    _sxy += (int64_t)x * y;
+
+    if(x >= (int32_t)RDS_CLOCK_MIN_BASELINE) {
+        //Slope of the fit is the drift: ms per s, scaled to ppm.
+        int64_t den = (int64_t)_n * _sxx - _sx * _sx;
+        int64_t num = (int64_t)_n * _sxy - _sx * _sy;
+
+        if(den >= 1000)
+            _drift = (int32_t)(num / (den / 1000));
+    };
+    _intercept = (int32_t)((_sy - _sx * _drift / 1000) / _n);
+
+    //Arrivals scatter above the minute edge, never below: the lower envelope
+    //of the residuals is where the edge is.
+    int32_t residual = y - _intercept - (int32_t)((int64_t)x * _drift / 1000);
+    if(_n == 1 || residual <= _bias + RDS_CLOCK_LEAK_MS)
+        _bias = residual;
+    else
+        _bias += RDS_CLOCK_LEAK_MS;
+    _lag = residual - _bias;
+
+    return true;
+}
+
+uint32_t RDSClock::now(uint32_t timestamp, word *millis) {
+    if(!_valid)
+        return 0;
+
+    int64_t elapsed = (int64_t)(uint32_t)(timestamp - _anchorts) - _intercept -
+                      _bias;
+    if(elapsed < 0)
+        elapsed = 0;
+    elapsed = elapsed * 1000000L / (1000000L + _drift);
+
+    if(millis)
+        *millis = elapsed % 1000;
+
+    return _anchorutc + (uint32_t)(elapsed / 1000);
+}
@@ -0,0 +1,119 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This file contains the RDS CT clock service: it turns the minute-resolution
+ * CT groups into a running clock by timestamping their arrival against a
+ * local millisecond counter (e.g. millis() on Arduino or CLOCK_MONOTONIC on a
+ * host) and estimating where the minute edges fall and how fast the local
+ * counter drifts with respect to UTC.
+ */
+
+#ifndef _RDSCLOCK_H_INCLUDED
+#define _RDSCLOCK_H_INCLUDED
+
+#include "RDSDecoder.h"
+
+//Minimum span of CT samples before we dare estimate the drift, in seconds.
+//Arrival jitter is about one group (88ms), so 10 minutes bounds the error of
+//the first estimate to about 150ppm; it improves as the span grows.
+#define RDS_CLOCK_MIN_BASELINE 600UL
+//Maximum span before re-anchoring, in seconds. Keeps the local millisecond
+//counter differences well clear of wrapping around.
+#define RDS_CLOCK_MAX_BASELINE 86400UL
+//A CT sample this far off the prediction (in ms) means the station or the
+//local counter stepped: start over.
+#define RDS_CLOCK_STEP_MS 5000L
+//How fast (in ms per sample) the minute edge estimate is allowed to creep
+//later, so that a single early outlier doesn't pin it forever.
+#define RDS_CLOCK_LEAK_MS 1
+
+class RDSClock
+{
+    public:
+        RDSClock() { reset(); }
+
+        /*
+        * Description:
+        *   Forgets everything learned so far.
+        */
+        void reset(void);
+
+        /*
+        * Description:
+        *   Feeds one CT sample to the clock, typically from within the
+        *   RDS_CALLBACK_CT callback with the values from
+        *   RDSDecoder::getRDSEpoch(). Repeats of the same minute are ignored as
+        *   only the first arrival of each carries timing information.
+        * Parameters:
+        *   utc - UTC time in seconds since the UNIX epoch, as signalled.
+        *   offset - local time offset in minutes, as signalled.
+        *   timestamp - local millisecond counter at the time of arrival.
+        * Returns:
+        *   true if the sample was used, false if it was ignored.
+        */
+        bool update(uint32_t utc, int16_t offset, uint32_t timestamp);
+
+        /*
+        * Description:
+        *   Returns true once at least one CT sample has been accepted.
+        */
+        bool isValid(void) { return _valid; }
+
+        /*
+        * Description:
+        *   Estimates UTC at the given local timestamp.
+        * Parameters:
+        *   timestamp - local millisecond counter value to convert.
+        *   millis - optional pointer to a word receiving the milliseconds
+        *            part of the estimate.
+        * Returns:
+        *   UTC time in seconds since the UNIX epoch, or 0 if not isValid().
+        */
+        uint32_t now(uint32_t timestamp, word *millis = NULL);
+
+        /*
+        * Description:
+        *   Returns the local time offset, in minutes, as last signalled.
+        */
+        int16_t getOffset(void) { return _offset; }
+
+        /*
+        * Description:
+        *   Returns the estimated drift of the local millisecond counter with
+        *   respect to UTC, in parts per million: positive if the local counter
+        *   runs fast. Zero until enough samples have been seen.
+        */
+        int32_t getDrift(void) { return _drift; }
+
+        /*
+        * Description:
+        *   Returns how late (in ms) the last CT sample arrived after the
+        *   estimated minute edge. The earliest arrivals seen define the edge,
+        *   so this is never negative.
+        */
+        int32_t getLag(void) { return _lag; }
+
+    private:
+        bool _valid;
+        uint32_t _anchorutc, _anchorts, _lastutc;
+        int32_t _drift, _intercept, _bias, _lag;
+        int16_t _offset;
+        //Running sums for the least squares fit of arrival time deviation
+        //(ms) against time since the anchor (s).
+        word _n;
+        int64_t _sx, _sy, _sxx, _sxy;
+
+        /*
+        * Description:
+        *   Makes the given sample the reference all others are measured
+        *   against, keeping the drift estimate.
+        */
+        void anchor(uint32_t utc, uint32_t timestamp);
+};
+
+#endif
@@ -189,6 +189,7 @@
 #define RDS_TIME_MJD2_SHR 17
 #define RDS_TIME_MJD1_MASK word(0x0003)
 #define RDS_TIME_MJD1_SHL 15
+#define RDS_TIME_MJD_EPOCH 40587UL // MJD of 1970-01-01, i.e. UNIX epoch
 
 //Define RDS EON (group 14A) values and decoding masks
 #define RDS_EON_TP word(0x0010)
@@ -268,6 +269,19 @@
 #define RDS_PAGING_ENHANCED_TYPE_DIGIT 0x1
 #define RDS_PAGING_ENHANCED_TYPE_FUNCTION 0x3
 
+//Define station cache bookkeeping bits (which segments were heard on air)
+#define RDS_STATION_SEEN_PS_FIRST 0x01
+#define RDS_STATION_SEEN_PS 0x0F
+#define RDS_STATION_SEEN_PTYN_FIRST 0x10
+#define RDS_STATION_SEEN_PTYN 0x30
+#define RDS_STATION_SEEN_RT_PREVIOUS 0x40
+#define RDS_STATION_SEEN_RT 0x80
+
+//Define printable text bookkeeping bits (which segments changed)
+#define RDS_DIRTY_PS 0x0F
+#define RDS_DIRTY_PTYN 0x03
+#define RDS_DIRTY_RT 0xFFFF
+
 //Define RDS group types
 #define RDS_GROUP_0A 0x00
 #define RDS_GROUP_0B 0x01
@@ -13,6 +13,14 @@
 #include "RDSDecoder.h"
 #include "RDSDecoder-private.h"
 #include "iso14819-2.h"
+#include "RDSRTPlus.h"
+#include "RDSTMCRepeatFilter.h"
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+# include "RDSStationCache.h"
+# include "RDSERTAssembler.h"
+# include "RDSTMCTables.h"
+# include "RDSTMCLanguagePack.h"
+#endif
 
 #include <stdlib.h>
 #include <string.h>
@@ -42,11 +50,16 @@
 #  define pgm_read_byte(x) (uint8_t)(*x)
 #  define pgm_read_word(x) (uint16_t)(*x)
 #  define pgm_read_ptr(x) (void *)(*x)
+#  define memcpy_P memcpy
 # endif
 #else
 # warning Non-GNU compiler detected, you are on your own!
 #endif
 
+#if defined(__SSE2__)
+# include <emmintrin.h>
+#endif
+
 void RDSDecoder::registerCallback(byte type, TRDSCallback callback){
     if (type < sizeof(_callbacks) / sizeof(_callbacks[0]))
         _callbacks[type] = callback;
@@ -57,10 +70,24 @@ void RDSDecoder::decodeRDSGroup(word block[]){
     word fourchars[2];
     bool pagingCallback = false;
 
-    _status.programIdentifier = block[0];
+    _groups++;
+    if(_detached || block[0] != _status->programIdentifier) {
+        selectState(block[0]);
+        //RT+ tags, TMC repeats and eRT are not part of the cached state,
+        //start over.
+        if(_rtplus)
+            _rtplus->reset(_state->radioText);
+        if(_tmcfilter)
+            _tmcfilter->reset();
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+        if(_ertassembler)
+            _ertassembler->reset();
+#endif
+    };
+    _status->programIdentifier = block[0];
     grouptype = lowByte((block[1] & RDS_TYPE_MASK) >> RDS_TYPE_SHR);
-    _status.TP = (bool)(block[1] & RDS_TP);
-    _status.PTY = lowByte((block[1] & RDS_PTY_MASK) >> RDS_PTY_SHR);
+    _status->TP = (bool)(block[1] & RDS_TP);
+    _status->PTY = lowByte((block[1] & RDS_PTY_MASK) >> RDS_PTY_SHR);
 
     switch(grouptype){
         case RDS_GROUP_0A:
@@ -69,17 +96,18 @@ void RDSDecoder::decodeRDSGroup(word block[]){
             byte DIPSA;
             word twochars;
 
-            _status.TA = (bool)(block[1] & RDS_TA);
-            _status.MS = (bool)(block[1] & RDS_MS);
+            _status->TA = (bool)(block[1] & RDS_TA);
+            _status->MS = (bool)(block[1] & RDS_MS);
             DIPSA = lowByte(block[1] & RDS_DIPS_ADDRESS);
             if(block[1] & RDS_DI)
-                _status.DICC |= (0x1 << (3 - DIPSA));
+                _status->DICC |= (0x1 << (3 - DIPSA));
             else
-                _status.DICC &= ~(0x1 << (3 - DIPSA));
+                _status->DICC &= ~(0x1 << (3 - DIPSA));
             if(grouptype != RDS_GROUP_15B) {
                 twochars = swab(block[3]);
-                strncpy(&_status.programService[DIPSA * 2],
+                strncpy(&_status->programService[DIPSA * 2],
                         (char *)&twochars, 2);
+                _psdirty |= 0x01 << DIPSA;
             };
             if(grouptype == RDS_GROUP_0A) {
                 if (_callbacks[RDS_CALLBACK_AF])
@@ -87,24 +115,24 @@ void RDSDecoder::decodeRDSGroup(word block[]){
             }
             break;
         case RDS_GROUP_1A:
-            _status.linkageActuator = (bool)(block[2] & RDS_SLABEL_LA);
+            _status->linkageActuator = (bool)(block[2] & RDS_SLABEL_LA);
             switch((block[2] & RDS_SLABEL_MASK) >> RDS_SLABEL_SHR) {
                 case RDS_SLABEL_TYPE_PAGINGECC:
-                    _status.extendedCountryCode = lowByte(block[2]);
-                    _status.pagingOperatorCode = highByte(block[2]) & 0x0F;
+                    _status->extendedCountryCode = lowByte(block[2]);
+                    _status->pagingOperatorCode = highByte(block[2]) & 0x0F;
                     pagingCallback = true;
                     break;
                 case RDS_SLABEL_TYPE_TMCID:
-                    _status.tmcIdentification = block[2] & RDS_SLABEL_VALUE_MASK;
+                    _status->tmcIdentification = block[2] & RDS_SLABEL_VALUE_MASK;
                     break;
                 case RDS_SLABEL_TYPE_PAGINGID:
-                    _status.pagingOperatorCode = (
+                    _status->pagingOperatorCode = (
                         block[2] & RDS_PAGING_OPC_MASK) >> RDS_PAGING_OPC_SHR;
-                    _status.pagingAreaCode = block[2] & RDS_PAGING_PAC_MASK;
+                    _status->pagingAreaCode = block[2] & RDS_PAGING_PAC_MASK;
                     pagingCallback = true;
                     break;
                 case RDS_SLABEL_TYPE_LANGUAGE:
-                    _status.languageCode = lowByte(block[2]);
+                    _status->languageCode = lowByte(block[2]);
                     break;
             };
             if(!(block[3] & RDS_PIN_DAY_MASK)) {
@@ -113,17 +141,17 @@ void RDSDecoder::decodeRDSGroup(word block[]){
                     switch((block[3] & RDS_PIN_PAGING_TYPE1_MASK) >>
                             RDS_PIN_PAGING_TYPE1_SHR) {
                         case RDS_PIN_PAGING_TYPE1_ECC:
-                            _status.extendedCountryCode = lowByte(block[3]);
+                            _status->extendedCountryCode = lowByte(block[3]);
                             break;
                         case RDS_PIN_PAGING_TYPE1_CCF:
-                            _status.currentCarrierFrequency = lowByte(block[3]);
+                            _status->currentCarrierFrequency = lowByte(block[3]);
                             break;
                     };
                 } else {
-                    _status.pagingAreaCode = (
+                    _status->pagingAreaCode = (
                         block[3] & RDS_PIN_PAGING_TYPE0_PAC_MASK) >>
                         RDS_PIN_PAGING_TYPE0_PAC_SHR;
-                    _status.pagingOperatorCode = block[3] &
+                    _status->pagingOperatorCode = block[3] &
                         RDS_PIN_PAGING_TYPE0_OPC_MASK;
                 };
             };
@@ -133,26 +161,42 @@ void RDSDecoder::decodeRDSGroup(word block[]){
                     true, block[2], block[3]);
             break;
         case RDS_GROUP_1B:
-            _status.programItemNumber = block[3];
+            _status->programItemNumber = block[3];
             break;
         case RDS_GROUP_2A:
         case RDS_GROUP_2B:
             byte RTA, RTAW;
 
-            if((bool)(block[1] & RDS_TEXTAB) != _rdstextab) {
+            if((bool)(block[1] & RDS_TEXTAB) != _state->rdstextab) {
                 if (_callbacks[RDS_CALLBACK_RT])
                     _callbacks[RDS_CALLBACK_RT](0x00,
                                                 (grouptype == RDS_GROUP_2A),
                                                 0x00, 0x00);
-                _rdstextab = !_rdstextab;
-                memset(_status.radioText, ' ', sizeof(_status.radioText) - 1);
+                _state->rdstextab = !_state->rdstextab;
+                //Keep the outgoing text around rather than wiping it, unless
+                //there's nothing to keep.
+                if(_state->seen & RDS_STATION_SEEN_RT) {
+                    char *swap = _state->previousRadioText;
+
+                    _state->previousRadioText = _state->radioText;
+                    _state->radioText = swap;
+                    _state->seen &= ~RDS_STATION_SEEN_RT;
+                    _state->seen |= RDS_STATION_SEEN_RT_PREVIOUS;
+                    memset(_state->radioText, ' ',
+                           sizeof(_status->radioText) - 1);
+                    _rtdirty = RDS_DIRTY_RT;
+                    if(_rtplus)
+                        _rtplus->textChanged(_state->radioText);
+                };
             }
             RTA = lowByte(block[1] & RDS_TEXT_ADDRESS);
             RTAW = (grouptype == RDS_GROUP_2A) ? 4 : 2;
             fourchars[0] = swab(block[(grouptype == RDS_GROUP_2A) ? 2 : 3]);
             if(grouptype == RDS_GROUP_2A)
                 fourchars[1] = swab(block[3]);
-            strncpy(&_status.radioText[RTA * RTAW], (char *)fourchars, RTAW);
+            strncpy(&_state->radioText[RTA * RTAW], (char *)fourchars, RTAW);
+            _state->seen |= RDS_STATION_SEEN_RT;
+            _rtdirty |= 0x01 << (RTA * RTAW / 4);
             break;
         case RDS_GROUP_3A:
             switch(block[3]){
@@ -160,25 +204,25 @@ void RDSDecoder::decodeRDSGroup(word block[]){
                     if ((block[1] & RDS_ODA_GROUP_MASK) == RDS_GROUP_8A) {
                       //Default use of Group 8A is TMC, so act as if we saw an
                       //explicit mapping of TMC's AID to Group 8A.
-                      _status.TMC.carriedInGroup = RDS_GROUP_8A;
-                      _status.TMC.message = block[2];
+                      _status->TMC.carriedInGroup = RDS_GROUP_8A;
+                      _status->TMC.message = block[2];
                     };
                     break;
                 case RDS_AID_ERT:
-                    _status.ERT.carriedInGroup = block[1] & RDS_ODA_GROUP_MASK;
-                    _status.ERT.message = block[2];
+                    _status->ERT.carriedInGroup = block[1] & RDS_ODA_GROUP_MASK;
+                    _status->ERT.message = block[2];
                     break;
                 case RDS_AID_RTPLUS:
-                    _status.RTP.carriedInGroup = block[1] & RDS_ODA_GROUP_MASK;
-                    _status.RTP.message = block[2];
+                    _status->RTP.carriedInGroup = block[1] & RDS_ODA_GROUP_MASK;
+                    _status->RTP.message = block[2];
                     break;
                 case RDS_AID_IRDS:
-                    _status.IRDS.carriedInGroup = block[1] & RDS_ODA_GROUP_MASK;
-                    _status.IRDS.message = block[2];
+                    _status->IRDS.carriedInGroup = block[1] & RDS_ODA_GROUP_MASK;
+                    _status->IRDS.message = block[2];
                     break;
                 case RDS_AID_TMC:
-                    _status.TMC.carriedInGroup = block[1] & RDS_ODA_GROUP_MASK;
-                    _status.TMC.message = block[2];
+                    _status->TMC.carriedInGroup = block[1] & RDS_ODA_GROUP_MASK;
+                    _status->TMC.message = block[2];
                     break;
             };
             if (_callbacks[RDS_CALLBACK_AID])
@@ -201,17 +245,32 @@ void RDSDecoder::decodeRDSGroup(word block[]){
         case RDS_GROUP_12B:
         case RDS_GROUP_13B:
         case RDS_GROUP_15A:
-            if(grouptype == _status.TMC.carriedInGroup) {
+            if(grouptype == _status->TMC.carriedInGroup) {
+                //Most TMC groups are repeats, drop them before anyone spends
+                //time unpacking them.
+                if (_tmcfilter &&
+                    _tmcfilter->isRepeat(block[1] & RDS_ODA_GROUP_MASK,
+                                         block[2], block[3], _groups))
+                    break;
                 if (_callbacks[RDS_CALLBACK_TMC])
                     _callbacks[RDS_CALLBACK_TMC](
                         block[1] & RDS_ODA_GROUP_MASK, true, block[2],
                         block[3]);
-            } else if(grouptype == _status.RTP.carriedInGroup) {
+            } else if(grouptype == _status->RTP.carriedInGroup) {
+                if (_rtplus)
+                    _rtplus->addGroup(block[1] & RDS_ODA_GROUP_MASK, block[2],
+                                      block[3], _status->RTP.message);
                 if (_callbacks[RDS_CALLBACK_RTP])
                     _callbacks[RDS_CALLBACK_RTP](
                         block[1] & RDS_ODA_GROUP_MASK, true, block[2],
                         block[3]);
-            } else if(grouptype == _status.ERT.carriedInGroup) {
+            } else if(grouptype == _status->ERT.carriedInGroup) {
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+                if (_ertassembler)
+                    _ertassembler->addSegment(block[1] & RDS_ODA_GROUP_MASK,
+                                              _status->ERT.message, block[2],
+                                              block[3]);
+#endif
                 if (_callbacks[RDS_CALLBACK_ERT])
                     _callbacks[RDS_CALLBACK_ERT](
                         block[1] & RDS_ODA_GROUP_MASK, true, block[2],
@@ -238,15 +297,26 @@ void RDSDecoder::decodeRDSGroup(word block[]){
             if (CT & RDS_TIME_TZ_SIGN)
               _time.tm_tz = - _time.tm_tz;
             _time.tm_min = (CT & RDS_TIME_MINUTE_MASK) >> RDS_TIME_MINUTE_SHR;
-            //Use integer arithmetic at all costs, Arduino lacks an FPU
-            yp = (MJD * 10 - 150782) * 10 / 36525;
-            ys = yp * 36525 / 100;
-            mp = (MJD * 10 - 149561 - ys * 10) * 1000 / 306001;
-            _time.tm_mday = MJD - 14956 - ys - mp * 306001 / 10000;
-            k = (mp == 14 || mp == 15) ? 1 : 0;
-            _time.tm_year = 1900 + yp + k;
-            _time.tm_mon = mp - 1 - k * 12;
-            _time.tm_wday = (MJD + 2) % 7 + 1;
+            //The date only changes once a day, don't redo the math for it
+            //every minute.
+            if(MJD != _ctmjd) {
+                //Use integer arithmetic at all costs, Arduino lacks an FPU
+                yp = (MJD * 10 - 150782) * 10 / 36525;
+                ys = yp * 36525 / 100;
+                mp = (MJD * 10 - 149561 - ys * 10) * 1000 / 306001;
+                _time.tm_mday = MJD - 14956 - ys - mp * 306001 / 10000;
+                k = (mp == 14 || mp == 15) ? 1 : 0;
+                _time.tm_year = 1900 + yp + k;
+                _time.tm_mon = mp - 1 - k * 12;
+                _time.tm_wday = (MJD + 2) % 7 + 1;
+                _ctmjd = MJD;
+                _ctday = (MJD >= RDS_TIME_MJD_EPOCH ?
+                          (MJD - RDS_TIME_MJD_EPOCH) * 86400UL : 0);
+            };
+            _ctutc = _ctday + _time.tm_hour * 3600UL + _time.tm_min * 60UL;
+            if (_callbacks[RDS_CALLBACK_CT])
+                _callbacks[RDS_CALLBACK_CT](block[1] & RDS_TIME_MJD1_MASK, true,
+                                            block[2], block[3]);
             break;
         case RDS_GROUP_5A:
         case RDS_GROUP_5B:
@@ -267,14 +337,16 @@ void RDSDecoder::decodeRDSGroup(word block[]){
             //      there is no standard and it's never going to work. Pity!
             break;
         case RDS_GROUP_10A:
-            if((block[1] & RDS_PTYNAB) != _rdsptynab) {
-                _rdsptynab = !_rdsptynab;
-                memset(_status.programTypeName, ' ', 8);
+            if((block[1] & RDS_PTYNAB) != _state->rdsptynab) {
+                _state->rdsptynab = !_state->rdsptynab;
+                memset(_status->programTypeName, ' ', 8);
+                _ptyndirty = RDS_DIRTY_PTYN;
             }
             fourchars[0] = swab(block[2]);
             fourchars[1] = swab(block[3]);
-            strncpy(&_status.programTypeName[(block[1] & RDS_PTYN_ADDRESS) * 4],
+            strncpy(&_status->programTypeName[(block[1] & RDS_PTYN_ADDRESS) * 4],
                     (char *)&fourchars, 4);
+            _ptyndirty |= 0x01 << (block[1] & RDS_PTYN_ADDRESS);
             break;
         case RDS_GROUP_13A:
             if (_callbacks[RDS_CALLBACK_P13])
@@ -283,8 +355,8 @@ void RDSDecoder::decodeRDSGroup(word block[]){
             break;
         case RDS_GROUP_14A:
         case RDS_GROUP_14B:
-            _status.EON.TP = block[1] & RDS_EON_TP;
-            _status.EON.programIdentifier = block[3];
+            _status->EON.TP = block[1] & RDS_EON_TP;
+            _status->EON.programIdentifier = block[3];
             if (grouptype == RDS_GROUP_14A) {
                 switch(block[1] & RDS_EON_MASK){
                     case RDS_EON_TYPE_PS_SA0:
@@ -293,9 +365,10 @@ void RDSDecoder::decodeRDSGroup(word block[]){
                     case RDS_EON_TYPE_PS_SA3:
                         twochars = swab(block[2]);
                         strncpy(
-                            &_status.EON.programService[
+                            &_status->EON.programService[
                                 (block[1] & RDS_EON_MASK) * 2],
                             (char *)&twochars, 2);
+                        _eonpsdirty |= 0x01 << (block[1] & RDS_EON_MASK);
                         break;
                     case RDS_EON_TYPE_AF:
                         if (_callbacks[RDS_CALLBACK_EON])
@@ -313,34 +386,62 @@ void RDSDecoder::decodeRDSGroup(word block[]){
                             _callbacks[RDS_CALLBACK_EON](3, true, block[2], 0x00);
                         break;
                     case RDS_EON_TYPE_LINKAGE:
-                        memcpy(&_status.EON.linkageInformation, &block[2],
-                               sizeof(_status.EON.linkageInformation));
+                        memcpy(&_status->EON.linkageInformation, &block[2],
+                               sizeof(_status->EON.linkageInformation));
                         break;
                     case RDS_EON_TYPE_PTYTA:
-                        _status.EON.PTY = (block[2] & RDS_EON_PTY_A_MASK) >>
+                        _status->EON.PTY = (block[2] & RDS_EON_PTY_A_MASK) >>
                             RDS_EON_PTY_A_SHR;
-                        _status.EON.TA = block[2] & RDS_EON_TA_A;
+                        _status->EON.TA = block[2] & RDS_EON_TA_A;
                         break;
                     case RDS_EON_TYPE_PIN:
-                        _status.EON.programItemNumber = block[2];
+                        _status->EON.programItemNumber = block[2];
                         break;
                 };
             } else {
-                _status.EON.TA = block[1] & RDS_EON_TA_B;
-                _status.EON.PTY = mapShortPTY(
+                _status->EON.TA = block[1] & RDS_EON_TA_B;
+                _status->EON.PTY = mapShortPTY(
                     (block[1] & RDS_EON_PTY_B_MASK) >> RDS_EON_PTY_B_SHR);
             }
             break;
     }
+
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+    if(_stationcache)
+        updateStation(grouptype, block);
+#endif
 }
 
 void RDSDecoder::getRDSData(TRDSData* rdsdata){
-    makePrintable(_status.programService);
-    makePrintable(_status.programTypeName);
-    makePrintable(_status.radioText);
-    makePrintable(_status.EON.programService);
+    if(_detached) {
+        //Nothing heard since the last resetRDS().
+        initStatus(rdsdata);
+        return;
+    };
 
-    *rdsdata = _status;
+    if(_psdirty) {
+        makePrintable(_printps, _status->programService, 2, _psdirty);
+        _psdirty = 0x00;
+    };
+    if(_ptyndirty) {
+        makePrintable(_printptyn, _status->programTypeName, 4, _ptyndirty);
+        _ptyndirty = 0x00;
+    };
+    if(_rtdirty) {
+        makePrintable(_printrt, _state->radioText, 4, _rtdirty);
+        _rtdirty = 0x0000;
+    };
+    if(_eonpsdirty) {
+        makePrintable(_printeonps, _status->EON.programService, 2,
+                      _eonpsdirty);
+        _eonpsdirty = 0x00;
+    };
+
+    *rdsdata = *_status;
+    memcpy(rdsdata->programService, _printps, sizeof(_printps));
+    memcpy(rdsdata->programTypeName, _printptyn, sizeof(_printptyn));
+    memcpy(rdsdata->radioText, _printrt, sizeof(_printrt));
+    memcpy(rdsdata->EON.programService, _printeonps, sizeof(_printeonps));
 }
 
 bool RDSDecoder::getRDSTime(TRDSTime* rdstime){
@@ -349,74 +450,381 @@ bool RDSDecoder::getRDSTime(TRDSTime* rdstime){
     return _havect;
 }
 
-void RDSDecoder::resetRDS(void){
-    memset(&_status, 0x00, sizeof(_status));
-    memset(_status.programService, ' ', sizeof(_status.programService) - 1);
-    memset(_status.programTypeName, ' ', sizeof(_status.programTypeName) - 1);
-    memset(_status.radioText, ' ', sizeof(_status.radioText) - 1);
-    _rdstextab = false;
-    _rdsptynab = false;
+bool RDSDecoder::getRDSEpoch(uint32_t *utc, int16_t *offset){
+    if(_havect) {
+        if(utc) *utc = _ctutc;
+        //Local time offset is sent in multiples of half hours
+        if(offset) *offset = _time.tm_tz * 30;
+    };
+
+    return _havect;
+}
+
+const char *RDSDecoder::getRDSText(byte which, byte *length){
+    const char *text;
+    byte size;
+
+    if(_detached)
+        return NULL;
+    switch(which) {
+        case RDS_TEXT_PS:
+            text = _status->programService;
+            size = sizeof(_status->programService) - 1;
+            break;
+        case RDS_TEXT_PTYN:
+            text = _status->programTypeName;
+            size = sizeof(_status->programTypeName) - 1;
+            break;
+        case RDS_TEXT_RT:
+            text = _state->radioText;
+            size = sizeof(_status->radioText) - 1;
+            break;
+        case RDS_TEXT_RT_PREVIOUS:
+            if(!(_state->seen & RDS_STATION_SEEN_RT_PREVIOUS))
+                return NULL;
+            text = _state->previousRadioText;
+            size = sizeof(_status->radioText) - 1;
+            break;
+        case RDS_TEXT_EON_PS:
+            text = _status->EON.programService;
+            size = sizeof(_status->EON.programService) - 1;
+            break;
+        default:
+            return NULL;
+    };
+    if(length) *length = size;
+
+    return text;
+}
+
+bool RDSDecoder::getPreviousRT(char *radioText){
+    if(_detached || !(_state->seen & RDS_STATION_SEEN_RT_PREVIOUS))
+        return false;
+
+    if(radioText) {
+        makePrintable(radioText, _state->previousRadioText, 4, RDS_DIRTY_RT);
+        radioText[sizeof(_status->radioText) - 1] = '\0';
+    };
+
+    return true;
+}
+
+void RDSDecoder::resetRDS(bool forget){
+    if(forget) {
+        for(byte i = 0; i < RDS_STATE_CACHE_SLOTS; i++) {
+            initStatus(&_states[i].status);
+            _states[i].radioText = _states[i].status.radioText;
+            _states[i].previousRadioText = _states[i].spareRadioText;
+            _states[i].rdstextab = false;
+            _states[i].rdsptynab = false;
+            _states[i].seen = 0x00;
+            _states[i].lastUsed = 0;
+        };
+        _state = &_states[0];
+        _status = &_state->status;
+        _stateclock = 0;
+    };
+    //Keep the current state around (it's still cached under its PI) but stop
+    //showing it until we hear from a station again.
+    _detached = true;
+    markDirty();
     _havect = false;
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+    _stationrecord = NULL;
+#endif
 }
 
-const char PROGMEM RDS2LCD_S[] = "\xE1\xE0\xE9\xE8\xED\xEE\xF3\xF2\xFA\xF9\xD1"
-                                 "\xC7S\xDF\xA1J\xE2\xE4\xEA\xEB\xEE\xEF\xF4"
-                                 "\xF6\xFB\xFC\xF1\xE7sgij\xAA\x90\xA9%Gen\xF6"
-                                 "\x93""E\xA3$\x1B\x18\x1A\x19\xBA\xB9\xB2\xB3"
-                                 "\xB1In\xFC\xB5\xBF\xF7\xB0\xBC\xBD\xBE\xA7"
-                                 "\xC1\xC0\xC9\xC8\xCD\xCE\xD3\xD2\xDA\xD9RCSZ"
-                                 "\xD0L\xC2\xC4\xCA\xCB\xCE\xCF\xD4\xD6\xDB\xDC"
-                                 "rcsz\xF0l\xC3\xC5\xC6Oy\xDD\xD5""0\xDEGRCSZT"
-                                 "\xF0\xE3\xE5\xE6ow\xF5""0\xFEgrcszt";
-
-void RDSDecoder::makePrintable(char* str){
-    for(byte i = 0; i < strlen(str); i++) {
-        if(str[i] == 0x0D) {
-            //CR ends the string, according to RDS §6.1.5.3
-            str[i] = '\0';
+void RDSDecoder::initStatus(TRDSData *status) {
+    memset(status, 0x00, sizeof(TRDSData));
+    memset(status->programService, ' ', sizeof(status->programService) - 1);
+    memset(status->programTypeName, ' ', sizeof(status->programTypeName) - 1);
+    memset(status->radioText, ' ', sizeof(status->radioText) - 1);
+}
+
+void RDSDecoder::markDirty(void) {
+    _psdirty = RDS_DIRTY_PS;
+    _ptyndirty = RDS_DIRTY_PTYN;
+    _rtdirty = RDS_DIRTY_RT;
+    _eonpsdirty = RDS_DIRTY_PS;
+}
+
+void RDSDecoder::selectState(word programIdentifier) {
+    TRDSDecoderState *victim = NULL;
+
+    _detached = false;
+    markDirty();
+    for(byte i = 0; i < RDS_STATE_CACHE_SLOTS; i++) {
+        if(_states[i].status.programIdentifier == programIdentifier) {
+            //Seen this one recently, pick up where we left off.
+            _state = &_states[i];
+            _status = &_state->status;
+            _state->lastUsed = ++_stateclock;
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+            _stationrecord = (_stationcache ?
+                              _stationcache->lookup(programIdentifier) : NULL);
+#endif
+            return;
+        };
+#if RDS_STATE_CACHE_SLOTS == 1
+        //Nowhere to put the old state aside, so do what an uncached decoder
+        //does: take on the new PI and keep everything else, block A may just
+        //have been corrupted. Only a freshly reset slot gets initialised.
+        if(_states[i].status.programIdentifier) {
+            _state = &_states[i];
+            _status = &_state->status;
+# if defined(WITH_RDS_HOST_EXTENSIONS)
+            //What was seen belongs to the old PI, don't cache it under this
+            //one.
+            _state->seen &= ~(RDS_STATION_SEEN_PS | RDS_STATION_SEEN_PTYN);
+            _stationrecord = (_stationcache ?
+                              _stationcache->lookup(programIdentifier) : NULL);
+# endif
+            return;
+        };
+#endif
+        if(!victim ||
+           (victim->status.programIdentifier &&
+            (!_states[i].status.programIdentifier ||
+             (word)(_stateclock - _states[i].lastUsed) >
+             (word)(_stateclock - victim->lastUsed))))
+            victim = &_states[i];
+    };
+
+    //New station: recycle an empty slot or, failing that, the least recently
+    //used one.
+    _state = victim;
+    _status = &_state->status;
+    initStatus(_status);
+    _state->radioText = _status->radioText;
+    _state->previousRadioText = _state->spareRadioText;
+    _state->rdstextab = false;
+    _state->rdsptynab = false;
+    _state->seen = 0x00;
+    _state->lastUsed = ++_stateclock;
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+    if(_stationcache)
+        seedStation(programIdentifier);
+#endif
+}
+
+void RDSDecoder::setTMCRepeatFilter(RDSTMCRepeatFilter *filter) {
+    _tmcfilter = filter;
+    if(filter)
+        filter->reset();
+}
+
+void RDSDecoder::setRTPlus(RDSRTPlus *rtplus) {
+    _rtplus = rtplus;
+    if(rtplus)
+        rtplus->reset(_detached ? NULL : _state->radioText);
+}
+
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+void RDSDecoder::setStationCache(RDSStationCache *cache) {
+    _stationcache = cache;
+    _stationrecord = (cache && !_detached ?
+                      cache->lookup(_status->programIdentifier) : NULL);
+}
+
+void RDSDecoder::setERTAssembler(RDSERTAssembler *assembler) {
+    _ertassembler = assembler;
+    if(assembler)
+        assembler->reset();
+}
+
+void RDSDecoder::seedStation(word programIdentifier) {
+    _stationrecord = _stationcache->lookup(programIdentifier);
+    if(!_stationrecord)
+        return;
+
+    memcpy(_status->programService, _stationrecord->programService,
+           sizeof(_stationrecord->programService));
+    if(_stationrecord->hasPTYN)
+        memcpy(_status->programTypeName, _stationrecord->programTypeName,
+               sizeof(_stationrecord->programTypeName));
+    _status->PTY = _stationrecord->PTY;
+    _status->TP = _stationrecord->TP;
+    _status->MS = _stationrecord->MS;
+    _status->DICC = _stationrecord->DICC;
+    _status->extendedCountryCode = _stationrecord->extendedCountryCode;
+    _status->languageCode = _stationrecord->languageCode;
+    _status->tmcIdentification = _stationrecord->tmcIdentification;
+    _stationcache->touch(_stationrecord);
+
+    //Replay the AF list the way 0A groups carry it (method A: the count
+    //first, then pairs padded with a filler), so that AF consumers have it
+    //from the first group on.
+    if(_callbacks[RDS_CALLBACK_AF] && _stationrecord->afCount) {
+        //The record comes from a file, don't trust its count blindly.
+        byte count = (_stationrecord->afCount < RDS_STATION_MAX_AF ?
+                      _stationrecord->afCount : RDS_STATION_MAX_AF);
+
+        for(byte i = 0; i <= count; i += 2) {
+            byte first = (i ? _stationrecord->alternativeFrequencies[i - 1] :
+                              RDS_AF_NODATA + count);
+            byte second = (i < count ?
+                           _stationrecord->alternativeFrequencies[i] :
+                           RDS_AF_FILLER);
+
+            _callbacks[RDS_CALLBACK_AF](0x00, true,
+                                        (word)first << 8 | second, 0x00);
+        };
+    };
+}
+
+void RDSDecoder::updateStation(byte grouptype, word block[]) {
+    byte address = 0;
+
+    switch(grouptype) {
+        case RDS_GROUP_0A:
+        case RDS_GROUP_0B:
+            address = lowByte(block[1] & RDS_DIPS_ADDRESS);
+            _state->seen |= RDS_STATION_SEEN_PS_FIRST << address;
             break;
-        }
-        // 0x24 is currency sign (U+00A4), not dollar sign
-        // 0x5E is horizontal bar (quotation dash, U+2015), not caret
-        // 0x60 is double vertical line (math norm symbol, U+2016), not backtick
-        // 0x7E is overline (U+203E), not tilde
-        // 0x80: a-acute, a-grave, e-acute, e-grave, i-acute, i-grave, o-acute,
-        //       o-grave, u-acute, u-grave, N-tilde, C-cedilla, S-cedilla,
-        //       scharfes-es, spanish-exclamation, dutch-IJ, a-circ, a-umlaut,
-        //       e-circ, e-umlaut, i-circ, i-umlaut, o-circ, o-umlaut, u-circ,
-        //       u-umlaut, n-tilde, c-cedilla, s-cedilla, g-breve,
-        //       turkish-i-nodot, dutch-ij, a-superscript, alpha, (c), permille,
-        //       G-breve, e-caron, n-caron, o-dprime, pi, EUR, GBP, USD, 
-        //       arrow-left, arrow-up, arrow-right, arrow-down, o-superscript,
-        //       1-superscript, 2-superscript, 3-superscript, +/-,
-        //       turkish-I-dot, n-acute, u-dprime, miu, spanish-question,
-        //       division, degree, 1/4, 1/2, 3/4, paragraph,
-        //       A,E,I,O,U{acute,grave}, R,C,S,Z{caron}, D-line, L-dot,
-        //       A,E,I,O,U{circ,umlaut}, r,c,s,z{caron}, d-line, l-dot,
-        //       A-tilde, A-circle, AE, OE, y-circ, Y-acute, O-tilde, O-slash,
-        //       Thorn, NG, R,C,S,Z{acute}, T-bar, th, a-tilde, a-circle, ae,
-        //       oe, w-circ, o-tilde, o-slash, thorn, ng, r,c,s,z{acute}, t-bar
-        if(str[i] == 0x0A || str[i] == 0x0B || str[i] == 0x1F)
-            //LF, VT and US are allowed as a control characters. The first with
-            //the same meaning as on UNIX, second as end-of-headline indicator
-            //and third as soft-hyphen, according to RDS §6.1.5.3
-            continue;
-        //Any other control character is an undetected error on the receiving
-        //side (because the manufacturers of the RDS decoder chip were too cheap
-        //to properly implement the ECC in the standard).
-        if(str[i] < 32) str[i] = '?';
-        else if(str[i] == 0x24) str[i] = '\xA4';
-        else if(str[i] == 0x5E) str[i] = '-';
-        else if(str[i] == 0x60) str[i] = '\xA0';
-        else if(str[i] == 0x7E) str[i] = '_';
-        else if(str[i] >= 0x80)
-            str[i] = (char)pgm_read_byte(&RDS2LCD_S[str[i] - 0x80]);
-    }
+        case RDS_GROUP_1A:
+            if(((block[2] & RDS_SLABEL_MASK) >> RDS_SLABEL_SHR) ==
+                RDS_SLABEL_TYPE_PAGINGECC && _stationrecord &&
+               _stationrecord->extendedCountryCode &&
+               _stationrecord->extendedCountryCode !=
+                   _status->extendedCountryCode)
+                //Same PI, different country: not the station we thought.
+                _stationrecord = NULL;
+            break;
+        case RDS_GROUP_10A:
+            _state->seen |= RDS_STATION_SEEN_PTYN_FIRST << (
+                block[1] & RDS_PTYN_ADDRESS);
+            break;
+    };
+
+    if(!_stationrecord) {
+        //Don't let a burst of noise with a corrupted PI into the cache: only
+        //remember stations we've heard a whole PS from.
+        if((_state->seen & RDS_STATION_SEEN_PS) == RDS_STATION_SEEN_PS)
+            _stationrecord = _stationcache->store(_status);
+        if(!_stationrecord)
+            return;
+    };
+
+    _stationrecord->PTY = _status->PTY;
+    _stationrecord->TP = _status->TP;
+    if(grouptype == RDS_GROUP_0A || grouptype == RDS_GROUP_0B) {
+        word twochars = swab(block[3]);
+
+        memcpy(&_stationrecord->programService[address * 2], &twochars, 2);
+        _stationrecord->MS = _status->MS;
+        _stationrecord->DICC = _status->DICC;
+        if(grouptype == RDS_GROUP_0A) {
+            _stationcache->addAlternativeFrequency(_stationrecord,
+                                                   highByte(block[2]));
+            _stationcache->addAlternativeFrequency(_stationrecord,
+                                                   lowByte(block[2]));
+        };
+    } else if(grouptype == RDS_GROUP_1A) {
+        if(_status->extendedCountryCode)
+            _stationrecord->extendedCountryCode = _status->extendedCountryCode;
+        if(_status->languageCode)
+            _stationrecord->languageCode = _status->languageCode;
+        if(_status->tmcIdentification)
+            _stationrecord->tmcIdentification = _status->tmcIdentification;
+    } else if(grouptype == RDS_GROUP_10A &&
+              (_state->seen & RDS_STATION_SEEN_PTYN) == RDS_STATION_SEEN_PTYN) {
+        memcpy(_stationrecord->programTypeName, _status->programTypeName,
+               sizeof(_stationrecord->programTypeName));
+        _stationrecord->hasPTYN = true;
+    };
+}
+#endif
+
+//RDS G0 (IEC 62106 Annex E) to European CGROM HD44780 translation table.
+//0x00-0x1F: CR (and NUL) end the string, according to RDS §6.1.5.3. LF, VT
+//           and US are allowed as control characters, the first with the same
+//           meaning as on UNIX, second as end-of-headline indicator and third
+//           as soft-hyphen. Any other control character is an undetected error
+//           on the receiving side (because the manufacturers of the RDS decoder
+//           chip were too cheap to properly implement the ECC in the standard)
+//           and becomes a question mark, as is customary. This helps with
+//           filtering out noisy strings.
+//0x24 is currency sign (U+00A4), not dollar sign
+//0x5E is horizontal bar (quotation dash, U+2015), not caret
+//0x60 is double vertical line (math norm symbol, U+2016), not backtick
+//0x7E is overline (U+203E), not tilde
+//0x80: a-acute, a-grave, e-acute, e-grave, i-acute, i-grave, o-acute,
+//      o-grave, u-acute, u-grave, N-tilde, C-cedilla, S-cedilla,
+//      scharfes-es, spanish-exclamation, dutch-IJ, a-circ, a-umlaut,
+//      e-circ, e-umlaut, i-circ, i-umlaut, o-circ, o-umlaut, u-circ,
+//      u-umlaut, n-tilde, c-cedilla, s-cedilla, g-breve,
+//      turkish-i-nodot, dutch-ij, a-superscript, alpha, (c), permille,
+//      G-breve, e-caron, n-caron, o-dprime, pi, EUR, GBP, USD,
+//      arrow-left, arrow-up, arrow-right, arrow-down, o-superscript,
+//      1-superscript, 2-superscript, 3-superscript, +/-,
+//      turkish-I-dot, n-acute, u-dprime, miu, spanish-question,
+//      division, degree, 1/4, 1/2, 3/4, paragraph,
+//      A,E,I,O,U{acute,grave}, R,C,S,Z{caron}, D-line, L-dot,
+//      A,E,I,O,U{circ,umlaut}, r,c,s,z{caron}, d-line, l-dot,
+//      A-tilde, A-circle, AE, OE, y-circ, Y-acute, O-tilde, O-slash,
+//      Thorn, NG, R,C,S,Z{acute}, T-bar, th, a-tilde, a-circle, ae,
+//      oe, w-circ, y-acute, o-tilde, o-slash, thorn, ng, r,c,s,z{acute}, t-bar
+//Characters the HD44780 lacks are approximated by their base letter.
+const byte PROGMEM RDS2LCD_S[256] = {
+    0x00, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x0A, 0x0B, 0x3F, 0x00, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x1F,
+    0x20, 0x21, 0x22, 0x23, 0xA4, 0x25, 0x26, 0x27,
+    0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F,
+    0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
+    0x58, 0x59, 0x5A, 0x5B, 0x5C, 0x5D, 0x2D, 0x5F,
+    0xA0, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+    0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x5F, 0x7F,
+    0xE1, 0xE0, 0xE9, 0xE8, 0xED, 0xEE, 0xF3, 0xF2,
+    0xFA, 0xF9, 0xD1, 0xC7, 0x53, 0xDF, 0xA1, 0x4A,
+    0xE2, 0xE4, 0xEA, 0xEB, 0xEE, 0xEF, 0xF4, 0xF6,
+    0xFB, 0xFC, 0xF1, 0xE7, 0x73, 0x67, 0x69, 0x6A,
+    0xAA, 0x90, 0xA9, 0x25, 0x47, 0x65, 0x6E, 0xF6,
+    0x93, 0x45, 0xA3, 0x24, 0x1B, 0x18, 0x1A, 0x19,
+    0xBA, 0xB9, 0xB2, 0xB3, 0xB1, 0x49, 0x6E, 0xFC,
+    0xB5, 0xBF, 0xF7, 0xB0, 0xBC, 0xBD, 0xBE, 0xA7,
+    0xC1, 0xC0, 0xC9, 0xC8, 0xCD, 0xCE, 0xD3, 0xD2,
+    0xDA, 0xD9, 0x52, 0x43, 0x53, 0x5A, 0xD0, 0x4C,
+    0xC2, 0xC4, 0xCA, 0xCB, 0xCE, 0xCF, 0xD4, 0xD6,
+    0xDB, 0xDC, 0x72, 0x63, 0x73, 0x7A, 0xF0, 0x6C,
+    0xC3, 0xC5, 0xC6, 0x4F, 0x79, 0xDD, 0xD5, 0x30,
+    0xDE, 0x47, 0x52, 0x43, 0x53, 0x5A, 0x54, 0xF0,
+    0xE3, 0xE5, 0xE6, 0x6F, 0x77, 0xFD, 0xF5, 0x30,
+    0xFE, 0x67, 0x72, 0x63, 0x73, 0x7A, 0x74, 0x3F
+};
+
+void RDSDecoder::makePrintable(char *str, const char *raw, byte segmentSize,
+                               word dirty){
+    //Only touch what changed since the last call, one table lookup per
+    //character.
+    for(byte i = 0; dirty; i += segmentSize, dirty >>= 1)
+        if(dirty & 0x01)
+            for(byte j = i; j < i + segmentSize; j++)
+                str[j] = (char)pgm_read_byte(&RDS2LCD_S[(byte)raw[j]]);
 }
 
 RDSDecoder::RDSDecoder(byte locale) {
     _locale = locale;
-    resetRDS();
+    _ctmjd = 0;
+    _printps[sizeof(_printps) - 1] = '\0';
+    _printptyn[sizeof(_printptyn) - 1] = '\0';
+    _printrt[sizeof(_printrt) - 1] = '\0';
+    _printeonps[sizeof(_printeonps) - 1] = '\0';
+    _rtplus = NULL;
+    _tmcfilter = NULL;
+    _groups = 0;
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+    _stationcache = NULL;
+    _ertassembler = NULL;
+#endif
+    resetRDS(true);
 }
 
 byte RDSDecoder::mapShortPTY(byte shortPTY) {
@@ -566,6 +974,158 @@ void RDSTranslator::getTextForPTY(byte PTY, char* text, byte textsize){
     }
 }
 
+//RDS G0 (IEC 62106 Annex E) to UCS-2 translation table. 0x0000 marks the
+//characters that end a string (NUL and CR), 0xFFFD (the Unicode replacement
+//character) the ones that are errors (stray control codes and the unassigned
+//0x7F and 0xFF). US (0x1F) is the soft hyphen.
+const word PROGMEM RDS2UCS_S[256] = {
+    0x0000, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+    0xFFFD, 0xFFFD, 0x000A, 0x000B, 0xFFFD, 0x0000, 0xFFFD, 0xFFFD,
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0x00AD,
+    0x0020, 0x0021, 0x0022, 0x0023, 0x00A4, 0x0025, 0x0026, 0x0027,
+    0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+    0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+    0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+    0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x2015, 0x005F,
+    0x2016, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+    0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+    0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x203E, 0xFFFD,
+    0x00E1, 0x00E0, 0x00E9, 0x00E8, 0x00ED, 0x00EC, 0x00F3, 0x00F2,
+    0x00FA, 0x00F9, 0x00D1, 0x00C7, 0x015E, 0x00DF, 0x00A1, 0x0132,
+    0x00E2, 0x00E4, 0x00EA, 0x00EB, 0x00EE, 0x00EF, 0x00F4, 0x00F6,
+    0x00FB, 0x00FC, 0x00F1, 0x00E7, 0x015F, 0x011F, 0x0131, 0x0133,
+    0x00AA, 0x03B1, 0x00A9, 0x2030, 0x011E, 0x011B, 0x0148, 0x0151,
+    0x03C0, 0x20AC, 0x00A3, 0x0024, 0x2190, 0x2191, 0x2192, 0x2193,
+    0x00BA, 0x00B9, 0x00B2, 0x00B3, 0x00B1, 0x0130, 0x0144, 0x0171,
+    0x00B5, 0x00BF, 0x00F7, 0x00B0, 0x00BC, 0x00BD, 0x00BE, 0x00A7,
+    0x00C1, 0x00C0, 0x00C9, 0x00C8, 0x00CD, 0x00CC, 0x00D3, 0x00D2,
+    0x00DA, 0x00D9, 0x0158, 0x010C, 0x0160, 0x017D, 0x0110, 0x013F,
+    0x00C2, 0x00C4, 0x00CA, 0x00CB, 0x00CE, 0x00CF, 0x00D4, 0x00D6,
+    0x00DB, 0x00DC, 0x0159, 0x010D, 0x0161, 0x017E, 0x0111, 0x0140,
+    0x00C3, 0x00C5, 0x00C6, 0x0152, 0x0177, 0x00DD, 0x00D5, 0x00D8,
+    0x00DE, 0x014A, 0x0154, 0x0106, 0x015A, 0x0179, 0x0166, 0x00F0,
+    0x00E3, 0x00E5, 0x00E6, 0x0153, 0x0175, 0x00FD, 0x00F5, 0x00F8,
+    0x00FE, 0x014B, 0x0155, 0x0107, 0x015B, 0x017A, 0x0167, 0xFFFD
+};
+
+#if defined(__SSE2__)
+//True if all 16 bytes in chunk are in the part of G0 that coincides with
+//ASCII (0x20-0x7D sans 0x24, 0x5E and 0x60), i.e. map to themselves.
+static inline bool isASCIIChunk(__m128i chunk) {
+    //Bytes above 0x7F are negative as far as the comparisons go.
+    __m128i ok = _mm_and_si128(_mm_cmpgt_epi8(chunk, _mm_set1_epi8(0x1F)),
+                               _mm_cmplt_epi8(chunk, _mm_set1_epi8(0x7E)));
+    __m128i bad = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(0x24)),
+                     _mm_cmpeq_epi8(chunk, _mm_set1_epi8(0x5E))),
+        _mm_cmpeq_epi8(chunk, _mm_set1_epi8(0x60)));
+
+    return _mm_movemask_epi8(_mm_andnot_si128(bad, ok)) == 0xFFFF;
+}
+#endif
+
+size_t RDSTranslator::convertToUTF8(const char *text, size_t length, char *buf,
+                                    size_t size){
+    size_t in = 0, out = 0;
+
+    if(!(text && buf && size))
+        return 0;
+
+    while(in < length) {
+        size_t stop = (in + 16 < length ? in + 16 : length);
+
+#if defined(__SSE2__)
+        if(stop == in + 16 && out + 16 < size) {
+            __m128i chunk = _mm_loadu_si128((const __m128i *)&text[in]);
+
+            if(isASCIIChunk(chunk)) {
+                _mm_storeu_si128((__m128i *)&buf[out], chunk);
+                in += 16;
+                out += 16;
+                continue;
+            };
+        };
+#endif
+        for(; in < stop; in++) {
+            word ucs = pgm_read_word(&RDS2UCS_S[(byte)text[in]]);
+
+            if(!ucs) {
+                buf[out] = '\0';
+                return out;
+            };
+            if(ucs < 0x80) {
+                if(out + 1 >= size) break;
+                buf[out++] = ucs;
+            } else if(ucs < 0x800) {
+                if(out + 2 >= size) break;
+                buf[out++] = 0xC0 | (ucs >> 6);
+                buf[out++] = 0x80 | (ucs & 0x3F);
+            } else {
+                if(out + 3 >= size) break;
+                buf[out++] = 0xE0 | (ucs >> 12);
+                buf[out++] = 0x80 | ((ucs >> 6) & 0x3F);
+                buf[out++] = 0x80 | (ucs & 0x3F);
+            };
+        };
+        if(in < stop)
+            //Out of room, don't split a character.
+            break;
+    };
+    buf[out] = '\0';
+
+    return out;
+}
+
+size_t RDSTranslator::convertToUTF16(const char *text, size_t length,
+                                     uint16_t *buf, size_t size){
+    size_t in = 0, out = 0;
+
+    if(!(text && buf && size))
+        return 0;
+
+    while(in < length) {
+        size_t stop = (in + 16 < length ? in + 16 : length);
+
+#if defined(__SSE2__)
+        if(stop == in + 16 && out + 16 < size) {
+            __m128i chunk = _mm_loadu_si128((const __m128i *)&text[in]);
+
+            if(isASCIIChunk(chunk)) {
+                __m128i zero = _mm_setzero_si128();
+
+                _mm_storeu_si128((__m128i *)&buf[out],
+                                 _mm_unpacklo_epi8(chunk, zero));
+                _mm_storeu_si128((__m128i *)&buf[out + 8],
+                                 _mm_unpackhi_epi8(chunk, zero));
+                in += 16;
+                out += 16;
+                continue;
+            };
+        };
+#endif
+        //Everything in G0 is in the BMP, so no surrogates needed.
+        for(; in < stop && out + 1 < size; in++) {
+            word ucs = pgm_read_word(&RDS2UCS_S[(byte)text[in]]);
+
+            if(!ucs) {
+                buf[out] = 0x0000;
+                return out;
+            };
+            buf[out++] = ucs;
+        };
+        if(in < stop)
+            break;
+    };
+    buf[out] = 0x0000;
+
+    return out;
+}
+
 const char PI2CallSign_S[] PROGMEM = "KEXKFHKFIKGAKGOKGUKGWKGYKIDKITKJRKLOKLZ"
                                      "KMAKMJKNXKOA---------KQVKSLKUJKVIKWG---"
                                      "---KYW---WBZWDZWEW---WGLWGNWGR---WHAWHB"
@@ -675,6 +1235,267 @@ void RDSTranslator::decodeTMCDuration(byte length, TRDSTime* tmctime) {
     };
 };
 
+#if defined(WITH_RDS_TMC_EVENTS)
+static bool findTMCEvent(word event, TRDSTMCEventListEntry *entry) {
+    word low = 0, high = ISO14819_2_EVENTS_COUNT;
+
+#if defined(WITH_RDS_TMC_DIRECT_INDEX)
+    if(event >= sizeof(ISO14819_2_EventIndex) / sizeof(ISO14819_2_EventIndex[0]))
+        return false;
+    low = pgm_read_word(&ISO14819_2_EventIndex[event]);
+    if(low >= high)
+        return false;
+    high = low + 1;
+#endif
+    //The event list is sorted by code but has holes, so bisect it.
+    while(low < high) {
+        word middle = (low + high) / 2;
+
+        memcpy_P(entry, &ISO14819_2_Events[middle], sizeof(*entry));
+        if(entry->code < event)
+            low = middle + 1;
+        else if(entry->code > event)
+            high = middle;
+        else
+            return true;
+    };
+
+    return false;
+}
+#endif
+
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+static void fetchFromFlash(const void *from, void *to, size_t size) {
+    memcpy_P(to, from, size);
+}
+#endif
+
+bool RDSTranslator::getTMCEventInfo(word event, TRDSTMCEventInfo *info) {
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+    if(_tables && _tables->isOpen()) {
+        const TRDSTMCTableEvent *entry = _tables->findEvent(event);
+
+        if(!(info && entry))
+            return false;
+        info->quantifier = entry->quantifier;
+        info->nature = RDS_TMC_TABLES_NATURE(entry->flags);
+        info->urgency = RDS_TMC_TABLES_URGENCY(entry->flags);
+        info->updateClass = entry->updateClass;
+        info->longerLasting = entry->flags & RDS_TMC_TABLES_LONGER_LASTING;
+        info->silentDuration = entry->flags & RDS_TMC_TABLES_SILENT_DURATION;
+        info->bidirectional = entry->flags & RDS_TMC_TABLES_BIDIRECTIONAL;
+
+        return true;
+    };
+#endif
+#if defined(WITH_RDS_TMC_EVENTS)
+    TRDSTMCEventListEntry entry;
+
+    if(!(info && findTMCEvent(event, &entry)))
+        return false;
+
+    info->quantifier = entry.quantifier;
+    info->nature = entry.nature;
+    info->urgency = entry.urgency;
+    info->updateClass = entry.updateClass;
+    info->longerLasting = entry.longerLasting;
+    info->silentDuration = entry.silentDuration;
+    info->bidirectional = entry.bidirectional;
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool RDSTranslator::getTMCEventText(word event, const char **text,
+                                    byte *length) {
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+    if(text && _language && (*text = _language->getEventText(event, length)))
+        return true;
+    if(_tables && _tables->isOpen()) {
+        if(!text)
+            return false;
+        *text = _tables->getText(_tables->findEvent(event), length);
+
+        return *text != NULL;
+    };
+#endif
+#if defined(WITH_RDS_TMC_EVENT_STRING_POINTERS) && \
+    defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH) && \
+    !defined(WITH_RDS_TMC_EVENT_STRINGS_COMPRESSED)
+    TRDSTMCEventListEntry entry;
+
+    if(!(text && findTMCEvent(event, &entry)))
+        return false;
+
+    *text = &ISO14819_2_EventStrings[entry.description + 1];
+    if(length)
+        *length = pgm_read_byte(&ISO14819_2_EventStrings[entry.description]);
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+size_t RDSTranslator::expandTMCEventText(word event, char *buf, size_t size) {
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+    //Mapped texts are never compressed, copy them as they are.
+    const char *mapped = NULL;
+    byte mappedLength = 0;
+
+    if(!(buf && size))
+        return 0;
+    if(_language)
+        mapped = _language->getEventText(event, &mappedLength);
+    if(!mapped && _tables && _tables->isOpen())
+        mapped = _tables->getText(_tables->findEvent(event), &mappedLength);
+    if(mapped || (_tables && _tables->isOpen())) {
+        if(mappedLength > size - 1) {
+            mappedLength = size - 1;
+            //Don't leave half a UTF-8 sequence behind.
+            while(mappedLength && (mapped[mappedLength] & 0xC0) == 0x80)
+                mappedLength--;
+        };
+        if(mapped)
+            memcpy(buf, mapped, mappedLength);
+        buf[mappedLength] = '\0';
+
+        return mappedLength;
+    };
+#endif
+#if defined(WITH_RDS_TMC_EVENT_STRING_POINTERS) && \
+    defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+    TRDSTMCEventListEntry entry;
+
+    if(!(buf && size))
+        return 0;
+    buf[0] = '\0';
+    if(!findTMCEvent(event, &entry))
+        return 0;
+
+    const char *text = &ISO14819_2_EventStrings[entry.description];
+    byte length = pgm_read_byte(text++);
+# if defined(WITH_RDS_TMC_EVENT_STRINGS_COMPRESSED)
+    return expandTMCText((const byte *)text, length, buf, size, true);
+# else
+    if(length > size - 1)
+        length = size - 1;
+    memcpy_P(buf, text, length);
+    buf[length] = '\0';
+
+    return length;
+# endif
+#else
+    return 0;
+#endif
+}
+
+size_t RDSTranslator::expandTMCText(const byte *packed, byte length, char *buf,
+                                    size_t size, bool in_flash) {
+#if defined(WITH_RDS_TMC_EVENTS) && \
+    defined(WITH_RDS_TMC_EVENT_STRINGS_COMPRESSED)
+    //Phrases nest, expand them depth first keeping the pending right halves
+    //on a stack.
+    word pending[ISO14819_2_EVENT_PHRASES_DEPTH];
+    size_t written = 0;
+
+    if(!(packed && buf && size))
+        return 0;
+
+    for(byte i = 0; i < length && written < size - 1; i++) {
+        byte c = in_flash ? pgm_read_byte(&packed[i]) : packed[i];
+        word phrase;
+
+        if(c >= 0x20 && c < 0x7F) {
+            buf[written++] = c;
+            continue;
+        } else if(!c)
+            break;
+        else if(c < 0x20)
+            phrase = c - 0x01;
+        else if(c < RDS_TMC_PHRASE_LONG_PREFIX)
+            phrase = c - 0x60;
+        else if(++i < length)
+            phrase = RDS_TMC_PHRASE_SHORT_CODES +
+                     ((c - RDS_TMC_PHRASE_LONG_PREFIX) << 8 |
+                      (in_flash ? pgm_read_byte(&packed[i]) : packed[i]));
+        else
+            break;
+
+        byte depth = 0;
+        word symbol = 0x100 + phrase;
+        while(true) {
+            while(symbol >= 0x100) {
+                const byte *entry;
+
+                if(symbol - 0x100 >= ISO14819_2_EVENT_PHRASES_COUNT ||
+                   depth == ISO14819_2_EVENT_PHRASES_DEPTH) {
+                    //Garbage in, stop rather than read out of bounds.
+                    buf[written] = '\0';
+
+                    return written;
+                };
+                entry = &ISO14819_2_EventPhrases[(symbol - 0x100) * 3];
+                c = pgm_read_byte(&entry[2]);
+                pending[depth++] = pgm_read_byte(&entry[1]) | (c & 0x0F) << 8;
+                symbol = pgm_read_byte(&entry[0]) | (c & 0xF0) << 4;
+            };
+            buf[written++] = symbol;
+            if(!depth || written == size - 1)
+                break;
+            symbol = pending[--depth];
+        };
+    };
+    buf[written] = '\0';
+
+    return written;
+#else
+    //No compressed texts in this build, nothing to expand.
+    (void)packed;
+    (void)length;
+    (void)in_flash;
+    if(buf && size)
+        buf[0] = '\0';
+
+    return 0;
+#endif
+}
+
+bool RDSTranslator::getTMCSupplementaryText(byte code, const char **text,
+                                            byte *length) {
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+    if(text && _language &&
+       (*text = _language->getSupplementaryText(code, length)))
+        return true;
+    if(_tables && _tables->isOpen()) {
+        if(!text)
+            return false;
+        *text = _tables->getText(_tables->findSupplementary(code), length);
+
+        return *text != NULL;
+    };
+#endif
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+    TRDSTMCSupplementaryEntry entry;
+
+    if(!(text && locateMessageRecord(ISO14819_2_Supplementary, sizeof(entry),
+                                     ISO14819_2_SUPPLEMENTARY_COUNT, 0, false,
+                                     code, &entry, fetchFromFlash)))
+        return false;
+
+    *text = &ISO14819_2_SupplementaryStrings[entry.description + 1];
+    if(length)
+        *length = pgm_read_byte(
+            &ISO14819_2_SupplementaryStrings[entry.description]);
+
+    return true;
+#else
+    return false;
+#endif
+}
+
 word RDSTranslator::decodeAFFrequency(byte AF, bool FM) {
     if (FM) return (AF + 875) * 10;
     else if (AF < 16) return (AF - 1) * 9 + 153;
@@ -752,6 +1573,61 @@ word RDSTranslator::decryptLocation(word location, byte serviceKey, byte encId,
     return decryptLocation(location, table[serviceKey][encId]);
 };
 
+void RDSTranslator::setTMCDecryptionKey(TRDSTMCDecryptionKey *key,
+                                        byte serviceKey, byte encId,
+                                        const word table[][32],
+                                        bool in_flash) {
+    word packed;
+
+    if(!(key && table))
+        return;
+    if(key->valid && key->serviceKey == serviceKey && key->encId == encId &&
+       key->table == table && key->in_flash == in_flash)
+        return;
+
+    packed = (in_flash ? pgm_read_word(&table[serviceKey][encId]) :
+                         table[serviceKey][encId]);
+    key->valid = true;
+    key->serviceKey = serviceKey;
+    key->encId = encId;
+    key->table = table;
+    key->in_flash = in_flash;
+    //Same as decryptLocation(), with the shift done once and for all.
+    key->xorMask = word(highByte(packed)) << ((lowByte(packed) & 0xF0) >> 4);
+    key->rol = lowByte(packed) & 0x0F;
+};
+
+void RDSTranslator::decryptLocations(const TRDSTMCDecryptionKey *key,
+                                     const word *locations, word *decrypted,
+                                     size_t count) {
+    size_t i = 0;
+
+    if(!(key && key->valid && locations && decrypted))
+        return;
+
+#if defined(__SSE2__)
+    __m128i mask = _mm_set1_epi16(key->xorMask);
+    //Shifting a 16 bit lane by 16 yields 0, so rol == 0 needs no special
+    //case, same as in decryptLocation().
+    __m128i left = _mm_cvtsi32_si128(key->rol);
+    __m128i right = _mm_cvtsi32_si128(16 - key->rol);
+
+    for(; i + 8 <= count; i += 8) {
+        __m128i chunk = _mm_xor_si128(
+            _mm_loadu_si128((const __m128i *)&locations[i]), mask);
+
+        _mm_storeu_si128((__m128i *)&decrypted[i],
+                         _mm_or_si128(_mm_sll_epi16(chunk, left),
+                                      _mm_srl_epi16(chunk, right)));
+    };
+#endif
+    for(; i < count; i++) {
+        uint16_t result = key->xorMask ^ locations[i];
+
+        decrypted[i] = (result >> (16 - key->rol)) | (result << key->rol);
+    };
+};
+
 void RDSTranslator::unpackTMCFLT(word flt, TRDSTMCFLT *unpacked) {
     if((flt & RDS_TMC_MESSAGE_LOCATION_FOREIGN_MASK) !=
        RDS_TMC_MESSAGE_LOCATION_FOREIGN_MASK)
@@ -902,14 +1778,14 @@ word RDSTranslator::readFromTMCContainer(const uint32_t slices[4],
 
     if(size > fp->bitIndex + 1) {
         //Split fetch
-        result = slices[fp->sliceIndex - 1] & ((1U << fp->bitIndex) - 1);
-        result <<= size - (fp->bitIndex + 1);
+        byte rest = size - (fp->bitIndex + 1);
+
+        result = slices[fp->sliceIndex - 1] & ((1U << (fp->bitIndex + 1)) - 1);
+        result <<= rest;
         if(fp->sliceIndex < 4) {
             fp->sliceIndex++;
-            result |= (((1U << (size - fp->bitIndex)) - 1) <<
-                      (31 - (size - fp->bitIndex) + 1)) &
-                      slices[fp->sliceIndex - 1];
-            fp->bitIndex = 31 - (size - fp->bitIndex);
+            result |= slices[fp->sliceIndex - 1] >> (32 - rest);
+            fp->bitIndex = 31 - rest;
         } else
             //Simulate EOF.
             fp->sliceIndex = 6;
@@ -989,152 +1865,469 @@ bool RDSTranslator::readNextTMCLabel(const uint32_t slices[4],
     return true;
 };
 
-const char QuantifierText_S_0[] PROGMEM = "%" PRIu8;
-const char QuantifierText_S_1[] PROGMEM = "%" PRIu16;
-const char QuantifierText_S_2[] PROGMEM = "less than %" PRIu16 " meters";
-const char QuantifierText_S_3[] PROGMEM = "%" PRIu8 "%%";
-const char QuantifierText_S_4[] PROGMEM = "of up to %" PRIu8 " km/h";
-const char QuantifierText_S_5[] PROGMEM = "of up to %" PRIu8 " %s";
-const char QuantifierText_S_6[] PROGMEM = "%" PRIi8 " degrees Celsius";
-const char QuantifierText_S_7[] PROGMEM = "%02" PRIu8 ":%02" PRIu8;
-const char QuantifierText_S_8[] PROGMEM = "%2.1f tonnes";
-const char QuantifierText_S_9[] PROGMEM = "%2.1f meters";
-const char QuantifierText_S_A[] PROGMEM = "of up to %" PRIu8 " millimeters";
-const char QuantifierText_S_B[] PROGMEM = "%3.1f MHz";
-const char QuantifierText_S_C[] PROGMEM = "%" PRIu16 " kHz";
-
-PGM_P const QuantifierText_S[13] PROGMEM = {
-    QuantifierText_S_0,
-    QuantifierText_S_1,
-    QuantifierText_S_2,
-    QuantifierText_S_3,
-    QuantifierText_S_4,
-    QuantifierText_S_5,
-    QuantifierText_S_6,
-    QuantifierText_S_7,
-    QuantifierText_S_8,
-    QuantifierText_S_9,
-    QuantifierText_S_A,
-    QuantifierText_S_B,
-    QuantifierText_S_C
+//Size of the value of each label type, in bits, see ISO 14819-1 §5.5.1.
+const byte TMCLabelSizes[16] PROGMEM = {
+    3, 3, 5, 5, 5, 8, 8, 8, 8, 11, 16, 16, 16, 16, 0, 0
+};
+
+//The whole container, MSB first, in two halves.
+typedef struct {
+    uint64_t high, low;
+} TRDSBitBuffer;
+
+static inline word takeBits(TRDSBitBuffer *bits, byte size) {
+    word result = bits->high >> (64 - size);
+
+    bits->high = (bits->high << size) | (bits->low >> (64 - size));
+    bits->low <<= size;
+
+    return result;
+}
+
+byte RDSTranslator::parseTMCLabels(const uint32_t slices[4],
+                                   TRDSTMCLabel *labels, byte capacity,
+                                   word *maybeFLT, TRDSTMCFLT *unpacked) {
+    TRDSBitBuffer bits;
+    int16_t left = 128;
+    byte count = 0;
+
+    if(!(slices && labels))
+        return 0;
+
+    bits.high = ((uint64_t)slices[0] << 32) | slices[1];
+    bits.low = ((uint64_t)slices[2] << 32) | slices[3];
+    if(maybeFLT && unpacked &&
+       (*maybeFLT & RDS_TMC_MESSAGE_LOCATION_FOREIGN_MASK) ==
+       RDS_TMC_MESSAGE_LOCATION_FOREIGN_MASK) {
+        //Same as adjustTMCContainerForFLT(), without moving anything.
+        unpackTMCFLT(*maybeFLT, unpacked);
+        *maybeFLT = takeBits(&bits, 16);
+        left -= 16;
+    };
+
+    //Reading past the end yields zeroes, which is what the (glued) container
+    //ends with anyway, so a label cut short still comes out as the cursor
+    //would read it.
+    while(left > 0 && count < capacity) {
+        TRDSTMCLabel *label = &labels[count];
+        byte size;
+
+        label->type = takeBits(&bits, 4);
+        size = pgm_read_byte(&TMCLabelSizes[label->type]);
+        label->value = (size ? takeBits(&bits, size) : 0);
+        left -= 4 + size;
+        if(label->type == RDS_TMC_LABEL_DURATION && !label->value)
+            //Seven zero bits, see readNextTMCLabel().
+            break;
+        count++;
+        if(label->type == RDS_TMC_LABEL_RESERVED2)
+            break;
+    };
+
+    return count;
+}
+
+void RDSTranslator::decodeTMCLabels(word event, const TRDSTMCLabel *labels,
+                                    byte count, TRDSTMCMessageContent *content) {
+    TRDSTMCMessageEvent *current;
+    byte block = 0;
+
+    if(!content)
+        return;
+    memset(content, 0x00, sizeof(*content));
+    content->eventCount = 1;
+    content->events[0].code = event;
+    current = &content->events[0];
+    if(!labels)
+        return;
+
+    for(byte i = 0; i < count; i++) {
+        const TRDSTMCLabel *label = &labels[i];
+        word bit = 1U << label->type;
+        bool first = !(content->present & bit);
+
+        content->present |= bit;
+        switch(label->type) {
+            case RDS_TMC_LABEL_DURATION:
+                if(first)
+                    content->duration = label->value;
+                break;
+            case RDS_TMC_LABEL_CONTROL:
+                content->controls |= 1 << label->value;
+                if(label->value == RDS_TMC_L1_EXTENT_ADD8)
+                    content->extentIncrement += 8;
+                else if(label->value == RDS_TMC_L1_EXTENT_ADD16)
+                    content->extentIncrement += 16;
+                break;
+            case RDS_TMC_LABEL_LENGTH:
+                if(first)
+                    content->length = label->value;
+                break;
+            case RDS_TMC_LABEL_SPEED:
+                if(first)
+                    content->speed = label->value;
+                break;
+            case RDS_TMC_LABEL_QUANTIFIER_5:
+            case RDS_TMC_LABEL_QUANTIFIER_8:
+                //One per event, to the one it follows.
+                if(current && !current->quantified) {
+                    current->quantified = true;
+                    current->quantifier = *label;
+                };
+                break;
+            case RDS_TMC_LABEL_SUPPLEMENTARY:
+                if(current &&
+                   content->supplementaryCount < RDS_TMC_MAX_SUPPLEMENTARY) {
+                    TRDSTMCMessageSupplementary *info =
+                        &content->supplementary[content->supplementaryCount++];
+
+                    info->code = label->value;
+                    info->event = current - content->events;
+                };
+                break;
+            case RDS_TMC_LABEL_START:
+                if(first)
+                    content->startTime = label->value;
+                break;
+            case RDS_TMC_LABEL_STOP:
+                if(first)
+                    content->stopTime = label->value;
+                break;
+            case RDS_TMC_LABEL_ADDITIONAL:
+                if(content->eventCount < RDS_TMC_MAX_EVENTS) {
+                    current = &content->events[content->eventCount++];
+                    current->code = label->value;
+                    current->block = block;
+                } else
+                    //Nowhere to put it, nor anything that goes with it.
+                    current = NULL;
+                break;
+            case RDS_TMC_LABEL_DIVERSION:
+                if(content->diversionCount < RDS_TMC_MAX_ROUTE)
+                    content->diversion[content->diversionCount++] =
+                        label->value;
+                break;
+            case RDS_TMC_LABEL_DESTINATION:
+                if(content->destinationCount < RDS_TMC_MAX_ROUTE)
+                    content->destination[content->destinationCount++] =
+                        label->value;
+                break;
+            case RDS_TMC_LABEL_XREF:
+                if(first)
+                    content->crossReference = label->value;
+                break;
+            case RDS_TMC_LABEL_SEPARATOR:
+                block++;
+                break;
+        };
+    };
+}
+
+//Quantities are rendered as bound, number and unit, see writeQuantity().
+const char QuantifierText_LessThan[] PROGMEM = "less than ";
+const char QuantifierText_UpTo[] PROGMEM = "of up to ";
+const char QuantifierText_U_Meters[] PROGMEM = " meters";
+const char QuantifierText_U_Percent[] PROGMEM = "%";
+const char QuantifierText_U_KMH[] PROGMEM = " km/h";
+const char QuantifierText_U_Minutes[] PROGMEM = " minutes";
+const char QuantifierText_U_Hours[] PROGMEM = " hours";
+const char QuantifierText_U_Celsius[] PROGMEM = " degrees Celsius";
+const char QuantifierText_U_Tonnes[] PROGMEM = " tonnes";
+const char QuantifierText_U_Millimeters[] PROGMEM = " millimeters";
+const char QuantifierText_U_MHz[] PROGMEM = " MHz";
+const char QuantifierText_U_kHz[] PROGMEM = " kHz";
+
+//Indexed by RDS_TMC_UNIT_*; counts and times of day have no suffix.
+PGM_P const QuantifierText_U[RDS_TMC_UNIT_LAST + 1] PROGMEM = {
+    NULL,
+    QuantifierText_U_Meters,
+    QuantifierText_U_Percent,
+    QuantifierText_U_KMH,
+    QuantifierText_U_Minutes,
+    QuantifierText_U_Hours,
+    QuantifierText_U_Celsius,
+    NULL,
+    QuantifierText_U_Tonnes,
+    QuantifierText_U_Millimeters,
+    QuantifierText_U_MHz,
+    QuantifierText_U_kHz
 };
 
+//Bounded output to a caller buffer, always leaving room for the terminator.
+typedef struct {
+    char *buf;
+    size_t size, length;
+} TRDSTextWriter;
+
+static inline void writeChar(TRDSTextWriter *writer, char c) {
+    if(writer->length + 1 < writer->size)
+        writer->buf[writer->length++] = c;
+}
+
+static void writeText_P(TRDSTextWriter *writer, PGM_P text) {
+    char c;
+
+    while((c = pgm_read_byte(text++)))
+        writeChar(writer, c);
+}
+
+static inline char readTextChar(const char *text, byte index, bool in_flash) {
+    return (in_flash ? pgm_read_byte(&text[index]) : text[index]);
+}
+
+static void writeSpan(TRDSTextWriter *writer, const char *text, size_t count,
+                      bool in_flash) {
+    if(writer->length + count >= writer->size)
+        count = writer->size - writer->length - 1;
+    if(in_flash)
+        memcpy_P(&writer->buf[writer->length], text, count);
+    else
+        memcpy(&writer->buf[writer->length], text, count);
+    writer->length += count;
+}
+
+//Writes value in decimal, zero-padded to at least digits digits; if tenths,
+//the last digit goes after a decimal point.
+static void writeNumber(TRDSTextWriter *writer, int16_t value, byte digits = 1,
+                        bool tenths = false) {
+    char reversed[6];
+    byte count = 0;
+    word magnitude = (value < 0 ? -(int32_t)value : value);
+
+    if(value < 0)
+        writeChar(writer, '-');
+    if(tenths && digits < 2)
+        digits = 2;
+    do {
+        reversed[count++] = '0' + magnitude % 10;
+        magnitude /= 10;
+    } while(magnitude || count < digits);
+    while(count) {
+        if(tenths && count == 1)
+            writeChar(writer, '.');
+        writeChar(writer, reversed[--count]);
+    };
+}
+
+//Checks that label is the right kind of quantifier label for qType.
+static bool isQuantifierFor(byte qType, const TRDSTMCLabel *label) {
+    if(!label || qType > RDS_TMC_QUANTIFIER_LAST)
+        return false;
+    if(label->type == RDS_TMC_LABEL_QUANTIFIER_5)
+        return qType <= RDS_TMC_QUANTIFIER_UPTO_MINUTES;
+    if(label->type == RDS_TMC_LABEL_QUANTIFIER_8)
+        return qType >= RDS_TMC_QUANTIFIER_DEGREES_CELSIUS;
+
+    return false;
+}
+
+static void writeQuantity(TRDSTextWriter *writer,
+                          const TRDSTMCQuantity *quantity) {
+    PGM_P unit;
+
+    if(quantity->bound == RDS_TMC_BOUND_LESSTHAN)
+        writeText_P(writer, QuantifierText_LessThan);
+    else if(quantity->bound == RDS_TMC_BOUND_UPTO)
+        writeText_P(writer, QuantifierText_UpTo);
+    if(quantity->unit == RDS_TMC_UNIT_TIME_OF_DAY) {
+        writeNumber(writer, quantity->value / 60, 2);
+        writeChar(writer, ':');
+        writeNumber(writer, quantity->value % 60, 2);
+        return;
+    };
+    writeNumber(writer, quantity->value, 1, quantity->decimals);
+    unit = (PGM_P)pgm_read_ptr(&QuantifierText_U[quantity->unit]);
+    if(unit)
+        writeText_P(writer, unit);
+}
+
+bool RDSTranslator::decodeQuantifierValue(byte qType,
+                                          const TRDSTMCLabel *label,
+                                          TRDSTMCQuantity *quantity) {
+    if(!(quantity && isQuantifierFor(qType, label)))
+        return false;
+
+    byte value = label->value;
+
+    quantity->decimals = 0;
+    quantity->unit = RDS_TMC_UNIT_NONE;
+    quantity->bound = RDS_TMC_BOUND_EXACT;
+    switch(qType) {
+        case RDS_TMC_QUANTIFIER_SMALL_NUMBER:
+            if(value <= 28)
+                quantity->value = (value ? value : 36);
+            else
+                quantity->value = 28 + (value - 28) * 2;
+            break;
+        case RDS_TMC_QUANTIFIER_NUMBER:
+            if(value <= 4)
+                quantity->value = (value ? value : 1000);
+            else if(value <= 14)
+                quantity->value = (value - 4) * 10;
+            else
+                quantity->value = 100 + (value - 14) * 50;
+            break;
+        case RDS_TMC_QUANTIFIER_LESSTHAN_METERS:
+            quantity->value = value * 10;
+            quantity->unit = RDS_TMC_UNIT_METERS;
+            quantity->bound = RDS_TMC_BOUND_LESSTHAN;
+            break;
+        case RDS_TMC_QUANTIFIER_PERCENT:
+            //0% is coded as 1, 0 is not used.
+            if(!value)
+                return false;
+            quantity->value = (value - 1) * 5;
+            quantity->unit = RDS_TMC_UNIT_PERCENT;
+            break;
+        case RDS_TMC_QUANTIFIER_UPTO_KMH:
+            quantity->value = (value ? value * 5 : 160);
+            quantity->unit = RDS_TMC_UNIT_KMH;
+            quantity->bound = RDS_TMC_BOUND_UPTO;
+            break;
+        case RDS_TMC_QUANTIFIER_UPTO_MINUTES:
+            quantity->bound = RDS_TMC_BOUND_UPTO;
+            if(value > 0 && value <= 10) {
+                quantity->value = value * 5;
+                quantity->unit = RDS_TMC_UNIT_MINUTES;
+            } else {
+                if(value <= 22)
+                    quantity->value = (value ? value - 10 : 72);
+                else
+                    quantity->value = 12 + (value - 22) * 6;
+                quantity->unit = RDS_TMC_UNIT_HOURS;
+            };
+            break;
+        case RDS_TMC_QUANTIFIER_DEGREES_CELSIUS:
+            quantity->value = value - 51;
+            quantity->unit = RDS_TMC_UNIT_CELSIUS;
+            break;
+        case RDS_TMC_QUANTIFIER_TIME:
+            //Ten minute steps, 00:00 is coded as 1.
+            if(!value || value > 144)
+                return false;
+            quantity->value = (value - 1) * 10;
+            quantity->unit = RDS_TMC_UNIT_TIME_OF_DAY;
+            break;
+        case RDS_TMC_QUANTIFIER_TONNES:
+        case RDS_TMC_QUANTIFIER_METERS:
+            if(value <= 100)
+                quantity->value = value;
+            else
+                quantity->value = 100 + (value - 100) * 5;
+            quantity->decimals = 1;
+            quantity->unit = (qType == RDS_TMC_QUANTIFIER_TONNES ?
+                              RDS_TMC_UNIT_TONNES : RDS_TMC_UNIT_METERS);
+            break;
+        case RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS:
+            quantity->value = value;
+            quantity->unit = RDS_TMC_UNIT_MILLIMETERS;
+            quantity->bound = RDS_TMC_BOUND_UPTO;
+            break;
+        case RDS_TMC_QUANTIFIER_MHZ:
+            //Tens of kHz, always a multiple of ten.
+            quantity->value = decodeAFFrequency(value, true) / 10;
+            quantity->decimals = 1;
+            quantity->unit = RDS_TMC_UNIT_MHZ;
+            break;
+        case RDS_TMC_QUANTIFIER_KHZ:
+            quantity->value = decodeAFFrequency(value, false);
+            quantity->unit = RDS_TMC_UNIT_KHZ;
+            break;
+    };
+
+    return true;
+}
+
 void RDSTranslator::decodeQuantifier(byte qType, TRDSTMCLabel *label, char *buf,
                                      size_t size) {
-  if(!(label && buf))
-      return;
-  if(qType > RDS_TMC_QUANTIFIER_LAST)
-      return;
-  if(!(label->type == RDS_TMC_LABEL_QUANTIFIER_5 ||
-       label->type == RDS_TMC_LABEL_QUANTIFIER_8))
-      return;
-  if(label->type == RDS_TMC_LABEL_QUANTIFIER_5 &&
-     !(qType == RDS_TMC_QUANTIFIER_SMALL_NUMBER ||
-       qType == RDS_TMC_QUANTIFIER_NUMBER ||
-       qType == RDS_TMC_QUANTIFIER_LESSTHAN_METERS ||
-       qType == RDS_TMC_QUANTIFIER_PERCENT ||
-       qType == RDS_TMC_QUANTIFIER_UPTO_KMH ||
-       qType == RDS_TMC_QUANTIFIER_UPTO_MINUTES))
-      return;
-  if(label->type == RDS_TMC_LABEL_QUANTIFIER_8 &&
-    !(qType == RDS_TMC_QUANTIFIER_DEGREES_CELSIUS ||
-      qType == RDS_TMC_QUANTIFIER_TIME ||
-      qType == RDS_TMC_QUANTIFIER_TONNES ||
-      qType == RDS_TMC_QUANTIFIER_METERS ||
-      qType == RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS ||
-      qType == RDS_TMC_QUANTIFIER_MHZ ||
-      qType == RDS_TMC_QUANTIFIER_KHZ))
-      return;
-
-  byte aByte1, aByte2;
-  word aWord;
-  int8_t aSChar;
-  float aFloat;
-  switch(qType) {
-      case RDS_TMC_QUANTIFIER_SMALL_NUMBER:
-          if(label->value <= 28)
-              aByte1 = (label->value ? label->value : 36);
-          else
-              aByte1 = 28 + (label->value - 28) * 2;
-          snprintf_P(buf, size, (PGM_P)(pgm_read_ptr(&QuantifierText_S[qType])),
-                     aByte1);
-          break;
-      case RDS_TMC_QUANTIFIER_NUMBER:
-          if(label->value <= 4)
-              aWord = (label->value ? label->value : 1000);
-          else if(label->value > 4 && label->value <= 14)
-              aWord = (label->value - 4) * 10;
-          else if(label->value > 14)
-              aWord = 100 + (label->value - 14) * 50;
-          snprintf_P(buf, size, (PGM_P)(pgm_read_ptr(&QuantifierText_S[qType])),
-                     aWord);
-          break;
-      case RDS_TMC_QUANTIFIER_LESSTHAN_METERS:
-          aWord = label->value * 10;
-          snprintf_P(buf, size, (PGM_P)(pgm_read_ptr(&QuantifierText_S[qType])),
-                     aWord);
-          break;
-      case RDS_TMC_QUANTIFIER_PERCENT:
-          aByte1 = (label->value - 1) * 5;
-          snprintf_P(buf, size, (PGM_P)(pgm_read_ptr(&QuantifierText_S[qType])),
-                     aByte1);
-          break;
-      case RDS_TMC_QUANTIFIER_UPTO_KMH:
-          aByte1 = (label->value ? label->value * 5 : 160);
-          snprintf_P(buf, size, (PGM_P)(pgm_read_ptr(&QuantifierText_S[qType])),
-                     aByte1);
-          break;
-      case RDS_TMC_QUANTIFIER_UPTO_MINUTES:
-          if(label->value > 0 && label->value <= 10) {
-              aByte1 = label->value * 5;
-              snprintf_P(buf, size,
-                         (PGM_P)(pgm_read_ptr(&QuantifierText_S[qType])),
-                         aByte1, "minutes");
-          } else {
-              if(label->value <= 22)
-                  aByte1 = (label->value ? label->value - 10 : 72);
-              else
-                  aByte1 = 12 + (label->value - 22) * 6;
-              snprintf_P(buf, size,
-                         (PGM_P)(pgm_read_ptr(&QuantifierText_S[qType])),
-                         aByte1, "hours");
-          };
-          break;
-      case RDS_TMC_QUANTIFIER_DEGREES_CELSIUS:
-          aSChar = (int8_t)label->value - 51;
-          snprintf_P(buf, size, (PGM_P)(pgm_read_ptr(&QuantifierText_S[qType])),
-                     aSChar);
-          break;
-      case RDS_TMC_QUANTIFIER_TIME:
-          aByte1 = label->value / 6;
-          aByte2 = (label->value % 6 - 1) * 10;
-          snprintf_P(buf, size, (PGM_P)(pgm_read_ptr(&QuantifierText_S[qType])),
-                     aByte1, aByte2);
-          break;
-      case RDS_TMC_QUANTIFIER_TONNES:
-      case RDS_TMC_QUANTIFIER_METERS:
-          if(label->value <= 100)
-              aFloat = label->value * 0.1;
-          else
-              aFloat = 10.0 + (label->value - 100) * 0.5;
-          snprintf_P(buf, size, (PGM_P)(pgm_read_ptr(&QuantifierText_S[qType])),
-                     aFloat);
-          break;
-      case RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS:
-          aByte1 = label->value;
-          snprintf_P(buf, size, (PGM_P)(pgm_read_ptr(&QuantifierText_S[qType])),
-                     aByte1);
-          break;
-      case RDS_TMC_QUANTIFIER_MHZ:
-      case RDS_TMC_QUANTIFIER_KHZ:
-        aWord = decodeAFFrequency(label->value,
-                                  qType == RDS_TMC_QUANTIFIER_MHZ);
-        snprintf_P(buf, size, (PGM_P)(pgm_read_ptr(&QuantifierText_S[qType])),
-                   (qType == RDS_TMC_QUANTIFIER_KHZ ? aWord : aWord / 100.0));
-        break;
-  };
+    TRDSTextWriter writer = {buf, size, 0};
+    TRDSTMCQuantity quantity;
+
+    if(!(buf && size))
+        return;
+    buf[0] = '\0';
+    if(!decodeQuantifierValue(qType, label, &quantity))
+        return;
+
+    writeQuantity(&writer, &quantity);
+    buf[writer.length] = '\0';
 };
 
+size_t RDSTranslator::renderTMCEvent(word event, const TRDSTMCLabel *quantifier,
+                                     char *buf, size_t size) {
+    TRDSTextWriter writer = {buf, size, 0};
+    TRDSTMCEventInfo info;
+    TRDSTMCQuantity quantity;
+    const char *text;
+    byte length;
+    bool in_flash = false;
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_COMPRESSED)
+    char expanded[ISO14819_2_EVENT_TEXT_SIZE];
+#endif
+
+    if(!(buf && size))
+        return 0;
+    buf[0] = '\0';
+    if(!getTMCEventInfo(event, &info))
+        return 0;
+    if(!decodeQuantifierValue(info.quantifier, quantifier, &quantity))
+        quantifier = NULL;
+
+    //Mapped and RAM texts come first, whatever is left is in FLASH.
+    if(!getTMCEventText(event, &text, &length)) {
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_COMPRESSED)
+        length = expandTMCEventText(event, expanded, sizeof(expanded));
+        text = expanded;
+#else
+        return 0;
+#endif
+    } else {
+#if !defined(WITH_RDS_HOST_EXTENSIONS)
+        in_flash = true;
+#endif
+    };
+
+    //The quantifier goes where the "%s" is and the parentheses around it
+    //go; without a quantifier, the whole parenthesized part goes along with
+    //the space separating it from the rest. Everything else is copied over
+    //in runs.
+    byte start = 0;
+    for(byte i = 0; i < length; i++) {
+        if(readTextChar(text, i, in_flash) != '(')
+            continue;
+
+        byte end, placeholder = 0;
+        for(end = i + 1; end < length; end++) {
+            char c = readTextChar(text, end, in_flash);
+
+            if(c == ')')
+                break;
+            if(c == '%')
+                placeholder = end;
+        };
+        if(!placeholder || end == length)
+            continue;
+
+        writeSpan(&writer, text + start, i - start, in_flash);
+        start = end + 1;
+        if(quantifier) {
+            writeSpan(&writer, text + i + 1, placeholder - i - 1, in_flash);
+            writeQuantity(&writer, &quantity);
+            if(placeholder + 2 < end)
+                writeSpan(&writer, text + placeholder + 2,
+                          end - placeholder - 2, in_flash);
+        } else if(start < length && readTextChar(text, start, in_flash) == ' ')
+            start++;
+        else if(writer.length && buf[writer.length - 1] == ' ')
+            writer.length--;
+        i = end;
+    };
+    writeSpan(&writer, text + start, length - start, in_flash);
+    buf[writer.length] = '\0';
+
+    return writer.length;
+}
+
 void RDSTranslator::adjustTMCContainerForFLT(uint32_t slices[4], word *maybeFLT,
                                              TRDSTMCFLT *unpacked) {
     if(!maybeFLT)
@@ -1148,10 +2341,11 @@ void RDSTranslator::adjustTMCContainerForFLT(uint32_t slices[4], word *maybeFLT,
 
     unpackTMCFLT(*maybeFLT, unpacked);
     *maybeFLT = (slices[0] & 0xFFFF0000) >> 16;
-    for(byte i = 0; i < 4; i++) {
+    for(byte i = 0; i < 3; i++) {
       slices[i] <<= 16;
       slices[i] |= (slices[i + 1] & 0xFFFF0000) >> 16;
     }
+    slices[3] <<= 16;
 };
 
 bool RDSTranslator::locateMessageRecord(const void *table, size_t recSize,
@@ -1166,6 +2360,25 @@ bool RDSTranslator::locateMessageRecord(const void *table, size_t recSize,
     if(!wordId && (tableSize > 256 || key > 256))
         return false;
 
+#if defined(WITH_RDS_TMC_DIRECT_INDEX)
+    //The ISO 14819-2 tables come with a dense index by code, no need to go
+    //probing for them.
+    if(table == ISO14819_2_Events || table == ISO14819_2_Supplementary) {
+        word position = 0xFFFF;
+
+        if(table == ISO14819_2_Events) {
+            if(key < sizeof(ISO14819_2_EventIndex) /
+                     sizeof(ISO14819_2_EventIndex[0]))
+                position = pgm_read_word(&ISO14819_2_EventIndex[key]);
+        } else if(key < sizeof(ISO14819_2_SupplementaryIndex))
+            position = pgm_read_byte(&ISO14819_2_SupplementaryIndex[key]);
+        if(position >= tableSize)
+            return false;
+        blockFetcher((byte *)table + position * recSize, record, recSize);
+
+        return true;
+    };
+#endif
     word recNo = key - 1, curId = 0;
     if(recNo > tableSize - 1)
         recNo = tableSize - 1;
@@ -31,6 +31,9 @@
 #  include <stddef.h>
 #  define word uint16_t
 #  define byte uint8_t
+// Hosted (i.e. non-MCU) builds get the facilities that need an OS and/or more
+// RAM than an MCU has to spare: persistent caches, text assemblers, etc.
+#  define WITH_RDS_HOST_EXTENSIONS
 # endif
 #else
 # warning Non-GNU compiler detected, you are on your own!
@@ -83,6 +86,12 @@
 #define RDS_TMC_LABEL_XREF 0xD
 #define RDS_TMC_LABEL_SEPARATOR 0xE
 #define RDS_TMC_LABEL_RESERVED2 0xF
+//At most this many labels fit in a container (112 bits of separators)
+#define RDS_TMC_MAX_LABELS 28
+//Sizes of the lists in TRDSTMCMessageContent, again as many as would fit
+#define RDS_TMC_MAX_EVENTS 8
+#define RDS_TMC_MAX_SUPPLEMENTARY 9
+#define RDS_TMC_MAX_ROUTE 5
 #define RDS_TMC_L1_URGENCY_INC 0x00
 #define RDS_TMC_L1_URGENCY_DEC 0x01
 #define RDS_TMC_L1_DIRECTION_INV 0x02
@@ -91,6 +100,22 @@
 #define RDS_TMC_L1_DIVERSION 0x05
 #define RDS_TMC_L1_EXTENT_ADD8 0x06
 #define RDS_TMC_L1_EXTENT_ADD16 0x07
+#define RDS_TMC_UNIT_NONE 0x0
+#define RDS_TMC_UNIT_METERS 0x1
+#define RDS_TMC_UNIT_PERCENT 0x2
+#define RDS_TMC_UNIT_KMH 0x3
+#define RDS_TMC_UNIT_MINUTES 0x4
+#define RDS_TMC_UNIT_HOURS 0x5
+#define RDS_TMC_UNIT_CELSIUS 0x6
+#define RDS_TMC_UNIT_TIME_OF_DAY 0x7
+#define RDS_TMC_UNIT_TONNES 0x8
+#define RDS_TMC_UNIT_MILLIMETERS 0x9
+#define RDS_TMC_UNIT_MHZ 0xA
+#define RDS_TMC_UNIT_KHZ 0xB
+#define RDS_TMC_UNIT_LAST RDS_TMC_UNIT_KHZ
+#define RDS_TMC_BOUND_EXACT 0x0
+#define RDS_TMC_BOUND_UPTO 0x1
+#define RDS_TMC_BOUND_LESSTHAN 0x2
 #define RDS_RTP_CLASS_DUMMY 0
 #define RDS_RTP_CLASS_ITEM_TITLE 1
 #define RDS_RTP_CLASS_ITEM_ALBUM 2
@@ -160,6 +185,13 @@
 #define RDS_PAGING_DIGIT 0x2
 #define RDS_PAGING_ALPHA 0x3
 
+//Values for RDSDecoder::getRDSText()
+#define RDS_TEXT_PS 0x00
+#define RDS_TEXT_PTYN 0x01
+#define RDS_TEXT_RT 0x02
+#define RDS_TEXT_EON_PS 0x03
+#define RDS_TEXT_RT_PREVIOUS 0x04
+
 //RDS Decoder callback types
 #define RDS_CALLBACK_AF 0x00
 #define RDS_CALLBACK_TDC 0x01
@@ -172,7 +204,8 @@
 #define RDS_CALLBACK_SLP 0x08
 #define RDS_CALLBACK_P7 0x09
 #define RDS_CALLBACK_P13 0x0A
-#define RDS_CALLBACK_LAST RDS_CALLBACK_P13
+#define RDS_CALLBACK_CT 0x0B
+#define RDS_CALLBACK_LAST RDS_CALLBACK_CT
 
 //This holds time of day as received via RDS. Mimicking struct tm from
 //<time.h> for familiarity.
@@ -325,6 +358,80 @@ typedef struct {
     uint16_t value;
 } TRDSTMCLabel;
 
+typedef struct {
+    //In tenths of unit if decimals is 1, in minutes since midnight for
+    //RDS_TMC_UNIT_TIME_OF_DAY
+    int16_t value;
+    uint8_t decimals;
+    uint8_t unit;
+    uint8_t bound;
+} TRDSTMCQuantity;
+
+typedef struct {
+    word code;
+    //Information block (counting separators, from 0) the event belongs to
+    byte block;
+    bool quantified;
+    TRDSTMCLabel quantifier;
+} TRDSTMCMessageEvent;
+
+typedef struct {
+    byte code;
+    //Index in TRDSTMCMessageContent.events of the event it goes with
+    byte event;
+} TRDSTMCMessageSupplementary;
+
+//A TMC message with its labels sorted out, see decodeTMCLabels().
+typedef struct {
+    //events[0] is the one from the first group, the rest come from Label 9
+    byte eventCount;
+    TRDSTMCMessageEvent events[RDS_TMC_MAX_EVENTS];
+    byte supplementaryCount;
+    TRDSTMCMessageSupplementary supplementary[RDS_TMC_MAX_SUPPLEMENTARY];
+    //Location codes, in order, from Label 10 and Label 11 respectively
+    byte diversionCount;
+    word diversion[RDS_TMC_MAX_ROUTE];
+    byte destinationCount;
+    word destination[RDS_TMC_MAX_ROUTE];
+    //Bit n set if Label n was seen; the single valued ones below are only
+    //meaningful if their bit is set and hold the value of the first one
+    word present;
+    byte duration;
+    byte length;
+    byte speed;
+    byte startTime;
+    byte stopTime;
+    word crossReference;
+    //Bit n set if control code n (RDS_TMC_L1_*) was seen
+    byte controls;
+    //To be added to the extent of the message, from RDS_TMC_L1_EXTENT_ADD*
+    byte extentIncrement;
+} TRDSTMCMessageContent;
+
+//Decomposed decryption parameters of one (Service Key, encId) pair, see
+//RDSTranslator::setTMCDecryptionKey()
+typedef struct {
+    bool valid;
+    byte serviceKey;
+    byte encId;
+    //The key table the parameters were taken from, and where it lives
+    const word (*table)[32];
+    bool in_flash;
+    uint16_t xorMask;
+    byte rol;
+} TRDSTMCDecryptionKey;
+
+//The machine-readable part of an ISO 14819-2 event list entry.
+typedef struct {
+    byte quantifier;
+    byte nature;
+    byte urgency;
+    byte updateClass;
+    bool longerLasting;
+    bool silentDuration;
+    bool bidirectional;
+} TRDSTMCEventInfo;
+
 typedef struct __attribute__ ((__packed__)) {
     uint8_t itemToggle:1;
     uint8_t itemRunning:1;
@@ -407,6 +514,30 @@ typedef struct {
     TRDSEON EON;
 } TRDSData;
 
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+#define RDS_STATION_MAX_AF 25
+
+//This is what RDSStationCache remembers about a station. It lives in a file
+//shared across program runs (and possibly architectures), hence the fixed
+//width types and the packing.
+typedef struct __attribute__ ((__packed__)) {
+    uint16_t programIdentifier;
+    uint8_t extendedCountryCode;
+    uint8_t PTY;
+    uint8_t TP:1;
+    uint8_t MS:1;
+    uint8_t DICC:4;
+    uint8_t hasPTYN:1;
+    uint8_t languageCode;
+    uint16_t tmcIdentification;
+    char programService[8];
+    char programTypeName[8];
+    uint8_t afCount;
+    uint8_t alternativeFrequencies[RDS_STATION_MAX_AF];
+    uint32_t lastSeen;
+} TRDSStationRecord;
+#endif
+
 //RDS Decoder callback prototype.
 //In general, the first argument is the semantic equivalent of the segment
 //address, the second is true if this was an A group and the third parameter
@@ -428,13 +559,16 @@ typedef struct {
 //    frequency pair and fourth is undefined.
 //RDS_CALLBACK_RT:
 //    First parameter as well as the last two are always zero; the second is
-//    true if it was a 2A group that triggered this RT change. The callee is
-//    expected to call getRDSData() to fetch the current RT before it gets
-//    replaced as signalled by the group currently being processed.
+//    true if it was a 2A group that triggered this RT change. This is called
+//    right before the current RT gets replaced as signalled by the group
+//    currently being processed. There is no need to save the outgoing RT from
+//    within the callback anymore: it stays available through getPreviousRT()
+//    until the next change.
 //RDS_CALLBACK_TMC:
 //    First parameter is the first 5 bits of the TMC message, the second is
 //    always true and the last two contain the remaining 32 bits of the TMC
-//    message.
+//    message. Repeats of self-contained payloads never make it here if a
+//    repeat filter is attached, see setTMCRepeatFilter().
 //RDS_CALLBACK_RTP:
 //    First parameter is the first 5 bits of the RT+ message, the second is
 //    always true and the last two contain the remaining 32 bits of the RT+
@@ -447,6 +581,8 @@ typedef struct {
 //    with that or, even less so, storing 128 bytes of it. NOTE: with UTF-8
 //    encoding, a single eRT message may contain anywhere from one to four
 //    Unicode codepoints. NOTE: RT+ counts [displayed] characters, not bytes.
+//    Hosted builds that would rather have the whole text can attach an
+//    RDSERTAssembler instead, see setERTAssembler().
 //RDS_CALLBACK_SLP:
 //    First parameter is the 5 bit Paging field in the 1A group, the second is
 //    always true, the third contains the slow labelling code (when used for
@@ -463,8 +599,49 @@ typedef struct {
 //    remaining 32 bits of the paging message. RDS_CALLBACK_P7 is for normal
 //    paging transmitted in group 7A, whereas RDS_CALLBACK_P13 is for enhanced
 //    paging transmitted in group 13A.
+//RDS_CALLBACK_CT:
+//    First parameter contains the two MJD MSBs from block B, second is always
+//    true and the last two contain blocks C and D of the 4A group. This is
+//    called right after the CT information has been decoded, so that the
+//    callee can timestamp its arrival (e.g. for RDSClock) and then call
+//    getRDSTime() or getRDSEpoch() as needed.
 typedef void (*TRDSCallback)(byte, bool, word, word);
 
+class RDSRTPlus;
+class RDSTMCRepeatFilter;
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+class RDSStationCache;
+class RDSERTAssembler;
+class RDSTMCTables;
+class RDSTMCLanguagePack;
+#endif
+
+//How many stations RDSDecoder keeps the full decoding state of, so that going
+//back to one of them (as a scanning receiver does) doesn't mean learning
+//everything again. Each slot costs about sizeof(TRDSData) bytes of RAM, hence
+//the MCU default of one (i.e. no caching at all).
+#if !defined(RDS_STATE_CACHE_SLOTS)
+# if defined(WITH_RDS_HOST_EXTENSIONS)
+#  define RDS_STATE_CACHE_SLOTS 8
+# else
+#  define RDS_STATE_CACHE_SLOTS 1
+# endif
+#endif
+
+//Everything RDSDecoder knows about one station.
+typedef struct {
+    TRDSData status;
+    //RadioText is double buffered: radioText points to the one being
+    //received, previousRadioText to the one replaced by the last A/B flip.
+    //They start out as status.radioText and spareRadioText, respectively, and
+    //get swapped on each flip.
+    char spareRadioText[65];
+    char *radioText, *previousRadioText;
+    bool rdstextab, rdsptynab;
+    byte seen;
+    word lastUsed;
+} TRDSDecoderState;
+
 class RDSDecoder
 {
     public:
@@ -508,32 +685,187 @@ class RDSDecoder
         */
         bool getRDSTime(TRDSTime* rdstime = NULL);
 
+        /*
+        * Description:
+        *   Returns currently decoded RDS CT information as machine-readable
+        *   time, if any is available, and returns true; otherwise returns
+        *   false and does not touch the parameters.
+        * Parameters:
+        *   utc - pointer to a uint32_t to be filled with the UTC time in
+        *         seconds since the UNIX epoch. This is the minute edge as
+        *         signalled by the station, the seconds are therefore always
+        *         zero.
+        *   offset - pointer to an int16_t to be filled with the local time
+        *            offset, in minutes.
+        */
+        bool getRDSEpoch(uint32_t *utc, int16_t *offset = NULL);
+
+        /*
+        * Description:
+        *   Gives direct access to one of the texts being received, exactly as
+        *   received (i.e. in the RDS character set and not necessarily
+        *   terminated), for feeding to RDSTranslator::convertToUTF8() and
+        *   friends without an intermediate copy. The pointer stays valid but
+        *   its contents change with the next call to decodeRDSGroup().
+        * Parameters:
+        *   which - one of the RDS_TEXT_* constants.
+        *   length - optional pointer to a byte receiving the size of the text
+        *            buffer.
+        * Returns:
+        *   pointer to the text or NULL if which is invalid or nothing was
+        *   received since the last resetRDS() (or, for RDS_TEXT_RT_PREVIOUS,
+        *   since the last RT A/B flip).
+        */
+        const char *getRDSText(byte which, byte *length = NULL);
+
+        /*
+        * Description:
+        *   Returns the RadioText that was current before the last A/B flip, in
+        *   printable form (see getRDSData()).
+        * Parameters:
+        *   radioText - pointer to a buffer of at least 65 characters to be
+        *               filled with the text, ignore if only interested in
+        *               its availability.
+        * Returns:
+        *   true if there was such a text, false if no A/B flip has been seen
+        *   on the current station yet.
+        */
+        bool getPreviousRT(char *radioText = NULL);
+
         /*
         * Description:
         *   Resets internal data structures, use when switching to a new
-        *   station.
+        *   station. The state of the last RDS_STATE_CACHE_SLOTS stations
+        *   heard is kept aside, keyed by PI, and switched back to as soon as a
+        *   group from one of them arrives, unless forget is true in which case
+        *   all of it is discarded too. forget defaults to true when
+        *   RDS_STATE_CACHE_SLOTS is 1 (i.e. there is no cache), which then
+        *   behaves as before: a reset always starts over and a PI change alone
+        *   never discards anything.
+        */
+        void resetRDS(bool forget = (RDS_STATE_CACHE_SLOTS == 1));
+
+        /*
+        * Description:
+        *   Attaches an RT+ tag engine (see RDSRTPlus.h), which is then fed
+        *   every RT+ group, told about every RT A/B flip and rebound to the
+        *   RadioText of each new station. RDS_CALLBACK_RTP keeps working as
+        *   before. Using NULL detaches the currently attached engine (if
+        *   any).
+        */
+        void setRTPlus(RDSRTPlus *rtplus = NULL);
+
+        /*
+        * Description:
+        *   Attaches a TMC repeat filter (see RDSTMCRepeatFilter.h), which then
+        *   sees every TMC group before RDS_CALLBACK_TMC does: repeats are
+        *   counted and dropped, only new payloads reach the callback. Time,
+        *   as far as the filter is concerned, is measured in groups decoded.
+        *   Using NULL detaches the currently attached filter (if any).
+        */
+        void setTMCRepeatFilter(RDSTMCRepeatFilter *filter = NULL);
+
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+        /*
+        * Description:
+        *   Attaches a persistent station cache (see RDSStationCache.h). From
+        *   then on, the first group seen from a known PI pre-seeds PS, PTYN,
+        *   PTY, ECC and friends from the cache, replays the cached AFs
+        *   through RDS_CALLBACK_AF (as 0A groups would carry them, AF method
+        *   A) and everything learned from the air is written back to it as it
+        *   completes. Using NULL detaches the currently attached cache (if
+        *   any).
         */
-        void resetRDS(void);
+        void setStationCache(RDSStationCache *cache = NULL);
+
+        /*
+        * Description:
+        *   Attaches an eRT assembler (see RDSERTAssembler.h), which is then
+        *   fed every eRT group along with the current eRT ODA message and
+        *   reset on each station change. RDS_CALLBACK_ERT keeps working as
+        *   before. Using NULL detaches the currently attached assembler (if
+        *   any).
+        */
+        void setERTAssembler(RDSERTAssembler *assembler = NULL);
+#endif
 
     private:
-        TRDSData _status;
+        TRDSDecoderState _states[RDS_STATE_CACHE_SLOTS];
+        TRDSDecoderState *_state;
+        TRDSData *_status;
+        word _stateclock;
+        bool _detached;
+        //Printable versions of the texts in _status, kept up to date with
+        //what changed as opposed to recomputing everything on each poll.
+        char _printps[9], _printptyn[9], _printrt[65], _printeonps[9];
+        byte _psdirty, _ptyndirty, _eonpsdirty;
+        word _rtdirty;
         TRDSTime _time;
-        bool _rdstextab, _rdsptynab, _havect;
+        unsigned long _ctmjd;
+        uint32_t _ctday, _ctutc;
+        bool _havect;
         TRDSCallback _callbacks[RDS_CALLBACK_LAST + 1];
+        RDSRTPlus *_rtplus;
+        RDSTMCRepeatFilter *_tmcfilter;
+        //Groups decoded so far, the filter's notion of time
+        uint32_t _groups;
         byte _locale;
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+        RDSStationCache *_stationcache;
+        TRDSStationRecord *_stationrecord;
+        RDSERTAssembler *_ertassembler;
 
         /*
         * Description:
-        *   Filters str in place to only contain printable characters and also
-        *   replaces 0x0D (CR) with 0x00 effectively ending the string at that
-        *   point as per RDS §6.1.5.3.
+        *   Station cache plumbing: seedStation() is called when the PI changes
+        *   to a station not in the state cache and pre-fills _status from the
+        *   station cache, updateStation() is called after each group and
+        *   writes back whatever became known.
+        */
+        void seedStation(word programIdentifier);
+        void updateStation(byte grouptype, word block[]);
+#endif
+
+        /*
+        * Description:
+        *   Translates the dirty segments of raw into str, such that str only
+        *   contains printable characters and 0x0D (CR) is replaced with 0x00,
+        *   effectively ending the string at that point as per RDS §6.1.5.3.
         *   Makes a good-will effort to map the RDS character set to the one on
         *   a European CGROM Hitachi HD44780 as most users will want to display
         *   RDS information on such a display.
         *   Any unprintable character is converted to a question mark ("?"),
         *   as is customary. This helps with filtering out noisy strings.
+        * Parameters:
+        *   str - the printable version, updated in place.
+        *   raw - the text as received.
+        *   segmentSize - how many characters each bit in dirty stands for.
+        *   dirty - bitmap of the segments to translate, LSB first.
+        */
+        void makePrintable(char *str, const char *raw, byte segmentSize,
+                           word dirty);
+
+        /*
+        * Description:
+        *   Marks all printable text as needing translation, used whenever the
+        *   raw text is replaced wholesale.
         */
-        void makePrintable(char* str);
+        void markDirty(void);
+
+        /*
+        * Description:
+        *   Fills status with the "nothing received yet" values.
+        */
+        void initStatus(TRDSData *status);
+
+        /*
+        * Description:
+        *   Makes the cached state for the given PI the current one, recycling
+        *   the least recently used one if there's no such state yet. Called
+        *   whenever the PI changes, this is what makes switching between
+        *   stations O(1).
+        */
+        void selectState(word programIdentifier);
 
         /*
         * Description:
@@ -567,7 +899,35 @@ class RDSTranslator
         * Description:
         *   Constructor, sets locale to be used for all further operations.
         */
-        RDSTranslator(byte locale = RDS_LOCALE_EU) { _locale = locale; }
+        RDSTranslator(byte locale = RDS_LOCALE_EU) {
+            _locale = locale;
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+            _tables = NULL;
+            _language = NULL;
+#endif
+        }
+
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+        /*
+        * Description:
+        *   Attaches an ISO 14819-2 table file (see RDSTMCTables.h). While it
+        *   is open, the TMC event and supplementary information lookups below
+        *   use it instead of the compiled-in tables. Using NULL detaches the
+        *   currently attached tables (if any).
+        */
+        void setTMCTables(RDSTMCTables *tables = NULL) { _tables = tables; }
+
+        /*
+        * Description:
+        *   Attaches an ISO 14819-2 language pack (see RDSTMCLanguagePack.h).
+        *   While it is open, event and supplementary information texts come
+        *   from it, in UTF-8, wherever it has a translation; everything else
+        *   still comes from the tables. Using NULL goes back to English.
+        */
+        void setTMCLanguage(RDSTMCLanguagePack *language = NULL) {
+            _language = language;
+        }
+#endif
 
         /*
         * Description:
@@ -577,6 +937,30 @@ class RDSTranslator
         */
         void getTextForPTY(byte PTY, char* text, byte textsize);
 
+        /*
+        * Description:
+        *   Converts text in the RDS character set (IEC 62106 Annex E) to
+        *   UTF-8 or UTF-16, e.g. for display outside an HD44780. Conversion
+        *   stops at the first CR or NUL, at the end of the input or when the
+        *   output buffer is full, whichever comes first; multi-byte
+        *   characters are never split and the output is always terminated.
+        *   Erroneous characters become U+FFFD. On hosts with SSE2, runs of
+        *   plain ASCII are copied 16 characters at a time.
+        * Parameters:
+        *   text - the text to convert, e.g. from RDSDecoder::getRDSText().
+        *   length - the maximum number of characters to convert.
+        *   buf - the output buffer.
+        *   size - the size of the output buffer, in bytes for UTF-8 and in
+        *          16 bit code units for UTF-16.
+        * Returns:
+        *   the number of bytes (or code units) written, not including the
+        *   terminating zero.
+        */
+        size_t convertToUTF8(const char *text, size_t length, char *buf,
+                             size_t size);
+        size_t convertToUTF16(const char *text, size_t length, uint16_t *buf,
+                              size_t size);
+
         /*
         * Description:
         *   Decodes the station callsign out of the PI using the method
@@ -633,6 +1017,82 @@ class RDSTranslator
         */
         void decodeTMCDuration(byte length, TRDSTime* tmctime);
 
+        /*
+        * Description:
+        *   Looks up an RDS-TMC event in the ISO 14819-2 event list.
+        * Parameters:
+        *   event - the 11 bit event code.
+        *   info - pointer to a TRDSTMCEventInfo struct to be filled in with
+        *          the event's properties.
+        * Returns:
+        *   true if the event is in the list, false otherwise (or if the
+        *   library was built without the event list).
+        */
+        bool getTMCEventInfo(word event, TRDSTMCEventInfo *info);
+
+        /*
+        * Description:
+        *   Looks up the description of an RDS-TMC event in the ISO 14819-2
+        *   event list, or that of a supplementary information code in the
+        *   ISO 14819-2 supplementary information list. The text is handed out
+        *   in place together with its length, no copying or strlen() needed;
+        *   it is NUL-terminated nonetheless and has a "%s" where the
+        *   quantifier (if any) goes. NOTE: on AVR the text is in FLASH and
+        *   must be read with the _P family of functions.
+        * Parameters:
+        *   event - the 11 bit event code.
+        *   code - the supplementary information code.
+        *   text - pointer to a const char * that will receive the address of
+        *          the text.
+        *   length - optional pointer to a byte that will receive the length
+        *            of the text.
+        * Returns:
+        *   true if the code is in the list, false otherwise (or if the
+        *   library was built without the strings in FLASH or, for events,
+        *   with them compressed).
+        */
+        bool getTMCEventText(word event, const char **text,
+                             byte *length = NULL);
+        bool getTMCSupplementaryText(byte code, const char **text,
+                                     byte *length = NULL);
+
+        /*
+        * Description:
+        *   Copies the description of an RDS-TMC event into a buffer, expanding
+        *   it first if the library was built with phrase-compressed event
+        *   strings (WITH_RDS_TMC_EVENT_STRINGS_COMPRESSED). At most size-1
+        *   characters are copied and the result is always terminated.
+        * Parameters:
+        *   event - the 11 bit event code.
+        *   buf - the output buffer.
+        *   size - the size of the output buffer.
+        * Returns:
+        *   the number of characters written, not including the terminating
+        *   zero; 0 if the event is not in the list or the library was built
+        *   without the event strings in FLASH.
+        */
+        size_t expandTMCEventText(word event, char *buf, size_t size);
+
+        /*
+        * Description:
+        *   Expands a phrase-compressed event text, as found in the compressed
+        *   event string pool (see iso14819-2.h), into a buffer. Meant for
+        *   builds keeping said pool in the external EEPROM: read the length
+        *   byte and the packed text from there, then call this. At most size-1
+        *   characters are written and the result is always terminated.
+        * Parameters:
+        *   packed - the compressed text, without its length byte.
+        *   length - the length of the compressed text, in bytes.
+        *   buf - the output buffer.
+        *   size - the size of the output buffer.
+        *   in_flash - bool, true if packed points to Flash as opposed to RAM.
+        * Returns:
+        *   the number of characters written, not including the terminating
+        *   zero; 0 if the library was built without compressed event strings.
+        */
+        size_t expandTMCText(const byte *packed, byte length, char *buf,
+                             size_t size, bool in_flash = false);
+
         /*
         * Description:
         *   Translates an AF frequency code into a human readable measurement
@@ -689,6 +1149,40 @@ class RDSTranslator
         word decryptLocation(word location, byte serviceKey, byte encId,
                              const word table[][32], bool in_flash=false);
 
+        /*
+        * Description:
+        *   Prepares a TRDSTMCDecryptionKey for decryptLocations() from the
+        *   Service Key and the encId (as seen in the encryption
+        *   administration group, see TRDSTMCMessage8). Keep one per service:
+        *   the key table is only looked up again when any of the parameters
+        *   changes.
+        * Parameters:
+        *   key - pointer to the TRDSTMCDecryptionKey to update; zero it out
+        *         before first use.
+        *   serviceKey, encId, table, in_flash - as for decryptLocation().
+        */
+        void setTMCDecryptionKey(TRDSTMCDecryptionKey *key, byte serviceKey,
+                                 byte encId, const word table[][32],
+                                 bool in_flash=false);
+
+        /*
+        * Description:
+        *   Decrypts many location table indexes at once, all with the same
+        *   key, e.g. when reprocessing recordings of an encrypted service.
+        *   Same results as decryptLocation(), eight at a time where SSE2 is
+        *   available.
+        * Parameters:
+        *   key - pointer to a TRDSTMCDecryptionKey, as prepared by
+        *         setTMCDecryptionKey().
+        *   locations - the encrypted location table indexes.
+        *   decrypted - array receiving the decrypted ones, may be the same
+        *               as locations.
+        *   count - the number of elements in both arrays.
+        */
+        void decryptLocations(const TRDSTMCDecryptionKey *key,
+                              const word *locations, word *decrypted,
+                              size_t count);
+
         /*
         * Description:
         *   Unpacks a Group 8A TMC message into a TRDSTMCMessage8 struct.
@@ -758,6 +1252,52 @@ class RDSTranslator
         bool readNextTMCLabel(const uint32_t slices[4],
                               TRDSTMCContainerIndex *fp, TRDSTMCLabel *label);
 
+        /*
+        * Description:
+        *   Reads all labels from the bit container in one go, which is much
+        *   cheaper than calling readNextTMCLabel() in a loop. If maybeFLT and
+        *   unpacked are given, the FLT adjustment (see
+        *   adjustTMCContainerForFLT()) is done as well, without touching the
+        *   container.
+        * Parameters:
+        *   slices - an array of 4 uint32_t containing the TMC message bit
+        *            container.
+        *   labels - an array of TRDSTMCLabel structs that will receive the
+        *            labels read, RDS_TMC_MAX_LABELS is always enough.
+        *   capacity - the number of elements in labels.
+        *   maybeFLT - a pointer to a word containing the presumed FLT, or NULL.
+        *              If a FLT is indeed found there, it will be overwritten
+        *              with the actual location code.
+        *   unpacked - a pointer to a TRDSTMCFLT struct that will receive the
+        *              unpacked FLT code, or NULL.
+        * Returns:
+        *   the number of labels read, the same ones readNextTMCLabel() would
+        *   return (including a trailing Label 15, if any).
+        */
+        byte parseTMCLabels(const uint32_t slices[4], TRDSTMCLabel *labels,
+                            byte capacity, word *maybeFLT = NULL,
+                            TRDSTMCFLT *unpacked = NULL);
+
+        /*
+        * Description:
+        *   Sorts out the labels of a TMC multi-group message according to
+        *   ISO 14819-1 §5.5: additional events (each starting a new
+        *   information block if preceded by a separator) with the quantifier
+        *   that follows each, supplementary information attached to the event
+        *   it follows, diversion and destination routes, control codes and
+        *   the single valued labels. Lists that would overflow (not possible
+        *   with a well formed container) are cut short.
+        * Parameters:
+        *   event - the event code from the first group of the message.
+        *   labels - an array of TRDSTMCLabel structs, as filled in by
+        *            parseTMCLabels().
+        *   count - the number of elements in labels.
+        *   content - a pointer to a TRDSTMCMessageContent struct that will
+        *             receive the decoded message.
+        */
+        void decodeTMCLabels(word event, const TRDSTMCLabel *labels,
+                             byte count, TRDSTMCMessageContent *content);
+
         /*
         * Description:
         *   Given an expected quantifier type and the corresponding label which
@@ -769,12 +1309,57 @@ class RDSTranslator
         *   label - a pointer to a TRDSTMCLabel struct containing the decoded
         *           quantifier value
         *   buf - a pointer to a character string buffer that will receive the
-        *         human readable representation.
+        *         human readable representation, or an empty string if the
+        *         value isn't valid for qType.
         *   size - the size of the buffer provided.
         */
         void decodeQuantifier(byte qType, TRDSTMCLabel *label, char *buf,
                               size_t size);
 
+        /*
+        * Description:
+        *   Same as decodeQuantifier() but for machine consumption: fills in
+        *   the numeric value, unit and bound ("of up to", "less than") of the
+        *   quantifier instead of generating text.
+        * Parameters:
+        *   qType - a nibble specifying the quantifier type, according to
+        *           ISO 14819-2 §3.1.2
+        *   label - a pointer to a TRDSTMCLabel struct containing the decoded
+        *           quantifier value
+        *   quantity - a pointer to a TRDSTMCQuantity struct to be filled in.
+        * Returns:
+        *   true if quantity was filled in, false if the label isn't a
+        *   quantifier of the right kind for qType or holds a value not used
+        *   by the standard.
+        */
+        bool decodeQuantifierValue(byte qType, const TRDSTMCLabel *label,
+                                   TRDSTMCQuantity *quantity);
+
+        /*
+        * Description:
+        *   Renders an RDS-TMC event as a human readable sentence: looks up the
+        *   event text (wherever it lives, see getTMCEventText() and
+        *   expandTMCEventText()) and puts the quantifier in it, or drops the
+        *   optional part that would have held it if there is none. Uses
+        *   neither the heap nor floating point nor the printf() family, so
+        *   it's cheap enough to call for every message on every refresh. At
+        *   most size-1 characters are written and the result is always
+        *   terminated.
+        * Parameters:
+        *   event - the 11 bit event code.
+        *   quantifier - a pointer to a TRDSTMCLabel struct containing the
+        *                quantifier label that goes with the event, or NULL if
+        *                there is none. A label of the wrong kind for the
+        *                event counts as none.
+        *   buf - the output buffer.
+        *   size - the size of the output buffer.
+        * Returns:
+        *   the number of characters written, not including the terminating
+        *   zero; 0 if the event is unknown or has no text in this build.
+        */
+        size_t renderTMCEvent(word event, const TRDSTMCLabel *quantifier,
+                              char *buf, size_t size);
+
         /*
         * Description:
         *   Unpacks a Group 3A RT+ message into a TRDSRTPlusMessage3 struct.
@@ -849,6 +1434,10 @@ class RDSTranslator
 
     private:
         byte _locale;
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+        RDSTMCTables *_tables;
+        RDSTMCLanguagePack *_language;
+#endif
 
         /*
         * Description:
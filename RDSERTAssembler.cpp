@@ -0,0 +1,146 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This is the code file for the eRT assembler.
+ * See the header file for better function documentation.
+ */
+
+#include "RDSERTAssembler.h"
+#include "RDSDecoder-private.h"
+
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+
+#include <string.h>
+
+RDSERTAssembler::RDSERTAssembler(TRDSERTCallback callback) {
+    _callback = callback;
+    reset();
+}
+
+void RDSERTAssembler::reset(void) {
+    _mask = 0;
+    _last = RDS_ERT_SEGMENTS;
+    _message = 0;
+    _complete = false;
+    _text[0] = '\0';
+    _textlength = 0;
+    _textrtl = false;
+    _havetext = false;
+}
+
+bool RDSERTAssembler::addSegment(byte address, word message, word blockC,
+                                 word blockD) {
+    byte segment[RDS_ERT_SEGMENT_SIZE];
+    byte *slot;
+    uint32_t needed;
+
+    if(address >= RDS_ERT_SEGMENTS)
+        return false;
+
+    segment[0] = blockC >> 8;
+    segment[1] = blockC & 0xFF;
+    segment[2] = blockD >> 8;
+    segment[3] = blockD & 0xFF;
+    slot = &_raw[address * RDS_ERT_SEGMENT_SIZE];
+
+    //eRT has no A/B flag, a new message can only be told apart from a repeat
+    //of the current one by its contents.
+    if((message & RDS_ERT_MESSAGE_UTF8) != (_message & RDS_ERT_MESSAGE_UTF8) ||
+       ((_mask & (1UL << address)) &&
+        memcmp(slot, segment, RDS_ERT_SEGMENT_SIZE))) {
+        _mask = 0;
+        _last = RDS_ERT_SEGMENTS;
+        _complete = false;
+    };
+    _message = message;
+    memcpy(slot, segment, RDS_ERT_SEGMENT_SIZE);
+    _mask |= 1UL << address;
+
+    if(address < _last) {
+        if(message & RDS_ERT_MESSAGE_UTF8) {
+            if(memchr(segment, 0x0D, RDS_ERT_SEGMENT_SIZE))
+                _last = address;
+        } else if(blockC == 0x000D || blockD == 0x000D)
+            _last = address;
+    };
+
+    if(_complete)
+        return false;
+    needed = (_last < RDS_ERT_SEGMENTS - 1 ? (2UL << _last) - 1 : 0xFFFFFFFFUL);
+    if((_mask & needed) != needed)
+        return false;
+
+    _complete = true;
+    render();
+    if(_callback)
+        _callback(_text, _textlength, _textrtl);
+
+    return true;
+}
+
+const char *RDSERTAssembler::getText(word *length) {
+    if(!_havetext)
+        return NULL;
+    if(length)
+        *length = _textlength;
+
+    return _text;
+}
+
+void RDSERTAssembler::render(void) {
+    word out = 0;
+
+    if(_message & RDS_ERT_MESSAGE_UTF8) {
+        word end = 0;
+
+        while(end < RDS_ERT_SIZE && _raw[end] != 0x0D && _raw[end])
+            end++;
+        //Don't pass on a sequence cut short by the end of the buffer.
+        if(end == RDS_ERT_SIZE) {
+            word lead = end;
+
+            while(lead && (_raw[lead - 1] & 0xC0) == 0x80)
+                lead--;
+            if(lead && _raw[lead - 1] >= 0xC0) {
+                byte need = (_raw[lead - 1] >= 0xF0 ? 4 :
+                             (_raw[lead - 1] >= 0xE0 ? 3 : 2));
+
+                if(end - (lead - 1) < need)
+                    end = lead - 1;
+            };
+        };
+        memcpy(_text, _raw, end);
+        out = end;
+    } else {
+        for(word i = 0; i < RDS_ERT_SIZE; i += 2) {
+            word ucs = ((word)_raw[i] << 8) | _raw[i + 1];
+
+            if(ucs == 0x000D || !ucs)
+                break;
+            //UCS-2 has no surrogates, so these can only be errors.
+            if(ucs >= 0xD800 && ucs <= 0xDFFF)
+                ucs = 0xFFFD;
+            if(ucs < 0x80)
+                _text[out++] = ucs;
+            else if(ucs < 0x800) {
+                _text[out++] = 0xC0 | (ucs >> 6);
+                _text[out++] = 0x80 | (ucs & 0x3F);
+            } else {
+                _text[out++] = 0xE0 | (ucs >> 12);
+                _text[out++] = 0x80 | ((ucs >> 6) & 0x3F);
+                _text[out++] = 0x80 | (ucs & 0x3F);
+            };
+        };
+    };
+    _text[out] = '\0';
+    _textlength = out;
+    _textrtl = (bool)(_message & RDS_ERT_MESSAGE_RTL);
+    _havetext = true;
+}
+
+#endif
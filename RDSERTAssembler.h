@@ -0,0 +1,111 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This file contains the eRT (Enhanced RadioText) assembler: it collects the
+ * 32 segments of an eRT message in their native encoding (UCS-2 or UTF-8, as
+ * announced in group 3A), notices when the broadcaster starts a new message and
+ * hands out the complete text, once, as UTF-8. Only available in hosted
+ * builds, see RDS_CALLBACK_ERT for why.
+ */
+
+#ifndef _RDSERTASSEMBLER_H_INCLUDED
+#define _RDSERTASSEMBLER_H_INCLUDED
+
+#include "RDSDecoder.h"
+
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+
+//eRT is 32 segments of 4 bytes each
+#define RDS_ERT_SEGMENTS 32
+#define RDS_ERT_SEGMENT_SIZE 4
+#define RDS_ERT_SIZE (RDS_ERT_SEGMENTS * RDS_ERT_SEGMENT_SIZE)
+//Worst case UTF-8 size: 64 UCS-2 characters of 3 bytes each, plus the NUL
+#define RDS_ERT_TEXT_SIZE (RDS_ERT_SIZE / 2 * 3 + 1)
+
+//Called once per completed eRT message with the UTF-8 text, its length in
+//bytes and whether it is to be displayed right to left.
+typedef void (*TRDSERTCallback)(const char *, word, bool);
+
+class RDSERTAssembler
+{
+    public:
+        RDSERTAssembler(TRDSERTCallback callback = NULL);
+
+        /*
+        * Description:
+        *   Forgets the message being assembled as well as the last complete
+        *   one, use when switching to a new station. RDSDecoder does this on
+        *   its own for an attached assembler.
+        */
+        void reset(void);
+
+        /*
+        * Description:
+        *   Feeds one eRT group to the assembler. A segment that differs from
+        *   what was previously received at the same address, or a change of
+        *   encoding, means the broadcaster moved on to a new message and the
+        *   old one is discarded.
+        * Parameters:
+        *   address - the 5 bit segment address from block B.
+        *   message - the eRT ODA message from group 3A (see
+        *             RDSTranslator::unpackERTMessage3()).
+        *   blockC, blockD - the four bytes of the segment.
+        * Returns:
+        *   true if this segment completed a message, false otherwise.
+        */
+        bool addSegment(byte address, word message, word blockC, word blockD);
+
+        /*
+        * Description:
+        *   Returns the last complete message as NUL terminated UTF-8 (or NULL
+        *   if none is available yet). The text stays put until the next
+        *   message completes.
+        * Parameters:
+        *   length - optional pointer to a word receiving the length of the
+        *            text in bytes.
+        */
+        const char *getText(word *length = NULL);
+
+        /*
+        * Description:
+        *   Returns true if the last complete message is to be displayed right
+        *   to left.
+        */
+        bool isRTL(void) { return _textrtl; }
+
+        /*
+        * Description:
+        *   Returns the bitmap of segments received so far for the message
+        *   being assembled, LSB is segment 0.
+        */
+        uint32_t getSegmentMask(void) { return _mask; }
+
+    private:
+        TRDSERTCallback _callback;
+        //The message being assembled, as transmitted (big endian for UCS-2)
+        byte _raw[RDS_ERT_SIZE];
+        uint32_t _mask;
+        //Index of the first segment containing the end of message (CR), or
+        //RDS_ERT_SEGMENTS if none seen yet.
+        byte _last;
+        word _message;
+        bool _complete;
+        //The last complete message
+        char _text[RDS_ERT_TEXT_SIZE];
+        word _textlength;
+        bool _textrtl, _havetext;
+
+        /*
+        * Description:
+        *   Converts _raw to UTF-8 into _text, stopping at the end of message.
+        */
+        void render(void);
+};
+
+#endif
+#endif
@@ -0,0 +1,230 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This is the code file for the now-playing history.
+ * See the header file for better function documentation.
+ */
+
+#include "RDSHistory.h"
+
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+
+#include "RDSRTPlus.h"
+
+#include <string.h>
+
+#define RDS_HISTORY_FNV_BASIS 2166136261UL
+#define RDS_HISTORY_FNV_PRIME 16777619UL
+
+void RDSHistory::clear(void) {
+    for(byte i = 0; i < RDS_HISTORY_STATIONS; i++) {
+        _stations[i].programIdentifier = 0;
+        _stations[i].lastUsed = 0;
+        _stations[i].texts = 0;
+        _stations[i].items = 0;
+    };
+    _clock = 0;
+    _lastprevious = NULL;
+    _lastpi = 0;
+}
+
+RDSHistory::TRDSHistoryStation *RDSHistory::findStation(
+    word programIdentifier, bool create) {
+    TRDSHistoryStation *victim = NULL;
+
+    //PI 0 marks an unused slot.
+    if(!programIdentifier)
+        return NULL;
+    for(byte i = 0; i < RDS_HISTORY_STATIONS; i++) {
+        if(_stations[i].programIdentifier == programIdentifier) {
+            _stations[i].lastUsed = ++_clock;
+            return &_stations[i];
+        };
+        if(!victim || _stations[i].lastUsed < victim->lastUsed)
+            victim = &_stations[i];
+    };
+    if(!create)
+        return NULL;
+
+    victim->programIdentifier = programIdentifier;
+    victim->lastUsed = ++_clock;
+    victim->texts = 0;
+    victim->items = 0;
+
+    return victim;
+}
+
+word RDSHistory::convert(const char *text, byte length, char *buf,
+                         uint32_t *hash) {
+    RDSTranslator translator;
+    word size;
+
+    if(!text) {
+        buf[0] = '\0';
+        return 0;
+    };
+    while(length && *text == ' ') {
+        text++;
+        length--;
+    };
+    size = translator.convertToUTF8(text, length, buf, RDS_HISTORY_TEXT_SIZE);
+    while(size && buf[size - 1] == ' ')
+        buf[--size] = '\0';
+    for(word i = 0; i < size; i++)
+        *hash = (*hash ^ (byte)buf[i]) * RDS_HISTORY_FNV_PRIME;
+
+    return size;
+}
+
+bool RDSHistory::addText(word programIdentifier, const char *text,
+                         byte length, uint32_t timestamp) {
+    char buf[RDS_HISTORY_TEXT_SIZE];
+    uint32_t hash = RDS_HISTORY_FNV_BASIS;
+    TRDSHistoryStation *station;
+    TRDSHistoryText *entry;
+    byte slot;
+
+    if(!convert(text, length, buf, &hash))
+        return false;
+    station = findStation(programIdentifier, true);
+    if(!station)
+        return false;
+
+    for(byte i = 0; i < station->texts; i++)
+        if(station->textHash[i] == hash && !strcmp(station->text[i].text, buf)) {
+            station->text[i].lastSeen = timestamp;
+            if(station->text[i].count < 0xFFFF)
+                station->text[i].count++;
+            return false;
+        };
+
+    //Take the next free slot or, once full, the one seen the longest ago.
+    if(station->texts < RDS_HISTORY_ENTRIES)
+        slot = station->texts++;
+    else
+        for(byte i = slot = 0; i < RDS_HISTORY_ENTRIES; i++)
+            if(station->text[i].lastSeen < station->text[slot].lastSeen)
+                slot = i;
+    entry = &station->text[slot];
+    station->textHash[slot] = hash;
+    entry->firstSeen = entry->lastSeen = timestamp;
+    entry->count = 1;
+    strcpy(entry->text, buf);
+
+    return true;
+}
+
+bool RDSHistory::addItem(word programIdentifier, const char *artist,
+                         byte artistLength, const char *title,
+                         byte titleLength, uint32_t timestamp) {
+    char abuf[RDS_HISTORY_TEXT_SIZE], tbuf[RDS_HISTORY_TEXT_SIZE];
+    uint32_t hash = RDS_HISTORY_FNV_BASIS;
+    TRDSHistoryStation *station;
+    TRDSHistoryItem *entry;
+    byte slot;
+    word size;
+
+    size = convert(artist, artistLength, abuf, &hash);
+    //Separator, so that ("AB", "C") and ("A", "BC") hash differently.
+    hash = (hash ^ 0x1F) * RDS_HISTORY_FNV_PRIME;
+    size += convert(title, titleLength, tbuf, &hash);
+    if(!size)
+        return false;
+    station = findStation(programIdentifier, true);
+    if(!station)
+        return false;
+
+    for(byte i = 0; i < station->items; i++)
+        if(station->itemHash[i] == hash &&
+           !strcmp(station->item[i].artist, abuf) &&
+           !strcmp(station->item[i].title, tbuf)) {
+            station->item[i].lastSeen = timestamp;
+            if(station->item[i].count < 0xFFFF)
+                station->item[i].count++;
+            return false;
+        };
+
+    if(station->items < RDS_HISTORY_ENTRIES)
+        slot = station->items++;
+    else
+        for(byte i = slot = 0; i < RDS_HISTORY_ENTRIES; i++)
+            if(station->item[i].lastSeen < station->item[slot].lastSeen)
+                slot = i;
+    entry = &station->item[slot];
+    station->itemHash[slot] = hash;
+    entry->firstSeen = entry->lastSeen = timestamp;
+    entry->count = 1;
+    strcpy(entry->artist, abuf);
+    strcpy(entry->title, tbuf);
+
+    return true;
+}
+
+void RDSHistory::update(word programIdentifier, RDSDecoder *decoder,
+                        RDSRTPlus *rtplus, uint32_t timestamp) {
+    const char *previous;
+    byte length;
+
+    if(!decoder)
+        return;
+    previous = decoder->getRDSText(RDS_TEXT_RT_PREVIOUS, &length);
+    //The decoder swaps buffers on each A/B flip, so a new previous RT is a
+    //different pointer.
+    if(!previous || (previous == _lastprevious && programIdentifier == _lastpi))
+        return;
+    _lastprevious = previous;
+    _lastpi = programIdentifier;
+
+    addText(programIdentifier, previous, length, timestamp);
+    if(rtplus) {
+        const char *artist, *title;
+        byte artistLength = 0, titleLength = 0;
+
+        artist = rtplus->getPreviousItem(RDS_RTP_CLASS_ITEM_ARTIST,
+                                         &artistLength);
+        title = rtplus->getPreviousItem(RDS_RTP_CLASS_ITEM_TITLE,
+                                        &titleLength);
+        if(artist || title)
+            addItem(programIdentifier, artist, artistLength, title,
+                    titleLength, timestamp);
+    };
+}
+
+byte RDSHistory::getTextCount(word programIdentifier) {
+    TRDSHistoryStation *station = findStation(programIdentifier, false);
+
+    return station ? station->texts : 0;
+}
+
+byte RDSHistory::getItemCount(word programIdentifier) {
+    TRDSHistoryStation *station = findStation(programIdentifier, false);
+
+    return station ? station->items : 0;
+}
+
+const TRDSHistoryText *RDSHistory::getText(word programIdentifier,
+                                           byte index) {
+    TRDSHistoryStation *station = findStation(programIdentifier, false);
+
+    if(!station || index >= station->texts)
+        return NULL;
+
+    return &station->text[index];
+}
+
+const TRDSHistoryItem *RDSHistory::getItem(word programIdentifier,
+                                           byte index) {
+    TRDSHistoryStation *station = findStation(programIdentifier, false);
+
+    if(!station || index >= station->items)
+        return NULL;
+
+    return &station->item[index];
+}
+
+#endif
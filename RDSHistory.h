@@ -0,0 +1,151 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This file contains the now-playing history: a bounded, per-station record of
+ * the distinct RadioTexts and RT+ (artist, title) items heard, each with the
+ * time it was first and last seen and how many times it was repeated. Only
+ * available in hosted builds.
+ */
+
+#ifndef _RDSHISTORY_H_INCLUDED
+#define _RDSHISTORY_H_INCLUDED
+
+#include "RDSDecoder.h"
+
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+
+class RDSRTPlus;
+
+//How many stations to keep history for, least recently heard goes first
+#if !defined(RDS_HISTORY_STATIONS)
+# define RDS_HISTORY_STATIONS 16
+#endif
+//How many distinct texts (and items) to keep per station, least recently seen
+//goes first
+#if !defined(RDS_HISTORY_ENTRIES)
+# define RDS_HISTORY_ENTRIES 32
+#endif
+//Texts are kept as UTF-8, which takes at most 3 bytes per RDS character
+#define RDS_HISTORY_TEXT_SIZE (64 * 3 + 1)
+
+typedef struct {
+    uint32_t firstSeen, lastSeen;
+    word count;
+    char text[RDS_HISTORY_TEXT_SIZE];
+} TRDSHistoryText;
+
+typedef struct {
+    uint32_t firstSeen, lastSeen;
+    word count;
+    char artist[RDS_HISTORY_TEXT_SIZE];
+    char title[RDS_HISTORY_TEXT_SIZE];
+} TRDSHistoryItem;
+
+class RDSHistory
+{
+    public:
+        RDSHistory() { clear(); }
+
+        /*
+        * Description:
+        *   Forgets all history.
+        */
+        void clear(void);
+
+        /*
+        * Description:
+        *   Records one sighting of a RadioText. Leading and trailing spaces
+        *   are ignored and the text ends at the first CR, as usual; empty
+        *   texts are not recorded.
+        * Parameters:
+        *   programIdentifier - the station's PI.
+        *   text - the text, in the RDS character set.
+        *   length - its maximum length.
+        *   timestamp - the time of the sighting, in whatever unit the caller
+        *               likes (e.g. seconds since the UNIX epoch).
+        * Returns:
+        *   true if this text was not in the station's history yet.
+        */
+        bool addText(word programIdentifier, const char *text, byte length,
+                     uint32_t timestamp);
+
+        /*
+        * Description:
+        *   Same as addText(), for an RT+ item. Either of artist and title may
+        *   be NULL, but not both.
+        */
+        bool addItem(word programIdentifier, const char *artist,
+                     byte artistLength, const char *title, byte titleLength,
+                     uint32_t timestamp);
+
+        /*
+        * Description:
+        *   Convenience function meant to be called after each decoded group:
+        *   whenever the decoder has just retired a RadioText (A/B flip), that
+        *   text and (if an RT+ engine is given) the artist and title tagged in
+        *   it are recorded. Texts still being received are not, as they may be
+        *   incomplete.
+        */
+        void update(word programIdentifier, RDSDecoder *decoder,
+                    RDSRTPlus *rtplus, uint32_t timestamp);
+
+        /*
+        * Description:
+        *   Returns how many distinct texts (items) the station's history
+        *   holds, 0 if the station is not known.
+        */
+        byte getTextCount(word programIdentifier);
+        byte getItemCount(word programIdentifier);
+
+        /*
+        * Description:
+        *   Returns the index-th entry in the station's history, in no
+        *   particular order (sort on firstSeen or lastSeen as needed), or NULL
+        *   if there is no such entry.
+        */
+        const TRDSHistoryText *getText(word programIdentifier, byte index);
+        const TRDSHistoryItem *getItem(word programIdentifier, byte index);
+
+    private:
+        typedef struct {
+            word programIdentifier;
+            uint32_t lastUsed;
+            byte texts, items;
+            //Hashes live apart from the entries so that the search for a
+            //duplicate only touches a couple of cache lines.
+            uint32_t textHash[RDS_HISTORY_ENTRIES];
+            uint32_t itemHash[RDS_HISTORY_ENTRIES];
+            TRDSHistoryText text[RDS_HISTORY_ENTRIES];
+            TRDSHistoryItem item[RDS_HISTORY_ENTRIES];
+        } TRDSHistoryStation;
+
+        TRDSHistoryStation _stations[RDS_HISTORY_STATIONS];
+        uint32_t _clock;
+        const char *_lastprevious;
+        word _lastpi;
+
+        /*
+        * Description:
+        *   Finds the given station's history, creating it (in place of the
+        *   least recently used one) if create is true.
+        */
+        TRDSHistoryStation *findStation(word programIdentifier, bool create);
+
+        /*
+        * Description:
+        *   Converts length characters of RDS text to trimmed UTF-8 in buf,
+        *   folding it into hash (FNV-1a) as it goes.
+        * Returns:
+        *   the length of the result.
+        */
+        static word convert(const char *text, byte length, char *buf,
+                            uint32_t *hash);
+};
+
+#endif
+#endif
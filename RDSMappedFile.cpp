@@ -0,0 +1,94 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This is the code file for the read-only mapped file.
+ * See the header file for better function documentation.
+ */
+
+#include "RDSMappedFile.h"
+
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+RDSMappedFile::RDSMappedFile() {
+    _data = NULL;
+    _size = 0;
+}
+
+bool RDSMappedFile::open(const char *path, uint32_t magic, uint16_t version,
+                         uint16_t headerSize) {
+    const TRDSMappedFileHeader *header;
+    struct stat st;
+    int fd;
+
+    close();
+    if(!path || headerSize < sizeof(TRDSMappedFileHeader))
+        return false;
+
+    fd = ::open(path, O_RDONLY);
+    if(fd < 0)
+        return false;
+    if(fstat(fd, &st) || (size_t)st.st_size < headerSize) {
+        ::close(fd);
+        return false;
+    };
+
+    //The mapping outlives the descriptor, no need to keep it around.
+    void *map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if(map == MAP_FAILED)
+        return false;
+    _data = (const byte *)map;
+    _size = st.st_size;
+
+    header = (const TRDSMappedFileHeader *)_data;
+    if(header->magic != magic || header->version != version ||
+       header->headerSize != headerSize || header->size != _size) {
+        close();
+        return false;
+    };
+
+    return true;
+}
+
+void RDSMappedFile::close(void) {
+    if(_data)
+        munmap((void *)_data, _size);
+    _data = NULL;
+    _size = 0;
+}
+
+void RDSMappedFile::swap(RDSMappedFile &other) {
+    const byte *data = _data;
+    size_t size = _size;
+
+    _data = other._data;
+    _size = other._size;
+    other._data = data;
+    other._size = size;
+}
+
+const char *RDSMappedFile::getString(uint32_t pool, uint32_t poolSize,
+                                     uint32_t offset, byte *length) {
+    const byte *text = region(pool, poolSize);
+
+    //Length byte, text and NUL must all be inside the pool.
+    if(!text || offset >= poolSize || text[offset] + 2UL > poolSize - offset ||
+       text[offset + 1 + text[offset]])
+        return NULL;
+    if(length)
+        *length = text[offset];
+
+    return (const char *)&text[offset + 1];
+}
+
+#endif
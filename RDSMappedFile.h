@@ -0,0 +1,117 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This file contains the read-only mapped file used by the binary files
+ * gentables.py generates (ISO 14819-2 tables and language packs, ISO 14819-3
+ * location tables): mapping, checking the header they all start with, bounds
+ * checked access to regions of the file and lookups in length-prefixed string
+ * pools. Only available in hosted builds.
+ */
+
+#ifndef _RDSMAPPEDFILE_H_INCLUDED
+#define _RDSMAPPEDFILE_H_INCLUDED
+
+#include "RDSDecoder.h"
+
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+
+//What every file generated by gentables.py starts with, little endian like
+//the rest of the file. size is that of the whole file.
+typedef struct __attribute__ ((__packed__)) {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t headerSize;
+    uint32_t size;
+} TRDSMappedFileHeader;
+
+class RDSMappedFile
+{
+    public:
+        RDSMappedFile();
+        ~RDSMappedFile() { close(); }
+
+        /*
+        * Description:
+        *   Maps the file at path, read-only, and checks its header. Opening a
+        *   new file replaces the current one.
+        * Parameters:
+        *   path - the file to map.
+        *   magic, version - what the header must hold.
+        *   headerSize - the size of the whole header, of which
+        *                TRDSMappedFileHeader is the beginning.
+        * Returns:
+        *   true if the file is mapped, false otherwise (in which case none
+        *   is).
+        */
+        bool open(const char *path, uint32_t magic, uint16_t version,
+                  uint16_t headerSize);
+
+        /*
+        * Description:
+        *   Unmaps the file. Any pointers handed out before are invalid
+        *   afterwards.
+        */
+        void close(void);
+
+        /*
+        * Description:
+        *   Exchanges the mappings of two instances, which is how a mapping
+        *   changes hands since instances can't be copied.
+        */
+        void swap(RDSMappedFile &other);
+
+        /*
+        * Description:
+        *   Returns true if a file is currently mapped.
+        */
+        bool isOpen(void) { return _data != NULL; }
+
+        /*
+        * Description:
+        *   Returns the start of the mapped file (i.e. its header), or NULL if
+        *   none is mapped.
+        */
+        const byte *getData(void) { return _data; }
+
+        /*
+        * Description:
+        *   Returns a pointer to the region at the given offset of the mapped
+        *   file, or NULL if it doesn't fit in the file.
+        */
+        inline const byte *region(uint32_t offset, uint32_t size) {
+            return (offset <= _size && size <= _size - offset ?
+                    _data + offset : NULL);
+        }
+
+        /*
+        * Description:
+        *   Looks up a string in a pool in the format gentables.py writes
+        *   (length byte, text, NUL).
+        * Parameters:
+        *   pool, poolSize - where the pool is in the file, as checked with
+        *                    region() beforehand.
+        *   offset - offset of the string in the pool.
+        *   length - if not NULL, receives the length of the string.
+        * Returns:
+        *   the (NUL-terminated) string, straight out of the mapped file, or
+        *   NULL if it isn't all inside the pool.
+        */
+        const char *getString(uint32_t pool, uint32_t poolSize,
+                              uint32_t offset, byte *length);
+
+    private:
+        const byte *_data;
+        size_t _size;
+
+        //Copies would unmap the same file twice, use swap() instead.
+        RDSMappedFile(const RDSMappedFile &);
+        RDSMappedFile &operator=(const RDSMappedFile &);
+};
+
+#endif
+#endif
@@ -0,0 +1,103 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This is the code file for the RT+ tag engine.
+ * See the header file for better function documentation.
+ */
+
+#include "RDSRTPlus.h"
+#include "RDSDecoder-private.h"
+
+#include <string.h>
+
+//RDS_RTP_CLASS_ITEM_TITLE through RDS_RTP_CLASS_ITEM_GENRE
+#define RDS_RTP_ITEM_TAGS 0x0000000000000FFEULL
+
+void RDSRTPlus::reset(const char *text) {
+    _text = text;
+    _prevtext = NULL;
+    _tags = 0;
+    _prevtags = 0;
+    _toggle = false;
+    _running = false;
+    _havetoggle = false;
+}
+
+void RDSRTPlus::textChanged(const char *text) {
+    memcpy(_prevstart, _start, sizeof(_start));
+    memcpy(_prevlength, _length, sizeof(_length));
+    _prevtags = _tags;
+    _prevtext = _text;
+    _text = text;
+    _tags = 0;
+}
+
+void RDSRTPlus::addGroup(byte fiveBits, word blockC, word blockD,
+                         word message) {
+    TRDSRTPlusMessage11 unpacked;
+    RDSTranslator translator;
+
+    if(message & RDS_RTP_MESSAGE_ERT)
+        return;
+
+    translator.unpackRTPlusMessage11(fiveBits, blockC, blockD, &unpacked);
+    if(_havetoggle && (unpacked.itemToggle != _toggle ||
+                       unpacked.itemRunning != _running))
+        //New (or no) programme item, what we know about the old one is stale.
+        _tags &= ~RDS_RTP_ITEM_TAGS;
+    _toggle = unpacked.itemToggle;
+    _running = unpacked.itemRunning;
+    _havetoggle = true;
+
+    //Length markers count the characters after the first one.
+    setTag(unpacked.contentType1, unpacked.startMarker1,
+           unpacked.lengthMarker1 + 1);
+    setTag(unpacked.contentType2, unpacked.startMarker2,
+           unpacked.lengthMarker2 + 1);
+}
+
+void RDSRTPlus::setTag(byte contentType, byte start, byte length) {
+    if(contentType == RDS_RTP_CLASS_DUMMY || contentType >= RDS_RTP_CLASSES)
+        return;
+    if((word)start + length > 64)
+        return;
+
+    _start[contentType] = start;
+    _length[contentType] = length;
+    _tags |= 1ULL << contentType;
+}
+
+bool RDSRTPlus::getTag(byte contentType, byte *start, byte *length) {
+    if(contentType >= RDS_RTP_CLASSES || !(_tags & (1ULL << contentType)))
+        return false;
+    if(start)
+        *start = _start[contentType];
+    if(length)
+        *length = _length[contentType];
+
+    return true;
+}
+
+const char *RDSRTPlus::getItem(byte contentType, byte *length) {
+    byte start;
+
+    if(!_text || !getTag(contentType, &start, length))
+        return NULL;
+
+    return &_text[start];
+}
+
+const char *RDSRTPlus::getPreviousItem(byte contentType, byte *length) {
+    if(!_prevtext || contentType >= RDS_RTP_CLASSES ||
+       !(_prevtags & (1ULL << contentType)))
+        return NULL;
+    if(length)
+        *length = _prevlength[contentType];
+
+    return &_prevtext[_prevstart[contentType]];
+}
@@ -0,0 +1,124 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This file contains the RT+ tag engine: it applies the content type, start
+ * and length markers carried in the RT+ ODA group to the RadioText being
+ * received by RDSDecoder and hands out the tagged items as views into it.
+ */
+
+#ifndef _RDSRTPLUS_H_INCLUDED
+#define _RDSRTPLUS_H_INCLUDED
+
+#include "RDSDecoder.h"
+
+//Number of RT+ content types, see RDS_RTP_CLASS_*
+#define RDS_RTP_CLASSES 64
+
+class RDSRTPlus
+{
+    public:
+        RDSRTPlus() { reset(); }
+
+        /*
+        * Description:
+        *   Forgets all tags and the item toggle/running state and (re)binds
+        *   the engine to the given RadioText buffer. RDSDecoder does this on
+        *   its own on each station change for an attached engine.
+        * Parameters:
+        *   text - the 64 character RadioText buffer the tags refer to.
+        */
+        void reset(const char *text = NULL);
+
+        /*
+        * Description:
+        *   Feeds one RT+ group (as carried in the group announced in 3A) to
+        *   the engine. Tags of type RDS_RTP_CLASS_DUMMY and tags that don't fit
+        *   in the RadioText are ignored, as are all tags if the RT+ ODA message
+        *   says they refer to eRT instead.
+        * Parameters:
+        *   fiveBits - the five LSBs of block B.
+        *   blockC, blockD - blocks C and D.
+        *   message - the RT+ ODA message from group 3A.
+        */
+        void addGroup(byte fiveBits, word blockC, word blockD, word message);
+
+        /*
+        * Description:
+        *   Tells the engine the RadioText it was tagging has been replaced
+        *   (A/B flip). The current tags move to the previous set, still
+        *   pointing into the outgoing RadioText which RDSDecoder keeps
+        *   around, and tagging starts over on the new one.
+        * Parameters:
+        *   text - the RadioText buffer that is current from now on.
+        */
+        void textChanged(const char *text);
+
+        /*
+        * Description:
+        *   Returns the position of the given content type in the RadioText.
+        * Parameters:
+        *   contentType - one of the RDS_RTP_CLASS_* constants.
+        *   start - optional pointer to a byte receiving the first character.
+        *   length - optional pointer to a byte receiving the length.
+        * Returns:
+        *   true if the content type is currently tagged, false otherwise.
+        */
+        bool getTag(byte contentType, byte *start = NULL, byte *length = NULL);
+
+        /*
+        * Description:
+        *   Same as getTag(), but returns a pointer straight into the
+        *   RadioText buffer. The item is not terminated, use length. The view
+        *   reflects the raw (not printable) RadioText and its contents change
+        *   as the RadioText does.
+        * Returns:
+        *   pointer to the first character of the item or NULL if the content
+        *   type is not currently tagged.
+        */
+        const char *getItem(byte contentType, byte *length);
+
+        /*
+        * Description:
+        *   Same as getItem(), for the tags that applied to the previous
+        *   RadioText (see RDSDecoder::getPreviousRT()). Handy for catching the
+        *   title of the song that just ended.
+        */
+        const char *getPreviousItem(byte contentType, byte *length);
+
+        /*
+        * Description:
+        *   Returns the bitmap of currently tagged content types, bit N being
+        *   content type N.
+        */
+        uint64_t getTags(void) { return _tags; }
+        uint64_t getPreviousTags(void) { return _prevtags; }
+
+        /*
+        * Description:
+        *   Item toggle and item running bits, as last received. The toggle
+        *   flips whenever a new programme item starts; any change in either of
+        *   them discards all item (RDS_RTP_CLASS_ITEM_*) tags.
+        */
+        bool getItemToggle(void) { return _toggle; }
+        bool isItemRunning(void) { return _running; }
+
+    private:
+        const char *_text, *_prevtext;
+        byte _start[RDS_RTP_CLASSES], _length[RDS_RTP_CLASSES];
+        byte _prevstart[RDS_RTP_CLASSES], _prevlength[RDS_RTP_CLASSES];
+        uint64_t _tags, _prevtags;
+        bool _toggle, _running, _havetoggle;
+
+        /*
+        * Description:
+        *   Records one tag, if valid.
+        */
+        void setTag(byte contentType, byte start, byte length);
+};
+
+#endif
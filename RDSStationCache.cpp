@@ -0,0 +1,196 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This is the code file for the persistent station cache.
+ * See the header file for better function documentation.
+ */
+
+#include "RDSStationCache.h"
+
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+RDSStationCache::RDSStationCache() {
+    _header = NULL;
+    _records = NULL;
+    _size = 0;
+    _fd = -1;
+}
+
+bool RDSStationCache::open(const char *path, word slots) {
+    struct stat st;
+
+    close();
+    if(!(path && slots))
+        return false;
+
+    _fd = ::open(path, O_RDWR | O_CREAT, 0644);
+    if(_fd < 0)
+        return false;
+    if(fstat(_fd, &st)) {
+        close();
+        return false;
+    };
+
+    //An existing file dictates its own geometry, if it's a sane one.
+    if((size_t)st.st_size >= sizeof(TRDSStationCacheHeader)) {
+        TRDSStationCacheHeader existing;
+
+        if(pread(_fd, &existing, sizeof(existing), 0) == sizeof(existing) &&
+           existing.magic == RDS_STATION_CACHE_MAGIC &&
+           existing.version == RDS_STATION_CACHE_VERSION &&
+           existing.recordSize == sizeof(TRDSStationRecord) &&
+           existing.slots &&
+           (size_t)st.st_size == sizeof(TRDSStationCacheHeader) +
+                                 existing.slots * sizeof(TRDSStationRecord))
+            slots = existing.slots;
+    };
+
+    _size = sizeof(TRDSStationCacheHeader) +
+            slots * sizeof(TRDSStationRecord);
+    if((size_t)st.st_size != _size && ftruncate(_fd, _size)) {
+        close();
+        return false;
+    };
+
+    void *map = mmap(NULL, _size, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+    if(map == MAP_FAILED) {
+        close();
+        return false;
+    };
+    _header = (TRDSStationCacheHeader *)map;
+    _records = (TRDSStationRecord *)(_header + 1);
+
+    if(_header->magic != RDS_STATION_CACHE_MAGIC ||
+       _header->version != RDS_STATION_CACHE_VERSION ||
+       _header->recordSize != sizeof(TRDSStationRecord) ||
+       _header->slots != slots) {
+        //Fresh (or foreign) file: start over.
+        memset(map, 0x00, _size);
+        _header->magic = RDS_STATION_CACHE_MAGIC;
+        _header->version = RDS_STATION_CACHE_VERSION;
+        _header->recordSize = sizeof(TRDSStationRecord);
+        _header->slots = slots;
+    };
+
+    return true;
+}
+
+void RDSStationCache::close(void) {
+    if(_header) {
+        msync(_header, _size, MS_ASYNC);
+        munmap(_header, _size);
+    };
+    if(_fd >= 0)
+        ::close(_fd);
+    _header = NULL;
+    _records = NULL;
+    _size = 0;
+    _fd = -1;
+}
+
+TRDSStationRecord *RDSStationCache::lookup(word programIdentifier,
+                                           byte extendedCountryCode) {
+    if(!(_records && programIdentifier))
+        return NULL;
+
+    word slot = homeSlot(programIdentifier);
+    for(byte i = 0; i < RDS_STATION_CACHE_PROBES; i++) {
+        TRDSStationRecord *record = &_records[slot];
+
+        //Records are never deleted, only overwritten, so the first empty slot
+        //ends the probe sequence.
+        if(!record->programIdentifier)
+            return NULL;
+        if(record->programIdentifier == programIdentifier &&
+           (!extendedCountryCode || !record->extendedCountryCode ||
+            record->extendedCountryCode == extendedCountryCode))
+            return record;
+        if(++slot == _header->slots)
+            slot = 0;
+    };
+
+    return NULL;
+}
+
+TRDSStationRecord *RDSStationCache::store(const TRDSData *rdsdata) {
+    if(!(_records && rdsdata && rdsdata->programIdentifier))
+        return NULL;
+
+    TRDSStationRecord *record = lookup(rdsdata->programIdentifier,
+                                       rdsdata->extendedCountryCode);
+
+    if(!record) {
+        word slot = homeSlot(rdsdata->programIdentifier);
+
+        //Take the first free slot or else evict the least recently seen.
+        for(byte i = 0; i < RDS_STATION_CACHE_PROBES; i++) {
+            TRDSStationRecord *candidate = &_records[slot];
+
+            if(!candidate->programIdentifier) {
+                record = candidate;
+                break;
+            };
+            if(!record || candidate->lastSeen < record->lastSeen)
+                record = candidate;
+            if(++slot == _header->slots)
+                slot = 0;
+        };
+        memset(record, 0x00, sizeof(TRDSStationRecord));
+        record->programIdentifier = rdsdata->programIdentifier;
+    };
+
+    if(rdsdata->extendedCountryCode)
+        record->extendedCountryCode = rdsdata->extendedCountryCode;
+    record->PTY = rdsdata->PTY;
+    record->TP = rdsdata->TP;
+    record->MS = rdsdata->MS;
+    record->DICC = rdsdata->DICC;
+    if(rdsdata->languageCode)
+        record->languageCode = rdsdata->languageCode;
+    if(rdsdata->tmcIdentification)
+        record->tmcIdentification = rdsdata->tmcIdentification;
+    memcpy(record->programService, rdsdata->programService,
+           sizeof(record->programService));
+    touch(record);
+
+    return record;
+}
+
+void RDSStationCache::addAlternativeFrequency(TRDSStationRecord *record,
+                                              byte AF) {
+    if(!record)
+        return;
+    //Only codes 1-204 are FM frequencies, the rest are fillers, counts and
+    //band switches, see RDS §3.2.1.6.1.
+    if(AF < 1 || AF > 204)
+        return;
+
+    for(byte i = 0; i < record->afCount; i++)
+        if(record->alternativeFrequencies[i] == AF)
+            return;
+    if(record->afCount < RDS_STATION_MAX_AF)
+        record->alternativeFrequencies[record->afCount++] = AF;
+}
+
+void RDSStationCache::touch(TRDSStationRecord *record) {
+    if(record && _header)
+        record->lastSeen = ++_header->clock;
+}
+
+void RDSStationCache::sync(void) {
+    if(_header)
+        msync(_header, _size, MS_ASYNC);
+}
+
+#endif
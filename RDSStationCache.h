@@ -0,0 +1,135 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This file contains the persistent station cache: a memory-mapped file keyed
+ * by PI (and ECC, where known) that remembers the slow-to-acquire parts of a
+ * station's RDS data across restarts. Only available in hosted builds.
+ */
+
+#ifndef _RDSSTATIONCACHE_H_INCLUDED
+#define _RDSSTATIONCACHE_H_INCLUDED
+
+#include "RDSDecoder.h"
+
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+
+//Default number of records in a newly created cache file
+#define RDS_STATION_CACHE_SLOTS 1024
+//How many consecutive slots a station may end up in, see lookup()
+#define RDS_STATION_CACHE_PROBES 8
+#define RDS_STATION_CACHE_MAGIC 0x43534452UL // "RDSC"
+#define RDS_STATION_CACHE_VERSION 1
+
+typedef struct __attribute__ ((__packed__)) {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t recordSize;
+    uint16_t slots;
+    uint16_t reserved;
+    uint32_t clock;
+} TRDSStationCacheHeader;
+
+class RDSStationCache
+{
+    public:
+        RDSStationCache();
+        ~RDSStationCache() { close(); }
+
+        /*
+        * Description:
+        *   Maps the cache file at path, creating it (with room for slots
+        *   stations) if it doesn't exist. A file that is unreadable, of the
+        *   wrong version or of the wrong size is reinitialized rather than
+        *   trusted.
+        * Returns:
+        *   true if the cache is ready for use, false otherwise.
+        */
+        bool open(const char *path, word slots = RDS_STATION_CACHE_SLOTS);
+
+        /*
+        * Description:
+        *   Flushes and unmaps the cache file. Any record pointers handed out
+        *   before are invalid afterwards.
+        */
+        void close(void);
+
+        /*
+        * Description:
+        *   Returns true if a cache file is currently mapped.
+        */
+        bool isOpen(void) { return _records != NULL; }
+
+        /*
+        * Description:
+        *   Finds the record of the station with the given PI. If an ECC is
+        *   given, records with a different (known) ECC are skipped, as they
+        *   belong to a station in another country that happens to use the same
+        *   PI.
+        * Returns:
+        *   pointer to the record (inside the mapped file) or NULL.
+        */
+        TRDSStationRecord *lookup(word programIdentifier,
+                                  byte extendedCountryCode = 0x00);
+
+        /*
+        * Description:
+        *   Writes everything known about the station in rdsdata to the cache,
+        *   creating its record (possibly evicting the least recently seen one
+        *   it collides with) if needed.
+        * Returns:
+        *   pointer to the record (inside the mapped file) or NULL if the cache
+        *   isn't open.
+        */
+        TRDSStationRecord *store(const TRDSData *rdsdata);
+
+        /*
+        * Description:
+        *   Adds an AF code to the record's AF list, unless already present or
+        *   not an FM frequency code.
+        */
+        void addAlternativeFrequency(TRDSStationRecord *record, byte AF);
+
+        /*
+        * Description:
+        *   Marks the record as having been seen just now, for the benefit of
+        *   the eviction policy.
+        */
+        void touch(TRDSStationRecord *record);
+
+        /*
+        * Description:
+        *   Schedules the dirty pages of the cache file to be written to disk.
+        *   The kernel does this on its own eventually, so calling this is only
+        *   needed to bound how much can be lost in a power failure.
+        */
+        void sync(void);
+
+    private:
+        TRDSStationCacheHeader *_header;
+        TRDSStationRecord *_records;
+        size_t _size;
+        int _fd;
+
+        /*
+        * Description:
+        *   Returns the first slot a station with the given PI may live in.
+        *   Consecutive PIs are common (regional variants of the same network)
+        *   so scatter them a bit.
+        */
+        inline word homeSlot(word programIdentifier) {
+            return (word)(((uint32_t)programIdentifier * 40503UL) >> 4) %
+                   _header->slots;
+        }
+
+        //Copies would unmap and close the same file twice.
+        RDSStationCache(const RDSStationCache &);
+        RDSStationCache &operator=(const RDSStationCache &);
+};
+
+#endif
+#endif
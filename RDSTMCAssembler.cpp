@@ -0,0 +1,122 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This is the code file for the TMC message assembler.
+ * See the header file for better function documentation.
+ */
+
+#include "RDSTMCAssembler.h"
+
+#include <string.h>
+
+//The second group says how many more will follow
+#define RDS_TMC_GSI_UNKNOWN 0xFF
+
+RDSTMCAssembler::RDSTMCAssembler(uint32_t timeout) {
+    _timeout = timeout;
+    _aborted = 0;
+    reset();
+}
+
+void RDSTMCAssembler::reset(void) {
+    for(byte i = 0; i < RDS_TMC_CI_SLOTS; i++)
+        _slots[i].active = false;
+}
+
+bool RDSTMCAssembler::addGroup(byte tmcXbits, word tmcYbits, word tmcZbits,
+                               uint32_t timestamp,
+                               TRDSTMCUserMessage *message) {
+    TRDSTMCMessage8 unpacked;
+    TRDSTMCAssemblerSlot *slot;
+    RDSTranslator translator;
+
+    if(!message)
+        return false;
+
+    translator.unpackTMCMessage8(tmcXbits, tmcYbits, tmcZbits, &unpacked);
+    if(unpacked.systemMessage)
+        return false;
+    if(unpacked.single) {
+        memset(message, 0x00, sizeof(TRDSTMCUserMessage));
+        message->single = true;
+        message->duration = unpacked.duration;
+        message->diversion = unpacked.diversion;
+        message->direction = unpacked.direction;
+        message->extent = unpacked.extent;
+        message->event = unpacked.event;
+        message->location = unpacked.location;
+
+        return true;
+    };
+    if(unpacked.continuationIndicator < RDS_TMC_CI_FIRST ||
+       unpacked.continuationIndicator > RDS_TMC_CI_LAST)
+        return false;
+
+    slot = &_slots[unpacked.continuationIndicator - RDS_TMC_CI_FIRST];
+    if(slot->active && timestamp - slot->started > _timeout) {
+        slot->active = false;
+        _aborted++;
+    };
+
+    if(unpacked.first) {
+        //Messages are sent whole and repeated, so a repeated first group is
+        //just that.
+        if(slot->active && slot->lastY == tmcYbits && slot->lastZ == tmcZbits)
+            return false;
+        if(slot->active)
+            _aborted++;
+        memset(&slot->message, 0x00, sizeof(TRDSTMCUserMessage));
+        slot->message.continuityIndex = unpacked.continuationIndicator;
+        slot->message.direction = unpacked.direction;
+        slot->message.extent = unpacked.extent;
+        slot->message.event = unpacked.event;
+        slot->message.location = unpacked.location;
+        slot->nextSequence = RDS_TMC_GSI_UNKNOWN;
+        slot->lastY = tmcYbits;
+        slot->lastZ = tmcZbits;
+        slot->started = timestamp;
+        slot->active = true;
+
+        return false;
+    };
+
+    if(!slot->active)
+        //Missed the start of this one.
+        return false;
+    if(slot->lastY == tmcYbits && slot->lastZ == tmcZbits)
+        return false;
+    if(unpacked.second != (slot->nextSequence == RDS_TMC_GSI_UNKNOWN) ||
+       (!unpacked.second && unpacked.sequence != slot->nextSequence) ||
+       slot->message.slices == RDS_TMC_MAX_SLICES) {
+        //Lost a group somewhere.
+        slot->active = false;
+        _aborted++;
+        return false;
+    };
+
+    slot->message.container[slot->message.slices++] = unpacked.data;
+    slot->lastY = tmcYbits;
+    slot->lastZ = tmcZbits;
+    if(unpacked.sequence) {
+        slot->nextSequence = unpacked.sequence - 1;
+        return false;
+    };
+
+    complete(slot, message);
+
+    return true;
+}
+
+void RDSTMCAssembler::complete(TRDSTMCAssemblerSlot *slot,
+                               TRDSTMCUserMessage *message) {
+    RDSTranslator translator;
+
+    slot->active = false;
+    translator.glueTMCContainerSlices(slot->message.container);
+    *message = slot->message;
+}
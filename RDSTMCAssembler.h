@@ -0,0 +1,113 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This file contains the TMC message assembler: it takes raw 8A (or whatever
+ * group TMC is carried in) payloads and puts multi-group messages back
+ * together, one slot per continuity index, as per ISO 14819-1 §7.6. Complete
+ * messages, single- and multi-group alike, come out in one uniform format.
+ */
+
+#ifndef _RDSTMCASSEMBLER_H_INCLUDED
+#define _RDSTMCASSEMBLER_H_INCLUDED
+
+#include "RDSDecoder.h"
+
+//Continuity indexes 1-6 identify multi-group messages being transmitted; 0 is
+//for encryption administration and 7 for single-group messages.
+#define RDS_TMC_CI_FIRST 1
+#define RDS_TMC_CI_LAST 6
+#define RDS_TMC_CI_SLOTS (RDS_TMC_CI_LAST - RDS_TMC_CI_FIRST + 1)
+//A multi-group message has at most 4 groups after the first one
+#define RDS_TMC_MAX_SLICES 4
+//Default time to wait for the rest of a multi-group message, in ms. TMC
+//services send up to about 3 groups per second and interleave messages.
+#define RDS_TMC_ASSEMBLER_TIMEOUT 5000UL
+
+//One complete TMC user message.
+typedef struct {
+    bool single;
+    //Single-group messages only, multi-group ones carry it in the container
+    byte duration;
+    //Multi-group messages only
+    byte continuityIndex;
+    bool diversion;
+    bool direction;
+    byte extent;
+    word event;
+    word location;
+    //How many groups followed the first one (0 for single-group messages),
+    //and their glued together payload (see glueTMCContainerSlices()).
+    byte slices;
+    uint32_t container[RDS_TMC_MAX_SLICES];
+} TRDSTMCUserMessage;
+
+class RDSTMCAssembler
+{
+    public:
+        RDSTMCAssembler(uint32_t timeout = RDS_TMC_ASSEMBLER_TIMEOUT);
+
+        /*
+        * Description:
+        *   Discards all partially received messages.
+        */
+        void reset(void);
+
+        /*
+        * Description:
+        *   Feeds one TMC group to the assembler, e.g. from within the
+        *   RDS_CALLBACK_TMC callback. System messages (tuning information and
+        *   friends) and encryption administration groups are not user
+        *   messages and are ignored. A continuation group that doesn't match
+        *   the group sequence (GSI) the assembler expects aborts the message
+        *   in that slot, as does a first group before the previous message
+        *   was complete; repeats of the last group received are ignored.
+        * Parameters:
+        *   tmcXbits, tmcYbits, tmcZbits - the TMC payload as passed to
+        *                                  RDS_CALLBACK_TMC.
+        *   timestamp - the current time in ms, used to discard messages that
+        *               took more than the timeout to complete.
+        *   message - pointer to a TRDSTMCUserMessage to be filled in if this
+        *             group completed a message.
+        * Returns:
+        *   true if message was filled in, false otherwise.
+        */
+        bool addGroup(byte tmcXbits, word tmcYbits, word tmcZbits,
+                      uint32_t timestamp, TRDSTMCUserMessage *message);
+
+        /*
+        * Description:
+        *   Returns how many multi-group messages were aborted, either because
+        *   of a broken group sequence or because they timed out. Useful for
+        *   judging reception quality.
+        */
+        word getAborted(void) { return _aborted; }
+
+    private:
+        typedef struct {
+            bool active;
+            //GSI expected in the next group, or 0xFF if the next one is the
+            //second group (which carries the total)
+            byte nextSequence;
+            word lastY, lastZ;
+            uint32_t started;
+            TRDSTMCUserMessage message;
+        } TRDSTMCAssemblerSlot;
+
+        TRDSTMCAssemblerSlot _slots[RDS_TMC_CI_SLOTS];
+        uint32_t _timeout;
+        word _aborted;
+
+        /*
+        * Description:
+        *   Finishes the message in slot: glues the container and copies it
+        *   out.
+        */
+        void complete(TRDSTMCAssemblerSlot *slot, TRDSTMCUserMessage *message);
+};
+
+#endif
@@ -0,0 +1,164 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This is the code file for the TMC extent engine.
+ * See the header file for better function documentation.
+ */
+
+#include "RDSTMCExtents.h"
+
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+
+#include "RDSTMCLocations.h"
+
+RDSTMCExtents::RDSTMCExtents() {
+    _codes = NULL;
+    _count = 0;
+    for(byte d = 0; d < 2; d++) {
+        for(byte l = 0; l < RDS_TMC_EXTENT_LEVELS; l++)
+            _jump[d][l] = NULL;
+        _reach[d] = NULL;
+    };
+}
+
+bool RDSTMCExtents::build(RDSTMCLocations *locations, byte country,
+                          byte table) {
+    const TRDSTMCLocation *records;
+    uint32_t count;
+
+    clear();
+    if(!locations)
+        return false;
+    records = locations->getLocations(country, table, &count);
+    if(!records)
+        return false;
+
+    //Location codes are 16 bit, so are positions.
+    _count = count;
+    _codes = new uint16_t[count];
+    for(uint32_t i = 0; i < count; i++)
+        _codes[i] = records[i].code;
+
+    for(byte d = 0; d < 2; d++) {
+        for(byte l = 0; l < RDS_TMC_EXTENT_LEVELS; l++)
+            _jump[d][l] = new uint16_t[count];
+        _reach[d] = new byte[count];
+
+        //The end of the road (or an offset to nowhere) leads to itself.
+        for(uint32_t i = 0; i < count; i++) {
+            uint32_t next;
+
+            if(!locate(d ? records[i].positive : records[i].negative, &next))
+                next = i;
+            _jump[d][0][i] = next;
+        };
+        for(byte l = 1; l < RDS_TMC_EXTENT_LEVELS; l++)
+            for(uint32_t i = 0; i < count; i++)
+                _jump[d][l][i] = _jump[d][l - 1][_jump[d][l - 1][i]];
+
+        //Count steps until stuck, circular roads never get stuck. A walk
+        //never gets unstuck, so the number of steps before it does is found
+        //by binary descent on the jump tables, like any other extent.
+        for(uint32_t i = 0; i < count; i++) {
+            uint32_t at = i;
+            byte reach = 0;
+
+            if(_jump[d][0][i] != i) {
+                for(byte l = RDS_TMC_EXTENT_LEVELS; l--; ) {
+                    uint32_t next = _jump[d][l][at];
+
+                    if(_jump[d][0][next] != next) {
+                        at = next;
+                        reach += 1 << l;
+                    };
+                };
+                //One more step gets stuck, unless the cap came first.
+                if(reach < RDS_TMC_EXTENT_MAX)
+                    reach++;
+            };
+            _reach[d][i] = reach;
+        };
+    };
+
+    return true;
+}
+
+void RDSTMCExtents::clear(void) {
+    delete[] _codes;
+    _codes = NULL;
+    _count = 0;
+    for(byte d = 0; d < 2; d++) {
+        for(byte l = 0; l < RDS_TMC_EXTENT_LEVELS; l++) {
+            delete[] _jump[d][l];
+            _jump[d][l] = NULL;
+        };
+        delete[] _reach[d];
+        _reach[d] = NULL;
+    };
+}
+
+word RDSTMCExtents::findEnd(word code, byte extent, bool positive,
+                            byte *steps) {
+    uint32_t at;
+
+    if(!locate(code, &at))
+        return 0;
+    if(extent > RDS_TMC_EXTENT_MAX)
+        extent = RDS_TMC_EXTENT_MAX;
+    if(extent > _reach[positive][at])
+        extent = _reach[positive][at];
+    if(steps)
+        *steps = extent;
+
+    for(byte l = 0; extent; l++, extent >>= 1)
+        if(extent & 0x01)
+            at = _jump[positive][l][at];
+
+    return _codes[at];
+}
+
+byte RDSTMCExtents::getExtent(word code, byte extent, bool positive,
+                              word *codes, byte capacity) {
+    uint32_t at;
+    byte count = 0;
+
+    if(!(codes && capacity && locate(code, &at)))
+        return 0;
+    if(extent > _reach[positive][at])
+        extent = _reach[positive][at];
+
+    codes[count++] = code;
+    while(count <= extent && count < capacity) {
+        at = _jump[positive][0][at];
+        codes[count++] = _codes[at];
+    };
+
+    return count;
+}
+
+bool RDSTMCExtents::locate(word code, uint32_t *index) {
+    uint32_t low = 0, high = _count;
+
+    if(!code)
+        return false;
+    while(low < high) {
+        uint32_t middle = low + (high - low) / 2;
+
+        if(_codes[middle] < code)
+            low = middle + 1;
+        else
+            high = middle;
+    };
+    if(low == _count || _codes[low] != code)
+        return false;
+    *index = low;
+
+    return true;
+}
+
+#endif
@@ -0,0 +1,110 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This file contains the TMC extent engine: given a location and an extent,
+ * finds the other end of the stretch of road a message applies to. Walking the
+ * offsets of the location table (see RDSTMCLocations.h) takes up to 31 steps
+ * per message (55 with RDS_TMC_L1_EXTENT_ADD8/ADD16), each one a table lookup;
+ * this precomputes, once per table, where 1, 2, 4, ... 32 steps lead from each
+ * location (binary lifting) so that any extent resolves in a handful of array
+ * reads. Only available in hosted builds.
+ */
+
+#ifndef _RDSTMCEXTENTS_H_INCLUDED
+#define _RDSTMCEXTENTS_H_INCLUDED
+
+#include "RDSDecoder.h"
+
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+
+//Jump table levels, enough for any extent up to RDS_TMC_EXTENT_MAX
+#define RDS_TMC_EXTENT_LEVELS 6
+#define RDS_TMC_EXTENT_MAX ((1 << RDS_TMC_EXTENT_LEVELS) - 1)
+
+class RDSTMCLocations;
+
+class RDSTMCExtents
+{
+    public:
+        RDSTMCExtents();
+        ~RDSTMCExtents() { clear(); }
+
+        /*
+        * Description:
+        *   Builds the jump tables for one location table. The engine keeps
+        *   its own copy of everything it needs, so the location table may be
+        *   closed afterwards; rebuild when it is replaced. Takes O(n log n)
+        *   time and about 28 bytes per location.
+        * Parameters:
+        *   locations - the location tables to take the table from.
+        *   country - the country code of the table.
+        *   table - the location table number.
+        * Returns:
+        *   true on success, false if the table isn't open (in which case the
+        *   engine is left empty).
+        */
+        bool build(RDSTMCLocations *locations, byte country, byte table);
+
+        /*
+        * Description:
+        *   Frees the jump tables.
+        */
+        void clear(void);
+
+        /*
+        * Description:
+        *   Finds the far end of an extent, i.e. the secondary location of a
+        *   message.
+        * Parameters:
+        *   code - the (primary) location code.
+        *   extent - the number of steps, at most RDS_TMC_EXTENT_MAX. For
+        *            multi-group messages, add the extentIncrement of the
+        *            decoded labels (see RDSTranslator::decodeTMCLabels()).
+        *   positive - true to follow positive offsets, false for negative
+        *              ones.
+        *   steps - if not NULL, receives the number of steps actually taken,
+        *           less than extent if the road ended before.
+        * Returns:
+        *   the code of the location reached, 0 if code isn't in the table.
+        */
+        word findEnd(word code, byte extent, bool positive,
+                     byte *steps = NULL);
+
+        /*
+        * Description:
+        *   Lists the locations covered by an extent, from code onwards, same
+        *   parameters as findEnd().
+        * Parameters:
+        *   codes - an array receiving the location codes, code itself first.
+        *   capacity - the number of elements in codes, extent + 1 is always
+        *              enough.
+        * Returns:
+        *   the number of location codes stored.
+        */
+        byte getExtent(word code, byte extent, bool positive, word *codes,
+                       byte capacity);
+
+    private:
+        //Location codes, sorted; everything else goes by position in here
+        uint16_t *_codes;
+        uint32_t _count;
+        //_jump[d][l][i]: where 2^l steps in direction d lead from location i
+        uint16_t *_jump[2][RDS_TMC_EXTENT_LEVELS];
+        //How many steps there are before the road ends, up to
+        //RDS_TMC_EXTENT_MAX
+        byte *_reach[2];
+
+        bool locate(word code, uint32_t *index);
+
+        //Copies would free the same tables twice.
+        RDSTMCExtents(const RDSTMCExtents &);
+        RDSTMCExtents &operator=(const RDSTMCExtents &);
+};
+
+#endif
+#endif
@@ -0,0 +1,82 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This is the code file for the ISO 14819-2 language packs.
+ * See the header file for better function documentation.
+ */
+
+#include "RDSTMCLanguagePack.h"
+
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+
+#include <string.h>
+
+RDSTMCLanguagePack::RDSTMCLanguagePack() {
+    _header = NULL;
+    _language[0] = '\0';
+}
+
+bool RDSTMCLanguagePack::open(const char *path) {
+    const TRDSTMCLanguageHeader *header;
+
+    close();
+    if(!_file.open(path, RDS_TMC_LANGUAGE_MAGIC, RDS_TMC_LANGUAGE_VERSION,
+                   sizeof(TRDSTMCLanguageHeader)))
+        return false;
+
+    header = (const TRDSTMCLanguageHeader *)_file.getData();
+    if(!_file.region(header->eventIndex,
+                     RDS_TMC_LANGUAGE_EVENT_CODES * sizeof(uint32_t)) ||
+       !_file.region(header->eventStrings, header->eventStringsSize) ||
+       !_file.region(header->supplementaryIndex,
+                     RDS_TMC_LANGUAGE_SUPPLEMENTARY_CODES *
+                     sizeof(uint32_t)) ||
+       !_file.region(header->supplementaryStrings,
+                     header->supplementaryStringsSize)) {
+        _file.close();
+        return false;
+    };
+    _header = header;
+    memcpy(_language, _header->language, sizeof(_header->language));
+    _language[sizeof(_header->language)] = '\0';
+
+    return true;
+}
+
+void RDSTMCLanguagePack::close(void) {
+    _file.close();
+    _header = NULL;
+    _language[0] = '\0';
+}
+
+const char *RDSTMCLanguagePack::getEventText(word event, byte *length) {
+    if(!_header || event >= RDS_TMC_LANGUAGE_EVENT_CODES)
+        return NULL;
+
+    return getText(_header->eventIndex, _header->eventStrings,
+                   _header->eventStringsSize, event, length);
+}
+
+const char *RDSTMCLanguagePack::getSupplementaryText(byte code,
+                                                     byte *length) {
+    if(!_header)
+        return NULL;
+
+    return getText(_header->supplementaryIndex, _header->supplementaryStrings,
+                   _header->supplementaryStringsSize, code, length);
+}
+
+const char *RDSTMCLanguagePack::getText(uint32_t index, uint32_t pool,
+                                        uint32_t poolSize, word code,
+                                        byte *length) {
+    uint32_t offset = ((const uint32_t *)_file.region(index, 0))[code];
+
+    return _file.getString(pool, poolSize, offset, length);
+}
+
+#endif
@@ -0,0 +1,119 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This file contains the ISO 14819-2 language packs: translations of the
+ * event and supplementary information texts, as generated by gentables.py
+ * from a translated CSV file, memory-mapped at runtime. A pack holds nothing
+ * but the texts, the language-independent properties of the events always
+ * come from the compiled-in tables or the table file (see RDSTMCTables.h).
+ * Attach one to an RDSTranslator (see RDSTranslator::setTMCLanguage()) to use
+ * it; any number of translators may share the same pack, so keeping one
+ * translator per TMC service or per user gets each its own language. Only
+ * available in hosted builds.
+ */
+
+#ifndef _RDSTMCLANGUAGEPACK_H_INCLUDED
+#define _RDSTMCLANGUAGEPACK_H_INCLUDED
+
+#include "RDSDecoder.h"
+
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+
+#include "RDSMappedFile.h"
+
+#define RDS_TMC_LANGUAGE_MAGIC 0x474E4C54UL // "TLNG"
+#define RDS_TMC_LANGUAGE_VERSION 1
+//Size of the code space covered by each index
+#define RDS_TMC_LANGUAGE_EVENT_CODES 2048
+#define RDS_TMC_LANGUAGE_SUPPLEMENTARY_CODES 256
+//Marks a code not translated, in either index
+#define RDS_TMC_LANGUAGE_NONE 0xFFFFFFFFUL
+
+//The file is little endian throughout and laid out as follows: this header,
+//the event index (one dword per event code, holding the offset of its text in
+//the event string pool or RDS_TMC_LANGUAGE_NONE), the event string pool, then
+//the supplementary information index and string pool. All other offsets are
+//in bytes from the start of the file. String pools have the same format as
+//the compiled-in ones (see gentables.py) but texts are in UTF-8.
+typedef struct __attribute__ ((__packed__)) {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t headerSize;
+    uint32_t size;
+    //ISO 639-1 code of the language, NUL-padded
+    char language[8];
+    uint32_t eventIndex, eventStrings, eventStringsSize;
+    uint32_t supplementaryIndex, supplementaryStrings,
+             supplementaryStringsSize;
+} TRDSTMCLanguageHeader;
+
+class RDSTMCLanguagePack
+{
+    public:
+        RDSTMCLanguagePack();
+        ~RDSTMCLanguagePack() { close(); }
+
+        /*
+        * Description:
+        *   Maps the language pack at path, read-only, checking its header for
+        *   sanity. Opening a new file replaces the current one.
+        * Returns:
+        *   true if the pack is ready for use, false otherwise (in which case
+        *   none is mapped).
+        */
+        bool open(const char *path);
+
+        /*
+        * Description:
+        *   Unmaps the language pack. Any pointers handed out before are
+        *   invalid afterwards.
+        */
+        void close(void);
+
+        /*
+        * Description:
+        *   Returns true if a language pack is currently mapped.
+        */
+        bool isOpen(void) { return _header != NULL; }
+
+        /*
+        * Description:
+        *   Returns the ISO 639-1 code of the language of the pack, or an
+        *   empty string if none is mapped.
+        */
+        const char *getLanguage(void) { return _language; }
+
+        /*
+        * Description:
+        *   Returns the (NUL-terminated) translation of the text of the given
+        *   event or supplementary information code, and its length in bytes
+        *   in *length if length isn't NULL, straight out of the mapped file.
+        *   Returns NULL if the pack has no translation for the code.
+        */
+        const char *getEventText(word event, byte *length = NULL);
+        const char *getSupplementaryText(byte code, byte *length = NULL);
+
+    private:
+        RDSMappedFile _file;
+        const TRDSTMCLanguageHeader *_header;
+        char _language[sizeof(((TRDSTMCLanguageHeader *)0)->language) + 1];
+
+        /*
+        * Description:
+        *   Looks up the text of code in the given index and pool.
+        */
+        const char *getText(uint32_t index, uint32_t pool, uint32_t poolSize,
+                            word code, byte *length);
+
+        //Copies would unmap the same file twice.
+        RDSTMCLanguagePack(const RDSTMCLanguagePack &);
+        RDSTMCLanguagePack &operator=(const RDSTMCLanguagePack &);
+};
+
+#endif
+#endif
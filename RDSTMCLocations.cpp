@@ -0,0 +1,127 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This is the code file for the ISO 14819-3 location tables.
+ * See the header file for better function documentation.
+ */
+
+#include "RDSTMCLocations.h"
+
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+
+RDSTMCLocations::RDSTMCLocations() {
+    _count = 0;
+}
+
+bool RDSTMCLocations::open(const char *path) {
+    RDSMappedFile opened;
+    const TRDSTMCLocationsHeader *loaded;
+    RDSMappedFile *slot;
+
+    if(!opened.open(path, RDS_TMC_LOCATIONS_MAGIC, RDS_TMC_LOCATIONS_VERSION,
+                    sizeof(TRDSTMCLocationsHeader)))
+        return false;
+
+    loaded = header(&opened);
+    if(loaded->count > loaded->size / sizeof(TRDSTMCLocation) ||
+       !opened.region(loaded->records,
+                      loaded->count * sizeof(TRDSTMCLocation)) ||
+       !opened.region(loaded->names, loaded->namesSize))
+        return false;
+
+    slot = findTable(loaded->country, loaded->table);
+    if(!slot) {
+        if(_count == RDS_TMC_LOCATIONS_MAX_TABLES)
+            return false;
+        slot = &_tables[_count++];
+    };
+    //Whatever the slot held before gets unmapped along with opened.
+    slot->swap(opened);
+
+    return true;
+}
+
+void RDSTMCLocations::close(byte country, byte table) {
+    RDSMappedFile *slot = findTable(country, table);
+
+    if(!slot)
+        return;
+    slot->close();
+    slot->swap(_tables[--_count]);
+}
+
+void RDSTMCLocations::close(void) {
+    while(_count)
+        _tables[--_count].close();
+}
+
+const TRDSTMCLocation *RDSTMCLocations::find(byte country, byte table,
+                                             word code) {
+    RDSMappedFile *slot = findTable(country, table);
+
+    if(!slot)
+        return NULL;
+
+    const TRDSTMCLocation *locations = records(slot);
+    uint32_t low = 0, high = header(slot)->count;
+
+    while(low < high) {
+        uint32_t middle = low + (high - low) / 2;
+
+        if(locations[middle].code < code)
+            low = middle + 1;
+        else
+            high = middle;
+    };
+
+    return (low < header(slot)->count && locations[low].code == code ?
+            &locations[low] : NULL);
+}
+
+const TRDSTMCLocation *RDSTMCLocations::getLocations(byte country,
+                                                     byte table,
+                                                     uint32_t *count) {
+    RDSMappedFile *slot = findTable(country, table);
+
+    if(!slot)
+        return NULL;
+    if(count)
+        *count = header(slot)->count;
+
+    return records(slot);
+}
+
+const char *RDSTMCLocations::getName(const TRDSTMCLocation *location,
+                                     uint32_t name, byte *length) {
+    if(!location || name == RDS_TMC_LOCATIONS_NONE)
+        return NULL;
+
+    for(byte i = 0; i < _count; i++) {
+        RDSMappedFile *slot = &_tables[i];
+        const TRDSTMCLocation *locations = records(slot);
+
+        if(location < locations || location >= locations + header(slot)->count)
+            continue;
+
+        return slot->getString(header(slot)->names, header(slot)->namesSize,
+                               name, length);
+    };
+
+    return NULL;
+}
+
+RDSMappedFile *RDSTMCLocations::findTable(byte country, byte table) {
+    for(byte i = 0; i < _count; i++)
+        if(header(&_tables[i])->country == country &&
+           header(&_tables[i])->table == table)
+            return &_tables[i];
+
+    return NULL;
+}
+
+#endif
@@ -0,0 +1,180 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This file contains the ISO 14819-3 location tables: what a TMC location code
+ * stands for (road, name, coordinates and neighbours), as generated by
+ * gentables.py from the LCL export of a location table, memory-mapped at
+ * runtime. Location codes only mean something within their table, identified
+ * by the country code (see TRDSTMCFLT and the PI code) and the location table
+ * number (see TRDSTMCMessage8), so many tables can be open at once, e.g. for
+ * services covering more than one country. Only available in hosted builds.
+ */
+
+#ifndef _RDSTMCLOCATIONS_H_INCLUDED
+#define _RDSTMCLOCATIONS_H_INCLUDED
+
+#include "RDSDecoder.h"
+
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+
+#include "RDSMappedFile.h"
+
+#define RDS_TMC_LOCATIONS_MAGIC 0x4C434C54UL // "TLCL"
+#define RDS_TMC_LOCATIONS_VERSION 1
+//How many tables can be open at the same time
+#define RDS_TMC_LOCATIONS_MAX_TABLES 16
+//Marks a missing name, in any of the name fields of TRDSTMCLocation
+#define RDS_TMC_LOCATIONS_NONE 0xFFFFFFFFUL
+
+//Values of TRDSTMCLocation.category
+#define RDS_TMC_LOCATION_AREA 0x0
+#define RDS_TMC_LOCATION_LINEAR 0x1
+#define RDS_TMC_LOCATION_POINT 0x2
+
+//Bits of TRDSTMCLocation.flags
+#define RDS_TMC_LOCATION_INTERRUPTS_ROAD 0x01
+#define RDS_TMC_LOCATION_URBAN 0x02
+#define RDS_TMC_LOCATION_IN_POSITIVE 0x04
+#define RDS_TMC_LOCATION_IN_NEGATIVE 0x08
+#define RDS_TMC_LOCATION_OUT_POSITIVE 0x10
+#define RDS_TMC_LOCATION_OUT_NEGATIVE 0x20
+#define RDS_TMC_LOCATION_PRESENT_POSITIVE 0x40
+#define RDS_TMC_LOCATION_PRESENT_NEGATIVE 0x80
+
+//The file is little endian throughout and laid out as follows: this header,
+//the location records sorted by code, then the name pool. All offsets are in
+//bytes from the start of the file. The name pool has the same format as the
+//ISO 14819-2 string pools (see gentables.py) but names are in UTF-8.
+typedef struct __attribute__ ((__packed__)) {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t headerSize;
+    uint32_t size;
+    //Country code (as in the PI code) and extended country code
+    uint8_t country;
+    uint8_t ecc;
+    uint8_t table;
+    uint8_t reserved;
+    uint32_t count;
+    uint32_t records, names, namesSize;
+    //Version of the location table, NUL-padded
+    char dataset[8];
+} TRDSTMCLocationsHeader;
+
+typedef struct __attribute__ ((__packed__)) {
+    uint16_t code;
+    uint8_t category;
+    //Location type and subtype codes, as per ISO 14819-3 §7
+    uint8_t type;
+    uint8_t subtype;
+    uint8_t flags;
+    //Codes of the area, road and segment the location is part of, or 0
+    uint16_t area;
+    uint16_t road;
+    uint16_t segment;
+    //Codes of the previous and next location along the road, or 0
+    uint16_t negative;
+    uint16_t positive;
+    //WGS 84, in hundred-thousandths of a degree; points only
+    int32_t latitude;
+    int32_t longitude;
+    //Offsets in the name pool, see RDSTMCLocations::getName(). number is the
+    //road number for roads and segments, the junction number for points.
+    uint32_t number, roadName, firstName, secondName;
+} TRDSTMCLocation;
+
+class RDSTMCLocations
+{
+    public:
+        RDSTMCLocations();
+        ~RDSTMCLocations() { close(); }
+
+        /*
+        * Description:
+        *   Maps the location table file at path, read-only, checking its
+        *   header for sanity. Opening a table that is already open (same
+        *   country and table number) replaces it, which is how tables get
+        *   updated.
+        * Returns:
+        *   true if the table is ready for use, false otherwise (invalid file
+        *   or RDS_TMC_LOCATIONS_MAX_TABLES already open).
+        */
+        bool open(const char *path);
+
+        /*
+        * Description:
+        *   Unmaps the given table, or all of them. Any pointers handed out
+        *   before into an unmapped table are invalid afterwards.
+        */
+        void close(byte country, byte table);
+        void close(void);
+
+        /*
+        * Description:
+        *   Returns true if the given table is currently mapped.
+        */
+        bool isOpen(byte country, byte table) {
+            return findTable(country, table) != NULL;
+        }
+
+        /*
+        * Description:
+        *   Finds a location, by binary search in its table.
+        * Parameters:
+        *   country - the country code, as in the PI code or TRDSTMCFLT.
+        *   table - the location table number.
+        *   code - the location code.
+        * Returns:
+        *   pointer to the record (inside the mapped file) or NULL if the table
+        *   isn't open or has no such location.
+        */
+        const TRDSTMCLocation *find(byte country, byte table, word code);
+
+        /*
+        * Description:
+        *   Returns all the locations of a table, sorted by code, and their
+        *   number in *count, or NULL if the table isn't open.
+        */
+        const TRDSTMCLocation *getLocations(byte country, byte table,
+                                            uint32_t *count);
+
+        /*
+        * Description:
+        *   Returns the (NUL-terminated, UTF-8) text of one of the name fields
+        *   of location, and its length in bytes in *length if length isn't
+        *   NULL, straight out of the mapped file. Returns NULL if the field
+        *   is empty or location doesn't come from an open table.
+        */
+        const char *getName(const TRDSTMCLocation *location, uint32_t name,
+                            byte *length = NULL);
+
+    private:
+        RDSMappedFile _tables[RDS_TMC_LOCATIONS_MAX_TABLES];
+        byte _count;
+
+        RDSMappedFile *findTable(byte country, byte table);
+
+        /*
+        * Description:
+        *   Returns the header and the records of a mapped table.
+        */
+        inline const TRDSTMCLocationsHeader *header(RDSMappedFile *table) {
+            return (const TRDSTMCLocationsHeader *)table->getData();
+        }
+        inline const TRDSTMCLocation *records(RDSMappedFile *table) {
+            return (const TRDSTMCLocation *)table->region(
+                header(table)->records, 0);
+        }
+
+        //Copies would unmap the same files twice.
+        RDSTMCLocations(const RDSTMCLocations &);
+        RDSTMCLocations &operator=(const RDSTMCLocations &);
+};
+
+#endif
+#endif
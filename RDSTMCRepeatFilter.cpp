@@ -0,0 +1,81 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This is the code file for the TMC repeat filter.
+ * See the header file for better function documentation.
+ */
+
+#include "RDSTMCRepeatFilter.h"
+#include "RDSDecoder-private.h"
+
+//Marks a slot as in use, X only has 5 bits
+#define RDS_TMC_REPEAT_USED 0x80
+
+RDSTMCRepeatFilter::RDSTMCRepeatFilter(uint32_t window) {
+    _window = window;
+    reset();
+}
+
+void RDSTMCRepeatFilter::reset(void) {
+    for(word i = 0; i < RDS_TMC_REPEAT_SLOTS; i++)
+        _slots[i].x = 0x00;
+    _repeats = 0;
+    _passed = 0;
+}
+
+bool RDSTMCRepeatFilter::isRepeat(byte tmcXbits, word tmcYbits, word tmcZbits,
+                                  uint32_t timestamp) {
+    //Continuation groups of multi-group messages carry neither event nor
+    //location, so the same payload turns up in unrelated messages, and
+    //dropping one would also defeat the retransmission of a message that
+    //lost a group. They always pass, only whole-message payloads are checked.
+    if(!(tmcXbits & (RDS_TMC_MESSAGE_SYSTEM | RDS_TMC_MESSAGE_SINGLE)) &&
+       (tmcXbits & RDS_TMC_MESSAGE_DURATION_MASK) &&
+       !(tmcYbits & RDS_TMC_MESSAGE_DIVERSION)) {
+        _passed++;
+        return false;
+    };
+
+    uint32_t yz = ((uint32_t)tmcYbits << 16) | tmcZbits;
+    byte x = (tmcXbits & 0x1F) | RDS_TMC_REPEAT_USED;
+    TRDSTMCRepeatSlot *victim = NULL;
+    uint32_t victimAge = 0;
+    //Multiplicative hashing, the top bits are the best mixed.
+    word slot = (word)((uint32_t)((yz ^ ((uint32_t)x << 27)) * 2654435761UL) >>
+                       16) & (RDS_TMC_REPEAT_SLOTS - 1);
+
+    for(byte i = 0; i < RDS_TMC_REPEAT_PROBES; i++) {
+        TRDSTMCRepeatSlot *candidate = &_slots[(slot + i) &
+                                               (RDS_TMC_REPEAT_SLOTS - 1)];
+        //Unused slots are older than anything.
+        uint32_t age = (candidate->x ? timestamp - candidate->passed :
+                                       0xFFFFFFFFUL);
+
+        if(candidate->x == x && candidate->yz == yz) {
+            //The window runs from when the payload last passed, so that a
+            //message on air keeps being let through once per window.
+            if(age <= _window) {
+                _repeats++;
+                return true;
+            };
+            victim = candidate;
+            break;
+        };
+        if(!victim || age > victimAge) {
+            victim = candidate;
+            victimAge = age;
+        };
+    };
+
+    victim->x = x;
+    victim->yz = yz;
+    victim->passed = timestamp;
+    _passed++;
+
+    return false;
+}
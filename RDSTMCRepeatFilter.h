@@ -0,0 +1,96 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This file contains the TMC repeat filter: TMC services send every group at
+ * least twice in a row and cycle through their messages every few minutes, so
+ * most of what arrives was seen very recently. The filter remembers recent
+ * 37 bit payloads in a small hash set so that repeats can be dropped before
+ * anybody spends time unpacking them.
+ */
+
+#ifndef _RDSTMCREPEATFILTER_H_INCLUDED
+#define _RDSTMCREPEATFILTER_H_INCLUDED
+
+#include "RDSDecoder.h"
+
+//Size of the hash set, a power of two
+#if !defined(RDS_TMC_REPEAT_SLOTS)
+# if defined(WITH_RDS_HOST_EXTENSIONS)
+#  define RDS_TMC_REPEAT_SLOTS 256
+# else
+#  define RDS_TMC_REPEAT_SLOTS 16
+# endif
+#endif
+//How many slots a payload may end up away from its home slot
+#define RDS_TMC_REPEAT_PROBES 4
+//Default window, in groups: about 30 seconds worth of them at 11.4 groups/s
+#define RDS_TMC_REPEAT_WINDOW 342UL
+
+class RDSTMCRepeatFilter
+{
+    public:
+        /*
+        * Description:
+        *   Constructor, sets the time window within which a payload seen
+        *   again counts as a repeat. The unit is whatever the caller passes as
+        *   timestamp; RDSDecoder passes its group count.
+        */
+        RDSTMCRepeatFilter(uint32_t window = RDS_TMC_REPEAT_WINDOW);
+
+        /*
+        * Description:
+        *   Forgets all payloads seen, use when switching to a new TMC service.
+        *   RDSDecoder does this on its own for an attached filter.
+        */
+        void reset(void);
+
+        /*
+        * Description:
+        *   Checks whether a TMC payload passed within the window, and if
+        *   not, lets it pass and remembers timestamp for it. Repeats do not
+        *   extend the window, so a payload that stays on air passes again
+        *   once per window and keeps its RDSTMCStore entry refreshed.
+        *   Only self-contained payloads are checked: single-group messages,
+        *   first groups of multi-group messages, tuning/system groups and
+        *   encryption administration groups. Subsequent groups of multi-group
+        *   messages always pass (and aren't remembered), since they don't
+        *   identify their message and may be needed to complete a
+        *   retransmission.
+        * Parameters:
+        *   tmcXbits, tmcYbits, tmcZbits - the TMC payload as passed to
+        *                                  RDS_CALLBACK_TMC.
+        *   timestamp - the current time.
+        * Returns:
+        *   true if this is a repeat, false if it is new.
+        */
+        bool isRepeat(byte tmcXbits, word tmcYbits, word tmcZbits,
+                      uint32_t timestamp);
+
+        /*
+        * Description:
+        *   Statistics: how many payloads were found to be repeats and how
+        *   many passed (including subsequent groups, which always do) since
+        *   the last reset().
+        */
+        uint32_t getRepeats(void) { return _repeats; }
+        uint32_t getPassed(void) { return _passed; }
+
+    private:
+        typedef struct {
+            //Y and Z bits, X bits with the MSB set to mark the slot as used
+            uint32_t yz;
+            byte x;
+            //When the payload last passed
+            uint32_t passed;
+        } TRDSTMCRepeatSlot;
+
+        TRDSTMCRepeatSlot _slots[RDS_TMC_REPEAT_SLOTS];
+        uint32_t _window, _repeats, _passed;
+};
+
+#endif
@@ -0,0 +1,162 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This is the code file for the TMC spatial index.
+ * See the header file for better function documentation.
+ */
+
+#include "RDSTMCSpatialIndex.h"
+
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+
+#include <string.h>
+
+//End of a cell list
+#define RDS_TMC_SPATIAL_NONE 0xFFFF
+//Flags a search() miss
+#define RDS_TMC_SPATIAL_MISS 0x8000
+#define RDS_TMC_SPATIAL_MASK (RDS_TMC_SPATIAL_GRID - 1)
+
+RDSTMCSpatialIndex::RDSTMCSpatialIndex(TRDSTMCCoordinateMapper mapper,
+                                       int32_t cellSize) {
+    _mapper = mapper;
+    _cellSize = (cellSize > 0 ? cellSize : RDS_TMC_SPATIAL_CELL);
+    clear();
+}
+
+void RDSTMCSpatialIndex::clear(void) {
+    _count = 0;
+    _freecount = RDS_TMC_STORE_SIZE;
+    for(word i = 0; i < RDS_TMC_STORE_SIZE; i++)
+        _free[i] = RDS_TMC_STORE_SIZE - 1 - i;
+    for(word i = 0; i < RDS_TMC_SPATIAL_GRID * RDS_TMC_SPATIAL_GRID; i++)
+        _cells[i] = RDS_TMC_SPATIAL_NONE;
+}
+
+void RDSTMCSpatialIndex::update(byte reason,
+                                const TRDSTMCStoredMessage *message) {
+    word position;
+
+    if(!message)
+        return;
+    position = search(message->key);
+    if(reason == RDS_TMC_STORE_ADDED || reason == RDS_TMC_STORE_REPLACED) {
+        if(position & RDS_TMC_SPATIAL_MISS)
+            insert(position & ~RDS_TMC_SPATIAL_MISS, message);
+        else
+            //Same key, same location: nothing moves.
+            _pool[_sorted[position]].message = message;
+    } else if(!(position & RDS_TMC_SPATIAL_MISS))
+        remove(position);
+}
+
+word RDSTMCSpatialIndex::query(int32_t minX, int32_t minY, int32_t maxX,
+                               int32_t maxY,
+                               const TRDSTMCStoredMessage **messages,
+                               word capacity) {
+    int32_t column = cellOf(minX), columns = cellOf(maxX) - column + 1;
+    int32_t row = cellOf(minY), rows = cellOf(maxY) - row + 1;
+    word found = 0;
+
+    if(minX > maxX || minY > maxY)
+        return 0;
+    //A box wider than the grid sees every column (or row) once.
+    if(columns > RDS_TMC_SPATIAL_GRID)
+        columns = RDS_TMC_SPATIAL_GRID;
+    if(rows > RDS_TMC_SPATIAL_GRID)
+        rows = RDS_TMC_SPATIAL_GRID;
+
+    for(int32_t i = 0; i < columns; i++)
+        for(int32_t j = 0; j < rows; j++) {
+            word cell = ((column + i) & RDS_TMC_SPATIAL_MASK) *
+                        RDS_TMC_SPATIAL_GRID +
+                        ((row + j) & RDS_TMC_SPATIAL_MASK);
+
+            //Cells are shared by wrapping around, check each entry.
+            for(word k = _cells[cell]; k != RDS_TMC_SPATIAL_NONE;
+                k = _pool[k].next) {
+                const TRDSTMCSpatialEntry *entry = &_pool[k];
+
+                if(entry->x < minX || entry->x > maxX || entry->y < minY ||
+                   entry->y > maxY)
+                    continue;
+                if(messages && found < capacity)
+                    messages[found] = entry->message;
+                found++;
+            };
+        };
+
+    return found;
+}
+
+word RDSTMCSpatialIndex::search(uint32_t key) {
+    word low = 0, high = _count;
+
+    while(low < high) {
+        word middle = (low + high) / 2;
+        uint32_t other = _pool[_sorted[middle]].key;
+
+        if(other < key)
+            low = middle + 1;
+        else if(other > key)
+            high = middle;
+        else
+            return middle;
+    };
+
+    return low | RDS_TMC_SPATIAL_MISS;
+}
+
+void RDSTMCSpatialIndex::insert(word position,
+                                const TRDSTMCStoredMessage *message) {
+    TRDSTMCSpatialEntry *entry;
+    int32_t x, y;
+    word slot;
+
+    if(!(_mapper && _freecount &&
+         _mapper(message->message.location, &x, &y)))
+        return;
+
+    slot = _free[--_freecount];
+    memmove(&_sorted[position + 1], &_sorted[position],
+            (_count - position) * sizeof(_sorted[0]));
+    _sorted[position] = slot;
+    _count++;
+
+    entry = &_pool[slot];
+    entry->message = message;
+    entry->key = message->key;
+    entry->x = x;
+    entry->y = y;
+    entry->cell = (cellOf(x) & RDS_TMC_SPATIAL_MASK) * RDS_TMC_SPATIAL_GRID +
+                  (cellOf(y) & RDS_TMC_SPATIAL_MASK);
+    entry->previous = RDS_TMC_SPATIAL_NONE;
+    entry->next = _cells[entry->cell];
+    if(entry->next != RDS_TMC_SPATIAL_NONE)
+        _pool[entry->next].previous = slot;
+    _cells[entry->cell] = slot;
+}
+
+void RDSTMCSpatialIndex::remove(word position) {
+    word slot = _sorted[position];
+    TRDSTMCSpatialEntry *entry = &_pool[slot];
+
+    if(entry->previous != RDS_TMC_SPATIAL_NONE)
+        _pool[entry->previous].next = entry->next;
+    else
+        _cells[entry->cell] = entry->next;
+    if(entry->next != RDS_TMC_SPATIAL_NONE)
+        _pool[entry->next].previous = entry->previous;
+
+    memmove(&_sorted[position], &_sorted[position + 1],
+            (_count - position - 1) * sizeof(_sorted[0]));
+    _count--;
+    _free[_freecount++] = slot;
+}
+
+#endif
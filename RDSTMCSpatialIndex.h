@@ -0,0 +1,127 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This file contains the TMC spatial index: the messages of an RDSTMCStore
+ * bucketed by the coordinates of their (primary) location on a fixed grid, so
+ * that "what is in this viewport" only looks at the messages nearby. Where a
+ * location is comes from a caller-supplied function, e.g. one looking it up in
+ * RDSTMCLocations. The store's observer keeps the index up to date:
+ *
+ *   void observer(byte reason, const TRDSTMCStoredMessage *message) {
+ *       spatialIndex.update(reason, message);
+ *   }
+ *
+ * Only available in hosted builds.
+ */
+
+#ifndef _RDSTMCSPATIALINDEX_H_INCLUDED
+#define _RDSTMCSPATIALINDEX_H_INCLUDED
+
+#include "RDSDecoder.h"
+#include "RDSTMCStore.h"
+
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+
+//Cells per side of the grid, a power of two. Coordinates wrap around, so any
+//area maps onto it; cells far apart simply share a bucket.
+#define RDS_TMC_SPATIAL_GRID 64
+//Default cell size, in coordinate units: 0.1 degrees at the resolution of
+//TRDSTMCLocation
+#define RDS_TMC_SPATIAL_CELL 10000L
+
+//Looks up the coordinates of a location code, returns false if unknown.
+//Must always give the same answer for the same code while it's in use.
+typedef bool (*TRDSTMCCoordinateMapper)(word location, int32_t *x,
+                                        int32_t *y);
+
+class RDSTMCSpatialIndex
+{
+    public:
+        RDSTMCSpatialIndex(TRDSTMCCoordinateMapper mapper = NULL,
+                           int32_t cellSize = RDS_TMC_SPATIAL_CELL);
+
+        /*
+        * Description:
+        *   Empties the index, use along with RDSTMCStore::clear().
+        */
+        void clear(void);
+
+        /*
+        * Description:
+        *   Sets the function giving the coordinates of locations, see
+        *   TRDSTMCCoordinateMapper. Only affects messages indexed from now on.
+        */
+        void setMapper(TRDSTMCCoordinateMapper mapper) { _mapper = mapper; }
+
+        /*
+        * Description:
+        *   Applies a store change to the index; call it from the store's
+        *   observer with the same arguments (see TRDSTMCStoreCallback).
+        *   Messages whose location the mapper doesn't know aren't indexed.
+        */
+        void update(byte reason, const TRDSTMCStoredMessage *message);
+
+        /*
+        * Description:
+        *   Finds the messages whose location lies in the given box, edges
+        *   included.
+        * Parameters:
+        *   minX, minY, maxX, maxY - the box, in mapper coordinates.
+        *   messages - an array receiving the messages found, in no particular
+        *              order. The pointers are valid until the next change to
+        *              the store.
+        *   capacity - the number of elements in messages.
+        * Returns:
+        *   the number of messages in the box, which may be more than
+        *   capacity (only the first capacity are stored).
+        */
+        word query(int32_t minX, int32_t minY, int32_t maxX, int32_t maxY,
+                   const TRDSTMCStoredMessage **messages, word capacity);
+
+        /*
+        * Description:
+        *   Returns the number of messages currently indexed.
+        */
+        word getCount(void) { return _count; }
+
+    private:
+        typedef struct {
+            const TRDSTMCStoredMessage *message;
+            uint32_t key;
+            int32_t x, y;
+            word cell;
+            //Doubly linked list of the entries in the same cell
+            word previous, next;
+        } TRDSTMCSpatialEntry;
+
+        //Entries never move in _pool; _sorted orders them by message key, by
+        //pool index, same as in RDSTMCStore.
+        TRDSTMCSpatialEntry _pool[RDS_TMC_STORE_SIZE];
+        word _sorted[RDS_TMC_STORE_SIZE];
+        word _free[RDS_TMC_STORE_SIZE];
+        word _cells[RDS_TMC_SPATIAL_GRID * RDS_TMC_SPATIAL_GRID];
+        word _count, _freecount;
+        TRDSTMCCoordinateMapper _mapper;
+        int32_t _cellSize;
+
+        word search(uint32_t key);
+        void insert(word position, const TRDSTMCStoredMessage *message);
+        void remove(word position);
+
+        /*
+        * Description:
+        *   Grid column or row of a coordinate, before wrapping around.
+        */
+        int32_t cellOf(int32_t coordinate) {
+            return (coordinate >= 0 ? coordinate / _cellSize :
+                    -1 - (-1 - coordinate) / _cellSize);
+        }
+};
+
+#endif
+#endif
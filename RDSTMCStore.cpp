@@ -0,0 +1,261 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This is the code file for the TMC message store.
+ * See the header file for better function documentation.
+ */
+
+#include "RDSTMCStore.h"
+#include "RDSDecoder-private.h"
+#include "rds-decoder.h"
+
+#include <string.h>
+
+//Special values in the persistence tables
+#define RDS_TMC_PERSISTENCE_TODAY 0xFE
+#define RDS_TMC_PERSISTENCE_TOMORROW 0xFF
+#define RDS_TMC_SECONDS_PER_DAY 86400UL
+//Flags a search() miss
+#define RDS_TMC_STORE_MISS 0x8000
+
+RDSTMCStore::RDSTMCStore(TRDSTMCStoreCallback observer) {
+    _observer = observer;
+    _translator = NULL;
+    clear();
+}
+
+void RDSTMCStore::clear(void) {
+    _count = 0;
+    _freecount = RDS_TMC_STORE_SIZE;
+    for(word i = 0; i < RDS_TMC_STORE_SIZE; i++)
+        _free[i] = RDS_TMC_STORE_SIZE - 1 - i;
+}
+
+word RDSTMCStore::search(uint32_t key) {
+    word low = 0, high = _count;
+
+    while(low < high) {
+        word middle = (low + high) / 2;
+        uint32_t other = _pool[_sorted[middle]].key;
+
+        if(other < key)
+            low = middle + 1;
+        else if(other > key)
+            high = middle;
+        else
+            return middle;
+    };
+
+    return low | RDS_TMC_STORE_MISS;
+}
+
+uint32_t RDSTMCStore::persistence(byte duration, bool longerLasting,
+                                  uint32_t timestamp) {
+    byte minutes = (longerLasting ? RDS_TMC_D2LongerlastingPersistence :
+                                    RDS_TMC_D2DynamicPersistence)[duration & 0x07];
+
+    switch(minutes) {
+        case RDS_TMC_PERSISTENCE_TODAY:
+            return timestamp - timestamp % RDS_TMC_SECONDS_PER_DAY +
+                   RDS_TMC_SECONDS_PER_DAY;
+        case RDS_TMC_PERSISTENCE_TOMORROW:
+            //Also stands for "end of the week/month/long period": we settle
+            //for the shortest of those, services keep repeating messages that
+            //are still current anyway.
+            return timestamp - timestamp % RDS_TMC_SECONDS_PER_DAY +
+                   2 * RDS_TMC_SECONDS_PER_DAY;
+        default:
+            return timestamp + minutes * 60UL;
+    };
+}
+
+bool RDSTMCStore::update(const TRDSTMCUserMessage *message,
+                         uint32_t timestamp) {
+    TRDSTMCEventInfo info;
+    RDSTranslator fallback;
+    RDSTranslator *translator = (_translator ? _translator : &fallback);
+    TRDSTMCStoredMessage *entry;
+    byte duration;
+    uint32_t key;
+    word position;
+    bool added;
+
+    if(!message)
+        return false;
+    expire(timestamp);
+    if(!translator->getTMCEventInfo(message->event, &info))
+        return false;
+
+    if(message->event == RDS_TMC_MESSAGE_EVENT_NULL) {
+        //The null message cancels everything at its location and direction,
+        //whatever the update class.
+        position = search(makeKey(message->location, message->direction, 0)) &
+                   ~RDS_TMC_STORE_MISS;
+        key = makeKey(message->location, message->direction, 0x7F);
+        while(position < _count && _pool[_sorted[position]].key <= key)
+            remove(position, RDS_TMC_STORE_CANCELLED);
+        return true;
+    };
+
+    duration = message->duration;
+    if(!message->single) {
+        TRDSTMCContainerIndex fp = {0, 0};
+        TRDSTMCLabel label;
+
+        //Multi-group messages carry the duration in label 0, if at all.
+        duration = 0;
+        while(translator->readNextTMCLabel(message->container, &fp, &label))
+            if(label.type == RDS_TMC_LABEL_DURATION) {
+                duration = label.value;
+                break;
+            };
+    };
+
+    key = makeKey(message->location, message->direction, info.updateClass);
+    position = search(key);
+    added = position & RDS_TMC_STORE_MISS;
+    if(added) {
+        word slot;
+
+        if(_count == RDS_TMC_STORE_SIZE) {
+            //Full: make room by dropping the one closest to expiring.
+            remove(search(_pool[_heap[0]].key), RDS_TMC_STORE_EXPIRED);
+            position = search(key);
+        };
+        position &= ~RDS_TMC_STORE_MISS;
+        slot = _free[--_freecount];
+        memmove(&_sorted[position + 1], &_sorted[position],
+                (_count - position) * sizeof(_sorted[0]));
+        _sorted[position] = slot;
+        entry = &_pool[slot];
+        entry->key = key;
+        entry->heapIndex = _count;
+        _heap[_count++] = slot;
+    } else
+        entry = &_pool[_sorted[position]];
+
+    entry->message = *message;
+    entry->updateClass = info.updateClass;
+    entry->duration = duration;
+    entry->received = timestamp;
+    entry->expires = persistence(duration, info.longerLasting, timestamp);
+    heapUp(entry->heapIndex);
+    heapDown(entry->heapIndex);
+
+    if(_observer)
+        _observer(added ? RDS_TMC_STORE_ADDED : RDS_TMC_STORE_REPLACED, entry);
+
+    return true;
+}
+
+word RDSTMCStore::expire(uint32_t timestamp) {
+    word expired = 0;
+
+    while(_count && _pool[_heap[0]].expires <= timestamp) {
+        remove(search(_pool[_heap[0]].key), RDS_TMC_STORE_EXPIRED);
+        expired++;
+    };
+
+    return expired;
+}
+
+bool RDSTMCStore::cancel(word location, bool direction, byte updateClass) {
+    word position = search(makeKey(location, direction, updateClass));
+
+    if(position & RDS_TMC_STORE_MISS)
+        return false;
+    remove(position, RDS_TMC_STORE_CANCELLED);
+
+    return true;
+}
+
+const TRDSTMCStoredMessage *RDSTMCStore::find(word location, bool direction,
+                                              byte updateClass) {
+    word position = search(makeKey(location, direction, updateClass));
+
+    if(position & RDS_TMC_STORE_MISS)
+        return NULL;
+
+    return &_pool[_sorted[position]];
+}
+
+word RDSTMCStore::findLocation(word location, word *first) {
+    word position = search(makeKey(location, false, 0)) & ~RDS_TMC_STORE_MISS;
+    word count = 0;
+
+    while(position + count < _count &&
+          (_pool[_sorted[position + count]].key >> 8) == location)
+        count++;
+    if(first)
+        *first = position;
+
+    return count;
+}
+
+const TRDSTMCStoredMessage *RDSTMCStore::getMessage(word index) {
+    if(index >= _count)
+        return NULL;
+
+    return &_pool[_sorted[index]];
+}
+
+void RDSTMCStore::remove(word position, byte reason) {
+    word slot = _sorted[position];
+    word index = _pool[slot].heapIndex;
+
+    if(_observer)
+        _observer(reason, &_pool[slot]);
+
+    memmove(&_sorted[position], &_sorted[position + 1],
+            (_count - position - 1) * sizeof(_sorted[0]));
+    _count--;
+    if(index != _count) {
+        //Plug the hole in the heap with its last element and restore order.
+        _heap[index] = _heap[_count];
+        _pool[_heap[index]].heapIndex = index;
+        heapUp(index);
+        heapDown(_pool[_heap[index]].heapIndex);
+    };
+    _free[_freecount++] = slot;
+}
+
+void RDSTMCStore::heapSwap(word a, word b) {
+    word slot = _heap[a];
+
+    _heap[a] = _heap[b];
+    _heap[b] = slot;
+    _pool[_heap[a]].heapIndex = a;
+    _pool[_heap[b]].heapIndex = b;
+}
+
+void RDSTMCStore::heapUp(word index) {
+    while(index) {
+        word parent = (index - 1) / 2;
+
+        if(_pool[_heap[parent]].expires <= _pool[_heap[index]].expires)
+            break;
+        heapSwap(parent, index);
+        index = parent;
+    };
+}
+
+void RDSTMCStore::heapDown(word index) {
+    for(;;) {
+        word child = 2 * index + 1;
+
+        if(child >= _count)
+            break;
+        if(child + 1 < _count &&
+           _pool[_heap[child + 1]].expires < _pool[_heap[child]].expires)
+            child++;
+        if(_pool[_heap[index]].expires <= _pool[_heap[child]].expires)
+            break;
+        heapSwap(index, child);
+        index = child;
+    };
+}
@@ -0,0 +1,205 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This file contains the TMC message store: the live traffic picture of one
+ * TMC service, kept up to date with the message management rules of
+ * ISO 14819-1 (a message replaces the one for the same location, direction and
+ * update class; the null message cancels everything at its location) and the
+ * persistence times implied by each message's duration code.
+ */
+
+#ifndef _RDSTMCSTORE_H_INCLUDED
+#define _RDSTMCSTORE_H_INCLUDED
+
+#include "RDSDecoder.h"
+#include "RDSTMCAssembler.h"
+
+//How many messages the store holds. When full, the one closest to expiring
+//makes room for a new one.
+#if !defined(RDS_TMC_STORE_SIZE)
+# if defined(WITH_RDS_HOST_EXTENSIONS)
+#  define RDS_TMC_STORE_SIZE 1024
+# else
+#  define RDS_TMC_STORE_SIZE 16
+# endif
+#endif
+
+//Observer notification types
+#define RDS_TMC_STORE_ADDED 0x00
+#define RDS_TMC_STORE_REPLACED 0x01
+#define RDS_TMC_STORE_CANCELLED 0x02
+#define RDS_TMC_STORE_EXPIRED 0x03
+
+typedef struct {
+    TRDSTMCUserMessage message;
+    byte updateClass;
+    //Duration code in effect (from the group or from label 0)
+    byte duration;
+    //Times are in seconds, in whatever timebase the caller uses
+    uint32_t received, expires;
+    //Sort key: location, direction, update class
+    uint32_t key;
+    word heapIndex;
+} TRDSTMCStoredMessage;
+
+//Called whenever a message enters or leaves the store. For
+//RDS_TMC_STORE_REPLACED, the message passed is the new one; for
+//RDS_TMC_STORE_CANCELLED and RDS_TMC_STORE_EXPIRED it is the one about to be
+//removed and is only valid during the call.
+typedef void (*TRDSTMCStoreCallback)(byte, const TRDSTMCStoredMessage *);
+
+class RDSTMCStore
+{
+    public:
+        RDSTMCStore(TRDSTMCStoreCallback observer = NULL);
+
+        /*
+        * Description:
+        *   Empties the store (without notifying the observer), use when
+        *   switching to a new TMC service.
+        */
+        void clear(void);
+
+        /*
+        * Description:
+        *   Registers the observer, see TRDSTMCStoreCallback. Using NULL removes
+        *   the current one.
+        */
+        void setObserver(TRDSTMCStoreCallback observer = NULL) {
+            _observer = observer;
+        }
+
+        /*
+        * Description:
+        *   Sets the translator used to look events up, e.g. one with a table
+        *   file attached (see RDSTranslator::setTMCTables()). Using NULL goes
+        *   back to a default one, which only knows the compiled-in tables.
+        */
+        void setTranslator(RDSTranslator *translator = NULL) {
+            _translator = translator;
+        }
+
+        /*
+        * Description:
+        *   Applies one received message to the store, e.g. as it comes out of
+        *   RDSTMCAssembler, expiring old messages first.
+        * Parameters:
+        *   message - the message.
+        *   timestamp - the current time in seconds. Persistence that runs
+        *               "until midnight" is computed as the next multiple of
+        *               86400, so pass local time if that's what matters.
+        * Returns:
+        *   true if the message was applied, false if its event is not in the
+        *   event list (and thus its update class is unknown).
+        */
+        bool update(const TRDSTMCUserMessage *message, uint32_t timestamp);
+
+        /*
+        * Description:
+        *   Removes every message whose persistence ran out by timestamp.
+        * Returns:
+        *   the number of messages removed.
+        */
+        word expire(uint32_t timestamp);
+
+        /*
+        * Description:
+        *   Removes the message for the given location, direction and update
+        *   class, if any.
+        * Returns:
+        *   true if a message was removed.
+        */
+        bool cancel(word location, bool direction, byte updateClass);
+
+        /*
+        * Description:
+        *   Finds the message for the given location, direction and update
+        *   class in O(log n).
+        * Returns:
+        *   pointer to the message or NULL. The pointer is valid until the next
+        *   call that modifies the store.
+        */
+        const TRDSTMCStoredMessage *find(word location, bool direction,
+                                         byte updateClass);
+
+        /*
+        * Description:
+        *   Finds all messages for the given location (in both directions) in
+        *   O(log n). They are consecutive in getMessage() order.
+        * Parameters:
+        *   location - the location code.
+        *   first - pointer to a word to receive the index of the first one.
+        * Returns:
+        *   the number of messages found.
+        */
+        word findLocation(word location, word *first);
+
+        /*
+        * Description:
+        *   Returns the number of messages currently in the store.
+        */
+        word getCount(void) { return _count; }
+
+        /*
+        * Description:
+        *   Returns the index-th message in (location, direction, update class)
+        *   order, or NULL if index is out of range.
+        */
+        const TRDSTMCStoredMessage *getMessage(word index);
+
+    private:
+        //Messages never move in _pool; _sorted orders them by key and _heap
+        //by expiry time, both by pool index.
+        TRDSTMCStoredMessage _pool[RDS_TMC_STORE_SIZE];
+        word _sorted[RDS_TMC_STORE_SIZE];
+        word _heap[RDS_TMC_STORE_SIZE];
+        word _free[RDS_TMC_STORE_SIZE];
+        word _count, _freecount;
+        TRDSTMCStoreCallback _observer;
+        RDSTranslator *_translator;
+
+        static uint32_t makeKey(word location, bool direction,
+                                byte updateClass) {
+            return ((uint32_t)location << 8) | ((uint32_t)direction << 7) |
+                   updateClass;
+        }
+
+        /*
+        * Description:
+        *   Binary search of _sorted for key.
+        * Returns:
+        *   the position of key in _sorted if found, or else the position it
+        *   should be inserted at with the MSB set.
+        */
+        word search(uint32_t key);
+
+        /*
+        * Description:
+        *   Computes when a message with the given properties stops being
+        *   current.
+        */
+        uint32_t persistence(byte duration, bool longerLasting,
+                             uint32_t timestamp);
+
+        /*
+        * Description:
+        *   Removes the message at position in _sorted, notifying the observer
+        *   with reason.
+        */
+        void remove(word position, byte reason);
+
+        /*
+        * Description:
+        *   Timer heap maintenance.
+        */
+        void heapUp(word index);
+        void heapDown(word index);
+        void heapSwap(word a, word b);
+};
+
+#endif
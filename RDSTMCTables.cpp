@@ -0,0 +1,100 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This is the code file for the ISO 14819-2 table file backend.
+ * See the header file for better function documentation.
+ */
+
+#include "RDSTMCTables.h"
+
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+
+RDSTMCTables::RDSTMCTables() {
+    _header = NULL;
+}
+
+bool RDSTMCTables::open(const char *path) {
+    const TRDSTMCTablesHeader *header;
+
+    close();
+    if(!_file.open(path, RDS_TMC_TABLES_MAGIC, RDS_TMC_TABLES_VERSION,
+                   sizeof(TRDSTMCTablesHeader)))
+        return false;
+
+    header = (const TRDSTMCTablesHeader *)_file.getData();
+    if(!_file.region(header->eventIndex,
+                     RDS_TMC_TABLES_EVENT_CODES * sizeof(uint16_t)) ||
+       !_file.region(header->events,
+                     header->eventCount * sizeof(TRDSTMCTableEvent)) ||
+       !_file.region(header->eventStrings, header->eventStringsSize) ||
+       !_file.region(header->supplementaryIndex,
+                     RDS_TMC_TABLES_SUPPLEMENTARY_CODES * sizeof(uint16_t)) ||
+       !_file.region(header->supplementary,
+                     header->supplementaryCount *
+                     sizeof(TRDSTMCTableSupplementary)) ||
+       !_file.region(header->supplementaryStrings,
+                     header->supplementaryStringsSize)) {
+        _file.close();
+        return false;
+    };
+    _header = header;
+
+    return true;
+}
+
+void RDSTMCTables::close(void) {
+    _file.close();
+    _header = NULL;
+}
+
+const TRDSTMCTableEvent *RDSTMCTables::findEvent(word event) {
+    if(!_header || event >= RDS_TMC_TABLES_EVENT_CODES)
+        return NULL;
+
+    word record = ((const uint16_t *)_file.region(_header->eventIndex,
+                                                  0))[event];
+    if(record >= _header->eventCount)
+        return NULL;
+
+    return (const TRDSTMCTableEvent *)_file.region(_header->events, 0) +
+           record;
+}
+
+const TRDSTMCTableSupplementary *RDSTMCTables::findSupplementary(byte code) {
+    if(!_header)
+        return NULL;
+
+    word record = ((const uint16_t *)_file.region(
+        _header->supplementaryIndex, 0))[code];
+    if(record >= _header->supplementaryCount)
+        return NULL;
+
+    return (const TRDSTMCTableSupplementary *)_file.region(
+        _header->supplementary, 0) + record;
+}
+
+const char *RDSTMCTables::getText(const TRDSTMCTableEvent *entry,
+                                  byte *length) {
+    if(!(_header && entry))
+        return NULL;
+
+    return _file.getString(_header->eventStrings, _header->eventStringsSize,
+                           entry->description, length);
+}
+
+const char *RDSTMCTables::getText(const TRDSTMCTableSupplementary *entry,
+                                  byte *length) {
+    if(!(_header && entry))
+        return NULL;
+
+    return _file.getString(_header->supplementaryStrings,
+                           _header->supplementaryStringsSize,
+                           entry->description, length);
+}
+
+#endif
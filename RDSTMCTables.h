@@ -0,0 +1,138 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This file contains the ISO 14819-2 table file backend: the event list and
+ * the supplementary information list, as generated by gentables.py into a
+ * single binary file, memory-mapped at runtime instead of compiled in. Once
+ * attached to an RDSTranslator (see RDSTranslator::setTMCTables()), it takes
+ * precedence over the compiled-in tables, if any. Only available in hosted
+ * builds.
+ */
+
+#ifndef _RDSTMCTABLES_H_INCLUDED
+#define _RDSTMCTABLES_H_INCLUDED
+
+#include "RDSDecoder.h"
+
+#if defined(WITH_RDS_HOST_EXTENSIONS)
+
+#include "RDSMappedFile.h"
+
+#define RDS_TMC_TABLES_MAGIC 0x54434D54UL // "TMCT"
+#define RDS_TMC_TABLES_VERSION 1
+//Size of the code space covered by each index
+#define RDS_TMC_TABLES_EVENT_CODES 2048
+#define RDS_TMC_TABLES_SUPPLEMENTARY_CODES 256
+//Marks a code not in the list, in either index
+#define RDS_TMC_TABLES_NONE 0xFFFF
+
+//Bits of TRDSTMCTableEvent.flags
+#define RDS_TMC_TABLES_NATURE(x) ((x) & 0x03)
+#define RDS_TMC_TABLES_URGENCY(x) (((x) >> 2) & 0x03)
+#define RDS_TMC_TABLES_LONGER_LASTING 0x10
+#define RDS_TMC_TABLES_SILENT_DURATION 0x20
+#define RDS_TMC_TABLES_BIDIRECTIONAL 0x40
+
+//The file is little endian throughout and laid out as follows: this header,
+//the event index (one word per event code, holding the record number or
+//RDS_TMC_TABLES_NONE), the event records, the event string pool, the
+//supplementary information index, records and string pool. All offsets are
+//in bytes from the start of the file. String pools have the same format as
+//the compiled-in ones, see gentables.py.
+typedef struct __attribute__ ((__packed__)) {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t headerSize;
+    uint32_t size;
+    uint16_t eventCount;
+    uint16_t supplementaryCount;
+    uint32_t eventIndex, events, eventStrings, eventStringsSize;
+    uint32_t supplementaryIndex, supplementary, supplementaryStrings,
+             supplementaryStringsSize;
+} TRDSTMCTablesHeader;
+
+typedef struct __attribute__ ((__packed__)) {
+    uint16_t code;
+    //Offset of the description in the event string pool
+    uint16_t description;
+    uint8_t quantifier;
+    uint8_t flags;
+    uint8_t updateClass;
+    uint8_t reserved;
+} TRDSTMCTableEvent;
+
+typedef struct __attribute__ ((__packed__)) {
+    uint8_t code;
+    uint8_t reserved;
+    //Offset of the description in the supplementary information string pool
+    uint16_t description;
+} TRDSTMCTableSupplementary;
+
+class RDSTMCTables
+{
+    public:
+        RDSTMCTables();
+        ~RDSTMCTables() { close(); }
+
+        /*
+        * Description:
+        *   Maps the table file at path, read-only. The header is checked for
+        *   sanity but the file is otherwise used as is, there is no parsing.
+        *   Opening a new file replaces the current one, which is how tables
+        *   get updated without a rebuild.
+        * Returns:
+        *   true if the tables are ready for use, false otherwise (in which
+        *   case none are mapped).
+        */
+        bool open(const char *path);
+
+        /*
+        * Description:
+        *   Unmaps the table file. Any pointers handed out before are invalid
+        *   afterwards.
+        */
+        void close(void);
+
+        /*
+        * Description:
+        *   Returns true if a table file is currently mapped.
+        */
+        bool isOpen(void) { return _header != NULL; }
+
+        /*
+        * Description:
+        *   Finds the record of an event or supplementary information code.
+        * Returns:
+        *   pointer to the record (inside the mapped file) or NULL.
+        */
+        const TRDSTMCTableEvent *findEvent(word event);
+        const TRDSTMCTableSupplementary *findSupplementary(byte code);
+
+        /*
+        * Description:
+        *   Returns the (NUL-terminated) description of the given record, and
+        *   its length in *length if length isn't NULL, straight out of the
+        *   mapped file. Returns NULL if the record points outside the string
+        *   pool.
+        */
+        const char *getText(const TRDSTMCTableEvent *entry,
+                            byte *length = NULL);
+        const char *getText(const TRDSTMCTableSupplementary *entry,
+                            byte *length = NULL);
+
+    private:
+        RDSMappedFile _file;
+        const TRDSTMCTablesHeader *_header;
+
+        //Copies would unmap the same file twice.
+        RDSTMCTables(const RDSTMCTables &);
+        RDSTMCTables &operator=(const RDSTMCTables &);
+};
+
+#endif
+#endif
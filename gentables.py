@@ -1,12 +1,13 @@
 #!/usr/bin/python
 """
-  This will read in CSV-formatted records and generate the equivalent C code as
-  well as raw EEPROM images.
+  This will read in CSV-formatted records and generate the equivalent C code (a
+  header with the declarations and a code file with the tables proper) as well
+  as raw EEPROM images.
   Used for generating the C code version of the ISO 14819-2 event list and
   supplementary information strings.
 
   Arguments:
-    $1: one of 'events' or 'supplementary'
+    $1: one of 'events', 'supplementary', 'tables', 'language' or 'locations'
     $2: source file to read in, CSV format, no header row. For both values of
         $1, the field order mimics the one in the standard, as follows:
       'events': event code, event text, event nature, event qualifier, event
@@ -14,16 +15,49 @@
                 class and event text reference phrases.
       'supplementary': supplementary information code, supplementary information
                        text.
+      'tables': the event list, as for 'events', followed by the supplementary
+                information list as $3, as for 'supplementary'. Generates the
+                binary table file for RDSTMCTables (see RDSTMCTables.h for its
+                layout) instead of C code.
+      'language': the ISO 639-1 code of the language, followed by a translated
+                  event list as $3 and a translated supplementary information
+                  list as $4, in UTF-8 and in the same formats as above (only
+                  the first two fields are used). Generates the language pack
+                  for RDSTMCLanguagePack (see RDSTMCLanguagePack.h for its
+                  layout) instead of C code.
+      'locations': the directory holding an ISO 14819-3 location table in
+                   the usual LCL exchange format (semicolon separated *.DAT
+                   files with a header row: COUNTRIES, LOCATIONDATASETS,
+                   NAMES, ADMINISTRATIVEAREA, OTHERAREAS, ROADS, SEGMENTS,
+                   POINTS, POFFSETS and SOFFSETS). Generates one location
+                   table file per table in there for RDSTMCLocations (see
+                   RDSTMCLocations.h for its layout) instead of C code.
   NOTE: this code makes assumptions about (1) the contents of iso14819-2.h and
         (2) the order of inclusion of said header with respect to the generated
         one.
+
+  All strings of a table go into a single pool, each one stored as a length
+  byte followed by the text and a terminating NUL. Records refer to their
+  string by the 16 bit offset of its length byte in the pool. The EEPROM image
+  is the very same pool, so offsets are valid for either storage option.
+
+  Event texts are additionally emitted phrase-compressed (see CompressStrings())
+  for configurations with WITH_RDS_TMC_EVENT_STRINGS_COMPRESSED, which also get
+  an EEPROM image of their own. Compressed strings are stored as a length byte
+  followed by the packed text, without a terminating NUL.
 """
 
 import csv
+import os
 import re
+import string
+import struct
 import sys
 
-WORK_TYPES = ['events', 'supplementary']
+WORK_TYPES = ['events', 'supplementary', 'tables', 'language', 'locations']
+# Number of arguments each work type takes
+WORK_ARGUMENTS = {'events': 2, 'supplementary': 2, 'tables': 3, 'language': 4,
+                  'locations': 2}
 OUTPUT_STRINGS = {'firstline': {
                       'events': 'event list',
                       'supplementary': 'supplementary information'},
@@ -31,9 +65,24 @@ OUTPUT_STRINGS = {'firstline': {
                       'events': 'TRDSTMCEventListEntry ISO14819_2_Events',
                       'supplementary': 'TRDSTMCSupplementaryEntry '
                                        'ISO14819_2_Supplementary'},
+                  'count': {
+                      'events': 'ISO14819_2_EVENTS_COUNT',
+                      'supplementary': 'ISO14819_2_SUPPLEMENTARY_COUNT'},
+                  'textsize': {
+                      'events': 'ISO14819_2_EVENT_TEXT_SIZE',
+                      'supplementary': 'ISO14819_2_SUPPLEMENTARY_TEXT_SIZE'},
+                  'pool': {
+                      'events': 'ISO14819_2_EventStrings',
+                      'supplementary': 'ISO14819_2_SupplementaryStrings'},
                   'storage': {
                       'events': 'WITH_RDS_TMC_EVENT_STRINGS_',
-                      'supplementary': 'WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_'}}
+                      'supplementary': 'WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_'},
+                  'index': {
+                      'events': 'uint16_t ISO14819_2_EventIndex',
+                      'supplementary': 'uint8_t ISO14819_2_SupplementaryIndex'}}
+# Size of the code space and "no such code" marker for each direct index
+INDEX_SIZE = {'events': 2048, 'supplementary': 256}
+INDEX_NONE = {'events': 0xFFFF, 'supplementary': 0xFF}
 QUANTIFIER_PREFIX = 'RDS_TMC_QUANTIFIER_'
 NATURE_PREFIX = 'RDS_TMC_NATURE_'
 URGENCY_PREFIX = 'RDS_TMC_URGENCY_'
@@ -45,91 +94,499 @@ URGENCIES = {'': 'NORMAL', 'U': 'URGENT', 'X': 'XURGENT'}
 FIND_Q = re.compile(r'([(][^(]*)(Q)([^)]*[)])')
 REPLACE_Q = r'\1%s\3'
 FIND_BRACE = re.compile(r'[{][^}]*[}]')
+# Phrase compression parameters, the encoding must match the one in
+# iso14819-2.h and RDSTranslator::expandTMCText()
+PHRASE_MIN_USES = 4
+PHRASE_MAX_DEPTH = 16
+PHRASE_MAX_COUNT = 0xF00
+PHRASE_SHORT_CODES = 0x80
+PHRASE_LONG_PREFIX = 0xE0
+# Table file parameters, must match RDSTMCTables.h
+TABLES_FILE = 'iso14819-2.tables'
+TABLES_MAGIC = 0x54434D54
+TABLES_VERSION = 1
+TABLES_HEADER = '<IHHIHH8I'
+TABLES_EVENT = '<HHBBBB'
+TABLES_SUPPLEMENTARY = '<BBH'
+TABLES_NONE = 0xFFFF
+# Language pack parameters, must match RDSTMCLanguagePack.h
+LANGUAGE_FILE = 'iso14819-2-%s.lang'
+LANGUAGE_MAGIC = 0x474E4C54
+LANGUAGE_VERSION = 1
+LANGUAGE_HEADER = '<IHHI8s6I'
+LANGUAGE_NONE = 0xFFFFFFFF
+# Location table file parameters, must match RDSTMCLocations.h
+LOCATIONS_FILE = 'tmc-locations-%X-%02d.lct'
+LOCATIONS_MAGIC = 0x4C434C54
+LOCATIONS_VERSION = 1
+LOCATIONS_HEADER = '<IHHIBBBBIIII8s'
+LOCATIONS_RECORD = '<HBBBBHHHHHiiIIII'
+LOCATIONS_NONE = 0xFFFFFFFF
+LOCATIONS_CATEGORIES = 'ALP'
+# Location files in the order their records are read, and the POINTS.DAT
+# columns giving the flags of TRDSTMCLocation, LSB first
+LOCATIONS_SOURCES = ['ADMINISTRATIVEAREA', 'OTHERAREAS', 'ROADS', 'SEGMENTS',
+                     'POINTS']
+LOCATIONS_FLAGS = ['INTERRUPTSROAD', 'URBAN', 'INPOS', 'INNEG', 'OUTPOS',
+                   'OUTNEG', 'PRESENTPOS', 'PRESENTNEG']
 
 
 def PostProcessString(s):
   return re.sub(FIND_BRACE, '', re.sub(FIND_Q, REPLACE_Q, s)).strip()
 
 
-def OutputStringPointer(fout, index, offset, worktype):
-  fout.write('#if defined(%sFLASH)\n' % OUTPUT_STRINGS['storage'][worktype])
+def CompressStrings(texts):
+  """
+    Byte pair encoding: keep replacing the most frequent pair of adjacent
+    symbols (characters or phrases) with a new phrase until no pair is frequent
+    enough to pay for its dictionary entry. Phrases used most often in the
+    compressed texts get the one byte codes, all others get two byte ones.
+    Returns the dictionary (a list of symbol pairs, indexed by phrase code with
+    symbols 0x100 and up standing for phrase code - 0x100), the list of
+    compressed texts and the depth of the deepest phrase.
+  """
+  for text in texts:
+    for c in text:
+      if not ' ' <= c <= '~':
+        print ('Cannot compress non-printable character 0x%02X in "%s"!' % (
+            ord(c), text))
+        exit(1)
 
-  if worktype == 'events':
-    fout.write(', Event_S_%04X\n' % index)
-  else:
-    fout.write(', Supplementary_S_%02X\n' % index)
+  seqs = [[ord(c) for c in text] for text in texts]
+  phrases = {}
+  depth = {}
+  symbol = 0x100
+  while len(phrases) < PHRASE_MAX_COUNT:
+    counts = {}
+    for seq in seqs:
+      for pair in zip(seq, seq[1:]):
+        counts[pair] = counts.get(pair, 0) + 1
+    best = None
+    for pair, count in counts.items():
+      if (count < PHRASE_MIN_USES or
+          max(depth.get(pair[0], 0), depth.get(pair[1], 0)) >=
+          PHRASE_MAX_DEPTH):
+        continue
+      # Break ties on the pair itself, so that output is reproducible
+      if best is None or (count, best) > (counts[best], pair):
+        best = pair
+    if best is None:
+      break
+
+    phrases[symbol] = best
+    depth[symbol] = 1 + max(depth.get(best[0], 0), depth.get(best[1], 0))
+    for seq in seqs:
+      i = 0
+      while i < len(seq) - 1:
+        if (seq[i], seq[i + 1]) == best:
+          seq[i:i + 2] = [symbol]
+        i += 1
+    symbol += 1
+
+  uses = {}
+  for seq in seqs:
+    for s in seq:
+      if s >= 0x100:
+        uses[s] = uses.get(s, 0) + 1
+  order = sorted(phrases, key=lambda s: (-uses.get(s, 0), s))
+  code = dict((s, i) for i, s in enumerate(order))
+
+  def Remap(s):
+    return s if s < 0x100 else 0x100 + code[s]
+
+  def Encode(s):
+    if s < 0x100:
+      return chr(s)
+    c = code[s]
+    if c < 0x1F:
+      return chr(c + 0x01)
+    elif c < PHRASE_SHORT_CODES:
+      return chr(c + 0x60)
+    c -= PHRASE_SHORT_CODES
+    return chr(PHRASE_LONG_PREFIX + (c >> 8)) + chr(c & 0xFF)
+
+  dictionary = [(Remap(phrases[s][0]), Remap(phrases[s][1])) for s in order]
+  packed = [''.join(Encode(s) for s in seq) for seq in seqs]
+
+  return dictionary, packed, max(depth.values() + [0])
+
+
+def CStringLiteral(s):
+  out = ''
+  escaped = False
+  for c in s:
+    if ' ' <= c <= '~' and c not in '"\\?':
+      # A hex escape would swallow any hex digit that follows it
+      if escaped and c in string.hexdigits:
+        out += '" "'
+      out += c
+      escaped = False
+    else:
+      out += '\\x%02X' % ord(c)
+      escaped = True
+  return '"%s"' % out
+
+
+def OutputCompressedPool(fout, packed, dictionary, depth):
+  fout.write('#if defined(WITH_RDS_TMC_EVENT_STRINGS_COMPRESSED)\n'
+             '#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)\n'
+             'const char ISO14819_2_EventStrings[] PROGMEM =\n')
+  for text in packed:
+    fout.write('\t"\\x%02X" %s\n' % (len(text), CStringLiteral(text)))
+  fout.write('\t;\n#endif\n\n'
+             'const byte ISO14819_2_EventPhrases[ISO14819_2_EVENT_PHRASES_COUNT'
+             ' * 3] PROGMEM = {\n')
+  # Two 12 bit symbols per phrase: low bytes first, then both high nibbles
+  for line in range(0, len(dictionary), 4):
+    fout.write('\t%s,\n' % ', '.join(
+        '0x%02X, 0x%02X, 0x%02X' % (a & 0xFF, b & 0xFF, (a >> 8) << 4 | b >> 8)
+        for a, b in dictionary[line:line + 4]))
+  fout.write('};\n#else\n')
+
+
+def OutputStringPool(fout, table, worktype):
+  fout.write('#if defined(%sFLASH)\nconst char %s[] PROGMEM =\n' % (
+      OUTPUT_STRINGS['storage'][worktype], OUTPUT_STRINGS['pool'][worktype]))
+  for row in table:
+    # Keep the length byte in a literal of its own, lest the hex escape eat
+    # into the text.
+    fout.write('\t"\\x%02X" "%s\\0"\n' % (
+        len(PostProcessString(row[1])), PostProcessString(row[1])))
+  fout.write('\t;\n#endif\n')
+
+
+def OutputDirectIndex(fout, table, worktype):
+  index = [INDEX_NONE[worktype]] * INDEX_SIZE[worktype]
+  for position, row in enumerate(table):
+    index[int(row[0])] = position
+  width = 4 if worktype == 'events' else 2
+
+  fout.write('\n#if defined(WITH_RDS_TMC_DIRECT_INDEX)\n'
+             'const %s[%d] PROGMEM = {\n' % (
+                 OUTPUT_STRINGS['index'][worktype], INDEX_SIZE[worktype]))
+  for line in range(0, len(index), 8):
+    fout.write('\t%s,\n' % ', '.join(
+        '0x%0*X' % (width, i) for i in index[line:line + 8]))
+  fout.write('};\n#endif\n')
+
+
+def OutputTableFile(fname, events, supplementary):
+  def Pool(table):
+    return ''.join('%c%s\x00' % (len(PostProcessString(row[1])),
+                                 PostProcessString(row[1])) for row in table)
+
+  def Index(table, size):
+    index = [TABLES_NONE] * size
+    for position, row in enumerate(table):
+      index[int(row[0])] = position
+    return struct.pack('<%dH' % size, *index)
+
+  def Align(blob):
+    return blob + '\x00' * (-len(blob) % 4)
+
+  event_records = []
+  offset = 0
+  for row in events:
+    flags = (['INFORMATION', 'FORECAST', 'SILENT'].index(NATURES[row[2]]) |
+             ['NORMAL', 'URGENT', 'XURGENT'].index(URGENCIES[row[6]]) << 2 |
+             ('L' in row[4]) << 4 |
+             ('(' in row[4] or row[3] == '7') << 5 |
+             (row[5] == '2') << 6)
+    event_records.append(struct.pack(TABLES_EVENT, int(row[0]), offset,
+                                     int(row[3]), flags, int(row[7]), 0))
+    offset += len(PostProcessString(row[1])) + 2
+  supplementary_records = []
+  offset = 0
+  for row in supplementary:
+    supplementary_records.append(struct.pack(TABLES_SUPPLEMENTARY,
+                                             int(row[0]), 0, offset))
+    offset += len(PostProcessString(row[1])) + 2
+
+  regions = [Index(events, INDEX_SIZE['events']), ''.join(event_records),
+             Pool(events), Index(supplementary, INDEX_SIZE['supplementary']),
+             ''.join(supplementary_records), Pool(supplementary)]
+  offsets = []
+  offset = struct.calcsize(TABLES_HEADER)
+  for region in regions:
+    offsets.append(offset)
+    offset += len(Align(region))
+
+  with open(fname, 'wb') as fout:
+    fout.write(struct.pack(
+        TABLES_HEADER, TABLES_MAGIC, TABLES_VERSION,
+        struct.calcsize(TABLES_HEADER), offset, len(events),
+        len(supplementary), offsets[0], offsets[1], offsets[2],
+        len(regions[2]), offsets[3], offsets[4], offsets[5],
+        len(regions[5])))
+    for region in regions:
+      fout.write(Align(region))
+
+
+def OutputLanguagePack(fname, language, events, supplementary):
+  def IndexAndPool(table, size):
+    index = [LANGUAGE_NONE] * size
+    pool = ''
+    for row in table:
+      text = PostProcessString(row[1])
+      if len(text) > 0xFF:
+        print ('Text of code %s is %d bytes long, too long for a length byte!'
+               % (row[0], len(text)))
+        exit(1)
+      index[int(row[0])] = len(pool)
+      pool += '%c%s\x00' % (len(text), text)
+    pool += '\x00' * (-len(pool) % 4)
+    return struct.pack('<%dI' % size, *index), pool
+
+  regions = list(IndexAndPool(events, INDEX_SIZE['events']) +
+                 IndexAndPool(supplementary, INDEX_SIZE['supplementary']))
+  offsets = []
+  offset = struct.calcsize(LANGUAGE_HEADER)
+  for region in regions:
+    offsets.append(offset)
+    offset += len(region)
+
+  with open(fname, 'wb') as fout:
+    fout.write(struct.pack(
+        LANGUAGE_HEADER, LANGUAGE_MAGIC, LANGUAGE_VERSION,
+        struct.calcsize(LANGUAGE_HEADER), offset, language, offsets[0],
+        offsets[1], len(regions[1]), offsets[2], offsets[3], len(regions[3])))
+    for region in regions:
+      fout.write(region)
+
+
+def ReadLocationFile(directory, name):
+  """Reads one LCL file as a list of dicts keyed by upper case column name,
+  or an empty list if there is no such file (name matching ignores case)."""
+  for fname in os.listdir(directory):
+    if fname.upper() == name + '.DAT':
+      with open(os.path.join(directory, fname), 'rb') as fin:
+        rows = list(csv.reader(fin, delimiter=';'))
+      header = [column.strip().upper() for column in rows[0]]
+      return [dict(zip(header, [field.strip() for field in row]))
+              for row in rows[1:] if row]
+  return []
+
+
+def LocationText(text):
+  """LCL files come in either UTF-8 or Windows-1252, always output UTF-8."""
+  try:
+    return text.decode('utf-8').encode('utf-8')
+  except UnicodeDecodeError:
+    return text.decode('cp1252').encode('utf-8')
 
-  fout.write(
-    '#elif defined(%sEEPROM)\n, (const char * const) 0x%04X\n'
-    '#endif\n' % (OUTPUT_STRINGS['storage'][worktype], offset))
+
+def OutputLocationTables(directory):
+  def Number(row, column):
+    return int(row.get(column) or 0)
+
+  names = {}
+  for row in ReadLocationFile(directory, 'NAMES'):
+    # First language wins, that's the one the table is published in.
+    names.setdefault((row['CID'], row['NID']), LocationText(row['NAME']))
+  countries = dict((row['CID'], row) for row in
+                   ReadLocationFile(directory, 'COUNTRIES'))
+  datasets = dict(((row['CID'], row['TABCD']), row) for row in
+                  ReadLocationFile(directory, 'LOCATIONDATASETS'))
+  offsets = {}
+  for source in ['POFFSETS', 'SOFFSETS']:
+    for row in ReadLocationFile(directory, source):
+      offsets[(row['CID'], row['TABCD'], Number(row, 'LCD'))] = (
+          Number(row, 'NEG_OFF_LCD'), Number(row, 'POS_OFF_LCD'))
+  tables = {}
+  for source in LOCATIONS_SOURCES:
+    for row in ReadLocationFile(directory, source):
+      tables.setdefault((row['CID'], row['TABCD']), []).append(row)
+
+  for (cid, tabcd), rows in sorted(tables.items()):
+    if cid not in countries:
+      print ('No country %s in COUNTRIES.DAT for table %s!' % (cid, tabcd))
+      exit(1)
+    country = int(countries[cid]['CCD'], 16)
+    ecc = int(countries[cid]['ECC'], 16)
+    pool = ['']
+    pooled = {}
+
+    def Name(text):
+      if not text:
+        return LOCATIONS_NONE
+      if text not in pooled:
+        if len(text) > 0xFF:
+          print ('Name "%s" is %d bytes long, too long for a length byte!' %
+                 (text, len(text)))
+          exit(1)
+        pooled[text] = len(pool[0])
+        pool[0] += '%c%s\x00' % (len(text), text)
+      return pooled[text]
+
+    records = []
+    for row in sorted(rows, key=lambda row: Number(row, 'LCD')):
+      code = Number(row, 'LCD')
+      negative, positive = offsets.get((cid, tabcd, code), (0, 0))
+      flags = 0
+      for bit, column in enumerate(LOCATIONS_FLAGS):
+        flags |= (Number(row, column) != 0) << bit
+      records.append(struct.pack(
+          LOCATIONS_RECORD, code, LOCATIONS_CATEGORIES.index(row['CLASS']),
+          Number(row, 'TCD'), Number(row, 'STCD'), flags,
+          Number(row, 'POL_LCD'), Number(row, 'ROA_LCD'),
+          Number(row, 'SEG_LCD'), negative, positive, Number(row, 'YCOORD'),
+          Number(row, 'XCOORD'),
+          Name(LocationText(row.get('ROADNUMBER') or
+                            row.get('JUNCTIONNUMBER') or '')),
+          Name(names.get((cid, row.get('RNID')), '')),
+          Name(names.get((cid, row.get('N1ID') or row.get('NID')), '')),
+          Name(names.get((cid, row.get('N2ID')), ''))))
+    version = datasets.get((cid, tabcd), {}).get('VERSION', '')
+    pool = pool[0] + '\x00' * (-len(pool[0]) % 4)
+    header_size = struct.calcsize(LOCATIONS_HEADER)
+    size = header_size + len(records) * struct.calcsize(LOCATIONS_RECORD)
+    with open(LOCATIONS_FILE % (country, int(tabcd)), 'wb') as fout:
+      fout.write(struct.pack(
+          LOCATIONS_HEADER, LOCATIONS_MAGIC, LOCATIONS_VERSION, header_size,
+          size + len(pool), country, ecc, int(tabcd), 0, len(records),
+          header_size, size, len(pool), version[:8]))
+      fout.write(''.join(records))
+      fout.write(pool)
 
 
 def main(argv):
-  if len(argv) != 3:
-    print ('Invalid calling convention, need exactly two arguments but got '
-           '%d!' % (len(argv) - 1))
-    exit(1)
-  if argv[1] not in WORK_TYPES:
+  if len(argv) < 2 or argv[1] not in WORK_TYPES:
     print ('Invalid calling convention, argv[1] must be one of %s but got '
-           '"%s"!' % (WORK_TYPES, argv[1]))
+           '"%s"!' % (WORK_TYPES, argv[1] if len(argv) > 1 else ''))
+    exit(1)
+  if len(argv) != WORK_ARGUMENTS[argv[1]] + 1:
+    print ('Invalid calling convention, need exactly %d arguments but got '
+           '%d!' % (WORK_ARGUMENTS[argv[1]], len(argv) - 1))
     exit(1)
 
+  if argv[1] == 'language':
+    if not re.match('^[a-z]{2}$', argv[2]):
+      print ('Invalid calling convention, argv[2] must be an ISO 639-1 '
+             'language code but got "%s"!' % argv[2])
+      exit(1)
+    with open(argv[3], 'rb') as fevents, open(argv[4], 'rb') as fsupp:
+      OutputLanguagePack(LANGUAGE_FILE % argv[2], argv[2],
+                         list(csv.reader(fevents)), list(csv.reader(fsupp)))
+    return
+
+  if argv[1] == 'locations':
+    OutputLocationTables(argv[2])
+    return
+
+  if argv[1] == 'tables':
+    with open(argv[2], 'rb') as fevents, open(argv[3], 'rb') as fsupp:
+      OutputTableFile(TABLES_FILE, list(csv.reader(fevents)),
+                      list(csv.reader(fsupp)))
+    return
+
   if argv[1] == 'events':
-    fname_out = 'iso14819-2-events.h'
-    fname_eeprom = 'iso14819-2-events.eeprom'
+    fname_out = 'iso14819-2-events'
   else:
-    fname_out = 'iso14819-2-supplementary.h'
-    fname_eeprom = 'iso14819-2-supplementary.eeprom'
-  eeprom_offset = 0
+    fname_out = 'iso14819-2-supplementary'
+  pool_offset = 0
+  packed_offset = 0
+  substitutions = {
+      'firstline': OUTPUT_STRINGS['firstline'][argv[1]],
+      'fname': fname_out.upper().replace('-','_') + '_H',
+      'worktype': argv[1].upper(),
+      'count': OUTPUT_STRINGS['count'][argv[1]],
+      'textsize': OUTPUT_STRINGS['textsize'][argv[1]],
+      'varname': OUTPUT_STRINGS['varname'][argv[1]],
+      'pool': OUTPUT_STRINGS['pool'][argv[1]],
+      'storage': OUTPUT_STRINGS['storage'][argv[1]],
+      'index': OUTPUT_STRINGS['index'][argv[1]],
+      'indexsize': INDEX_SIZE[argv[1]]}
 
-  with open(argv[2], 'rb') as fin, open(fname_out, 'w') as fout,\
-      open(fname_eeprom, 'wb') as feeprom:
+  with open(argv[2], 'rb') as fin, open(fname_out + '.h', 'w') as fout,\
+      open(fname_out + '.cpp', 'w') as fcode,\
+      open(fname_out + '.eeprom', 'wb') as feeprom:
     table = list(csv.reader(fin))
+    substitutions['records'] = len(table)
+    substitutions['maxtext'] = 1 + max(
+        len(PostProcessString(row[1])) for row in table)
+    if argv[1] == 'events':
+      dictionary, packed, depth = CompressStrings(
+          [PostProcessString(row[1]) for row in table])
+      substitutions['phrases'] = len(dictionary)
+      substitutions['depth'] = depth
+
     fout.write(
         '/*\n * ISO 14819-2 header file: %(firstline)s entries\n'
         ' * DO NOT EDIT: automatically generated by gentables.py from CSV files'
         '\n */\n\n'
         '#ifndef _%(fname)s_INCLUDED\n#define _%(fname)s_INCLUDED\n'
-        '#ifdef WITH_RDS_TMC_%(worktype)s\n\n' % {
-            'firstline': OUTPUT_STRINGS['firstline'][argv[1]],
-            'fname': fname_out.upper().replace('-','_').replace('.','_'),
-            'worktype': argv[1].upper()})
+        '#ifdef WITH_RDS_TMC_%(worktype)s\n\n'
+        '#define %(count)s %(records)d\n'
+        '#define %(textsize)s %(maxtext)d\n\n'
+        '#if defined(%(storage)sFLASH)\n'
+        'extern const char %(pool)s[] PROGMEM;\n'
+        '#endif\n'
+        'extern const %(varname)s[%(count)s] PROGMEM;\n'
+        '#if defined(WITH_RDS_TMC_DIRECT_INDEX)\n'
+        'extern const %(index)s[%(indexsize)d] PROGMEM;\n'
+        '#endif\n' % substitutions)
+    if argv[1] == 'events':
+      fout.write(
+          '\n#if defined(WITH_RDS_TMC_EVENT_STRINGS_COMPRESSED)\n'
+          '#define ISO14819_2_EVENT_PHRASES_COUNT %(phrases)d\n'
+          '#define ISO14819_2_EVENT_PHRASES_DEPTH %(depth)d\n\n'
+          'extern const byte ISO14819_2_EventPhrases['
+          'ISO14819_2_EVENT_PHRASES_COUNT * 3] PROGMEM;\n'
+          '#endif\n' % substitutions)
+    fout.write('\n#endif\n#endif')
+
+    fcode.write(
+        '/*\n * ISO 14819-2 code file: %(firstline)s entries\n'
+        ' * DO NOT EDIT: automatically generated by gentables.py from CSV files'
+        '\n */\n\n'
+        '#include "iso14819-2.h"\n\n'
+        '#ifdef WITH_RDS_TMC_%(worktype)s\n\n' % substitutions)
 
-    fout.write('#if defined(%sFLASH)\n' % OUTPUT_STRINGS['storage'][argv[1]])
+    if argv[1] == 'events':
+      OutputCompressedPool(fcode, packed, dictionary, depth)
+      OutputStringPool(fcode, table, argv[1])
+      fcode.write('#endif\n')
+      with open(fname_out + '-compressed.eeprom', 'wb') as fpacked:
+        for text in packed:
+          fpacked.write('%c%s' % (len(text), text))
+    else:
+      OutputStringPool(fcode, table, argv[1])
     for row in table:
-      fout.write('const char %s_S_%s[] PROGMEM = "%s";\n' % (
-          'Event' if argv[1] == 'events' else 'Supplementary',
-          '%04X' % int(row[0]) if argv[1] == 'events' else '%02X' % int(row[0]),
-          PostProcessString(row[1])))
-      feeprom.write('%s\x00' % PostProcessString(row[1]))
-    fout.write('#endif\n')
+      feeprom.write('%c%s\x00' % (
+          len(PostProcessString(row[1])), PostProcessString(row[1])))
 
-    fout.write('\nconst %(varname)s[%(count)d] PROGMEM = {\n' % {
-            'varname': OUTPUT_STRINGS['varname'][argv[1]],
-            'count': len(table)})
+    fcode.write('\nconst %(varname)s[%(count)s] PROGMEM = {\n' %
+                substitutions)
 
     if argv[1] == 'events':
-      for row in table:
-        fout.write('\t{0x%04X, %s, %s, %s, %s, %s, %s, %s\n' % (
-            int(row[0]),
-            '%s%s' % (QUANTIFIER_PREFIX, QUANTIFIERS[int(row[3])]),
-            '%s%s' % (NATURE_PREFIX, NATURES[row[2]]),
-            '%s%s' % (URGENCY_PREFIX, URGENCIES[row[6]]),
-            'true' if 'L' in row[4] else 'false',
-            'true' if '(' in row[4] or row[3] == '7' else 'false',
-            'true' if row[5] == '2' else 'false',
-            row[7]))
-        OutputStringPointer(fout, int(row[0]), eeprom_offset, argv[1])
-        eeprom_offset += len(PostProcessString(row[1])) + 1;
-        fout.write('},\n')
+      for position, row in enumerate(table):
+        fcode.write(
+            '\t{0x%04X, %s, %s, %s, %s, %s, %s, %s '
+            'RDS_TMC_EVENT_STRING(0x%04X, 0x%04X)},\n' % (
+                int(row[0]),
+                '%s%s' % (QUANTIFIER_PREFIX, QUANTIFIERS[int(row[3])]),
+                '%s%s' % (NATURE_PREFIX, NATURES[row[2]]),
+                '%s%s' % (URGENCY_PREFIX, URGENCIES[row[6]]),
+                'true' if 'L' in row[4] else 'false',
+                'true' if '(' in row[4] or row[3] == '7' else 'false',
+                'true' if row[5] == '2' else 'false',
+                row[7], pool_offset, packed_offset))
+        pool_offset += len(PostProcessString(row[1])) + 2
+        packed_offset += len(packed[position]) + 1
     else:
       for row in table:
-        fout.write('\t{0x%02X\n' % int(row[0]))
-        OutputStringPointer(fout, int(row[0]), eeprom_offset, argv[1])
-        eeprom_offset += len(PostProcessString(row[1])) + 1;
-        fout.write('},\n')
+        fcode.write('\t{0x%02X, 0x%04X},\n' % (int(row[0]), pool_offset))
+        pool_offset += len(PostProcessString(row[1])) + 2
+
+    if pool_offset > 0x10000:
+      print ('String pool is %d bytes long, too big for 16 bit offsets!' %
+             pool_offset)
+      exit(1)
+
+    fcode.write('};\n')
+    OutputDirectIndex(fcode, table, argv[1])
 
-    fout.write('};\n\n#endif\n#endif')
+    fcode.write('\n#endif\n')
 
 
 if __name__ == '__main__':
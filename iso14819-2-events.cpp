@@ -0,0 +1,5251 @@
+/*
+ * ISO 14819-2 code file: event list entries
+ * DO NOT EDIT: automatically generated by gentables.py from CSV files
+ */
+
+#include "iso14819-2.h"
+
+#ifdef WITH_RDS_TMC_EVENTS
+
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_COMPRESSED)
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+const char ISO14819_2_EventStrings[] PROGMEM =
+	"\x03" "\xC6\xE0\x84"
+	"\x03" "\xE1P\x18"
+	"\x11" "\xE0)\xE0\xC8\xE0\xB2sy\x85\xE0\xFC\xE1/gg\x13\x1F"
+	"\x11" "\x02,\xE0\xC5\xE1#\x0A\xE2\xD2\xE2" "f\xE1\x84\xE0\x07\xE0n"
+	"\x10" "\x82\xCA\xE0\x1F" "cu\x09\xC8\x94" "c\xE0\x96\xE1\xCF\xE1\x85"
+	"\x14" "\xE0\xD6 \xE0)\xE2\x1Cwd\x1F\xE2\x94\xC3\xE2\x8D\xD7\xE2\xA4\xE0\xD6"
+	"\x0A" "\xE0\xD6,\x89\xD4\xC2\x85\xE0!\x82"
+	"\x0B" "\xE0\xD6\xCA\xE1" "8au\xE2J\x8A\x82"
+	"\x03" "\xE0\x87\x82"
+	"\x06" "t\xA9\xE0r\xC2\x82"
+	"\x03" "\xE0\x87\x95"
+	"\x06" "t\xA9\xE0r\xC2\x95"
+	"\x0D" "\x8B\xE1\xC6\xE0`\x13\xE2" "Ft\xE1\xFF\xE2\x95"
+	"\x08" "f\xD4\xC2\x85\xE0!\xE0-"
+	"\x09" "\xE1" "8au\xE2J\x8A\xE0-"
+	"\x0A" "\xE2\xA1\x0A\xD8\xE0\x87\xE2`\x81\x80"
+	"\x08" "\xE1\x82\x7F\x13\x8A\xE0\xC7\x1F"
+	"\x06" "\xE1\xC9\xE1\xF7\xE0\x88"
+	"\x06" "\xE1\xC9\xE1\xF7\xE0\xE1"
+	"\x08" "\xCD\xCA\xE1\xC9\xE1\xF7\xE0\x88"
+	"\x0A" "\xE0\xCE\x8F\xE1\x08h\xE2\xA2" "d\x13"
+	"\x07" "\xE0\xCE\xE1=\xAE\xE0Q"
+	"\x04" "\xC6\xE0\x84\xD9"
+	"\x03" "\xE1\xE0\xD9"
+	"\x07" "n\xE1\xB3\x7F\xE0N\xD9"
+	"\x07" "\xE0}\xE1)\xE0i\x98"
+	"\x07" "\x01\xE2" "Bpi\xD1\xC0"
+	"\x08" "\xE0}\xE1)\xE0i\xE1" "d"
+	"\x06" "\xE2" "Bpi\xD1\x06"
+	"\x05" "\xE0M1\xE0" "F"
+	"\x05" "\xE0M2\xE0" "F"
+	"\x05" "\xE0M3\xE0" "F"
+	"\x05" "\xE0M4\xE0" "F"
+	"\x05" "\xE0M5\xE0" "F"
+	"\x05" "\xE0M6\xE0" "F"
+	"\x05" "\xE0M7\xE0" "F"
+	"\x06" "\xE0T\xE1\xAB\xE2\xC4"
+	"\x07" "\xE2" "1\xA0\xE0\x9F\xE2\xB6"
+	"\x03" "\x04\xE0\xD0"
+	"\x02" "\x0B\x17"
+	"\x03" "\x8C\xE0\xD0"
+	"\x03" "\x8D\xE0\xD0"
+	"\x03" "\x90\xE0\xD0"
+	"\x08" "\xE0" "a\xD3u\xE0\x95\xE0\xD0"
+	"\x04" "\xE1\xE0\xE0H"
+	"\x01" "\x05"
+	"\x05" "\xE1\x81\xE0" "7s"
+	"\x02" "\xE0^"
+	"\x04" "\xE0^\xE1\xBE"
+	"\x04" "\xE1Q\xE1\xBA"
+	"\x04" "\xE1Q\xE1\xBC"
+	"\x04" "\xE1Q\xE1\xBD"
+	"\x04" "\xE0^\xE1\xBF"
+	"\x03" "\xE0^\xD9"
+	"\x02" "\xE1P"
+	"\x05" "\xE0]\xE1\xBE\x97"
+	"\x05" "\xE1O\xE1\xBA\x97"
+	"\x05" "\xE1O\xE1\xBC\x97"
+	"\x05" "\xE1O\xE1\xBD\x97"
+	"\x05" "\xE0]\xE1\xBF\x97"
+	"\x03" "\xE0]\xD9"
+	"\x03" "\xE0s\x97"
+	"\x05" "\xE0s\xE1\xBE\x97"
+	"\x05" "\xE1n\xE1\xBA\x97"
+	"\x05" "\xE1n\xE1\xBC\x97"
+	"\x05" "\xE1n\xE1\xBD\x97"
+	"\x05" "\xE0s\xE1\xBF\x97"
+	"\x03" "\xE0s\xD9"
+	"\x05" "\xE0T\xE1\xAB\x97"
+	"\x05" "\xE0T\xE1\xAB\xD9"
+	"\x06" "t\xE2~\xA2\xE0\xB6"
+	"\x04" "\xC6\xE2y\x97"
+	"\x09" "\x9C\xE0\x84\xE1\xDE\xE0~\xE0\xC4"
+	"\x04" "\xE2" "1\xA0\x96"
+	"\x01" "\x05"
+	"\x04" "\xE1Q\xE1\xBB"
+	"\x03" "\xAF\xE0^"
+	"\x05" "\xE1O\xE1\xBB\x97"
+	"\x03" "\xAF\xE1P"
+	"\x09" "\xE0> q\xD4\xD4\x08\xE0\xB6"
+	"\x05" "\xE1n\xE1\xBB\x97"
+	"\x05" "\xC6\xE2\x17\xE0\xC0"
+	"\x03" "\xE1\xE0\x97"
+	"\x0D" "\xE2\xB5\xE0\xFD\xE1\x14\xDA\xE1\xE2\xE0g\xE0\xB6"
+	"\x0F" "\xE1P\xE0\xF7" "Ap\xE0W\xD3h\xE2+\xE0" "7e"
+	"\x11" "\xE0]\xE1\xA9\xE2S\xE1\xA9 b\xE0" "2\xE0" "9\xB2\xE2#"
+	"\x11" "\xE0] \xE0)\xDA\xE0\x5C\xE0\x1F\x8A\xD8" "a h\xC1l"
+	"\x13" "\xE0\x00\xE2" "b\xE0" "2\xE0\x93\x96\xCA\x9C\xE0\x84\xE1\xDE\xE0~\xE0\xC4"
+	"\x0C" "\xC6\xE1\x02i\x13\xDA\xE1\xE2\xE0g\xE0\xB6"
+	"\x13" "\xC6\xE0(m\xE2\x04h \xE1\x02i\x13\xDA\xE1\xE2\xE0g\xE0\xB6"
+	"\x0D" "\xE0xl\xA3 \xE0\x02p\xC1\x09\xE0X\x03"
+	"\x01" "\x02"
+	"\x05" "\x01\xE2\xB4\xE0V"
+	"\x11" "\xE0xl\xA3-\xE0\x02\xE0\x07(\xE0\xEF\xE0" "6\xB4\xE0\xF6"
+	"\x0C" "\xE0\x07\xE0\xEF(a/\xE0\x1C \xE0'"
+	"\x08" "\x02 \xE0\xEF\xE1\x9D\x7Fs"
+	"\x08" "\xE2\xCA\xD4\xC2\xE0\x0C\xE0V"
+	"\x0B" "\x01\xE2\x8Cm\xE0/\xB8\xE0\x0C\xE0V"
+	"\x01" "\x11"
+	"\x0B" "\x02 \xE1=\xE0j\xDB\xE2P\xE2j"
+	"\x01" "\x07"
+	"\x01" "\x86"
+	"\x04" "\xE1\xC8\xE0'"
+	"\x06" "\x01\xE0\x02\xE1\xE1\xC0"
+	"\x04" "\x01\xE2N\xC0"
+	"\x02" "\x02\x14"
+	"\x03" "\x02\xE0\x08"
+	"\x03" "\x02\xE0\x11"
+	"\x03" "\x02\xE0\x13"
+	"\x03" "\x02\xE0\x14"
+	"\x03" "\x02\xE0\x09"
+	"\x02" "\x02\x18"
+	"\x02" "\x02\x1A"
+	"\x03" "\x02\xE0\x0A"
+	"\x03" "\x02\xE0\x15"
+	"\x03" "\x02\xE0\x17"
+	"\x03" "\x02\xE0\x18"
+	"\x03" "\x02\xE0\x0B"
+	"\x02" "\x02\x1C"
+	"\x02" "\x02\x19"
+	"\x03" "\x02\xE0\x05"
+	"\x03" "\x02\xE0\x0D"
+	"\x03" "\x02\xE0\x0F"
+	"\x03" "\x02\xE0\x10"
+	"\x03" "\x02\xE0\x06"
+	"\x02" "\x02\x1B"
+	"\x02" "\x02\x15"
+	"\x02" "\x02\x17"
+	"\x02" "\x02\x1E"
+	"\x02" "\x02\x1D"
+	"\x03" "\x8B\x83\x02"
+	"\x03" "\x02\xE1x"
+	"\x03" "\x02\xE1~"
+	"\x03" "\x02\xE1}"
+	"\x04" "\x02\xE0\xCD\x95"
+	"\x03" "\x02\xE1{"
+	"\x03" "\x02\xE1|"
+	"\x03" "\xE0\x1E\x03"
+	"\x03" "\xE0\x1E\x0C"
+	"\x03" "\xE0\x1E\x0E"
+	"\x02" "\x11\x14"
+	"\x03" "\x11\xE0\x08"
+	"\x03" "\x11\xE0\x11"
+	"\x03" "\x11\xE0\x13"
+	"\x03" "\x11\xE0\x14"
+	"\x03" "\x11\xE0\x09"
+	"\x02" "\x11\x18"
+	"\x02" "\x11\x1A"
+	"\x03" "\x11\xE0\x0A"
+	"\x03" "\x11\xE0\x15"
+	"\x03" "\x11\xE0\x17"
+	"\x03" "\x11\xE0\x18"
+	"\x03" "\x11\xE0\x0B"
+	"\x02" "\x11\x1C"
+	"\x02" "\x11\x19"
+	"\x03" "\x11\xE0\x05"
+	"\x03" "\x11\xE0\x0D"
+	"\x03" "\x11\xE0\x0F"
+	"\x03" "\x11\xE0\x10"
+	"\x03" "\x11\xE0\x06"
+	"\x02" "\x11\x1B"
+	"\x02" "\x11\x15"
+	"\x02" "\x11\x17"
+	"\x02" "\x11\x1D"
+	"\x05" "\xE1\xB9\xE0\x1E\x03"
+	"\x05" "\xE1\xB9\xE0\x1E\x0C"
+	"\x05" "\xE1\xB9\xE0\x1E\x0E"
+	"\x02" "\x07\x14"
+	"\x03" "\x07\xE0\x08"
+	"\x03" "\x07\xE0\x11"
+	"\x03" "\x07\xE0\x13"
+	"\x03" "\x07\xE0\x14"
+	"\x03" "\x07\xE0\x09"
+	"\x02" "\x07\x18"
+	"\x02" "\x07\x1A"
+	"\x03" "\x07\xE0\x0A"
+	"\x03" "\x07\xE0\x15"
+	"\x03" "\x07\xE0\x17"
+	"\x03" "\x07\xE0\x18"
+	"\x03" "\x07\xE0\x0B"
+	"\x02" "\x07\x1C"
+	"\x02" "\x07\x19"
+	"\x03" "\x07\xE0\x05"
+	"\x03" "\x07\xE0\x0D"
+	"\x03" "\x07\xE0\x0F"
+	"\x03" "\x07\xE0\x10"
+	"\x03" "\x07\xE0\x06"
+	"\x02" "\x07\x1B"
+	"\x02" "\x07\x15"
+	"\x02" "\x07\x17"
+	"\x02" "\x07\x1E"
+	"\x02" "\x07\x1D"
+	"\x03" "\xE0*\x07"
+	"\x03" "\x07\xE1x"
+	"\x03" "\x07\xE1~"
+	"\x03" "\x07\xE1}"
+	"\x04" "\x07\xE0\xCD\x95"
+	"\x03" "\x07\xE1{"
+	"\x03" "\x07\xE1|"
+	"\x05" "\xE1\xB5\xE0Y\x03"
+	"\x05" "\xE1\xB5\xE0Y\x0C"
+	"\x05" "\xE1\xB5\xE0Y\x0E"
+	"\x02" "\x86\x14"
+	"\x02" "\x86\x18"
+	"\x02" "\x86\x1A"
+	"\x02" "\x86\x1C"
+	"\x02" "\x86\x19"
+	"\x02" "\x86\x1B"
+	"\x02" "\x86\x15"
+	"\x02" "\x86\x17"
+	"\x02" "\x86\x1E"
+	"\x05" "\x86.T\xE2\x15"
+	"\x04" "\xE0*\x86."
+	"\x03" "\x86\xE1x"
+	"\x03" "\x86\xE1~"
+	"\x03" "\x86\xE1}"
+	"\x04" "\x86\xE0\xCD\x95"
+	"\x03" "\x86\xE1{"
+	"\x03" "\x86\xE1|"
+	"\x04" "\xE1\xC3\xB4\x03"
+	"\x04" "\xE1\xC3\xB4\x0C"
+	"\x04" "\xE1\xC3\xB4\x0E"
+	"\x03" "\xE0\x07\x96"
+	"\x01" "\x05"
+	"\x0F" "\xE0\x07\xE0\xEF(a/\xE0\x1C \xE0\x83(\xE0\xA7"
+	"\x08" "\x01o\xE0\xAD\xE0\x0C\xE0V"
+	"\x01" "\x93"
+	"\x04" "\xE2\x85\xE0'"
+	"\x0E" "\x01j\xE1>knif\x1F\xE0%\xC1\x13\xC0"
+	"\x0F" "\x01j\xE1>knif\x81\xE0\xA5\x87v\xD7\xC0"
+	"\x14" "\x01j\xE1>knif\x81\xD0\xE0z\xE2\xAFt\x81\xE2\x83\xE2\x90"
+	"\x0A" "\xE1" "6 \xE0\xFF\xA9\xE1\xA9\xE2S"
+	"\x02" "\xE2\xAB"
+	"\x0B" "\xE0\x07\xB2\xE0Ps\xA3g\xE0!\xB1"
+	"\x08" "\x01\xA8\xC4" "d\xE1" "4\xE0V"
+	"\x07" "\xE1\xC8\xE0\x83(\xE0\xA7"
+	"\x06" "\x01\xE0)\xE0\xC8\xDC"
+	"\x03" "\x02\xE0\x12"
+	"\x03" "\x02\xE0\x16"
+	"\x03" "\x02\xE0\x0E"
+	"\x08" "\x02 \xDF\xB3\xE1\xE6\xE0n"
+	"\x03" "\x11\xE0\x12"
+	"\x03" "\x11\xE0\x16"
+	"\x03" "\x11\xE0\x0E"
+	"\x02" "\x11\x06"
+	"\x03" "\x07\xE0\x12"
+	"\x03" "\x07\xE0\x16"
+	"\x03" "\x07\xE0\x0E"
+	"\x02" "\x07\x06"
+	"\x02" "\x93\x14"
+	"\x02" "\x93\x18"
+	"\x02" "\x93\x1A"
+	"\x02" "\x93\x1C"
+	"\x02" "\x93\x19"
+	"\x02" "\x93\x1B"
+	"\x02" "\x93\x15"
+	"\x02" "\x93\x17"
+	"\x02" "\x93\x1D"
+	"\x03" "\xE0*\x93"
+	"\x03" "\x93\xE1x"
+	"\x03" "\x93\xE1~"
+	"\x03" "\x93\xE1}"
+	"\x03" "\x93\xE1{"
+	"\x03" "\x93\xE1|"
+	"\x06" "\xE1\x07\xE1\xCB\xB4\x03"
+	"\x06" "\xE1\x07\xE1\xCB\xB4\x0C"
+	"\x06" "\xE1\x07\xE1\xCB\xB4\x0E"
+	"\x02" "\x93\x06"
+	"\x05" "S\xE2" "c\xE0J"
+	"\x09" "D\xE2\x01\xE0\x98\xE0^\xE0J"
+	"\x04" "\xE2" "d\xE0J"
+	"\x09" "D\xE2\x01\xE0\x98\xE0]\xE0J"
+	"\x05" "S\xE2" "a\xE0J"
+	"\x05" "H\xE2i\xE0J"
+	"\x05" "T\xE2\x15\xE0J"
+	"\x09" "D\xE0\x9D\xE0\x22\xE2" "9\xE0\x1E"
+	"\x0C" "L\xE1\xAE\xAA\xE0\x9D\xE0\x22\xE2" "9\xE0\x1E"
+	"\x0C" "\xE0\x07\xB2\xE0Ps\xA3g\xE0!\xB1\x06"
+	"\x09" "\x01\xA8\xC4" "d\xE1" "4\xE0V\x06"
+	"\x02" "\x86\x06"
+	"\x05" "\xE1\xC8\xE0'\x06"
+	"\x02" "\x8B\x96"
+	"\x05" "\xE2\xA6\xE0<\x96"
+	"\x0E" "\xE0\x1F" "cu\x09\xC8\x94" "c\xE0\x96\xE1\xCF\xE1\x85"
+	"\x01" "\x05"
+	"\x01" "\x82"
+	"\x01" "\x95"
+	"\x06" "\xE0" "E\xC5\xAB\xE1\xF8"
+	"\x0B" "\xE0\x1D\xDA\xE0\xC6\xE0N\xE0" "5\xE1\x88"
+	"\x07" "\xE0\x1D\xDA\xE0\xC6\xE0N"
+	"\x07" "\xE1\x92\xE0\x80\xE0\xDE\x82"
+	"\x07" "\xE1\x92\xE0\x7F\xE0\xDE\x82"
+	"\x04" "\xE0+\x08\x82"
+	"\x06" "\xE0\xDE\xE0\xA9\xA4s"
+	"\x02" "\x0B\x14"
+	"\x03" "\x0B\xE0\x08"
+	"\x03" "\x0B\xE0\x11"
+	"\x03" "\x0B\xE0\x13"
+	"\x03" "\x0B\xE0\x14"
+	"\x03" "\x0B\xE0\x09"
+	"\x02" "\x0B\x18"
+	"\x02" "\x0B\x1A"
+	"\x03" "\x0B\xE0\x0A"
+	"\x03" "\x0B\xE0\x15"
+	"\x03" "\x0B\xE0\x17"
+	"\x03" "\x0B\xE0\x18"
+	"\x03" "\x0B\xE0\x0B"
+	"\x02" "\x0B\x1C"
+	"\x02" "\x0B\x19"
+	"\x03" "\x0B\xE0\x05"
+	"\x03" "\x0B\xE0\x0D"
+	"\x03" "\x0B\xE0\x0F"
+	"\x03" "\x0B\xE0\x10"
+	"\x03" "\x0B\xE0\x06"
+	"\x02" "\x0B\x1B"
+	"\x02" "\x0B\x15"
+	"\x02" "\x0B\x17"
+	"\x02" "\x0B\x1E"
+	"\x02" "\x0B\x1D"
+	"\x02" "\x0B\x03"
+	"\x02" "\x0B\x0C"
+	"\x02" "\x0B\x0E"
+	"\x02" "\x0F\x14"
+	"\x03" "\x0F\xE0\x08"
+	"\x03" "\x0F\xE0\x11"
+	"\x03" "\x0F\xE0\x13"
+	"\x03" "\x0F\xE0\x14"
+	"\x03" "\x0F\xE0\x09"
+	"\x02" "\x0F\x18"
+	"\x02" "\x0F\x1A"
+	"\x03" "\x0F\xE0\x0A"
+	"\x03" "\x0F\xE0\x15"
+	"\x03" "\x0F\xE0\x17"
+	"\x03" "\x0F\xE0\x18"
+	"\x03" "\x0F\xE0\x0B"
+	"\x02" "\x0F\x1C"
+	"\x02" "\x0F\x19"
+	"\x03" "\x0F\xE0\x05"
+	"\x03" "\x0F\xE0\x0D"
+	"\x03" "\x0F\xE0\x0F"
+	"\x03" "\x0F\xE0\x10"
+	"\x03" "\x0F\xE0\x06"
+	"\x02" "\x0F\x1B"
+	"\x02" "\x0F\x15"
+	"\x02" "\x0F\x17"
+	"\x02" "\x0F\x1E"
+	"\x02" "\x0F\x1D"
+	"\x02" "\x0F\x03"
+	"\x02" "\x0F\x0C"
+	"\x02" "\x0F\x0E"
+	"\x05" "\xE0+\x08\xE0-"
+	"\x02" "\xE0-"
+	"\x01" "\x05"
+	"\x01" "\x0B"
+	"\x01" "\x0F"
+	"\x08" "\x01\xE0\x80\xE0+\xE0i\x82"
+	"\x07" "\xE1\x92\xE0\x80\xE0\xDE\x95"
+	"\x03" "\xE0\x80\x95"
+	"\x08" "\x01\xE0\x7F\xE0+\xE0i\x82"
+	"\x07" "\xE1\x92\xE0\x7F\xE0\xDE\x95"
+	"\x03" "\xE0\x7F\x95"
+	"\x04" "\xE0+\x08\x95"
+	"\x09" "\xC4\xE0r\xE0S\x0A\xE1\xE3\x82"
+	"\x03" "\xE2Z\x82"
+	"\x06" "\xE1" "Ct\xE1\x8C\x82"
+	"\x06" "\x84\xE2'\xE1\x8C\x82"
+	"\x07" "\xE0Rp\xE0\x1F\x08\xA6"
+	"\x06" "\xB6\xE0\xC6\xE0\xC5\xA6"
+	"\x03" "\xE1\x86\xA6"
+	"\x09" "\xC4\xE0r\xE0S\x0A\xE1\xE3\x95"
+	"\x03" "\xE2Z\x95"
+	"\x06" "\xE1" "Ct\xE1\x8C\x95"
+	"\x06" "\x84\xE2'\xE1\x8C\x95"
+	"\x08" "\xE0Rp\xE0\x1F\x08\xE0\xAA"
+	"\x07" "\xB6\xE0\xC6\xE0\xC5\xE0\xAA"
+	"\x04" "\xE1\x86\xE0\xAA"
+	"\x03" "\xE0\xD9\xAD"
+	"\x04" "\xE0\xA9\xA4s"
+	"\x04" "\xE0" "E\xE1\x88"
+	"\x03" "\x0B\xE0\x12"
+	"\x03" "\x0B\xE0\x16"
+	"\x03" "\x0B\xE0\x0E"
+	"\x03" "\x0F\xE0\x12"
+	"\x03" "\x0F\xE0\x16"
+	"\x03" "\x01\xE0\x88"
+	"\x06" "\x01\xE1" "C\x8A\xE0\x88"
+	"\x06" "\x01" "c\xE2<\xE0\x88"
+	"\x06" "\x01\x84\xE2:\xE0\x88"
+	"\x04" "h\xE1\xE8\x82"
+	"\x04" "t\xE2\x13\xA6"
+	"\x04" "\xB6\xE0\xA1\xA6"
+	"\x06" "\x01\xE1" "C\x8A\xE0\xE1"
+	"\x06" "\x01" "c\xE2<\xE0\xE1"
+	"\x06" "\x01\x84\xE2:\xE0\xE1"
+	"\x04" "h\xE1\xE8\x95"
+	"\x05" "t\xE2\x13\xE0\xAA"
+	"\x05" "\xB6\xE0\xA1\xE0\xAA"
+	"\x06" "\xE0\xC0\xE2\xDE\xE1\x8F"
+	"\x01" "\xBA"
+	"\x01" "\xBB"
+	"\x01" "\xBC"
+	"\x01" "\x0D"
+	"\x01" "\xB9"
+	"\x01" "\xBE"
+	"\x03" "\x01\xE0\xE1"
+	"\x02" "\x16\x14"
+	"\x03" "\x16\xE0\x08"
+	"\x03" "\x16\xE0\x11"
+	"\x03" "\x16\xE0\x13"
+	"\x03" "\x16\xE0\x14"
+	"\x03" "\x16\xE0\x09"
+	"\x02" "\x16\x18"
+	"\x02" "\x16\x1A"
+	"\x03" "\x16\xE0\x0A"
+	"\x03" "\x16\xE0\x15"
+	"\x03" "\x16\xE0\x17"
+	"\x03" "\x16\xE0\x18"
+	"\x03" "\x16\xE0\x0B"
+	"\x02" "\x16\x1C"
+	"\x02" "\x16\x19"
+	"\x03" "\x16\xE0\x05"
+	"\x03" "\x16\xE0\x0D"
+	"\x03" "\x16\xE0\x0F"
+	"\x03" "\x16\xE0\x10"
+	"\x03" "\x16\xE0\x06"
+	"\x02" "\x16\x1B"
+	"\x02" "\x16\x15"
+	"\x02" "\x16\x17"
+	"\x03" "\x80\xA6\x1E"
+	"\x03" "\x80\xA6\x1D"
+	"\x02" "\xBA\x14"
+	"\x02" "\xBA\x18"
+	"\x02" "\xBA\x1A"
+	"\x02" "\xBA\x1C"
+	"\x02" "\xBA\x19"
+	"\x02" "\xBA\x1B"
+	"\x02" "\xBA\x15"
+	"\x02" "\xBA\x17"
+	"\x02" "\xBA\x1E"
+	"\x02" "\xBA\x1D"
+	"\x02" "\xBB\x14"
+	"\x02" "\xBB\x18"
+	"\x02" "\xBB\x1A"
+	"\x02" "\xBB\x1C"
+	"\x02" "\xBB\x19"
+	"\x02" "\xBB\x1B"
+	"\x02" "\xBB\x15"
+	"\x02" "\xBB\x17"
+	"\x02" "\xBB\x1E"
+	"\x02" "\xBB\x1D"
+	"\x02" "\xBC\x14"
+	"\x02" "\xBC\x18"
+	"\x02" "\xBC\x1A"
+	"\x02" "\xBC\x1C"
+	"\x02" "\xBC\x19"
+	"\x02" "\xBC\x1B"
+	"\x02" "\xBC\x15"
+	"\x02" "\xBC\x17"
+	"\x02" "\xBC\x1E"
+	"\x02" "\xBC\x1D"
+	"\x02" "\x0D\x14"
+	"\x03" "\x0D\xE0\x08"
+	"\x03" "\x0D\xE0\x11"
+	"\x03" "\x0D\xE0\x13"
+	"\x03" "\x0D\xE0\x14"
+	"\x03" "\x0D\xE0\x09"
+	"\x02" "\x0D\x18"
+	"\x02" "\x0D\x1A"
+	"\x03" "\x0D\xE0\x0A"
+	"\x03" "\x0D\xE0\x15"
+	"\x03" "\x0D\xE0\x17"
+	"\x03" "\x0D\xE0\x18"
+	"\x03" "\x0D\xE0\x0B"
+	"\x02" "\x0D\x1C"
+	"\x02" "\x0D\x19"
+	"\x03" "\x0D\xE0\x05"
+	"\x03" "\x0D\xE0\x0D"
+	"\x03" "\x0D\xE0\x0F"
+	"\x03" "\x0D\xE0\x10"
+	"\x03" "\x0D\xE0\x06"
+	"\x02" "\x0D\x1B"
+	"\x02" "\x0D\x15"
+	"\x02" "\x0D\x17"
+	"\x02" "\x0D\x1E"
+	"\x02" "\x0D\x1D"
+	"\x03" "\x0D\xE0\xDD"
+	"\x03" "\x0D\xE0\xE3"
+	"\x03" "\x0D\xE0\xE4"
+	"\x02" "\xB9\x14"
+	"\x02" "\xB9\x18"
+	"\x02" "\xB9\x1A"
+	"\x02" "\xB9\x1C"
+	"\x02" "\xB9\x19"
+	"\x02" "\xB9\x1B"
+	"\x02" "\xB9\x15"
+	"\x02" "\xB9\x17"
+	"\x02" "\xB9\x1E"
+	"\x02" "\xB9\x1D"
+	"\x02" "\xBE\x14"
+	"\x03" "\xBE\x14\x18"
+	"\x02" "\xBE\x1A"
+	"\x02" "\xBE\x1C"
+	"\x02" "\xBE\x19"
+	"\x02" "\xBE\x1B"
+	"\x02" "\xBE\x15"
+	"\x02" "\xBE\x17"
+	"\x02" "\xBE\x1E"
+	"\x02" "\xBE\x1D"
+	"\x0C" "\xE0\x9A\xE1\xA5\xE1\x0F\x08\x94m\xE0\x96\x1F"
+	"\x01" "\x05"
+	"\x03" "\x0F\xE0\x0E"
+	"\x15" "\xE0\xD9\xAB\xE1\xA8\xE0\x85\xE0\xA5t\x7Fy\xE0z \xC4v\xE1\xAD\x13s"
+	"\x16" "\xE0\xD9\xE1I\xE0" "a\xE0" "2-\xE0L\x13\x81\xE0\xE0\xE2" "A\xA0\xE1+t\xAC"
+	"\x15" "\xE0\xD9\xE1I\xE0\xBD" "d-\xE0L\x13\x81\xE0\xE0\xE2" "A\xA0\xE1+t\xAC"
+	"\x02" "\xE2\x9D"
+	"\x02" "\x8B\x96"
+	"\x04" "\xE0\x80\xE0-"
+	"\x04" "\xE0\x7F\xE0-"
+	"\x0A" "\xE0\x00\xE0" "7\xE1\xACy\x08\xE0-"
+	"\x06" "\xE2\xC1\xE0\x02\xE0\x8A"
+	"\x03" "\xC6\xE0\x8A"
+	"\x02" "\xAE\x91"
+	"\x05" "t\xE1\xC1\x0A\x91"
+	"\x06" "\xE1&wl\xD6\x91"
+	"\x05" "\xE1Y\xE0\x02\x91"
+	"\x03" "\xE0" "c\x91"
+	"\x03" "\xAE\xE0$"
+	"\x06" "t\xE1\xC1\x0A\xE0$"
+	"\x07" "\xE1&wl\xD6\xE0$"
+	"\x06" "\xE1Y\xE0\x02\xE0$"
+	"\x04" "\xE0" "c\xE0$"
+	"\x09" "\xE1\x93\xE0\x9A\xDFo\xE1\xB0\xA4"
+	"\x03" "\xE1\x93\x91"
+	"\x04" "\xE1\x93\xE0$"
+	"\x13" "\xE1" "F\xE1\xE4\xE0\x86\xE2\x09\xE1\x09\xE0" "6\xE2\xD7\x08p\xD6\xB4)"
+	"\x03" "\x16\xE0\x12"
+	"\x03" "\x16\xE0\x16"
+	"\x03" "\x16\xE0\x0E"
+	"\x03" "\x0D\xE0\x12"
+	"\x03" "\x0D\xE0\x16"
+	"\x03" "\x0D\xE0\x0E"
+	"\x08" "\xE0\x9A\xE1\xA6\xE2\x0A\x08\x96"
+	"\x07" "\x0D \x94m\xE0\x96\x1F"
+	"\x04" "\xE1\x93\xE0\x8A"
+	"\x04" "\xE0\x9A\xE0\x8A"
+	"\x0B" "u\xE0@\xD8h\xE1\xE8\x7F\xE0" "3\x1F"
+	"\x0C" "\xE0g\xE0\x9A\xE2W\xE0Z\xE1" "8\xBF\x1F"
+	"\x09" "\xE0\x00\xE0" "7\xE1\xACy\x08\x96"
+	"\x03" "\xE1\xE3\x82"
+	"\x09" "\xE1\x16\xB6\xAA\xE2" "3\xE2t\x82"
+	"\x15" "\xE0`\x13\xE2" "Ft\xE0<\xB5\xE0\xC4\xE0" "0\x13\xE0\x99\xE1\xA5u\xE0\x1F"
+	"\x1E" "\xE1J\xE1\x97\xE0" "7\xDB\xE0" "e\x08(\xE1\xA8\xE1\xB7\x84" "a\xE0" "b\xE0" "6\xE0\xBC" "c\xE0X\xE1" "A\xE0\xF6"
+	"\x01" "\x05"
+	"\x01" "\x05"
+	"\x06" "\x01s\x7Ft\x0A\xAD"
+	"\x04" "\xE1J\xE0$"
+	"\x03" "\xE0\xD3\x91"
+	"\x04" "\xE0\xD3\xE0$"
+	"\x09" "\xE0-\xE0\xAC\xDA\xE0\xC6\xE0N"
+	"\x09" "\x01\xE0" "dp\xE1\xFB\xE2Hs"
+	"\x01" "\x04"
+	"\x04" "\x9F\xE1\xCA\xCD"
+	"\x04" "\x9F\xE1\xCE\xB1"
+	"\x01" "\x10"
+	"\x0C" "\x9F" "c\xE1\xFF\x87\xC2\x94\xE2" "e\xE0!\xB1"
+	"\x01" "\x8E"
+	"\x0D" "\xE0\x87\xE1\xCE\xB1\xE0\xCA\xE0" "6\xE0G\xE0\xA7"
+	"\x0A" "\xE1_\xE2G\xE2\x11\xE0\xFDts"
+	"\x07" "\xE2u\xE1$\x85\xE2h"
+	"\x02" "\x04\x14"
+	"\x03" "\x04\xE0\x08"
+	"\x03" "\x04\xE0\x11"
+	"\x03" "\x04\xE0\x13"
+	"\x03" "\x04\xE0\x14"
+	"\x03" "\x04\xE0\x09"
+	"\x02" "\x04\x18"
+	"\x02" "\x04\x1A"
+	"\x03" "\x04\xE0\x0A"
+	"\x03" "\x04\xE0\x15"
+	"\x03" "\x04\xE0\x17"
+	"\x03" "\x04\xE0\x18"
+	"\x03" "\x04\xE0\x0B"
+	"\x02" "\x04\x1C"
+	"\x02" "\x04\x19"
+	"\x03" "\x04\xE0\x05"
+	"\x03" "\x04\xE0\x0D"
+	"\x03" "\x04\xE0\x0F"
+	"\x03" "\x04\xE0\x10"
+	"\x03" "\x04\xE0\x06"
+	"\x02" "\x04\x1B"
+	"\x02" "\x04\x15"
+	"\x02" "\x04\x17"
+	"\x02" "\x04\x1E"
+	"\x02" "\x04\x1D"
+	"\x02" "\x83\x04"
+	"\x04" "\x04\xE1\xEC\x91"
+	"\x04" "\x04\xE1\xF4\x91"
+	"\x04" "\x04\xE1\xF3\x91"
+	"\x04" "\x04\xE0\xCD\x82"
+	"\x04" "\x04\xE1\xEF\xA6"
+	"\x04" "\x04\xE1\xF0\xA6"
+	"\x05" "\x04\xE1<\xE1\x8F"
+	"\x03" "\xCD\xE0\xDD"
+	"\x03" "\xCD\xE0\xE3"
+	"\x03" "\xCD\xE0\xE4"
+	"\x07" "\x04\xE1\xC2\xE1" "2\xE1\xAF"
+	"\x02" "\xCD\x03"
+	"\x02" "\xCD\x0C"
+	"\x02" "\xCD\x0E"
+	"\x02" "\x10\x14"
+	"\x03" "\x10\xE0\x08"
+	"\x03" "\x10\xE0\x11"
+	"\x03" "\x10\xE0\x13"
+	"\x03" "\x10\xE0\x14"
+	"\x03" "\x10\xE0\x09"
+	"\x02" "\x10\x18"
+	"\x02" "\x10\x1A"
+	"\x03" "\x10\xE0\x0A"
+	"\x03" "\x10\xE0\x15"
+	"\x03" "\x10\xE0\x17"
+	"\x03" "\x10\xE0\x18"
+	"\x03" "\x10\xE0\x0B"
+	"\x02" "\x10\x1C"
+	"\x02" "\x10\x19"
+	"\x03" "\x10\xE0\x05"
+	"\x03" "\x10\xE0\x0D"
+	"\x03" "\x10\xE0\x0F"
+	"\x03" "\x10\xE0\x10"
+	"\x03" "\x10\xE0\x06"
+	"\x02" "\x10\x1B"
+	"\x02" "\x10\x15"
+	"\x02" "\x10\x17"
+	"\x02" "\x10\x1E"
+	"\x02" "\x10\x1D"
+	"\x05" "\x10\xE1<\xE1\x8F"
+	"\x03" "\xDE\xE0\xDD"
+	"\x03" "\xDE\xE0\xE3"
+	"\x03" "\xDE\xE0\xE4"
+	"\x07" "\x10\xE1\xC2\xE1" "2\xE1\xAF"
+	"\x02" "\xDE\x03"
+	"\x02" "\xDE\x0C"
+	"\x02" "\xDE\x0E"
+	"\x02" "\x8E\x14"
+	"\x02" "\x8E\x18"
+	"\x02" "\x8E\x1A"
+	"\x02" "\x8E\x1C"
+	"\x02" "\x8E\x19"
+	"\x02" "\x8E\x1B"
+	"\x02" "\x8E\x15"
+	"\x02" "\x8E\x17"
+	"\x02" "\x8E\x1E"
+	"\x02" "\x8E\x1D"
+	"\x04" "\x8E\xE1\xEC\x91"
+	"\x04" "\x8E\xE1\xF4\x91"
+	"\x04" "\x8E\xE1\xF3\x91"
+	"\x04" "\x8E\xE0\xCD\x82"
+	"\x04" "\x8E\xE1\xEF\xA6"
+	"\x04" "\x8E\xE1\xF0\xA6"
+	"\x12" "\xE0" "E\xE0\x87\xE2\x3Fo\xA5\xA0\xB1\xE0\xCA\xE0" "6\xE0G\xE0\xA7"
+	"\x04" "\xB3\xE1\xE6\x96"
+	"\x01" "\x05"
+	"\x09" "\x9F\xE0>-\xE1\x14\xE0\x99\xCD"
+	"\x06" "\x9F\xC4\xE1\x1D\xA0\xB1"
+	"\x01" "\x99"
+	"\x10" "\xE0\x87\xE2\x3Fo\xA5\xA0\xB1\xE0\xCA\xE0" "6\xE0G\xE0\xA7"
+	"\x03" "\x9F\xE1q"
+	"\x03" "\x9F\xE1p"
+	"\x03" "\x9F\xE1v"
+	"\x03" "\x9F\xE1w"
+	"\x0A" "\xE1m\xB3\xE1\xE6\xE0\x94\xE1\x03t"
+	"\x08" "\xE1m\x8B\xE0\x94\xE1\x03t"
+	"\x03" "\x04\xE0\x12"
+	"\x03" "\x04\xE0\x16"
+	"\x03" "\x04\xE0\x0E"
+	"\x0D" "\xE0\xCE" "d\xE1\x3F" "day\xE0" "0i\xE0U"
+	"\x13" "\xE0\xCE" "d\xE0\x1B\x0A\xE0\xF8" "f-\xD1\xE0\xA6 \xE1r\xE0\xBDs"
+	"\x09" "\xE0\xCE" "d\xE1\x3Fn\xE1\xC5t"
+	"\x03" "\x10\xE0\x12"
+	"\x03" "\x10\xE0\x16"
+	"\x03" "\x10\xE0\x0E"
+	"\x0D" "\x9F\xDE\xAA\xE1\x3F" "day\xE0" "0i\xE0U"
+	"\x13" "\x9F\xDE\xAA\xE0\x1B\x0A\xE0\xF8" "f-\xD1\xE0\xA6 \xE1r\xE0\xBDs"
+	"\x09" "\x9F\xDE\xAA\xE1\x3Fn\xE1\xC5t"
+	"\x02" "\x8E\x06"
+	"\x02" "\x99\x14"
+	"\x02" "\x99\x18"
+	"\x02" "\x99\x1A"
+	"\x02" "\x99\x1C"
+	"\x02" "\x99\x19"
+	"\x02" "\x99\x1B"
+	"\x02" "\x99\x15"
+	"\x02" "\x99\x17"
+	"\x02" "\x99\x1E"
+	"\x02" "\x99\x1D"
+	"\x04" "\x99\xE1\xEC\x91"
+	"\x04" "\x99\xE1\xF4\x91"
+	"\x04" "\x99\xE1\xF3\x91"
+	"\x04" "\x99\xE1\xEF\xA6"
+	"\x04" "\x99\xE1\xF0\xA6"
+	"\x03" "\xE1q\x03"
+	"\x03" "\xE1q\x0C"
+	"\x03" "\xE1q\x0E"
+	"\x03" "\xE1p\x03"
+	"\x03" "\xE1p\x0C"
+	"\x03" "\xE1p\x0E"
+	"\x03" "\xE1v\x03"
+	"\x03" "\xE1v\x0C"
+	"\x03" "\xE1v\x0E"
+	"\x03" "\xE1w\x03"
+	"\x03" "\xE1w\x0C"
+	"\x03" "\xE1w\x0E"
+	"\x0A" "\xC4\xE1u\xE0N\xE1\xAA\xE0\xA3\x88"
+	"\x07" "\xB3\xE2T\xE0\xF2\xE1 "
+	"\x05" "\xE1\xCE\xE2T\x96"
+	"\x09" "\x8B\xE0\x94\xE0\x85\xA9\xE0\x86\x1F"
+	"\x0B" "\xC4\xE1u\xE0N\xE1\xAA\xE0\xA3\x88\x06"
+	"\x0D" "\xE1" "5\xE0Wt\xE1\xEA\x81\xE0\x07\xE0n\xC0"
+	"\x12" "\xE0\xA8\xD6\xE0\xF8\xE1" "5\xE0Wt\xE1\xEA\x81\xE0\x07\xE0n\xC0"
+	"\x09" "\xE1" "5l\xE2!\xDC \xE0\x3F"
+	"\x0A" "\xAF\xE1" "5l\xE2!\xDC \xE0\x3F"
+	"\x0A" "\xE0t\xC8\xE1\x0E\xE0kb\xC3s"
+	"\x0B" "\xAF\xE0t\xC8\xE1\x0E\xE0kb\xC3s"
+	"\x14" "\xD1\xE0j\x84\xDA\xE0" "1w\x0A\xE1\x17\xE1)\x08\xE1" "2o\xE2#\x06"
+	"\x09" "\xE1\x17\xE1\x1D\xA0\xE0\xB2\xE1\x15"
+	"\x0D" "\xE0\xF2\xE1\x85\xCA\xB3\x89\xE0\xA1\xE2\x02" "a\xB2"
+	"\x04" "\xE2\x82\x0A\x9E"
+	"\x07" "\xE0}\xE1u\xE0i\x98"
+	"\x08" "\xE0}\xE1\x1D\xE0Z\xE1" "d"
+	"\x04" "\xE0\x0C\xE0\x3F"
+	"\x02" "\xE1\x89"
+	"\x03" "\xE1\xA0\xAC"
+	"\x04" "\xE1\xA0\xAC\x06"
+	"\x01" "\x92"
+	"\x02" "\x92\x06"
+	"\x07" "f\xA7\xB5\x89\xE1\x0As"
+	"\x0C" "\xE0\xA8\xD6\xE0\xF8\x89\xA7\xB5\x89\xE1\x0As"
+	"\x03" "\xE1ys"
+	"\x07" "\xE1\xED\x9B\x09\xC3\xE0\xBE"
+	"\x03" "\xE1\x90s"
+	"\x03" "\xE1:s"
+	"\x0B" "\xE2.\xB6\xE0\xB1\xE0\xA6\x09" "d\xE2V"
+	"\x0A" "\x8B\xE1\x8E\xDF\xDB\xE1\xA4\xE2=\xA4"
+	"\x02" "\xE0\x1A"
+	"\x09" "\x01\xE2\xC2s\x81\xA8\xE0\xC2\xC0"
+	"\x02" "\xE0\x8C"
+	"\x02" "\xE0\x89"
+	"\x02" "\xE0\x8D"
+	"\x03" "\xE1\x94\x98"
+	"\x04" "\xE1\x94\xE1" "d"
+	"\x03" "\xE0\xF2\xB1"
+	"\x04" "\xE0*\xE1\x89"
+	"\x05" "\xE0*\xE1\xA0\xAC"
+	"\x06" "\xE1\xA0" "e\xC0\xE0\x19"
+	"\x02" "\x92\x14"
+	"\x02" "\x92\x18"
+	"\x02" "\x92\x1A"
+	"\x02" "\x92\x1C"
+	"\x02" "\x92\x19"
+	"\x02" "\x92\x1B"
+	"\x02" "\x92\x15"
+	"\x02" "\x92\x17"
+	"\x02" "\x92\x1E"
+	"\x02" "\x92\x1D"
+	"\x09" "\xE1\xC6" "d\xD4\xE0\xD1\xE1\x0A\x88"
+	"\x02" "\x92\x03"
+	"\x02" "\x92\x0C"
+	"\x02" "\x92\x0E"
+	"\x03" "\x92\xE0\x19"
+	"\x04" "\x83\xE1ys"
+	"\x08" "\xE1ys\xE2" "7\x09\xE0\x01"
+	"\x04" "\x83\xE1\x90s"
+	"\x05" "\xE1\x90s\xE0\x19"
+	"\x05" "\x8B\x83\xE1:s"
+	"\x05" "\xE1:s\xE0\x19"
+	"\x03" "\x83\xE0\x1A"
+	"\x06" "\xE0\x1A\xE1<\xE1\x8F"
+	"\x04" "\xE0\x1A\xE0\xDD"
+	"\x04" "\xE0\x1A\xE0\xE3"
+	"\x04" "\xE0\x1A\xE0\xE4"
+	"\x0E" "\xE0\x1A\xE1\xC2\xE1" "2\xE1\xAF \xDFo\xE1\xB0\xA4"
+	"\x04" "\xE0\x1A\xE0\x19"
+	"\x03" "\x83\xE0\xF4"
+	"\x04" "\x8B\x83\xE0\x8C"
+	"\x03" "\xE0\x8C\x03"
+	"\x03" "\xE0\x8C\x0C"
+	"\x03" "\xE0\x8C\x0E"
+	"\x03" "\x83\xE0\x89"
+	"\x03" "\xE0\x89\x03"
+	"\x03" "\xE0\x89\x0C"
+	"\x03" "\xE0\x89\x0E"
+	"\x03" "\x83\xE0\x8D"
+	"\x03" "\xE0\x8D\x03"
+	"\x03" "\xE0\x8D\x0C"
+	"\x03" "\xE0\x8D\x0E"
+	"\x05" "\xE0" "E\xE0\xF2\xB1"
+	"\x08" "\xB3\x89\xE0\xA1\xE2\x02" "a\xB2"
+	"\x01" "\x05"
+	"\x06" "\xE2\xD4\xE1" "e\x09\x9E"
+	"\x04" "\xE0l\xE1\x9C"
+	"\x07" "\xE2K\xE0)f\xE0" "3"
+	"\x02" "\xE0\xDC"
+	"\x09" "\xE0x\xE0" "9sl\xE0\xF9" "e"
+	"\x06" "g\x87\xE0\xBF\xE1\xE1"
+	"\x05" "\xE1\xE7\xE1&\xB5"
+	"\x05" "\xE0" "D\xE1&\xB5"
+	"\x0A" "\xE0*\xE0}\xE1u\xE0i\xE0\x3F"
+	"\x0A" "\xE0}\xE1\x1D\xE0Z\xE0\x3F\xE0\x19"
+	"\x08" "\xE1\xA6\x81\xE0\x22\xE0\x0C\x98"
+	"\x06" "\xE0\x0C\xE0\x3F\xE0\x19"
+	"\x04" "\xE0\x0C\xE1" "d"
+	"\x04" "\xE1\x89\xE0\x19"
+	"\x03" "\xE1\x89\x06"
+	"\x0A" "\xE1\xA6\xE1\x10\xE0" "C\xE0\xA4\xE1\x9C"
+	"\x06" "\xE0l\xE1\x9C\xE0\x19"
+	"\x05" "\xE0l\xE1\x9C\x06"
+	"\x08" "\xE2K\xE0)f\xE0" "3\x06"
+	"\x08" "f\xA7\xB5\x89\xE1\x0A\xE0y"
+	"\x04" "\xE1y\xE0y"
+	"\x08" "\x83\xE1\xED\x9B\x09\xC3\xE0\xBE"
+	"\x08" "\xE1\xED\x9B\x09\xC3\xE0\xBE\x06"
+	"\x03" "\x83\xE0\xDC"
+	"\x07" "\xE0\xDC\xE2" "7\x09\xE0\x01"
+	"\x06" "\xE0\xDC\xE1<\xE2\xC7"
+	"\x04" "\xE1\x90\xE0y"
+	"\x04" "\xE1:\xE0y"
+	"\x0C" "\xE2.\xB6\xE0\xB1\xE0\xA6\x09" "d\xE2V\x06"
+	"\x06" "\xE1\x1F\xE0\xE6\xE0\x01"
+	"\x09" "\xAF" "a\xE0\xB1" "ap\xE2]\x88"
+	"\x04" "\xE1\x7F\xE0o"
+	"\x06" "\xE0x\xE0" "9\xE0#"
+	"\x07" "\x84" "a\xE0P\x08\xE0#"
+	"\x02" "\xE1\x5C"
+	"\x03" "\xAF\xE1\x5C"
+	"\x06" "\xE1$\xE1" "B\xE1\x5C"
+	"\x07" "\xE0\x8B\x0A\xE0{\xE0o"
+	"\x09" "\xE0\xC1\x8A\xC8\xE2\xB0\xB3\xE2\xBE"
+	"\x06" "slu\xB5\xE0o"
+	"\x04" "\xE1o\xE0o"
+	"\x06" "p\xE1>\x81\xE0\xDA"
+	"\x06" "\xE2@\xB5 \xE0\xDA"
+	"\x07" "\xE0kep \xE0\xDA"
+	"\x09" "\xE0" "d\xAA\xC3" "f\xE0\x93\xE0\x01"
+	"\x07" "\xE1\xF5\xE0\x22\xE0\x0C\x98"
+	"\x08" "\xE1\x7F\xE0o\xE2\xA8\xE0" "d"
+	"\x0A" "\xE1\x7F\xE0o\xAA\xD4\xE0\xD1\xE1" "3"
+	"\x05" "\x8B\xE0*\xE0\xDA"
+	"\x04" "\xE1o\xE0\xDD"
+	"\x04" "\xE1o\xE0\xE3"
+	"\x04" "\xE1o\xE0\xE4"
+	"\x08" "\xE2L\xD8\x8B\xE1\x8E\xE0\xF1"
+	"\x01" "\x05"
+	"\x03" "\xE0\x1A\x06"
+	"\x03" "\xE0\xF4\x03"
+	"\x03" "\xE0\xF4\x0C"
+	"\x03" "\xE0\xF4\x0E"
+	"\x03" "\xE0\xF4\x06"
+	"\x03" "\xE0\x8C\x06"
+	"\x03" "\xE0\x89\x06"
+	"\x03" "\xE0\x8D\x06"
+	"\x04" "\xE0\xF2\xB1\x06"
+	"\x04" "\xE1R\xE0\x01"
+	"\x09" "\x7F\xE0m\xE0" "b\xE1R\xE0\x01"
+	"\x09" "\xE1t\xCC\xE1\x1F\xE0\xE6\xE0\x01"
+	"\x0C" "\xE0:f\xE2[ul\x8A\xE0\xE6\xE0\x01"
+	"\x09" "\xE0_\xE2\x93\x09\xE1\x8B\xE2\x0F"
+	"\x06" "\xE2\xD0\xE1\x8B\xE2\x0F"
+	"\x06" "\xE1\x8E\xE2" "0\xE1\xDC"
+	"\x08" "\xE0\xFE\xE0@s\xC8\xE0#"
+	"\x0B" "\xE0\xFEs\xE0\x5C\xE2" "Epp\x88s"
+	"\x05" "o\xE0\xAD\xE0#"
+	"\x06" "\xD1t\xE2,\xE0#"
+	"\x04" "\xE1\x0E\xE0I"
+	"\x02" "\xE0\xEC"
+	"\x03" "\xAF\xE0\xEC"
+	"\x05" "\xE2\xC6\x08\xE0I"
+	"\x07" "\xAF\xE1$\xE1" "B\xE1\x5C"
+	"\x08" "\xE1$\xE1" "B\xE1\x0E\xE0I"
+	"\x07" "\xE0\x8B\x0A\xE0\xB4\xE0I"
+	"\x09" "\xE0" "d\xAA\xC3" "f\xE0\x93\xE0I"
+	"\x0B" "\xE1\xF5\xE0\x22\xE0\xFE\xE0@s\xC8\x98"
+	"\x07" "\xE0x\xE0" "9\xE0#\x06"
+	"\x0C" "\xE0\xFEs\xE0\x5C\xE2" "Epp\x88\xE0y"
+	"\x06" "o\xE0\xAD\xE0#\x06"
+	"\x07" "\xD1t\xE2,\xE0#\x06"
+	"\x0B" "\x8B\xE1\x8E\xDF\xDB\xE1\xA4\xE2=\xA4\x06"
+	"\x07" "\xE0\xEC\xE0=\xE0G\xAC"
+	"\x08" "\xAF\xE0\xEC\xE0=\xE0G\xAC"
+	"\x16" "\xE0\xEC\xE0=\xE0G\xAC\xCA\xDF\xB5\xE0O\x81\xE0n\x08\xC8\xE0\x9C\xE0+s"
+	"\x08" "\xE1R\xE1\xDB\xC5\xAB\xE1\xF8"
+	"\x0E" "\xE1R\xE0\x01\xE0" "5\xAB\xE1\xA8\xE0%\xC1\x13s"
+	"\x04" "\xE0\xE6\xE0\xF1"
+	"\x0F" "\xE0\x1F" "cu\x09\xC8\x94" "c\xE0\x96\xE1\xCF\xE1\x85\x06"
+	"\x07" "\xA7r\xE2o\xE1\x94\x98"
+	"\x08" "h\x13\xE2&\xD8\xE1\x94\x98"
+	"\x0D" "\xE0\xBE\xE0\xF9\xE2\xAC\xE2\x88\xE0" "9\xE2\x06\x1F"
+	"\x03" "\xE0t\x96"
+	"\x07" "\x8B\xE2L\xE0\xBA\xE2\xA9"
+	"\x01" "\x05"
+	"\x11" "\xE1t\xCC\xE1\x1F\xE0\xE6\xE2;\xE2s\xE2r\xE1\x14\xE0\xF6"
+	"\x07" "\xE0\x8B\x0A\xE0\xB4\xE0I"
+	"\x09" "\xAF\x8B\xE1#\x0A\xE0*\xE0\xDA"
+	"\x0A" "\xE1`\xE0l\x0A\xE2R\xCC\xE0v"
+	"\x0C" "\xE1\x1B\xE1*\xE0T\xE0\xAE\xE1\x8B\xE0\x1C"
+	"\x0C" "\xE1\x1Bm\xE0\x5C\xE0" "ed\xE2\x0B\xE1" "E"
+	"\x0B" "\xE1\xDF\xE1t\xE1\xC7\xE1\xB4u\xE0\x1F"
+	"\x08" "\xE1\xC4\xE1" "7t\xE2\x89\x80"
+	"\x07" "h\xE1\x03\xE0@\xE1\xE1"
+	"\x07" "\xE0\xBA" "e\x85\x89\xE2" "3"
+	"\x0C" "\xE0\x02\x85u\xE1" "B\xE0[\xD6\xE0Ge"
+	"\x0D" "\xE2\xBD" "c\xD7\xE0" "4\x13\xE0X\xA0\xE2/\x88"
+	"\x03" "\xE1N\x80"
+	"\x06" "\xE1N\xE0|\xE0w"
+	"\x06" "\xE1N\xE0|\xE0\xB8"
+	"\x03" "\xE1\x1E\x80"
+	"\x06" "\xE1\x1E\xE0|\xE1!"
+	"\x04" "\xE0\xD2\xE0\x03"
+	"\x06" "s\x84" "e\x8A\xE1\xE9"
+	"\x08" "\xB6\xE0[\x13\xE0&\xE1."
+	"\x03" "\xE1M\x80"
+	"\x06" "\xE1M\xE0|\xE0w"
+	"\x06" "\xE1M\xE0|\xE0\xB8"
+	"\x03" "\xE0\xB4\x80"
+	"\x06" "\xE0\xB4\xE0|\xE1!"
+	"\x06" "\xE0\xCC\xE0\xC2\xE1."
+	"\x06" "\xE1\x02\xE0" "C\xE1" "3"
+	"\x03" "\xE2m\x85"
+	"\x07" "\x12\xE0)\xE2" "8\xE0,"
+	"\x0A" "\x12\xE0m\x85\xCC\xE1\xFDudy"
+	"\x09" "\x12\xE2\xDB\xCC\xE1\xFDudy"
+	"\x0A" "\x12\xE1,n\xA2\xE1r\xE0\xBDs"
+	"\x06" "\x12\xE2\x19 \xE0,"
+	"\x07" "\x12\xE1,n\xA2\xE0,"
+	"\x0A" "\x12\xE0m\x85\xCC" "d\xE1\x0D\xE0,"
+	"\x06" "\x12" "d\xE1\x0D\xE0,"
+	"\x12" "\xE1,n\xA2\xE1ro\xE2&\xC8\xE2\x10\x12\xE0\xCC\xE0\xC2s"
+	"\x09" "\xE1gs\xD2u\xE0!\xE0\xF1"
+	"\x01" "\x05"
+	"\x08" "w\xE0`\xD6\xE0&\xE0\x03"
+	"\x07" "\x12w\xE0`\xD6\xE0&"
+	"\x07" "b\xA5z\xE1\xD6\xE0\x03"
+	"\x06" "\x12" "b\xA5z\xE1\xD6"
+	"\x08" "d\xE1" "e\x0A\xE0\xD2\xE0\x03"
+	"\x07" "\x12" "d\xE1" "e\x0A\xE0\xD2"
+	"\x05" "\xC5\xE1W\xE1" "f"
+	"\x04" "\xE1W\xE1" "f"
+	"\x05" "\xC5\xE0{\xE1" "f"
+	"\x04" "\xE0{\xE1" "f"
+	"\x0A" "\xE1\x91\xE1g\xE2/\x88\x08\xE1'"
+	"\x01" "\x05"
+	"\x04" "\xE0,\xE0H"
+	"\x04" "\xE0\xB0\xE0H"
+	"\x05" "\xE1\xF5\x8B\xE0I"
+	"\x04" "\x12\xC5\xE1W"
+	"\x03" "\x12\xE1W"
+	"\x03" "\x12\xE0\xD2"
+	"\x05" "\x12s\x84\xE1\x06"
+	"\x09" "\xE0\xD5\xDA\xE0[\x13\xE0&s"
+	"\x04" "\x12\xC5\xE0{"
+	"\x03" "\x12\xE0{"
+	"\x06" "\x12\xE0\xCC\xE0\xC2s"
+	"\x07" "\x12\xE1\x02\xE0" "C\xE1" "3"
+	"\x05" "\xE0\xD5\x89\xE1" "3"
+	"\x08" "\xE0\xB4\xE0\x86\x88\xD5\xE0" "d"
+	"\x08" "\xE0t\xE0\x86\x88\xD5\xE0{"
+	"\x04" "\xE1N\x01\x9E"
+	"\x04" "\xE1M\x01\x9E"
+	"\x0A" "\xE1g\x9E\xD5\xE1\xB8\xE0W\xE0P"
+	"\x07" "b\xA5z\xE1\xD6\xE1\x96"
+	"\x08" "d\xE1" "e\x0A\xE0\xD2\xE1\x96"
+	"\x09" "\xE2\x06\x81v\xE1\xB2\xE0v\xD9"
+	"\x10" "\xE0\x8B\xE0h\xE0\xA2 \xE2;\xE2\xCF\xE2l\xE1\x7Fs"
+	"\x04" "\xE0\xED\xE1\x96"
+	"\x09" "\xE0\xAB\x9B\xE0" "C\xE0\xA2\xE1\x96"
+	"\x0B" "v\xE1\xB2\x9E\xD5\xE1\xB8\xE0W\xE0P"
+	"\x0C" "\xE0O\xE1\xEB\xE0@\xE1g\xE0\xB2\xE1\x15"
+	"\x04" "\xE1\x91\xE2Q"
+	"\x0D" "\xE1\x91\xE0R\xE0\x9Fu\xE0" "b\xE0\xCFu\xA4"
+	"\x05" "t\xE1" "1o\xAC"
+	"\x0C" "h\xE0\x1Br\xE0/\xD7\x09\xE0\xBA\xE1k"
+	"\x05" "\xE2%\x84\x08\x80"
+	"\x06" "\xE0&\xE0\xAC\xE1k"
+	"\x04" "\xE0\x92\xE0" "A"
+	"\x09" "\xE0m\xE0k\x87t\x09\xE0" "A"
+	"\x06" "\xA5\xE0\xFD\x8A\xE0" "A"
+	"\x06" "c\x7F\xE0\x99\xE0,"
+	"\x06" "gu\x85\xA2\xE0" "A"
+	"\x04" "\xE2$\xE0" "A"
+	"\x11" "\xE0\x92\xE2-\x01" "aff\xE1\xEA\x0A\xE0\xE9\xE1\xD9\x81\xAD"
+	"\x0E" "\xE0" "E\xE0\xE9\xE1\xD9\x81\xAB\xE0\x22\xE0\x92\xE0" "A"
+	"\x08" "\xE0\x92\xE2-\xE2\x17\xE0\xC0"
+	"\x01" "\x05"
+	"\x0C" "\xE1\xE4\xE1\xDB\xE0\xE9\xE1\xD9\x81\xAB\xE2\xB2"
+	"\x0B" "t\xE1" "1\xE0" "4\xE2\x8E\x9B \xE1'"
+	"\x0A" "t\xE1" "1\xE0" "4\xE0\xB2\xE0\xC7\x1F"
+	"\x05" "\xE1\xD3" "d\xE0H"
+	"\x01" "\x05"
+	"\x08" "\xE0\xD5\xE0" "0\xE1" "1o\xAC"
+	"\x0C" "h\xE0\x1Br\xE0/\xD7\x09\xE0\xBA\xE1k"
+	"\x05" "\xE2%\x84\x08\x80"
+	"\x06" "\xE0&\xE0\xAC\xE1k"
+	"\x04" "\xE0\x92\xE0" "A"
+	"\x07" "\xE0\x92\xE1\xD3" "d\xE0H"
+	"\x08" "\xE1\x1E\xE1@\x89\xE0\xD7\xD9"
+	"\x04" "\xE0\xED\xE0\x03"
+	"\x06" "\xE0\xED\xE1\xE5\xE0w"
+	"\x06" "\xE0\xED\xE1\xE5\xE0\xB8"
+	"\x04" "\xE0\xB0\xE0\x03"
+	"\x06" "\xE0\xB0\xE1\xE5\xE1!"
+	"\x05" "\xE0\xD5\x89\xE0\xA2"
+	"\x07" "\xE0\xAB\x9B\xE0" "C\xE0\xD7"
+	"\x06" "\xE0\x8B\xE0h\xE0\xD7"
+	"\x09" "s\xE0mk\x09\xE1\xDC\xE0\x03"
+	"\x0A" "b\xE0" "3\x0A" "du\xE0" "b\xE1\xE9"
+	"\x0E" "\x12\xE1\x91\xE0R\xE0\x9Fu\xE0" "b\xE0\xCFu\xA4"
+	"\x07" "\xE1\x1E\xE1@\x89\xE0\xD7"
+	"\x05" "v\xE1\xB2\xE0\xF1"
+	"\x01" "\x05"
+	"\x03" "\x12\xE0\xED"
+	"\x08" "\x12\xE0\xAB\x9B\xE0" "C\xE0\xA2"
+	"\x0A" "\xE0\xD5\xE2{\xE2\xAD\xE0h\xE0\xA2"
+	"\x03" "v\xE2\xCE"
+	"\x05" "\xE1\xC0<\xE0w"
+	"\x05" "\xE1\xC0<\xE0\xB8"
+	"\x05" "\xE1\xC0<\xE1!"
+	"\x08" "wh\xD2\x09\xE0\x85\xE1\xE9"
+	"\x08" "b\xE0" "3\x0A\xE0" "d\xE0\x03"
+	"\x08" "\xE0\xFF\x87\xA2\xE1\xDC\xE0\x03"
+	"\x08" "\xE1;\xE1, g\xA7\x94"
+	"\x07" "s\xE1@\xE0&\xE1."
+	"\x07" "\x12s\xE1@\xE0&s"
+	"\x08" "\xE1\x98\xE0" "Bgo\xE0\xBD"
+	"\x06" "\xE1\x98:\x89\xE2\x14"
+	"\x06" "\xE1\x98\xE0" "B\xDB\xBF"
+	"\x08" "\xE1\x98\xE0" "B\xE0(\xDB\xBF"
+	"\x04" "\xE1\x82\xE1\xD2"
+	"\x03" "\x12\xE2Q"
+	"\x0D" "\x12\xE0\xCF\xE1\x1A\xE0\xAF\xA9t\xE0" "B\xE2\xBC"
+	"\x10" "\x12\xE0\xCF\xE1\x1A\xE0\xAF\xA9t:\xE1\xAA\x1Fi\xE2\x12"
+	"\x0D" "\x12\xE0\xCF\xE1\x1A\xE0\xAF\xA9t\xE0" "B\xE0" "3"
+	"\x0E" "\xE0\x8B\xE0h\xE0\xD7\xE2^\xE2|\xE2\xA5\xB3s"
+	"\x09" "\xE0\xD9\xAB\xE0\x22\xE1\x82\xE1\xD2"
+	"\x06" "\xE2\xD9\xE2\x03\xE0\xF1"
+	"\x0B" "s\xE1" "b\x08\xD8\xB2\xA8\xE0S\xE1."
+	"\x06" "\xE0\xB0 \xE2\x19\x88"
+	"\x04" "\xE0\xB0\xE0H"
+	"\x07" "\xE2\xB3\xE2*(\xE1" "E"
+	"\x05" "hot\xE0\x91"
+	"\x04" "\xE1" "b\xE0\x91"
+	"\x05" "m\xE1\x04\xE0\x91"
+	"\x06" "\xE0\xAF\xE0" "e\xE0\x91"
+	"\x04" "\xE1l\xE0\x91"
+	"\x06" "\xE0(\xE1l\xE0\x91"
+	"\x01" "\x05"
+	"\x07" "\xE1`\xC3\xE2P\xE0v"
+	"\x0A" "\xE1`\xE0l\x0A\xE2R\xCC\xE0v"
+	"\x03" "\xE1`\x80"
+	"\x19" "effec\xA3\xE0P\xE1\xC7\xE1\xB4\xE1\x0F,\xE2+\xE1\xD3\xE0" "9\x9B\xE2\x91\x80"
+	"\x0C" "\xE1\x1B\xE1*\xE0T\xE0\xAE\xE1\x8B\xE0\x1C"
+	"\x0C" "\xE1\x1Bm\xE0\x5C\xE0" "ed\xE2\x0B\xE1" "E"
+	"\x07" "\xE2\xAE\xE2*(\xE1" "E"
+	"\x06" "\xE0(\xE1" "b\xE0\xCB"
+	"\x04" "\xE1" "b\xE0\xCB"
+	"\x05" "m\xE1\x04\xE0\xCB"
+	"\x07" "\xE0\xAF\xE2\xA0(\xE2\xC5"
+	"\x04" "\xE1l\xE0\xCB"
+	"\x06" "\xE0(\xE1l\xE0\xCB"
+	"\x0C" "\xE1\xDF\xE1t\xE1\xC7\xE1\xB4\xE1\x0F\x08\x9E"
+	"\x08" "\xE1\xF6\xE0%\xB2\x0A\xE1 "
+	"\x08" "\xE0`\x13n\xE0\x95\xB8\x8D"
+	"\x02" "\xE1" "D"
+	"\x04" "to\xE1\x99"
+	"\x08" "a\xB6\x84\xE0z\x08\xE1\xCC"
+	"\x04" "\xE1%\xE1" "a"
+	"\x08" "\xE1\x16x\x88\xE0 \xE1\x99"
+	"\x08" "\xE1\x00\xE2z\x89\xE1\xC5t"
+	"\x09" "cr\xE0/\xE2\x9F\x8A\xE1" "D"
+	"\x07" "cyc\xE0" "8\x87\xCB"
+	"\x08" "foot\xE1%\xE1" "D"
+	"\x08" "g\xE0" "ef\xE0 \xE1\x99"
+	"\x05" "\xE1\xA7\x87\xB6\x8F"
+	"\x05" "\x87\xE2\x99\xE1\xCC"
+	"\x07" "rugb\xA2\xE1" "D"
+	"\x09" "\xE0\xCC\xE0\x9Ej\xE2\x12p\x88"
+	"\x0A" "t\xE0" "2n\xE1\x0Bto\xE1\x99"
+	"\x03" "\xE2" "0\x8D"
+	"\x05" "w\xE0`\xD6\x8D"
+	"\x03" "f\xA9\x90"
+	"\x05" "t\x87" "d\x09\x90"
+	"\x07" "\xE0W\xCB\xE0\x97i\x8F"
+	"\x14" "\xE2\x0C\xE0\xFDt\xA8\x13\x08\xE1\x17\xE2\x18u\xE0S\x0A\xD3\xCB\xE0\x97"
+	"\x06" "\xD1\xE0j\xE0" "8\x98"
+	"\x07" "\x9B\xE1\x04\xE1" "7 \x98"
+	"\x08" "cyc\xA5s\xE0\x93\x98"
+	"\x02" "\xE0."
+	"\x02" "\xE0\xDB"
+	"\x02" "\xE1\xA2"
+	"\x09" "\xE1\x14r\xBFi\xE0" "b\xE2N"
+	"\x09" "g\xA9" "fi\xE2\x9A\x98\xE0u"
+	"\x07" "\xE0\xB9v\xE0\xAD\xE1\xF6"
+	"\x07" "\xE1\xE7\x87\xE0\xF9\xE0u"
+	"\x07" "\xD1\xE0j\xE0" "8\x98\x06"
+	"\x08" "\x9B\xE1\x04\xE1" "7 \x98\x06"
+	"\x09" "cyc\xA5s\xE0\x93\x98\x06"
+	"\x03" "\x83\xE0\xDB"
+	"\x03" "\xE0\xDB\x03"
+	"\x03" "\xE0\xDB\x0C"
+	"\x03" "\xE0\xDB\x0E"
+	"\x03" "\xE1\xA2\x03"
+	"\x03" "\xE1\xA2\x0C"
+	"\x03" "\xE1\xA2\x0E"
+	"\x07" "\xE2\x80\x7F\x13\x8A\xE1\x15"
+	"\x04" "\xE2\x1A\xC6\x96"
+	"\x06" "\xE0" "a\xD3u\xE0\x95"
+	"\x07" "\xE0" "a\xD3u\xE0\x95\x15"
+	"\x0B" "t\xE2\x5C\xAAisr\xE0X\xA0\x96"
+	"\x0B" "m\xC1\xD2\xD0y\xE0%\xB2\x0A\xE1 "
+	"\x0B" "\xE1\xF1\xD3\xA3v\xE2\x03\xE1\xAEo\x88"
+	"\x0A" "m\x1F\xE0/\xB8\xAE\xE1\xAEo\x88"
+	"\x0C" "\x9B\xC1\xE0" "9\xE0\xFA" "d\xE2\x04\xA0\xE1 "
+	"\x01" "\x8C"
+	"\x08" "\xE2\x1A\xE0" "a\xE0<\xE1\xCC"
+	"\x03" "\xE0\xCCw"
+	"\x05" "f\xAC\xA3\xE2\xC8"
+	"\x06" "\xE0R\xE2\xDAi\xA4"
+	"\x01" "\x90"
+	"\x05" "m\xE2n\xE1\x06"
+	"\x09" "c\x13\xE0\xFC\x8Fi\xB8\xE2\x1B"
+	"\x0B" "\x85\xE2\xBA\x09\xE0\xBC\xE0\xA5\xE2\x0C\x8F"
+	"\x02" "\xE0\xE2"
+	"\x04" "\xE2\x1Cwd"
+	"\x03" "m\xD0\x9B"
+	"\x02" "\xE0\xEB"
+	"\x0B" "\xE2\xAA\xAAi\x85\xE0\x1B" "b\xE2ge"
+	"\x01" "\x9D"
+	"\x07" "\xE1\x16mb \xE1\xD2"
+	"\x02" "\x8C\x14"
+	"\x02" "\x8C\x18"
+	"\x02" "\x8C\x1A"
+	"\x02" "\x8C\x1C"
+	"\x02" "\x8C\x19"
+	"\x02" "\x8C\x1B"
+	"\x02" "\x8C\x15"
+	"\x02" "\x8C\x17"
+	"\x02" "\x8C\x1E"
+	"\x02" "\x8C\x1D"
+	"\x02" "\x83\x8C"
+	"\x02" "\x8C\x03"
+	"\x02" "\x8C\x0C"
+	"\x02" "\x8C\x0E"
+	"\x02" "\x8D\x14"
+	"\x02" "\x8D\x18"
+	"\x02" "\x8D\x1A"
+	"\x02" "\x8D\x1C"
+	"\x02" "\x8D\x19"
+	"\x02" "\x8D\x1B"
+	"\x02" "\x8D\x15"
+	"\x02" "\x8D\x17"
+	"\x02" "\x8D\x1E"
+	"\x02" "\x8D\x1D"
+	"\x02" "\x83\x8D"
+	"\x02" "\x8D\x03"
+	"\x02" "\x8D\x0C"
+	"\x02" "\x8D\x0E"
+	"\x02" "\x90\x14"
+	"\x02" "\x90\x18"
+	"\x02" "\x90\x1A"
+	"\x02" "\x90\x1C"
+	"\x02" "\x90\x19"
+	"\x02" "\x90\x1B"
+	"\x02" "\x90\x15"
+	"\x02" "\x90\x17"
+	"\x02" "\x90\x1E"
+	"\x02" "\x90\x1D"
+	"\x08" "\xE1\xC6" "d\xD4\xE0\xD1\xE2\x14"
+	"\x02" "\x90\x03"
+	"\x02" "\x90\x0C"
+	"\x02" "\x90\x0E"
+	"\x03" "\x83\xE0\xE2"
+	"\x03" "\xE0\xE2\x03"
+	"\x03" "\xE0\xE2\x0C"
+	"\x03" "\xE0\xE2\x0E"
+	"\x03" "\x83\xE0."
+	"\x03" "\xE0.\x03"
+	"\x03" "\xE0.\x0C"
+	"\x03" "\xE0.\x0E"
+	"\x03" "\x83\xE0\xEB"
+	"\x03" "\xE0\xEB\x03"
+	"\x03" "\xE0\xEB\x0C"
+	"\x03" "\xE0\xEB\x0E"
+	"\x02" "\x9D\x14"
+	"\x02" "\x9D\x18"
+	"\x02" "\x9D\x1A"
+	"\x02" "\x9D\x1C"
+	"\x02" "\x9D\x19"
+	"\x02" "\x9D\x1B"
+	"\x02" "\x9D\x15"
+	"\x02" "\x9D\x17"
+	"\x02" "\x9D\x1D"
+	"\x02" "\x83\x9D"
+	"\x02" "\x9D\x03"
+	"\x02" "\x9D\x0C"
+	"\x02" "\x9D\x0E"
+	"\x0E" "\xC6\xE0\x9F\x08\x94t\xE1\xC1\xE2\x0En\xE1\xB3\x7F"
+	"\x01" "\x05"
+	"\x02" "\x9D\x1E"
+	"\x0A" "\xE1\xE7\x87\xE0\xF9 \xE0\xB2\xE1'"
+	"\x08" "\xE0\xB9v\xE0\xAD\xAE\xE1'"
+	"\x01" "\x05"
+	"\x04" "\xE2\xDD\x8Cs"
+	"\x0D" "\xC7\xE0\xFA\xE0\x85\xE1\xCA\xE0" "a\xE0<\xE1\x9A"
+	"\x0B" "a\xE0" "fo\xE0mb\xC1\x09\x87\xCB"
+	"\x07" "ba\xA8\xE1%\xE1" "a"
+	"\x0A" "ba\xE0\xBE\xE1\x06\xE1%\xE1" "a"
+	"\x06" "\xE1\x16\xE0\xAE\x87\xCB"
+	"\x04" "\xC4" "c\xE1\xAD"
+	"\x08" "ho\xE0\xFB" "e\xA2\xE1" "a"
+	"\x02" "\xE2O"
+	"\x06" "\xBD" "1\xE1\x22\xE0\xB5"
+	"\x05" "\xBD\xE0w\xE0\xB5"
+	"\x06" "\xE0;\xE2\x1F\xE2" "2"
+	"\x08" "\xE0;\xE0 \xE2\x1E\xE0\xDF"
+	"\x04" "\xE1\x87\xE0\xDF"
+	"\x04" "d\xE0\x9D\x9E"
+	"\x04" "\xE0>\xE1\xB6"
+	"\x04" "\xE1\x81\xC5\xAD"
+	"\x09" "\xBD" "1\xE1\x22\xE2" "4\xDD\xE1h"
+	"\x08" "\xBD\xE0w\xE2" "4\xDD\xE1h"
+	"\x0A" "\xE0;\xE2\x1F\xE2" "2\xE0" "5\xE0'"
+	"\x0A" "\xE0;\xE0 \xE2\x1E\xE1i\xE1h"
+	"\x06" "\xE1\x87\xE1i\xE1h"
+	"\x09" "\x9Asu\xE0\xFF\xE0\xC7\xE1G"
+	"\x04" "\x01\x9A\xE1\x15"
+	"\x03" "\xE1\xA1\x1F"
+	"\x06" "\xE1\xA1\xE0\xC3\xC5\xAD"
+	"\x04" "\xE1Z\xE0\xEA"
+	"\x01" "\x05"
+	"\x05" "\xBD\xE1\x22\xE0\xB5"
+	"\x04" "\xBD" "1\xE1]"
+	"\x04" "\xBD" "2\xE1]"
+	"\x06" "\xBD" "2\xE1\x22\xE0\xB5"
+	"\x04" "\xBD" "4\xE1]"
+	"\x05" "\xBD\xE0\xB8\xE0\xB5"
+	"\x04" "\xBD" "9\xE1]"
+	"\x08" "\xE0;\xE0 \xE2 \xE0\xDF"
+	"\x09" "\xE0;\xE0\xD1\xE1\xD5 \xE0\xDF"
+	"\x09" "\xE0;\xE0\xD1iv\x09\xE0\xDF"
+	"\x06" "\xE0(\xE0>\xE1\xB6"
+	"\x0C" "\xE2\xD1\xA9" "c\xE1\xAD" "a\xB2\xAAu\x87\xA4"
+	"\x11" "d\xE1\xFC\x81\xE2wl\x89\xE0\x1B\xE2\x8F\xE0\x1D\xE0ze"
+	"\x06" "c\xE1\xB1\xA7\xA4s"
+	"\x04" "\xE0\x90\xE1S"
+	"\x0A" "\xE0\xA0\xE0\xB9\xB8\xE0K\xC9\xE1\x12"
+	"\x04" "\xE1Z\xE1\xF2"
+	"\x05" "\xE0" "D\xC9\xE1\xF2"
+	"\x05" "\xE1J\xC9\xE1\xF2"
+	"\x09" "\xB5\xE0" "ft\xE0" "8\x9A\xE1\x12"
+	"\x0C" "f\xE0\xA1\xB5\xE0" "ft\xE0" "8\x9A\xE1\x12"
+	"\x04" "\xE1\x81\xE0'"
+	"\x06" "\xE1\x81\xE1\x00\xA8s"
+	"\x06" "\xE1\xA1\xE0\xC3\xE0'"
+	"\x08" "\xE1\xA1\xE0\xC3\xE1\x00\xA8s"
+	"\x06" "\xE1\x9F\xE0" "5\xE0'"
+	"\x08" "\xE1\x9F\xE0" "5\xE1\x00\xA8s"
+	"\x03" "\xE2}\x96"
+	"\x04" "\xE1\x83\xE1S"
+	"\x09" "d\xE0\x9D\xDB\xE0\x97ib\x84"
+	"\x08" "\xE0[\xE0\xA3\xE1\x84\xE1S"
+	"\x07" "c\xE1\xB1\xA7\xE0Z\x9E"
+	"\x03" "\xE1" "c\x9E"
+	"\x05" "\xE0(\xE1" "c\x9E"
+	"\x09" "\xE0\x00\xC9\xE0\xBB\xE2X\xE1G"
+	"\x07" "\xE1\xF9\xD0\xC3v\xB8\x80"
+	"\x05" "\xE0" "D\xE1\x9B\x03"
+	"\x05" "\xE1J\xE1\x9B\x03"
+	"\x08" "\xE0[\xE0\xA3\xE1\x84\xE1\x9B"
+	"\x07" "\xE0g\xE0K\xC9\xE0\xEA"
+	"\x06" "\xE1(\xE1\x0D\xE1S"
+	"\x0A" "\xE2\xB8" "e\xE1/p\xE1" "0\x09\x80"
+	"\x0C" "\xE0k\xA7\xA2\x9E\xD5" "b\xE0\x5C\x84\xD0\x1F"
+	"\x06" "\xE2\xC3\xA0" "b\xA2\xAD"
+	"\x05" "d\xE0\x9D\xE0q"
+	"\x06" "\xE1\x87\xE1i\xE0q"
+	"\x03" "\x0B\xE0\xD4"
+	"\x03" "\xCD\xE0\xD4"
+	"\x03" "\x92\xE0\xD4"
+	"\x03" "\x8C\xE0\xD4"
+	"\x04" "\xE0.\xE0\xD4"
+	"\x0A" "\xE1\x87\xE1i\xE1\xDB\xE2\xD3\xE0q"
+	"\x04" "\xE1" "c\xE0q"
+	"\x06" "\xE0(\xE1" "c\xE0q"
+	"\x05" "d\xE1\xFC\xE0H"
+	"\x01" "\x05"
+	"\x0C" "\xE1\xC4\xE1" "7t\xE1/p\xE1" "0\x09\x80"
+	"\x08" "\x9E\xE1/p\xE1" "0\x09\x80"
+	"\x04" "\x01\xE2\x87\xDC"
+	"\x0C" "\xE1" "6\xE0=w\xE2\xB1\xE0\xB3\xE1\xACy"
+	"\x09" "\xE0\xA8\x13\xE1\xD0\xE0\x02\xE0\xE5"
+	"\x01" "\x05"
+	"\x0B" "\x01\x94\xE0\xFB\xE1\xDF\xE2" "D\xE1\xEB\xC0"
+	"\x0A" "\x01\xE1\x95\x81\xDC \xE0\x3F\xE2\x86"
+	"\x03" "\x01\xAE\xAD"
+	"\x08" "\x01\xE0\xE9\xE0\xA0\x81\xAE\xAD"
+	"\x12" "\xE0\xE9\xE0\xA0\x81" "c\xE0\x9F\xE0@(\xE0\xEF\xE0" "6\xB4\xE0\xF6"
+	"\x0F" "\xE0\x0C\xE0\xBC\xE1\xC4r\xE0h\xE0" "1m\xE2\x1D\xB4"
+	"\x0F" "\xE1\x17\xE1)\x08\xE0l\xE0h\xE0" "1m\xE2\x1D\xB4"
+	"\x05" "\xAE\xE0\x02\xE0\xE5"
+	"\x02" "\x8B\x96"
+	"\x04" "\xE0" "D\xE1\x9B"
+	"\x07" "\xE0K\xC9\xE0\x9B\xE1X"
+	"\x05" "\x01\xE1\xEE\xE1K"
+	"\x06" "\x01\xE1-\x09\xE1K"
+	"\x06" "\x01\xE0> \xE1K"
+	"\x06" "\x01\xE1Y\xDC\xE0u"
+	"\x0C" "\x80\xE0%\xE0\xFB-\xE0\x94\x0A\xDC\xE0u"
+	"\x0C" "\xE1" "6\xE0\xB3ry\x0A\xE1\x9D\x7F\xE0y"
+	"\x05" "\x01\xE1\x8A\xE0u"
+	"\x0A" "\x01m\xC1\xD2\xE1" "4\xE1\x8A\xE0u"
+	"\x07" "\x01\xE0)\xE0\xC8\xE1K"
+	"\x08" "\xE1z \xE1^\xE0s\x03"
+	"\x07" "\xE1s\xE1^\xE0s\x03"
+	"\x05" "\x01\xE1\xEE\xE1\x01"
+	"\x06" "\x01\xE1-\x09\xE1\x01"
+	"\x06" "\x01\xE0> \xE1\x01"
+	"\x04" "\x01\xE1Y\xDC"
+	"\x03" "\x01\xE1\x8A"
+	"\x03" "\xE1z\x03"
+	"\x03" "\xE1z\x0C"
+	"\x03" "\xE1z\x0E"
+	"\x06" "\xE1s\xE1^\xE2O"
+	"\x03" "\xE2\xD8\x0C"
+	"\x08" "\xE1s\xE1^\xE0>\xE1\xB6"
+	"\x0B" "\xE0R\xCBp\xE1" "9\xE0Y \xE0\xE5"
+	"\x01" "\x05"
+	"\x0A" "\x80\xE0%\xE0\xFB-\xE0\x94\x0A\xDC"
+	"\x0B" "\xE1" "6\xE0\xB3ry\x0A\xE1\x9D\x7Fs"
+	"\x08" "\x01m\xC1\xD2\xE1" "4\xE1\x8A"
+	"\x0F" "\x01\xE1\xEE\xE1\x01\xE0\xF7N\xE0" "4\xE1\x07\xE0\xA6\x88"
+	"\x20" "Ve\xE2_\x84\x08\xE0" "7ry\x0A\xE1\x9D\xE1\x1C\xE2\x92\x85\xE0j\xE1\xB7\xE1\xF9saf\x09\xE1+\xCB!"
+	"\x07" "\xE1\x1F\xE0Y \xE0\xE5"
+	"\x03" "\xE1s\x96"
+	"\x02" "\xE0\xE5"
+	"\x08" "c\xE1\xB1\xA7\xE0Z\xE0q"
+	"\x09" "\xE0\x00\xC9\xE0\xBB\xE2X\xE1G"
+	"\x04" "\xE0\x90\xE1T"
+	"\x04" "\xE1Z\xE2Y"
+	"\x05" "\xE0" "D\xC9\xE2Y"
+	"\x04" "\xE1\x83\xE1T"
+	"\x08" "\xE0[\xE0\xA3\xE1\x84\xE1T"
+	"\x08" "\xE0K\xE1j\xE0\x9C\xE0."
+	"\x06" "\xE1(\xE1\x0D\xE1T"
+	"\x03" "\xE1Z\x9E"
+	"\x01" "\x05"
+	"\x03" "\xE0\xF0\xB7"
+	"\x05" "\xE1\x80\x8F\xDD\xB7"
+	"\x08" "\xE1\x80\xE0" "c\xE0L\xE2\xCC"
+	"\x01" "\xB0"
+	"\x05" "\xE2)\xE1\xCD\xCF"
+	"\x01" "\xA1"
+	"\x02" "\xB0\x14"
+	"\x02" "\xB0\x18"
+	"\x02" "\xB0\x1A"
+	"\x02" "\xB0\x1C"
+	"\x02" "\xB0\x19"
+	"\x02" "\xB0\x1B"
+	"\x02" "\xB0\x15"
+	"\x02" "\xB0\x17"
+	"\x02" "\xB0\x1E"
+	"\x02" "\xB0\x1D"
+	"\x04" "\xE0\x8E\xB7\x03"
+	"\x04" "\xE0\x8E\xB7\x0C"
+	"\x04" "\xE0\x8E\xB7\x0E"
+	"\x02" "\xA1\x14"
+	"\x02" "\xA1\x18"
+	"\x02" "\xA1\x1A"
+	"\x02" "\xA1\x1C"
+	"\x02" "\xA1\x19"
+	"\x02" "\xA1\x1B"
+	"\x02" "\xA1\x15"
+	"\x02" "\xA1\x17"
+	"\x02" "\xA1\x1E"
+	"\x02" "\xA1\x1D"
+	"\x02" "\xA1\x03"
+	"\x02" "\xA1\x0C"
+	"\x02" "\xA1\x0E"
+	"\x11" "\xE2\xBB\xE0Sr\x8F\xE0/ \xE1\x19\xE0~\xE2\x0D\xE2\x05"
+	"\x0E" "\xAE" "c\xE0\xA4\x89\xD3\xC1i\xA3\xDD\xE1" "8\xBF\x1F"
+	"\x0A" "\xE2U\xE1\x1C\xE0~\xE2\x0D\xE2\x05"
+	"\x0F" "\xE2\x8B\x0A\xE0\x1D\xE0\x9E\xE2\x97n\xE1\xB3\xE0\xA4y"
+	"\x01" "\x05"
+	"\x03" "\xE0\xF0\xCF"
+	"\x04" "\xE0\xF0\xE1X"
+	"\x0A" "v\xD0i\xE1\x0C\xE1L\xE1\x19\xB7"
+	"\x0A" "v\xD0i\xE1\x0C\xE1L\xE1\x19\xCF"
+	"\x0B" "v\xD0i\xE1\x0C\xE1L\xE1\x19\xE1X"
+	"\x0C" "\x9F\xE2Ip \xE2" "5\xE2\x22\xE1\x1C\xB7"
+	"\x0C" "\x9F\xE2Ip \xE2" "5\xE2\x22\xE1\x1C\xCF"
+	"\x04" "\xE1_\xE0\xE8"
+	"\x07" "\xE1_\xE2G\xE1\xCD\xCF"
+	"\x02" "\xE1\xA3"
+	"\x0A" "\xE2U\x7F\xE1" "0\x88\x08\xE0\x86\x1F"
+	"\x0C" "t\xA9\xE0r\xC2v\xE0" "2\xA3\xA7\xA0\xB7"
+	"\x04" "\xE0\xF0\xB7\x06"
+	"\x07" "\xCE\xE1-\xE1H\xE0\xEE"
+	"\x07" "\xCE\xE1-\xE1H\xE0\xE7"
+	"\x10" "\xC6\xE2W\xE0Zh\xE2\x00\x09\xE1#\xE1\x1A\xE0\x86\x1F"
+	"\x05" "\xE0\x8F" "5\xE0\xB7"
+	"\x05" "\x9C\xE1\x11\xE0\xF3"
+	"\x01" "\x05"
+	"\x0A" "S\xE0\x1Dwp\xE1\xFB\xE2H\x03"
+	"\x06" "\xCE\xE0\xC8\xA5\xE0\xEE"
+	"\x06" "\xCE\xE0\xC8\xA5\xE0\xE7"
+	"\x13" "\x01" "a\xE0" "fo\xE1\xA7\xE0z \xE0_ym\xE0<\xE2k\xB7"
+	"\x04" "\xE0\xF0\xCF\x06"
+	"\x1E" "\xE1\x80\x8F\xDD\xE0\x85\xD8\xBF" "d\x13\xE0\xF7" "Ext\x87 \xE1\xF1\xE0\xAB\xE0" "1l\x08\xDFo\xE1\xB0\xA4"
+	"\x1E" "\xE1\x80\x8F\xDD\xE0\x85\xD8\xBF" "d\x13\xE0\xF7In \xE1\xF6\xCA\xE2\x07\xD2\xE0" "5\xE1\xF1\xE0\xAB\xE0" "1l"
+	"\x02" "\xB0\x06"
+	"\x04" "\xE0\x8E\xCF\x03"
+	"\x04" "\xE0\x8E\xCF\x0C"
+	"\x04" "\xE0\x8E\xCF\x0E"
+	"\x0B" "\xCE" "ax\xE0" "8\xE0Y\xE2\x11\xE0\xEE"
+	"\x0D" "\xCEg\xE0" "1\xE0\xBF\xE0\xC1\xE1\xD4\xA5\xE0\xEE"
+	"\x0D" "\xCEg\xE0" "1\xE0\xBF\xE0\xC1\xE1\xD4\xA5\xE0\xE7"
+	"\x0C" "\xCE" "ax\xE0" "8\xE0\xC1\xE1\xD4\xA5\xE0\xE7"
+	"\x06" "\xE2)\xE1\xCD\xCF\x06"
+	"\x05" "\xE1\xD7\xE0\xE8\x03"
+	"\x05" "\xE1\xD7\xE0\xE8\x0C"
+	"\x05" "\xE1\xD7\xE0\xE8\x0E"
+	"\x05" "\xE1_\xE0\xE8\x06"
+	"\x03" "\xE1\xA3\x03"
+	"\x08" "\xCE\x84\xE1\xFA\xE1H\xE0\xEE"
+	"\x08" "\xCE\x84\xE1\xFA\xE1H\xE0\xE7"
+	"\x01" "\x05"
+	"\x03" "\xE1\xA3\x0C"
+	"\x03" "\xE1\xA3\x0E"
+	"\x06" "\xE0g\xE1\x11\xE0\x8A"
+	"\x0D" "\xE0\xA0\xE0\xB9\xB8\xE1\x11\xE1\xE4\xB2\xE0\xAC\xCB"
+	"\x03" "1\xE0\x04"
+	"\x03" "2\xE0\x04"
+	"\x03" "3\xE0\x04"
+	"\x03" "4\xE0\x04"
+	"\x03" "5\xE0\x04"
+	"\x03" "6\xE0\x04"
+	"\x03" "7\xE0\x04"
+	"\x03" "8\xE0\x04"
+	"\x03" "9\xE0\x04"
+	"\x05" "\xE0\x8F" "1\xE0\xB7"
+	"\x05" "\xE0\x8F" "2\xE0\xB7"
+	"\x05" "\xE0\x8F" "3\xE0\xB7"
+	"\x05" "\xE0\x8F" "4\xE0\xB7"
+	"\x02" "\xE1\x9F"
+	"\x06" "\xE1\x9F\xE0" "5\xC5\xAD"
+	"\x07" "\xE0\xC9\xE2>\x80\xE2("
+	"\x0A" "\xE0\x00\xE0\xC9\xE1\x05\x08\x80\xE2("
+	"\x07" "\xE0\x8F\x01\xE0" "7\xE2\xB9"
+	"\x05" "\xE0\x90\x9A\xE1\x12"
+	"\x08" "(nul\xC2\xE2\x1B)"
+	"\x12" "s\xE2\x08\x9B y\xE1\xD5\xE0\xB3 \x87\xE0:\xE0" "4\xE0v"
+	"\x2D" "a\xA7r\xE0\x99" "c\xE0\xA4\xE0" "B\xE1\xB8p\xE0\xC4\xD7\x8A\xE1m\xC7\x8F\xE0\x81\xE2@\xE0\xB1\xE2v\xE0" "C\xE0" "e\xE0" "3\x08\xE0\x1D\xE0\x9E\xDF\xE1[\xE0U"
+	"\x27" "a\xA7r\xE0\x99\xA8t\xE0" "B\xE1m\xC7\xE1jb\xB3\xE2" "8b\xE1\x06\xE0\xC1\xE2\xCB\xE0T\xA8\xE0" "0i\xE0U\x08\xDF\xE1[\xE0U"
+	"\x01" "\x05"
+	"\x12" "s\xE2\x08\x9B y\xE1\xD5\xE0\xB3 \x87\xE0:\xE0" "4\xE0v"
+	"\x03" "\x9C\xE0\xF3"
+	"\x24" "\xE0\x82\xE1L\xE1\x0B\xE0\xBA\xE0" "0\xAC\x8Ap\xE0\x1B\xDB\xA8\x08\x8F\xCC(\xE0L\xE2\xA7\xCAp\x84" "a\xE0@ig\xE2\x7F" "e"
+	"\x12" "\x9C\xE0\xF3\xAA\xD4\xE0 \xE0" "0e\x9Bn\xE0/\xB8\xE0\x84s"
+	"\x1D" "a\xE0" "fo\xE1\xA7\xE0z\xE0 l\xC2sy\x85\xE0\xFC \xB7\xCA\xE0_\xA2m\xD7u\xE0\xA4y"
+	"\x02" "\xE0\xBB"
+	"\x09" "\x8F\xCC" "a\x89" "e\xE0\x9E\xE1\x18"
+	"\x03" "\x01\xE1\x18"
+	"\x0D" "\xE1\xFE" "c\x8A\xE0\xC9\xE1\x05\xD5\xE2x\xE0\xBB"
+	"\x07" "\xE1\xFE" "c\x8A\x9C\xE1\x18"
+	"\x0F" "\xE0xl\xA3 \x85\xBF\xA2\xE0\xC9\xE1\x05\x08\xE0\xBB"
+	"\x0F" "\x9C\xE0\x84\xE1\xDE\xE0~\xBF\x8A\xE2\x10\xE0\x90\xE2\xCD"
+	"\x03" "\x9C\xE1\x18"
+	"\x05" "\x9C\xE1\x05\xE2\x84"
+	"\x09" "\xE0\xA0\xE0\xB9\xB8\xE1\x11\xE0\x8A"
+	"\x1D" "\xE0\x1Bg\xE0<\xC7\xE1jgiv\xE0" "2\xE0\xCA\xE0\x1C\xE0=\xE1[\xE1*b\xB3\xE0\xA5\x85s"
+	"\x10" "\xE0\x82\xE1\xDD-\x9A\xE1\x0B\xE0\x9B\xD3\xA3v\x09\xE2\x16"
+	"\x1A" "\xE1\x8D\xC7\xE1jgiv\xE0" "2\xE0\xCA\xE0\x1C\xE0=\xE1[\xE1*b\xB3\xE0\xA5\x85s"
+	"\x04" "\xE1\x8D\xE0\xF5"
+	"\x05" "\x9C\xE0\x90\xE0\xF3"
+	"\x06" "\xE0\x90\xE0\xD8\xE0\xEA"
+	"\x13" "t\x87\xE1\xD1\xE1U\xE2\xDC\xE0" "c\x9A\xE2\x00\xE2\x81i\xE0\xFA\x84"
+	"\x0C" "\xE0O\xE0:\xE1" "9\xE0\xE0\x8F\xB8\xE0\xF5"
+	"\x0A" "\xE0O\xE0:\xE1" "9\xE1\x86\xE0\xF5"
+	"\x0A" "\xE0O\xE0:\xE1" "9\xE0K\xE0\xF5"
+	"\x08" "n\xE0\x95\x7F\xE0\xC5\xE0\xF5"
+	"\x0B" "\xE0\x82\x9A\xE0p\xDD\xE1\xCA\x8B\xE1U"
+	"\x10" "\xE0\x82\x9A\xE0p\xDD\xE0\xE0\x8F\x7F\xE0%\xE1\xD1\xE1U"
+	"\x0F" "\xE0\x82\x9A\xE0p\xDD\xE2\xC9\x7F\xE0%\xE1\xD1\xE1U"
+	"\x11" "\x9C\xE1\x8D\xE0\xE0\x8F\xB8\xC7\xE0p\xE1\x10y\xE0\x81\xE1\xDA"
+	"\x0F" "\x9C\xE1\x8D\xE1\x86\xC7\xE0p\xE1\x10y\xE0\x81\xE1\xDA"
+	"\x12" "\x9C\xE2$-b\xBF\xE2\x9E\xC7\xE0p\xE1\x10y\xE0\x81\xE1\xDA"
+	"\x0B" "\xC7\xE0\xA9t\x1F\xE0 \xE0\x81\xE0n"
+	"\x08" "\x9C\xE0rw\xE0\xC5\xE0\xF3"
+	"\x06" "\x9C\xE0K\xC7\xE1\x13"
+	"\x17" "\xE0\x82\xE1\xDD-\x9A\xE1\x0B\xE1#\x0Asu\xE0\xFF\xE0\xC7\xE2\x09\xE0\xAE\xE0\x1C"
+	"\x12" "\xD3\xA3v\x09\xE1\xDD-\x9A\xE2\x96\xE2\xBF\x09(\xE0\xAE\xE0\x1C"
+	"\x13" "\x94\xE1(\xE2" "6\xD5" "au\xE0:\xE0" "4\xE2\xD5\xE0U\x08\xE1\x9A"
+	"\x0B" "\x94\xE1(\xE2" "6\xD5\xE2M\xC9\xE1\x9A"
+	"\x1C" "p\x94v\xE2\xA3\xD7\xE0\x1D\xA9" "c\xE0\xFC\xE0<\xE0\xFA\xE1\x03t\xE0\x81\xE1\xA4\xE2M\xC9\xE1\x9A"
+	"\x11" "\x7F\xE1;\xAE\xAB\xE1\x09\xE0_\xE0\xBF\xE1=\xE1" "F\xE0Q"
+	"\x07" "\xE1" "F\xE1\x97\xE0\x00\xAD"
+	"\x0C" "\xE1\x9E via\xE1\x08\xE1" "F\xE0Q"
+	"\x08" "\xE0" "D\xE0\xD8\xE0\x9B\xE1\x13"
+	"\x06" "\xE0" "D\xE0\xD8\xE0\xEA"
+	"\x08" "\xE1\x83\xE0\xD8\xE0\x9B\xE1\x13"
+	"\x06" "\xE1\x83\xE0\xD8\xE0\xEA"
+	"\x02" "\xE1\x9E"
+	"\x07" "\xE0\x83\xE1\x97\xE0\x00\xAD"
+	"\x0C" "\xE1\x9E via\xE1\x08\xE0\x83\xE0Q"
+	"\x0B" "\x7F\xE1;\xAE\xAB\xE1\x09\xE0_\xE0\x97"
+	"\x0A" "\xE1V\xE1\x95\xE0\xC3\xC5\xAB\xE1\xF8"
+	"\x05" "\xE1V\xE1\x95\x1F"
+	"\x11" "\x7F\xE1;\xAE\xAB\xE1\x09\xE0_\xE0\xBF\xE1=\xE0\xD3\xE0Q"
+	"\x07" "\xE0\xD3\xE1\x97\xE0\x00\xAD"
+	"\x0C" "\xE1\x9E via\xE1\x08\xE0\xD3\xE0Q"
+	"\x08" "\xE1V\xE1\x95\xE0\xC3\xE1\x88"
+	"\x21" "\xE2" "D\xE1\xEB\x08\xD8\xE1\x88 \xD0\x09\x94\xE2\xD6m\xE0\xC7\xE2\x0E\x85\xE0j\xE1\xB7\xE1\xF9saf\x09\xE1+\xCB"
+	"\x03" "\xE0\x83\x91"
+	"\x06" "\xDB\xE0\xC2\x89\xE2\x8A"
+	"\x07" "\xE1V\xE0\xA9\xA4\xE2\xC0"
+	"\x16" "Lo\xE0\x9E" "Emi\xE0\x97i\xE0\x9CZ\xE0" "c\xE0\xA9\xA0\xB2\xE0\xAC\xCB"
+	"\x08" "\xE0\xC9\xE2>\xE1\xA5\xE1G"
+	"\x07" "\xAF\xE2\x07\xD2\x0A\xAB\x98"
+	"\x0D" "\xE0L\xE0\x98\xE1\xD8\xE0kc\x94" "a\xE0\xC0"
+	"\x0A" "\xE0L\xE0\x98\xE1\xD8\xC4\x85\xE1" "A"
+	"\x0C" "\xE0L\xE0\x98\xE1\xD8\xE2\x98\x94" "a\xE0\xC0"
+	"\x10" "\xE0\xA8\x13\xE1\xD0s\xD2u\xE0!\xE0\x9C\xE0\x7F\xE0+"
+	"\x10" "\xE0\xA8\x13\xE1\xD0s\xD2u\xE0!\xE0\x9C\xE0\x80\xE0+"
+	"\x08" "\x83\xE1\x82\x7F\x13\x8A\xE2\x16"
+	"\x11" "\xE0" "E\xE1I\xE2\xB7\xD7\xE2 \xE0\xBC" "c\xE0X\xE1" "As"
+	"\x0F" "\xE0" "E\xE1I\x8F\xCC\xE0" "c\xE0\xBC" "c\xE0X\xE1" "A"
+	"\x06" "\xE0\xD6 \xE0\x83y"
+	"\x11" "\x9A\xE0\x9B\xE1X\xCA\xE2\x9Bs\xA3t\xE0" "f\x09\x9A\xE1\x13"
+	"\x04" "\xE0K\xE0."
+	"\x01" "\x05"
+	"\x01" "\x05"
+	"\x01" "\x05"
+	"\x01" "\x05"
+	"\x01" "\x05"
+	"\x01" "\x05"
+	"\x01" "\x05"
+	"\x01" "\x05"
+	"\x01" "\x05"
+	"\x01" "\x05"
+	"\x09" "\xE0\x1D\xB6\x88\xD5\xE0~\xE0\xC4"
+	"\x0E" "\xE0\xDC\xE0=c\xE1\x0C\xE2\x18u\xE0S\xE1\x0F"
+	"\x05" "\x8Bs\x7Ft\x1F"
+	"\x06" "\xAF\xE0t\xE2" "Cs"
+	"\x05" "\xE0t\xE2" "Cs"
+	"\x14" "C\x8F\xE2\x9C\xA2\x9A\x94\xE0\xB1i\xE2q\xE0\x22" "b\xE0O \xE0,"
+	"\x0A" "(nul\xC2\xE2p\xE2\x0A)"
+	;
+#endif
+
+const byte ISO14819_2_EventPhrases[ISO14819_2_EVENT_PHRASES_COUNT * 3] PROGMEM = {
+	0x20, 0x20, 0x10, 0x00, 0xD6, 0x11, 0x67, 0x76, 0x44, 0x7D, 0x86, 0x44,
+	0x95, 0x9C, 0x44, 0x73, 0x12, 0x41, 0xA3, 0x81, 0x42, 0x73, 0x20, 0x00,
+	0x65, 0x20, 0x00, 0x28, 0x20, 0x10, 0x25, 0x7B, 0x34, 0x9B, 0x3E, 0x41,
+	0x84, 0x2F, 0x43, 0x97, 0xB0, 0x44, 0x26, 0x7B, 0x34, 0xF5, 0x7E, 0x31,
+	0x39, 0x01, 0x31, 0xA8, 0x68, 0x44, 0x65, 0x72, 0x00, 0xDE, 0xE3, 0x33,
+	0x7C, 0xE9, 0x43, 0x00, 0x46, 0x11, 0x14, 0x79, 0x11, 0xEC, 0xDE, 0x31,
+	0xDE, 0xE1, 0x33, 0x77, 0xE4, 0x23, 0x18, 0x79, 0x11, 0xEC, 0xDD, 0x31,
+	0x7E, 0x95, 0x43, 0xD5, 0x79, 0x40, 0x65, 0x64, 0x00, 0x61, 0x6C, 0x00,
+	0x5F, 0x76, 0x42, 0x1E, 0x20, 0x10, 0x25, 0x1E, 0x31, 0x46, 0xA2, 0x31,
+	0x6C, 0x65, 0x00, 0x73, 0x74, 0x00, 0x48, 0x7C, 0x31, 0x72, 0x61, 0x00,
+	0x69, 0x7A, 0x03, 0x20, 0x66, 0x00, 0x74, 0x20, 0x00, 0x53, 0x20, 0x10,
+	0x4A, 0x9B, 0x33, 0x9A, 0x4C, 0x33, 0xEF, 0xE8, 0x43, 0x6F, 0x6E, 0x00,
+	0x66, 0x94, 0x03, 0x1A, 0x22, 0x21, 0x02, 0x28, 0x41, 0x05, 0x7C, 0x41,
+	0x72, 0x65, 0x00, 0x26, 0x1E, 0x31, 0x99, 0x1E, 0x31, 0x8B, 0xCD, 0x34,
+	0xA3, 0x06, 0x14, 0xFA, 0x4D, 0x41, 0x79, 0x08, 0x41, 0x63, 0x68, 0x00,
+	0x6E, 0xB4, 0x01, 0x00, 0x52, 0x43, 0xE0, 0x1E, 0x31, 0x71, 0x68, 0x44,
+	0x44, 0x20, 0x10, 0x0B, 0x06, 0x45, 0x79, 0x20, 0x00, 0x74, 0x69, 0x00,
+	0x43, 0x2F, 0x11, 0x6C, 0x69, 0x00, 0xEB, 0x22, 0x31, 0x6C, 0x61, 0x00,
+	0x73, 0x65, 0x00, 0x75, 0x6E, 0x00, 0x20, 0x64, 0x00, 0x54, 0x07, 0x11,
+	0x65, 0x73, 0x00, 0x54, 0x73, 0x10, 0xEA, 0x42, 0x41, 0x28, 0x18, 0x22,
+	0xA9, 0xF7, 0x34, 0x61, 0x6B, 0x40, 0x69, 0x6E, 0x00, 0xB1, 0xCF, 0x11,
+	0x6A, 0x24, 0x41, 0x73, 0x68, 0x00, 0x74, 0x68, 0x00, 0x1B, 0xAE, 0x24,
+	0x61, 0x62, 0x01, 0xDA, 0xEA, 0x43, 0xAF, 0xFD, 0x44, 0xD9, 0xFC, 0x44,
+	0xD9, 0xFE, 0x44, 0xBB, 0x75, 0x11, 0x20, 0x59, 0x51, 0x6F, 0x72, 0x00,
+	0x28, 0x76, 0x02, 0x69, 0x6C, 0x00, 0x6C, 0x20, 0x00, 0x72, 0x69, 0x00,
+	0x63, 0x2F, 0x01, 0x82, 0x42, 0x21, 0x74, 0x7F, 0x04, 0xBC, 0xA1, 0x41,
+	0x77, 0xB9, 0x11, 0x79, 0x7D, 0x41, 0x2C, 0x20, 0x00, 0x63, 0x65, 0x00,
+	0x6C, 0x42, 0x01, 0x53, 0x86, 0x14, 0x57, 0x8D, 0x32, 0x2D, 0x2E, 0x55,
+	0x61, 0x72, 0x00, 0x70, 0x65, 0x00, 0x69, 0x74, 0x00, 0x61, 0x63, 0x00,
+	0x75, 0x65, 0x00, 0xB0, 0xB4, 0x11, 0x12, 0x20, 0x10, 0x61, 0x6E, 0x00,
+	0x78, 0x20, 0x20, 0x20, 0x3E, 0x01, 0xB0, 0x68, 0x10, 0x70, 0x6F, 0x00,
+	0x54, 0x60, 0x11, 0x65, 0x07, 0x01, 0x99, 0xE8, 0x43, 0x52, 0x20, 0x10,
+	0x1F, 0x62, 0x11, 0x28, 0xA7, 0x04, 0x6A, 0xB8, 0x41, 0x8B, 0xC3, 0x34,
+	0x30, 0x2F, 0x05, 0x18, 0x3E, 0x13, 0x18, 0x3F, 0x13, 0xE2, 0xBC, 0x31,
+	0x13, 0x3E, 0x13, 0x13, 0x3F, 0x13, 0x19, 0x3E, 0x13, 0x19, 0x3F, 0x13,
+	0x7F, 0x33, 0x25, 0xAA, 0x3A, 0x43, 0xAA, 0x3B, 0x43, 0xAA, 0x3C, 0x43,
+	0xAA, 0x3D, 0x43, 0xAB, 0x3A, 0x43, 0xAB, 0x3B, 0x43, 0xAB, 0x3C, 0x43,
+	0xAB, 0x3D, 0x43, 0xAC, 0x3A, 0x43, 0xAC, 0x3B, 0x43, 0xAC, 0x3C, 0x43,
+	0xAC, 0x3D, 0x43, 0xB7, 0x65, 0x30, 0x1B, 0x38, 0x45, 0x75, 0x72, 0x00,
+	0x25, 0x76, 0x02, 0x6E, 0x6F, 0x00, 0xE2, 0x7F, 0x33, 0x34, 0x73, 0x10,
+	0xB0, 0x6F, 0x10, 0x15, 0x20, 0x20, 0x64, 0xA9, 0x04, 0x1C, 0x53, 0x21,
+	0x1A, 0x35, 0x21, 0xB0, 0x27, 0x11, 0x25, 0x33, 0x13, 0xF5, 0x10, 0x44,
+	0x76, 0x4F, 0x03, 0x16, 0x12, 0x21, 0x26, 0x10, 0x35, 0x0F, 0x53, 0x51,
+	0x16, 0x44, 0x55, 0x21, 0x1E, 0x41, 0x42, 0x1F, 0x54, 0x69, 0x63, 0x00,
+	0x20, 0x74, 0x00, 0x72, 0x6F, 0x00, 0x65, 0x6E, 0x00, 0x7B, 0x77, 0x30,
+	0x6F, 0x20, 0x00, 0x29, 0x24, 0x13, 0x25, 0x07, 0x01, 0x63, 0x70, 0x01,
+	0x6C, 0x08, 0x01, 0x64, 0x20, 0x00, 0x64, 0x69, 0x00, 0xFD, 0xD8, 0x31,
+	0xB2, 0x2A, 0x11, 0x20, 0x1C, 0x02, 0x7B, 0x7A, 0x33, 0x2F, 0xA3, 0x13,
+	0x73, 0x08, 0x01, 0xAD, 0x20, 0x31, 0x3A, 0x20, 0x00, 0x79, 0x29, 0x01,
+	0x27, 0x2D, 0x12, 0x22, 0xB5, 0x11, 0xA1, 0x4C, 0x45, 0x09, 0x67, 0x50,
+	0x2C, 0x29, 0x24, 0xBB, 0xA7, 0x34, 0x28, 0x2B, 0x44, 0x2A, 0x57, 0x45,
+	0x53, 0x62, 0x50, 0x59, 0x54, 0x55, 0xB0, 0xDC, 0x13, 0x61, 0x64, 0x00,
+	0x76, 0x65, 0x00, 0xDD, 0x65, 0x30, 0x65, 0x78, 0x00, 0x63, 0x74, 0x00,
+	0x68, 0x65, 0x00, 0x6D, 0x65, 0x00, 0x9E, 0x60, 0x11, 0x70, 0xB1, 0x01,
+	0x75, 0x70, 0x00, 0x7B, 0xCF, 0x31, 0x44, 0x07, 0x11, 0x49, 0x64, 0x10,
+	0x08, 0x63, 0x10, 0x71, 0x6E, 0x04, 0x25, 0x70, 0x14, 0x70, 0x61, 0x00,
+	0x52, 0x74, 0x10, 0x65, 0x76, 0x00, 0x73, 0x2A, 0x01, 0x2F, 0x08, 0x11,
+	0xAD, 0x77, 0x40, 0x6F, 0x6C, 0x00, 0x75, 0x74, 0x00, 0xFF, 0xE0, 0x34,
+	0x28, 0x29, 0x11, 0x60, 0x20, 0x10, 0x6F, 0x70, 0x00, 0x64, 0x65, 0x00,
+	0x66, 0x24, 0x02, 0x6D, 0x6F, 0x00, 0x70, 0x97, 0x13, 0x8B, 0xA7, 0x34,
+	0xFB, 0x79, 0x42, 0x12, 0xF0, 0x44, 0x6E, 0x65, 0x00, 0x73, 0xE1, 0x03,
+	0xAD, 0x1E, 0x42, 0x14, 0x28, 0x45, 0x28, 0x22, 0x05, 0x33, 0xE6, 0x04,
+	0x6D, 0x75, 0x00, 0x73, 0x05, 0x01, 0x74, 0xAF, 0x01, 0x27, 0x52, 0x11,
+	0x20, 0x65, 0x13, 0x00, 0x97, 0x12, 0x34, 0x70, 0x10, 0xD2, 0xA1, 0x13,
+	0x7F, 0x8D, 0x32, 0x7A, 0x8B, 0x12, 0x56, 0x8B, 0x12, 0x80, 0x73, 0x20,
+	0x93, 0x63, 0x45, 0x83, 0x2A, 0x21, 0x3B, 0x81, 0x13, 0x09, 0xEF, 0x53,
+	0x1F, 0x22, 0x51, 0x2A, 0x64, 0x55, 0x64, 0x32, 0x34, 0xC0, 0x2D, 0x34,
+	0xC2, 0x6A, 0x35, 0x34, 0x61, 0x43, 0x35, 0xC2, 0x44, 0x37, 0x62, 0x43,
+	0x38, 0x08, 0x41, 0x5A, 0x6B, 0x55, 0x66, 0x20, 0x50, 0x74, 0x07, 0x01,
+	0x47, 0x79, 0x10, 0x61, 0x44, 0x01, 0x6F, 0x76, 0x00, 0x73, 0x73, 0x00,
+	0x76, 0x78, 0x11, 0x6D, 0x20, 0x00, 0xDD, 0x08, 0x31, 0x9D, 0x2A, 0x11,
+	0x2F, 0x20, 0x10, 0x69, 0x00, 0x41, 0x77, 0x20, 0x00, 0x68, 0x61, 0x00,
+	0x73, 0x71, 0x01, 0x34, 0x08, 0x11, 0x6F, 0x67, 0x00, 0x12, 0x67, 0x10,
+	0x1F, 0x6C, 0x10, 0x63, 0x61, 0x00, 0x61, 0x6B, 0x00, 0x65, 0x76, 0x02,
+	0x64, 0x81, 0x03, 0x04, 0xAF, 0x51, 0xEB, 0x35, 0x31, 0xDF, 0x74, 0x10,
+	0x29, 0x5F, 0x11, 0x61, 0x20, 0x10, 0x61, 0x2A, 0x01, 0x63, 0x6F, 0x00,
+	0x66, 0x22, 0x02, 0x71, 0x75, 0x00, 0xAF, 0x09, 0x31, 0x20, 0xB7, 0x01,
+	0x27, 0x7F, 0x11, 0xB4, 0x4C, 0x31, 0x28, 0xCD, 0x04, 0x30, 0x39, 0x04,
+	0x35, 0xE6, 0x04, 0x63, 0x69, 0x00, 0x66, 0x5F, 0x01, 0x66, 0xE2, 0x04,
+	0x6F, 0x63, 0x00, 0x6F, 0x64, 0x00, 0x73, 0x6B, 0x00, 0x73, 0x07, 0x01,
+	0x73, 0x28, 0x01, 0x77, 0x65, 0x00, 0x77, 0x12, 0x01, 0x1E, 0xB5, 0x11,
+	0x5F, 0x74, 0x10, 0xCE, 0x20, 0x10, 0xB1, 0xC8, 0x13, 0xB2, 0x64, 0x10,
+	0xD4, 0x54, 0x13, 0xB7, 0x20, 0x10, 0x8B, 0x2E, 0x32, 0x8B, 0x45, 0x34,
+	0x55, 0x6F, 0x10, 0x7C, 0x68, 0x43, 0x7D, 0x66, 0x43, 0x7B, 0xFA, 0x13,
+	0x14, 0x44, 0x14, 0xA0, 0x29, 0x11, 0x1F, 0x61, 0x21, 0x65, 0x82, 0x11,
+	0x9B, 0xF1, 0x41, 0xA8, 0x66, 0x44, 0x3A, 0xEE, 0x11, 0x22, 0x83, 0x21,
+	0x67, 0x3A, 0x11, 0x3C, 0x41, 0x14, 0xE4, 0xEF, 0x11, 0x00, 0xCE, 0x43,
+	0x8E, 0x7E, 0x25, 0x02, 0xFD, 0x54, 0x0F, 0x2B, 0x51, 0xB2, 0x73, 0x30,
+	0x1E, 0x69, 0x50, 0x1F, 0x35, 0x51, 0x21, 0xEB, 0x51, 0x2B, 0xFC, 0x54,
+	0x2B, 0xFE, 0x54, 0x32, 0x36, 0x21, 0xC4, 0x86, 0x35, 0xC6, 0x40, 0x34,
+	0xC7, 0xF7, 0x34, 0x3C, 0x2D, 0x40, 0x3F, 0x1E, 0x41, 0x43, 0x44, 0x41,
+	0x46, 0x3E, 0x44, 0x6E, 0x83, 0x55, 0x6F, 0x20, 0x51, 0x76, 0x26, 0x55,
+	0x7C, 0x99, 0x52, 0x7D, 0x1E, 0x51, 0x7F, 0x19, 0x54, 0x81, 0x96, 0x53,
+	0x87, 0x48, 0x51, 0x88, 0x5A, 0x53, 0x73, 0x29, 0x00, 0x2E, 0x20, 0x00,
+	0x6F, 0x66, 0x00, 0x69, 0x64, 0x00, 0x61, 0x62, 0x00, 0x63, 0x6B, 0x00,
+	0x65, 0x6D, 0x00, 0x67, 0x68, 0x00, 0x7B, 0x6F, 0x30, 0x73, 0x70, 0x00,
+	0x62, 0x75, 0x00, 0xD9, 0x60, 0x11, 0xD4, 0x80, 0x13, 0x6F, 0x75, 0x00,
+	0x61, 0x64, 0x10, 0x70, 0xEE, 0x03, 0x65, 0x74, 0x00, 0x16, 0x2D, 0x23,
+	0x7A, 0x08, 0x11, 0x74, 0xB4, 0x01, 0x7E, 0x64, 0x20, 0x69, 0x07, 0x01,
+	0x7A, 0xB8, 0x21, 0x72, 0x42, 0x01, 0xAF, 0x08, 0x11, 0x75, 0x34, 0x01,
+	0x21, 0x62, 0x10, 0x85, 0x09, 0x21, 0xDC, 0x04, 0x44, 0xD6, 0x24, 0x41,
+	0x74, 0x12, 0x01, 0x17, 0xA2, 0x54, 0x62, 0x6F, 0x00, 0x6F, 0x62, 0x00,
+	0x58, 0x93, 0x32, 0xA2, 0x07, 0x31, 0xB2, 0x20, 0x10, 0xD2, 0x8D, 0x14,
+	0x1F, 0x07, 0x11, 0x98, 0x84, 0x33, 0xE4, 0x3C, 0x15, 0x5C, 0x50, 0x33,
+	0x46, 0x40, 0x55, 0x31, 0x8D, 0x05, 0x35, 0x2A, 0x03, 0x62, 0x65, 0x00,
+	0x62, 0x47, 0x01, 0x62, 0x80, 0x01, 0x63, 0x27, 0x01, 0x63, 0x94, 0x04,
+	0x66, 0x12, 0x01, 0x6A, 0x6A, 0x03, 0x6D, 0x08, 0x01, 0x70, 0x47, 0x01,
+	0x73, 0x49, 0x01, 0x77, 0x79, 0x02, 0x07, 0x69, 0x13, 0xB0, 0x63, 0x11,
+	0xB0, 0x38, 0x13, 0x5F, 0x92, 0x15, 0x2F, 0x74, 0x10, 0xB1, 0x25, 0x11,
+	0x70, 0x42, 0x11, 0x00, 0x49, 0x11, 0x00, 0x7C, 0x11, 0x34, 0x6E, 0x10,
+	0x34, 0x25, 0x11, 0x44, 0x58, 0x11, 0xDD, 0x8F, 0x35, 0xB3, 0x20, 0x10,
+	0xDE, 0x9A, 0x35, 0x52, 0x88, 0x12, 0x73, 0x6B, 0x10, 0x9B, 0x99, 0x15,
+	0x77, 0x64, 0x10, 0x77, 0x74, 0x10, 0x7B, 0x20, 0x20, 0x63, 0x7D, 0x12,
+	0x27, 0x96, 0x35, 0x78, 0x9C, 0x11, 0xB7, 0x43, 0x15, 0x89, 0xBE, 0x34,
+	0x56, 0x91, 0x13, 0x4B, 0x90, 0x13, 0x80, 0x07, 0x21, 0x81, 0xF5, 0x21,
+	0x95, 0x08, 0x41, 0x65, 0x34, 0x12, 0x65, 0x9E, 0x12, 0xDD, 0xB5, 0x11,
+	0xDD, 0x37, 0x11, 0xDE, 0xB5, 0x11, 0x38, 0x50, 0x34, 0x3A, 0x72, 0x13,
+	0x3A, 0xD9, 0x13, 0xBC, 0x15, 0x42, 0x87, 0x77, 0x23, 0xE4, 0xEC, 0x11,
+	0xDC, 0x28, 0x41, 0xDD, 0x20, 0x40, 0xE7, 0x69, 0x11, 0xE7, 0x55, 0x14,
+	0x8E, 0x81, 0x21, 0xE6, 0x35, 0x42, 0x25, 0x97, 0x25, 0xED, 0xB5, 0x45,
+	0xF2, 0xE9, 0x44, 0xA5, 0xD5, 0x31, 0xF9, 0x6D, 0x40, 0xBE, 0xA5, 0x15,
+	0xBF, 0x05, 0x11, 0x03, 0x82, 0x53, 0x0B, 0x4E, 0x54, 0x16, 0x0F, 0x54,
+	0x5B, 0xA7, 0x31, 0xB2, 0x07, 0x31, 0x16, 0xF8, 0x43, 0x19, 0xC1, 0x41,
+	0x25, 0x64, 0x50, 0xF2, 0x1E, 0x12, 0xF3, 0xB5, 0x11, 0xF4, 0xBF, 0x11,
+	0x2A, 0xA7, 0x55, 0x2C, 0x45, 0x55, 0x30, 0x69, 0x50, 0x34, 0x42, 0x51,
+	0x9B, 0xD5, 0x21, 0x9D, 0x44, 0x21, 0x49, 0x48, 0x55, 0x49, 0x4D, 0x54,
+	0x6C, 0xA4, 0x31, 0x6D, 0x0C, 0x34, 0x6E, 0xD9, 0x31, 0x6F, 0x2A, 0x32,
+	0x70, 0x2A, 0x32, 0x73, 0xA4, 0x31, 0x74, 0xA4, 0x31, 0x75, 0x53, 0x31,
+	0x76, 0x5C, 0x34, 0xCF, 0xB5, 0x31, 0xD1, 0x20, 0x30, 0xD2, 0xBA, 0x35,
+	0xD3, 0x20, 0x30, 0xD4, 0xA0, 0x32, 0x49, 0x58, 0x41, 0x51, 0x5D, 0x44,
+	0x53, 0x78, 0x43, 0x54, 0xD6, 0x43, 0x58, 0x60, 0x41, 0x89, 0x75, 0x51,
+	0x8C, 0xB6, 0x55, 0x8E, 0xB7, 0x55, 0x94, 0x08, 0x51, 0x98, 0x47, 0x54,
+	0x9B, 0xEC, 0x51, 0x9F, 0x08, 0x51, 0xA0, 0x8A, 0x55, 0xA1, 0xC3, 0x55,
+	0xA4, 0x9C, 0x52, 0xA8, 0x72, 0x51, 0xA9, 0x79, 0x51, 0xAD, 0x5B, 0x53,
+	0xAF, 0x9D, 0x55, 0xB0, 0x7F, 0x53, 0xB1, 0xC5, 0x55, 0xB8, 0xC0, 0x55,
+	0xBB, 0x48, 0x55, 0xBC, 0x69, 0x50, 0xBD, 0x6C, 0x54, 0xBE, 0xB3, 0x55,
+	0xC1, 0x34, 0x51, 0xC4, 0xD8, 0x53, 0xC6, 0xAA, 0x55, 0xC7, 0x4C, 0x54,
+	0x5F, 0x20, 0x10, 0x7D, 0x73, 0x30, 0x74, 0x7B, 0x42, 0x6D, 0x61, 0x00,
+	0x88, 0x68, 0x30, 0x20, 0x61, 0x00, 0x20, 0x6D, 0x00, 0x80, 0x65, 0x34,
+	0x81, 0x87, 0x43, 0x12, 0x74, 0x10, 0x6F, 0x7A, 0x03, 0x60, 0xB3, 0x41,
+	0x71, 0x27, 0x11, 0xE7, 0x78, 0x34, 0x8F, 0x8E, 0x44, 0x5F, 0x6D, 0x10,
+	0x30, 0x74, 0x30, 0x55, 0x21, 0x11, 0x4A, 0x76, 0x14, 0x29, 0x2A, 0x31,
+	0x69, 0x6D, 0x00, 0xB7, 0xB9, 0x44, 0x32, 0x64, 0x04, 0x33, 0x64, 0x04,
+	0x34, 0x64, 0x04, 0x36, 0x64, 0x04, 0x80, 0x64, 0x44, 0x80, 0xA1, 0x44,
+	0x76, 0xA0, 0x04, 0x9B, 0x6E, 0x10, 0x77, 0x43, 0x20, 0xCB, 0xCC, 0x44,
+	0x63, 0x9B, 0x01, 0x69, 0x7D, 0x02, 0x25, 0x21, 0x31, 0xB0, 0x7C, 0x12,
+	0x00, 0x43, 0x13, 0x00, 0x87, 0x12, 0x27, 0xDB, 0x34, 0x41, 0x21, 0x31,
+	0xDF, 0x28, 0x41, 0x91, 0xC2, 0x34, 0xE4, 0xE5, 0x44, 0x12, 0x42, 0x11,
+	0x83, 0x07, 0x21, 0xD0, 0x62, 0x11, 0x1F, 0x2D, 0x13, 0x77, 0x52, 0x01,
+	0x45, 0x2A, 0x31, 0x6F, 0x9B, 0x01, 0x08, 0x64, 0x40, 0xF2, 0xF4, 0x44,
+	0x91, 0x0E, 0x25, 0x73, 0x79, 0x02, 0x79, 0x65, 0x40, 0x66, 0x24, 0x03,
+	0x1F, 0x56, 0x23, 0x54, 0x24, 0x05, 0x07, 0x89, 0x12, 0xEC, 0x07, 0x41,
+	0xB1, 0x44, 0x31, 0x66, 0xB3, 0x03, 0x77, 0x20, 0x10, 0xB7, 0x82, 0x14,
+	0x29, 0xDA, 0x21, 0x0B, 0x36, 0x55, 0x51, 0x07, 0x11, 0x94, 0x20, 0x30,
+	0x22, 0x1E, 0x44, 0x28, 0xC3, 0x04, 0x65, 0xD3, 0x01, 0x76, 0x12, 0x01,
+	0x77, 0x4D, 0x25, 0x80, 0x4E, 0x35, 0x7A, 0xE7, 0x21, 0x7E, 0x93, 0x43,
+	0x7E, 0x50, 0x45, 0x7B, 0x51, 0x15, 0x1B, 0x92, 0x22, 0x97, 0x4F, 0x45,
+	0x42, 0xBC, 0x33, 0xCE, 0x25, 0x44, 0xEA, 0x79, 0x40, 0x26, 0x09, 0x21,
+	0x4A, 0x27, 0x54, 0x52, 0x2A, 0x51, 0x6E, 0x67, 0x00, 0x6C, 0x6F, 0x00,
+	0x65, 0x14, 0x02, 0x63, 0x7B, 0x03, 0xD2, 0x71, 0x11, 0xB2, 0x74, 0x10,
+	0x61, 0x76, 0x00, 0x61, 0x7A, 0x03, 0x61, 0x67, 0x00, 0x72, 0x42, 0x11,
+	0x75, 0x63, 0x00, 0x72, 0x1E, 0x01, 0x85, 0x84, 0x33, 0x77, 0x61, 0x00,
+	0x77, 0x72, 0x01, 0x21, 0x28, 0x10, 0x82, 0x65, 0x30, 0x20, 0x28, 0x00,
+	0x73, 0x69, 0x00, 0x61, 0x69, 0x00, 0x1E, 0x75, 0x11, 0xF2, 0x9D, 0x34,
+	0x28, 0x20, 0x30, 0x20, 0x45, 0x01, 0x75, 0x6D, 0x00, 0x77, 0xB4, 0x01,
+	0x8D, 0x72, 0x30, 0x7F, 0xF9, 0x43, 0x28, 0xBE, 0x04, 0x65, 0x61, 0x00,
+	0x25, 0x72, 0x10, 0xBF, 0x70, 0x41, 0xC1, 0x13, 0x42, 0xE1, 0x7F, 0x13,
+	0x63, 0xB1, 0x01, 0x2A, 0xE7, 0x34, 0xB0, 0x93, 0x13, 0x75, 0xE3, 0x11,
+	0x7A, 0x21, 0x12, 0x72, 0x20, 0x10, 0x8C, 0xF1, 0x34, 0x88, 0x53, 0x21,
+	0x9C, 0x17, 0x32, 0x67, 0x61, 0x00, 0x64, 0x07, 0x01, 0x66, 0x74, 0x00,
+	0x29, 0xE2, 0x14, 0xED, 0xCE, 0x41, 0x05, 0x09, 0x54, 0x20, 0x90, 0x03,
+	0xB1, 0x62, 0x11, 0x53, 0xA6, 0x33, 0x65, 0x70, 0x01, 0xF9, 0x6E, 0x40,
+	0x0E, 0x76, 0x41, 0x19, 0x4C, 0x51, 0x68, 0x55, 0x03, 0x69, 0x34, 0x01,
+	0x52, 0xE6, 0x11, 0x84, 0xAC, 0x43, 0xF6, 0x65, 0x30, 0x1D, 0x13, 0x54,
+	0x25, 0xE2, 0x21, 0xAE, 0x29, 0x35, 0x66, 0x2A, 0x01, 0xE0, 0x89, 0x33,
+	0x7F, 0x1A, 0x34, 0x64, 0xBA, 0x11, 0x85, 0x20, 0x20, 0x64, 0x7C, 0x02,
+	0x66, 0x34, 0x01, 0x25, 0x27, 0x11, 0xF8, 0xE2, 0x41, 0x2B, 0x0C, 0x24,
+	0x64, 0x63, 0x01, 0x68, 0x69, 0x00, 0x6D, 0x72, 0x01, 0x72, 0x65, 0x04,
+	0x75, 0x7D, 0x02, 0x27, 0x6D, 0x10, 0x27, 0x6E, 0x10, 0x48, 0x1C, 0x15,
+	0xBD, 0xDA, 0x31, 0x24, 0x58, 0x45, 0x26, 0x7F, 0x43, 0x64, 0x76, 0x04,
+	0x73, 0x09, 0x01, 0x73, 0x5C, 0x05, 0x27, 0x5E, 0x15, 0xB1, 0xDB, 0x11,
+	0x51, 0x20, 0x10, 0x66, 0xA2, 0x13, 0x03, 0x8A, 0x53, 0x1E, 0x2F, 0x54,
+	0x62, 0x5D, 0x55, 0x68, 0x92, 0x52, 0x69, 0x65, 0x55, 0x66, 0xAF, 0x01,
+	0x60, 0xDB, 0x43, 0x47, 0x6E, 0x10, 0x77, 0x53, 0x20, 0x68, 0xAF, 0x01,
+	0x7E, 0xD3, 0x31, 0xB3, 0xCE, 0x11, 0x73, 0x72, 0x14, 0x74, 0x70, 0x04,
+	0x51, 0x6E, 0x04, 0x77, 0x76, 0x40, 0x21, 0x61, 0x10, 0x77, 0x63, 0x10,
+	0x09, 0x51, 0x11, 0x65, 0x2B, 0x03, 0xD1, 0x73, 0x10, 0xD1, 0x07, 0x11,
+	0x73, 0x18, 0x42, 0x66, 0xB1, 0x01, 0x70, 0x6B, 0x10, 0x67, 0x08, 0x01,
+	0xD5, 0x17, 0x12, 0x72, 0x21, 0x01, 0x98, 0x9A, 0x44, 0x9E, 0x08, 0x41,
+	0x63, 0xDA, 0x01, 0xB4, 0x68, 0x44, 0xB2, 0x63, 0x10, 0x49, 0x43, 0x11,
+	0x62, 0x08, 0x01, 0xB8, 0xC0, 0x44, 0x6C, 0x6C, 0x00, 0x29, 0x34, 0x11,
+	0x45, 0x70, 0x10, 0x64, 0x69, 0x04, 0xD1, 0x78, 0x44, 0x6E, 0x5F, 0x01,
+	0xDE, 0x83, 0x43, 0x61, 0x61, 0x01, 0x66, 0x8A, 0x02, 0x7B, 0x72, 0x30,
+	0x09, 0x96, 0x13, 0x49, 0x4B, 0x33, 0x87, 0x79, 0x30, 0xF6, 0x4E, 0x43,
+	0x7A, 0x70, 0x01, 0x47, 0xE9, 0x34, 0x01, 0x8F, 0x42, 0x01, 0xA4, 0x53,
+	0x63, 0xD4, 0x01, 0xD0, 0x75, 0x11, 0x87, 0x74, 0x30, 0x56, 0x76, 0x11,
+	0x0A, 0x12, 0x55, 0x61, 0x62, 0x11, 0x1F, 0x0D, 0x24, 0xF3, 0x18, 0x45,
+	0x2C, 0x4A, 0x01, 0x6C, 0x79, 0x00, 0x77, 0x11, 0x04, 0x51, 0x09, 0x11,
+	0x52, 0x63, 0x10, 0x63, 0x08, 0x01, 0x72, 0x08, 0x01, 0x73, 0xEB, 0x04,
+	0x76, 0x6F, 0x00, 0xEA, 0xB2, 0x11, 0x64, 0x76, 0x01, 0x6B, 0x65, 0x00,
+	0x6F, 0x62, 0x01, 0x34, 0x1D, 0x14, 0x39, 0x6C, 0x50, 0x69, 0x50, 0x03,
+	0x6F, 0x0F, 0x04, 0x70, 0x4F, 0x03, 0x52, 0x72, 0x14, 0x76, 0x9C, 0x11,
+	0x4A, 0xA9, 0x14, 0x3B, 0x95, 0x52, 0x3E, 0x15, 0x55, 0x3F, 0xD6, 0x51,
+	0x20, 0x1F, 0x02, 0x65, 0x7A, 0x00, 0x6D, 0x52, 0x01, 0x75, 0x47, 0x01,
+	0xAF, 0x42, 0x11, 0xB1, 0x7A, 0x13, 0x45, 0x11, 0x15, 0x27, 0x78, 0x30,
+	0x77, 0x23, 0x44, 0x66, 0x45, 0x11, 0x5E, 0xF0, 0x34, 0x5F, 0x56, 0x31,
+	0xBE, 0x56, 0x35, 0x20, 0x98, 0x02, 0x61, 0x74, 0x00, 0x65, 0x24, 0x01,
+	0x68, 0x45, 0x03, 0x76, 0xE5, 0x01, 0x07, 0x81, 0x11, 0x9F, 0x92, 0x13,
+	0x91, 0x11, 0x35, 0xED, 0x5F, 0x15, 0x25, 0x60, 0x55, 0xBF, 0x61, 0x35,
+	0x2C, 0x36, 0x44, 0x2E, 0x1A, 0x45, 0x30, 0xC3, 0x43, 0x65, 0xCE, 0x01,
+	0x76, 0x1F, 0x01, 0x7B, 0x63, 0x30, 0x20, 0x29, 0x11, 0xB2, 0xB0, 0x11,
+	0x76, 0x57, 0x11, 0x79, 0x4C, 0x41, 0x32, 0x7B, 0x35, 0x90, 0xC3, 0x34,
+	0xDF, 0xF3, 0x14, 0xFD, 0x78, 0x31, 0xBA, 0x00, 0x15, 0xF5, 0x79, 0x45,
+	0xA6, 0x4A, 0x11, 0x0D, 0xC9, 0x53, 0x2F, 0x6D, 0x20, 0x30, 0x73, 0x55,
+	0x34, 0x79, 0x50, 0x67, 0x85, 0x35, 0xC5, 0x62, 0x30, 0x72, 0x74, 0x50,
+	0x74, 0x71, 0x55, 0x75, 0x62, 0x51, 0x7A, 0x70, 0x55, 0x28, 0x25, 0x00,
+	0x27, 0x66, 0x10, 0x77, 0x5F, 0x01, 0x20, 0x6B, 0x00, 0x5F, 0x07, 0x41,
+	0x62, 0x6D, 0x40, 0x79, 0xCE, 0x01, 0x78, 0x29, 0x20, 0x77, 0x44, 0x20,
+	0x66, 0x20, 0x40, 0x7C, 0x07, 0x31, 0xD0, 0xDF, 0x13, 0x63, 0x48, 0x41,
+	0x28, 0xCE, 0x11, 0x75, 0x6C, 0x04, 0x74, 0x6D, 0x14, 0x70, 0x65, 0x14,
+	0x15, 0x6F, 0x24, 0x6B, 0x13, 0x42, 0x63, 0x79, 0x02, 0x67, 0x81, 0x43,
+	0x62, 0x7B, 0x03, 0x61, 0x83, 0x13, 0x69, 0x20, 0x41, 0x73, 0x12, 0x01,
+	0x65, 0x6C, 0x00, 0xE5, 0xAF, 0x31, 0xD4, 0xCF, 0x11, 0xE6, 0x7A, 0x34,
+	0x77, 0x48, 0x20, 0x3F, 0x53, 0x11, 0x77, 0x54, 0x20, 0xDC, 0x20, 0x30,
+	0xB5, 0x31, 0x10, 0x63, 0x8A, 0x13, 0x2C, 0x42, 0x31, 0xB3, 0x28, 0x11,
+	0x64, 0x74, 0x10, 0x86, 0x89, 0x33, 0x51, 0x73, 0x10, 0xD1, 0x76, 0x12,
+	0xB6, 0x87, 0x14, 0x82, 0x85, 0x44, 0x19, 0x88, 0x24, 0xED, 0x8A, 0x34,
+	0x89, 0x8B, 0x44, 0x74, 0x34, 0x01, 0x62, 0x75, 0x04, 0x69, 0x8C, 0x03,
+	0x66, 0x73, 0x01, 0x9B, 0x90, 0x14, 0x6C, 0x1E, 0x01, 0xD7, 0x62, 0x10,
+	0x31, 0x92, 0x34, 0xF0, 0x82, 0x33, 0x68, 0xDB, 0x01, 0x77, 0x4C, 0x20,
+	0xB6, 0x96, 0x14, 0x9F, 0x91, 0x14, 0xF1, 0xD5, 0x31, 0x67, 0x1D, 0x42,
+	0xDC, 0x94, 0x14, 0x8D, 0x76, 0x42, 0x7A, 0x16, 0x22, 0x86, 0x8E, 0x33,
+	0x32, 0x9F, 0x34, 0x30, 0x64, 0x04, 0x77, 0x6E, 0x00, 0x00, 0x35, 0x13,
+	0xD0, 0x27, 0x11, 0x63, 0x93, 0x44, 0x7A, 0x75, 0x24, 0xF3, 0x8F, 0x33,
+	0xA5, 0xA6, 0x44, 0x74, 0x75, 0x11, 0x18, 0xB5, 0x11, 0x13, 0xB5, 0x11,
+	0x19, 0xB5, 0x11, 0x73, 0x9D, 0x01, 0x51, 0x28, 0x11, 0xB7, 0x8C, 0x14,
+	0x2E, 0x36, 0x33, 0x6B, 0x37, 0x03, 0x73, 0x83, 0x04, 0x75, 0x7E, 0x12,
+	0x6B, 0xF4, 0x43, 0x29, 0xA4, 0x34, 0xEF, 0x20, 0x32, 0x4B, 0xB2, 0x14,
+	0x80, 0x84, 0x22, 0xB3, 0xB1, 0x44, 0xB5, 0xB6, 0x44, 0x66, 0x33, 0x03,
+	0x52, 0xBB, 0x14, 0x62, 0x9C, 0x11, 0xF7, 0xBD, 0x34, 0x63, 0x24, 0x01,
+	0x09, 0xD8, 0x11, 0x7F, 0x5F, 0x21, 0x7D, 0x13, 0x22, 0x40, 0x9C, 0x31,
+	0x62, 0xB1, 0x01, 0x6B, 0xB2, 0x01, 0x6F, 0xA2, 0x04, 0x07, 0x9C, 0x11,
+	0x1E, 0xC7, 0x14, 0x4A, 0xC6, 0x14, 0x28, 0xBA, 0x34, 0xC4, 0xC5, 0x44,
+	0xC9, 0x20, 0x40, 0xCA, 0xC8, 0x44, 0x73, 0xFC, 0x03, 0xDC, 0x29, 0x31,
+	0x83, 0xFB, 0x43, 0xCF, 0xD0, 0x44, 0x47, 0x62, 0x10, 0x9B, 0x08, 0x11,
+	0x80, 0x8D, 0x33, 0x7E, 0xFE, 0x43, 0xD4, 0xD2, 0x44, 0x6E, 0x70, 0x01,
+	0xB1, 0x1E, 0x12, 0xAF, 0xA0, 0x41, 0xD7, 0xD8, 0x44, 0x6A, 0x24, 0x03,
+	0x6F, 0x34, 0x03, 0x73, 0xB3, 0x01, 0x48, 0x44, 0x13, 0xD5, 0x86, 0x12,
+	0x27, 0x62, 0x31, 0x72, 0x79, 0x02, 0x75, 0xFA, 0x03, 0xB2, 0xE7, 0x13,
+	0x27, 0xE0, 0x31, 0xE3, 0x08, 0x41, 0x30, 0x2A, 0x03, 0x16, 0x09, 0x21,
+	0x7C, 0x23, 0x22, 0x34, 0xD3, 0x34, 0xE8, 0xF6, 0x43, 0x75, 0x62, 0x00,
+	0x24, 0x73, 0x10, 0x71, 0x66, 0x44, 0x2A, 0xEE, 0x33, 0x7D, 0xEE, 0x44,
+	0xF8, 0x3E, 0x31, 0x67, 0x6E, 0x00, 0x74, 0x7C, 0x02, 0x17, 0x8C, 0x22,
+	0x7B, 0x27, 0x11, 0x65, 0x03, 0x14, 0xDD, 0x9D, 0x43, 0x4D, 0x57, 0x31,
+	0x62, 0x9B, 0x01, 0x77, 0x70, 0x01, 0x3F, 0x07, 0x14, 0xD7, 0x76, 0x10,
+	0x9E, 0xEA, 0x33, 0x9F, 0xD1, 0x31, 0xA0, 0xEA, 0x33, 0x70, 0x8C, 0x14,
+	0x34, 0xD3, 0x11, 0x24, 0x51, 0x13, 0x42, 0xFF, 0x34, 0x61, 0x6D, 0x00,
+	0x34, 0x98, 0x13, 0x38, 0x92, 0x33, 0xE8, 0x0A, 0x14, 0x28, 0x79, 0x00,
+	0x2F, 0x69, 0x00, 0x62, 0xE1, 0x04, 0x72, 0x07, 0x05, 0x77, 0x56, 0x20,
+	0x73, 0x7D, 0x11, 0xD7, 0x67, 0x10, 0x7F, 0x0C, 0x25, 0xCE, 0x20, 0x40,
+	0x90, 0x42, 0x21, 0xA7, 0x1E, 0x31, 0x08, 0x27, 0x52, 0x63, 0x2E, 0x03,
+	0x64, 0x27, 0x01, 0x6C, 0xAF, 0x01, 0x77, 0x97, 0x03, 0x28, 0x14, 0x35,
+	0x90, 0xB7, 0x31, 0x66, 0x13, 0x15, 0xAA, 0x9C, 0x31, 0x50, 0x61, 0x00,
+	0x77, 0x76, 0x01, 0x77, 0x1B, 0x25, 0x34, 0x67, 0x10, 0xD1, 0xE9, 0x11,
+	0x0C, 0xAB, 0x13, 0xDF, 0x27, 0x11, 0x89, 0x9C, 0x21, 0xA5, 0x6E, 0x10,
+	0x4D, 0x43, 0x00, 0x63, 0xE5, 0x01, 0x76, 0x09, 0x01, 0x5F, 0x00, 0x15,
+	0x81, 0x12, 0x31, 0x45, 0x76, 0x11, 0xA5, 0x07, 0x31, 0x02, 0xA0, 0x51,
+	0xB0, 0x27, 0x33, 0x17, 0x18, 0x44, 0x27, 0x15, 0x54, 0x25, 0xA8, 0x03,
+	0x70, 0x12, 0x01, 0x47, 0xEF, 0x13, 0x70, 0xB9, 0x11, 0x61, 0x31, 0x15,
+	0x64, 0x1C, 0x14, 0x55, 0x83, 0x12, 0xA0, 0x3C, 0x40, 0xD6, 0xB8, 0x41,
+	0x59, 0xB6, 0x33, 0x32, 0x35, 0x55, 0x63, 0x7A, 0x02, 0x65, 0xB8, 0x03,
+	0x66, 0x80, 0x01, 0x69, 0x21, 0x01, 0x70, 0xEB, 0x04, 0x00, 0xB9, 0x13,
+	0x34, 0x17, 0x12, 0x51, 0xBD, 0x11, 0x25, 0x63, 0x11, 0x7B, 0x20, 0x14,
+	0x56, 0x12, 0x11, 0x7F, 0x51, 0x11, 0x7F, 0x0D, 0x15, 0xF8, 0x3D, 0x45,
+	0x3A, 0xEC, 0x54, 0x41, 0x47, 0x55, 0x28, 0x16, 0x02, 0x2C, 0xBA, 0x04,
+	0x2F, 0x68, 0x00, 0x52, 0x54, 0x03, 0x61, 0xDD, 0x03, 0x65, 0xBA, 0x03,
+	0x68, 0x21, 0x02, 0x6C, 0x8E, 0x02, 0x6E, 0xD2, 0x01, 0x6E, 0x92, 0x03,
+	0x21, 0x78, 0x11, 0xC1, 0x2A, 0x41, 0x68, 0xE1, 0x14, 0x23, 0x55, 0x55,
+	0x5D, 0x20, 0x30, 0x60, 0x4B, 0x35, 0x2C, 0x8B, 0x03, 0x6C, 0x24, 0x01,
+	0x6D, 0x22, 0x02, 0x6F, 0x6B, 0x00, 0x70, 0x79, 0x02, 0x74, 0x24, 0x03,
+	0x47, 0x70, 0x10, 0x2F, 0xC1, 0x13, 0x42, 0x96, 0x12, 0x24, 0x6D, 0x10,
+	0x24, 0x26, 0x12, 0x62, 0x63, 0x13, 0x25, 0x31, 0x14, 0x1B, 0xF8, 0x23,
+	0x16, 0x67, 0x45, 0x21, 0x5B, 0x55, 0x2C, 0x52, 0x51, 0x33, 0x1A, 0x45,
+	0x2D, 0xD8, 0x01, 0x61, 0xCA, 0x03, 0x64, 0xB2, 0x01, 0x6D, 0xA1, 0x03,
+	0x6E, 0x3A, 0x04, 0x70, 0x68, 0x00, 0x70, 0x70, 0x01, 0x73, 0x2F, 0x01,
+	0xB0, 0x3B, 0x14, 0x48, 0xA4, 0x14, 0x52, 0x3D, 0x14, 0x77, 0xCD, 0x13,
+	0x1F, 0x94, 0x12, 0x63, 0x7D, 0x11, 0xB8, 0x78, 0x15, 0x85, 0x22, 0x45,
+	0x1A, 0xB5, 0x23, 0x38, 0xFB, 0x34, 0xB8, 0x6C, 0x45, 0xBF, 0x6D, 0x45,
+	0x67, 0x8B, 0x12, 0x67, 0x37, 0x15, 0x10, 0x77, 0x55, 0xC0, 0x30, 0x12,
+	0xF0, 0x82, 0x15, 0x31, 0x1F, 0x21, 0x26, 0xCC, 0x53, 0xCB, 0x42, 0x34,
+	0x80, 0x84, 0x55, 0x28, 0xD8, 0x01, 0x29, 0x20, 0x00, 0x29, 0x33, 0x02,
+	0x2D, 0x68, 0x00, 0x30, 0xE6, 0x04, 0x64, 0x86, 0x02, 0x64, 0xCE, 0x04,
+	0x69, 0x72, 0x00, 0x6C, 0x52, 0x01, 0x6E, 0xCF, 0x01, 0x70, 0xE6, 0x01,
+	0x73, 0x91, 0x04, 0x73, 0xA1, 0x03, 0x74, 0x3B, 0x01, 0x75, 0xD0, 0x03,
+	0x08, 0x91, 0x15, 0x28, 0x88, 0x12, 0x28, 0x5E, 0x14, 0xB1, 0x7B, 0x12,
+	0x00, 0x5A, 0x13, 0x72, 0x79, 0x10, 0x60, 0xA8, 0x13, 0x48, 0x6B, 0x13,
+	0x63, 0x56, 0x41, 0x63, 0x57, 0x44, 0x76, 0x48, 0x14, 0xD4, 0x7B, 0x12,
+	0x77, 0x38, 0x13, 0x4A, 0x69, 0x14, 0x27, 0x94, 0x32, 0x27, 0x45, 0x35,
+	0xD7, 0x5A, 0x14, 0x8B, 0x4F, 0x34, 0x7B, 0xE0, 0x11, 0x7B, 0x15, 0x15,
+	0x7B, 0x1C, 0x15, 0x1A, 0x37, 0x25, 0xDC, 0xA3, 0x15, 0x11, 0x59, 0x14,
+	0x41, 0x03, 0x35, 0x3C, 0xBE, 0x11, 0x58, 0xB5, 0x13, 0xD3, 0x20, 0x41,
+	0x24, 0x4B, 0x24, 0x47, 0xF4, 0x34, 0x68, 0xDA, 0x13, 0x01, 0x21, 0x41,
+	0x69, 0x90, 0x15, 0xEB, 0x5B, 0x14, 0x23, 0x95, 0x55, 0x9A, 0xAC, 0x25,
+	0x9F, 0xA6, 0x25, 0x71, 0x52, 0x34, 0x79, 0xB9, 0x35, 0xD5, 0xB2, 0x35,
+	0xD7, 0x72, 0x30, 0x4A, 0xB4, 0x45, 0x56, 0x93, 0x45, 0x8B, 0x43, 0x55,
+	0x9C, 0x9E, 0x55, 0xA2, 0x79, 0x52, 0xAB, 0xAE, 0x55, 0xBF, 0xC2, 0x55,
+};
+#else
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+const char ISO14819_2_EventStrings[] PROGMEM =
+	"\x0F" "traffic problem\0"
+	"\x46" "queuing traffic (with average speeds %s). Danger of stationary traffic\0"
+	"\x23" "overheight warning system triggered\0"
+	"\x3D" "(%s) accident(s), traffic being directed around accident area\0"
+	"\x2C" "closed, rescue and recovery work in progress\0"
+	"\x37" "service area overcrowded, drive to another service area\0"
+	"\x21" "service area, fuel station closed\0"
+	"\x1F" "service area, restaurant closed\0"
+	"\x0D" "bridge closed\0"
+	"\x0D" "tunnel closed\0"
+	"\x0E" "bridge blocked\0"
+	"\x0E" "tunnel blocked\0"
+	"\x1A" "road closed intermittently\0"
+	"\x15" "fuel station reopened\0"
+	"\x13" "restaurant reopened\0"
+	"\x21" "reopening of bridge expected (%s)\0"
+	"\x10" "smog alert ended\0"
+	"\x1E" "(%s) overtaking lane(s) closed\0"
+	"\x1F" "(%s) overtaking lane(s) blocked\0"
+	"\x29" "roadworks, (%s) overtaking lane(s) closed\0"
+	"\x2B" "(%s sets of) roadworks on the hard shoulder\0"
+	"\x2C" "(%s sets of) roadworks in the emergency lane\0"
+	"\x18" "traffic problem expected\0"
+	"\x1B" "traffic congestion expected\0"
+	"\x17" "normal traffic expected\0"
+	"\x19" "(%s) object(s) on roadway\0"
+	"\x12" "(%s) burst pipe(s)\0"
+	"\x22" "(%s) object(s) on the road. Danger\0"
+	"\x12" "burst pipe. Danger\0"
+	"\x2C" "traffic congestion, average speed of 10 km/h\0"
+	"\x2C" "traffic congestion, average speed of 20 km/h\0"
+	"\x2C" "traffic congestion, average speed of 30 km/h\0"
+	"\x2C" "traffic congestion, average speed of 40 km/h\0"
+	"\x2C" "traffic congestion, average speed of 50 km/h\0"
+	"\x2C" "traffic congestion, average speed of 60 km/h\0"
+	"\x2C" "traffic congestion, average speed of 70 km/h\0"
+	"\x20" "heavy traffic has to be expected\0"
+	"\x25" "traffic congestion has to be expected\0"
+	"\x38" "(%s sets of) roadworks. Heavy traffic has to be expected\0"
+	"\x24" "closed ahead. Heavy traffic expected\0"
+	"\x2D" "major event. Heavy traffic has to be expected\0"
+	"\x30" "sports meeting. Heavy traffic has to be expected\0"
+	"\x26" "fair. Heavy traffic has to be expected\0"
+	"\x2C" "evacuation. Heavy traffic has to be expected\0"
+	"\x25" "traffic congestion forecast withdrawn\0"
+	"\x11" "message cancelled\0"
+	"\x14" "delays (%s) for cars\0"
+	"\x12" "stationary traffic\0"
+	"\x1B" "stationary traffic for 1 km\0"
+	"\x1B" "stationary traffic for 2 km\0"
+	"\x1B" "stationary traffic for 4 km\0"
+	"\x1B" "stationary traffic for 6 km\0"
+	"\x1C" "stationary traffic for 10 km\0"
+	"\x1B" "stationary traffic expected\0"
+	"\x28" "queuing traffic (with average speeds %s)\0"
+	"\x31" "queuing traffic for 1 km (with average speeds %s)\0"
+	"\x31" "queuing traffic for 2 km (with average speeds %s)\0"
+	"\x31" "queuing traffic for 4 km (with average speeds %s)\0"
+	"\x31" "queuing traffic for 6 km (with average speeds %s)\0"
+	"\x32" "queuing traffic for 10 km (with average speeds %s)\0"
+	"\x18" "queuing traffic expected\0"
+	"\x25" "slow traffic (with average speeds %s)\0"
+	"\x2E" "slow traffic for 1 km (with average speeds %s)\0"
+	"\x2E" "slow traffic for 2 km (with average speeds %s)\0"
+	"\x2E" "slow traffic for 4 km (with average speeds %s)\0"
+	"\x2E" "slow traffic for 6 km (with average speeds %s)\0"
+	"\x2F" "slow traffic for 10 km (with average speeds %s)\0"
+	"\x15" "slow traffic expected\0"
+	"\x26" "heavy traffic (with average speeds %s)\0"
+	"\x16" "heavy traffic expected\0"
+	"\x2F" "traffic flowing freely (with average speeds %s)\0"
+	"\x2C" "traffic building up (with average speeds %s)\0"
+	"\x15" "no problems to report\0"
+	"\x1A" "traffic congestion cleared\0"
+	"\x11" "message cancelled\0"
+	"\x1B" "stationary traffic for 3 km\0"
+	"\x1C" "danger of stationary traffic\0"
+	"\x31" "queuing traffic for 3 km (with average speeds %s)\0"
+	"\x32" "danger of queuing traffic (with average speeds %s)\0"
+	"\x24" "long queues (with average speeds %s)\0"
+	"\x2E" "slow traffic for 3 km (with average speeds %s)\0"
+	"\x0E" "traffic easing\0"
+	"\x2B" "traffic congestion (with average speeds %s)\0"
+	"\x34" "traffic lighter than normal (with average speeds %s)\0"
+	"\x3C" "queuing traffic (with average speeds %s). Approach with care\0"
+	"\x29" "queuing traffic around a bend in the road\0"
+	"\x28" "queuing traffic over the crest of a hill\0"
+	"\x2C" "all accidents cleared, no problems to report\0"
+	"\x34" "traffic heavier than normal (with average speeds %s)\0"
+	"\x3E" "traffic very much heavier than normal (with average speeds %s)\0"
+	"\x22" "multi vehicle pile up. Delays (%s)\0"
+	"\x10" "(%s) accident(s)\0"
+	"\x18" "(%s) serious accident(s)\0"
+	"\x2E" "multi-vehicle accident (involving %s vehicles)\0"
+	"\x2B" "accident involving (a/%s) heavy lorr(y/ies)\0"
+	"\x2E" "(%s) accident(s) involving hazardous materials\0"
+	"\x1E" "(%s) fuel spillage accident(s)\0"
+	"\x22" "(%s) chemical spillage accident(s)\0"
+	"\x2C" "vehicles slowing to look at (%s) accident(s)\0"
+	"\x26" "(%s) accident(s) in the opposing lanes\0"
+	"\x11" "(%s) shed load(s)\0"
+	"\x1B" "(%s) broken down vehicle(s)\0"
+	"\x22" "(%s) broken down heavy lorr(y/ies)\0"
+	"\x14" "(%s) vehicle fire(s)\0"
+	"\x10" "(%s) incident(s)\0"
+	"\x24" "(%s) accident(s). Stationary traffic\0"
+	"\x2D" "(%s) accident(s). Stationary traffic for 1 km\0"
+	"\x2D" "(%s) accident(s). Stationary traffic for 2 km\0"
+	"\x2D" "(%s) accident(s). Stationary traffic for 4 km\0"
+	"\x2D" "(%s) accident(s). Stationary traffic for 6 km\0"
+	"\x2E" "(%s) accident(s). Stationary traffic for 10 km\0"
+	"\x2E" "(%s) accident(s). Danger of stationary traffic\0"
+	"\x21" "(%s) accident(s). Queuing traffic\0"
+	"\x2A" "(%s) accident(s). Queuing traffic for 1 km\0"
+	"\x2A" "(%s) accident(s). Queuing traffic for 2 km\0"
+	"\x2A" "(%s) accident(s). Queuing traffic for 4 km\0"
+	"\x2A" "(%s) accident(s). Queuing traffic for 6 km\0"
+	"\x2B" "(%s) accident(s). Queuing traffic for 10 km\0"
+	"\x2B" "(%s) accident(s). Danger of queuing traffic\0"
+	"\x1E" "(%s) accident(s). Slow traffic\0"
+	"\x27" "(%s) accident(s). Slow traffic for 1 km\0"
+	"\x27" "(%s) accident(s). Slow traffic for 2 km\0"
+	"\x27" "(%s) accident(s). Slow traffic for 4 km\0"
+	"\x27" "(%s) accident(s). Slow traffic for 6 km\0"
+	"\x28" "(%s) accident(s). Slow traffic for 10 km\0"
+	"\x27" "(%s) accident(s). Slow traffic expected\0"
+	"\x1F" "(%s) accident(s). Heavy traffic\0"
+	"\x28" "(%s) accident(s). Heavy traffic expected\0"
+	"\x28" "(%s) accident(s). Traffic flowing freely\0"
+	"\x25" "(%s) accident(s). Traffic building up\0"
+	"\x23" "road closed due to (%s) accident(s)\0"
+	"\x24" "(%s) accident(s). Right lane blocked\0"
+	"\x25" "(%s) accident(s). Centre lane blocked\0"
+	"\x23" "(%s) accident(s). Left lane blocked\0"
+	"\x27" "(%s) accident(s). Hard shoulder blocked\0"
+	"\x23" "(%s) accident(s). Two lanes blocked\0"
+	"\x25" "(%s) accident(s). Three lanes blocked\0"
+	"\x15" "accident. Delays (%s)\0"
+	"\x1E" "accident. Delays (%s) expected\0"
+	"\x1A" "accident. Long delays (%s)\0"
+	"\x40" "vehicles slowing to look at (%s) accident(s). Stationary traffic\0"
+	"\x49" "vehicles slowing to look at (%s) accident(s). Stationary traffic for 1 km\0"
+	"\x49" "vehicles slowing to look at (%s) accident(s). Stationary traffic for 2 km\0"
+	"\x49" "vehicles slowing to look at (%s) accident(s). Stationary traffic for 4 km\0"
+	"\x49" "vehicles slowing to look at (%s) accident(s). Stationary traffic for 6 km\0"
+	"\x4A" "vehicles slowing to look at (%s) accident(s). Stationary traffic for 10 km\0"
+	"\x4A" "vehicles slowing to look at (%s) accident(s). Danger of stationary traffic\0"
+	"\x3D" "vehicles slowing to look at (%s) accident(s). Queuing traffic\0"
+	"\x46" "vehicles slowing to look at (%s) accident(s). Queuing traffic for 1 km\0"
+	"\x46" "vehicles slowing to look at (%s) accident(s). Queuing traffic for 2 km\0"
+	"\x46" "vehicles slowing to look at (%s) accident(s). Queuing traffic for 4 km\0"
+	"\x46" "vehicles slowing to look at (%s) accident(s). Queuing traffic for 6 km\0"
+	"\x47" "vehicles slowing to look at (%s) accident(s). Queuing traffic for 10 km\0"
+	"\x47" "vehicles slowing to look at (%s) accident(s). Danger of queuing traffic\0"
+	"\x3A" "vehicles slowing to look at (%s) accident(s). Slow traffic\0"
+	"\x43" "vehicles slowing to look at (%s) accident(s). Slow traffic for 1 km\0"
+	"\x43" "vehicles slowing to look at (%s) accident(s). Slow traffic for 2 km\0"
+	"\x43" "vehicles slowing to look at (%s) accident(s). Slow traffic for 4 km\0"
+	"\x43" "vehicles slowing to look at (%s) accident(s). Slow traffic for 6 km\0"
+	"\x44" "vehicles slowing to look at (%s) accident(s). Slow traffic for 10 km\0"
+	"\x43" "vehicles slowing to look at (%s) accident(s). Slow traffic expected\0"
+	"\x3B" "vehicles slowing to look at (%s) accident(s). Heavy traffic\0"
+	"\x44" "vehicles slowing to look at (%s) accident(s). Heavy traffic expected\0"
+	"\x41" "vehicles slowing to look at (%s) accident(s). Traffic building up\0"
+	"\x31" "vehicles slowing to look at accident. Delays (%s)\0"
+	"\x3A" "vehicles slowing to look at accident. Delays (%s) expected\0"
+	"\x36" "vehicles slowing to look at accident. Long delays (%s)\0"
+	"\x25" "(%s) shed load(s). Stationary traffic\0"
+	"\x2E" "(%s) shed load(s). Stationary traffic for 1 km\0"
+	"\x2E" "(%s) shed load(s). Stationary traffic for 2 km\0"
+	"\x2E" "(%s) shed load(s). Stationary traffic for 4 km\0"
+	"\x2E" "(%s) shed load(s). Stationary traffic for 6 km\0"
+	"\x2F" "(%s) shed load(s). Stationary traffic for 10 km\0"
+	"\x2F" "(%s) shed load(s). Danger of stationary traffic\0"
+	"\x22" "(%s) shed load(s). Queuing traffic\0"
+	"\x2B" "(%s) shed load(s). Queuing traffic for 1 km\0"
+	"\x2B" "(%s) shed load(s). Queuing traffic for 2 km\0"
+	"\x2B" "(%s) shed load(s). Queuing traffic for 4 km\0"
+	"\x2B" "(%s) shed load(s). Queuing traffic for 6 km\0"
+	"\x2C" "(%s) shed load(s). Queuing traffic for 10 km\0"
+	"\x2C" "(%s) shed load(s). Danger of queuing traffic\0"
+	"\x1F" "(%s) shed load(s). Slow traffic\0"
+	"\x28" "(%s) shed load(s). Slow traffic for 1 km\0"
+	"\x28" "(%s) shed load(s). Slow traffic for 2 km\0"
+	"\x28" "(%s) shed load(s). Slow traffic for 4 km\0"
+	"\x28" "(%s) shed load(s). Slow traffic for 6 km\0"
+	"\x29" "(%s) shed load(s). Slow traffic for 10 km\0"
+	"\x28" "(%s) shed load(s). Slow traffic expected\0"
+	"\x20" "(%s) shed load(s). Heavy traffic\0"
+	"\x29" "(%s) shed load(s). Heavy traffic expected\0"
+	"\x29" "(%s) shed load(s). Traffic flowing freely\0"
+	"\x26" "(%s) shed load(s). Traffic building up\0"
+	"\x1C" "blocked by (%s) shed load(s)\0"
+	"\x25" "(%s) shed load(s). Right lane blocked\0"
+	"\x26" "(%s) shed load(s). Centre lane blocked\0"
+	"\x24" "(%s) shed load(s). Left lane blocked\0"
+	"\x28" "(%s) shed load(s). Hard shoulder blocked\0"
+	"\x24" "(%s) shed load(s). Two lanes blocked\0"
+	"\x26" "(%s) shed load(s). Three lanes blocked\0"
+	"\x16" "shed load. Delays (%s)\0"
+	"\x1F" "shed load. Delays (%s) expected\0"
+	"\x1B" "shed load. Long delays (%s)\0"
+	"\x2F" "(%s) broken down vehicle(s). Stationary traffic\0"
+	"\x39" "(%s) broken down vehicle(s). Danger of stationary traffic\0"
+	"\x2C" "(%s) broken down vehicle(s). Queuing traffic\0"
+	"\x36" "(%s) broken down vehicle(s). Danger of queuing traffic\0"
+	"\x29" "(%s) broken down vehicle(s). Slow traffic\0"
+	"\x32" "(%s) broken down vehicle(s). Slow traffic expected\0"
+	"\x2A" "(%s) broken down vehicle(s). Heavy traffic\0"
+	"\x33" "(%s) broken down vehicle(s). Heavy traffic expected\0"
+	"\x33" "(%s) broken down vehicle(s). Traffic flowing freely\0"
+	"\x2F" "(%s) broken down vehicle(s).Traffic building up\0"
+	"\x27" "blocked by (%s) broken down vehicle(s).\0"
+	"\x2F" "(%s) broken down vehicle(s). Right lane blocked\0"
+	"\x30" "(%s) broken down vehicle(s). Centre lane blocked\0"
+	"\x2E" "(%s) broken down vehicle(s). Left lane blocked\0"
+	"\x32" "(%s) broken down vehicle(s). Hard shoulder blocked\0"
+	"\x2E" "(%s) broken down vehicle(s). Two lanes blocked\0"
+	"\x30" "(%s) broken down vehicle(s). Three lanes blocked\0"
+	"\x20" "broken down vehicle. Delays (%s)\0"
+	"\x29" "broken down vehicle. Delays (%s) expected\0"
+	"\x25" "broken down vehicle. Long delays (%s)\0"
+	"\x10" "accident cleared\0"
+	"\x11" "message cancelled\0"
+	"\x21" "accident involving (a/%s) bus(es)\0"
+	"\x1D" "(%s) oil spillage accident(s)\0"
+	"\x1A" "(%s) overturned vehicle(s)\0"
+	"\x21" "(%s) overturned heavy lorr(y/ies)\0"
+	"\x1A" "(%s) jackknifed trailer(s)\0"
+	"\x1A" "(%s) jackknifed caravan(s)\0"
+	"\x27" "(%s) jackknifed articulated lorr(y/ies)\0"
+	"\x1B" "(%s) vehicle(s) spun around\0"
+	"\x18" "(%s) earlier accident(s)\0"
+	"\x1B" "accident investigation work\0"
+	"\x1A" "(%s) secondary accident(s)\0"
+	"\x18" "(%s) broken down bus(es)\0"
+	"\x1A" "(%s) overheight vehicle(s)\0"
+	"\x2D" "(%s) accident(s). Stationary traffic for 3 km\0"
+	"\x2A" "(%s) accident(s). Queuing traffic for 3 km\0"
+	"\x27" "(%s) accident(s). Slow traffic for 3 km\0"
+	"\x22" "(%s) accident(s) in roadworks area\0"
+	"\x49" "vehicles slowing to look at (%s) accident(s). Stationary traffic for 3 km\0"
+	"\x46" "vehicles slowing to look at (%s) accident(s). Queuing traffic for 3 km\0"
+	"\x43" "vehicles slowing to look at (%s) accident(s). Slow traffic for 3 km\0"
+	"\x34" "vehicles slowing to look at (%s) accident(s). Danger\0"
+	"\x2E" "(%s) shed load(s). Stationary traffic for 3 km\0"
+	"\x2B" "(%s) shed load(s). Queuing traffic for 3 km\0"
+	"\x28" "(%s) shed load(s). Slow traffic for 3 km\0"
+	"\x19" "(%s) shed load(s). Danger\0"
+	"\x2E" "(%s) overturned vehicle(s). Stationary traffic\0"
+	"\x38" "(%s) overturned vehicle(s). Danger of stationary traffic\0"
+	"\x2B" "(%s) overturned vehicle(s). Queuing traffic\0"
+	"\x35" "(%s) overturned vehicle(s). Danger of queuing traffic\0"
+	"\x28" "(%s) overturned vehicle(s). Slow traffic\0"
+	"\x31" "(%s) overturned vehicle(s). Slow traffic expected\0"
+	"\x29" "(%s) overturned vehicle(s). Heavy traffic\0"
+	"\x32" "(%s) overturned vehicle(s). Heavy traffic expected\0"
+	"\x2F" "(%s) overturned vehicle(s). Traffic building up\0"
+	"\x25" "blocked by (%s) overturned vehicle(s)\0"
+	"\x2E" "(%s) overturned vehicle(s). Right lane blocked\0"
+	"\x2F" "(%s) overturned vehicle(s). Centre lane blocked\0"
+	"\x2D" "(%s) overturned vehicle(s). Left lane blocked\0"
+	"\x2D" "(%s) overturned vehicle(s). Two lanes blocked\0"
+	"\x2F" "(%s) overturned vehicle(s). Three lanes blocked\0"
+	"\x1F" "overturned vehicle. Delays (%s)\0"
+	"\x28" "overturned vehicle. Delays (%s) expected\0"
+	"\x24" "overturned vehicle. Long delays (%s)\0"
+	"\x22" "(%s) overturned vehicle(s). Danger\0"
+	"\x32" "Stationary traffic due to (%s) earlier accident(s)\0"
+	"\x3C" "Danger of stationary traffic due to (%s) earlier accident(s)\0"
+	"\x2F" "Queuing traffic due to (%s) earlier accident(s)\0"
+	"\x39" "Danger of queuing traffic due to (%s) earlier accident(s)\0"
+	"\x2C" "Slow traffic due to (%s) earlier accident(s)\0"
+	"\x2D" "Heavy traffic due to (%s) earlier accident(s)\0"
+	"\x33" "Traffic building up due to (%s) earlier accident(s)\0"
+	"\x23" "Delays (%s) due to earlier accident\0"
+	"\x28" "Long delays (%s) due to earlier accident\0"
+	"\x23" "accident investigation work. Danger\0"
+	"\x22" "(%s) secondary accident(s). Danger\0"
+	"\x23" "(%s) broken down vehicle(s). Danger\0"
+	"\x2A" "(%s) broken down heavy lorr(y/ies). Danger\0"
+	"\x0C" "road cleared\0"
+	"\x10" "incident cleared\0"
+	"\x24" "rescue and recovery work in progress\0"
+	"\x11" "message cancelled\0"
+	"\x06" "closed\0"
+	"\x07" "blocked\0"
+	"\x23" "closed for heavy vehicles (over %s)\0"
+	"\x2E" "no through traffic for heavy lorries (over %s)\0"
+	"\x12" "no through traffic\0"
+	"\x1E" "(%s th) entry slip road closed\0"
+	"\x1D" "(%s th) exit slip road closed\0"
+	"\x11" "slip roads closed\0"
+	"\x16" "slip road restrictions\0"
+	"\x20" "closed ahead. Stationary traffic\0"
+	"\x29" "closed ahead. Stationary traffic for 1 km\0"
+	"\x29" "closed ahead. Stationary traffic for 2 km\0"
+	"\x29" "closed ahead. Stationary traffic for 4 km\0"
+	"\x29" "closed ahead. Stationary traffic for 6 km\0"
+	"\x2A" "closed ahead. Stationary traffic for 10 km\0"
+	"\x2A" "closed ahead. Danger of stationary traffic\0"
+	"\x1D" "closed ahead. Queuing traffic\0"
+	"\x26" "closed ahead. Queuing traffic for 1 km\0"
+	"\x26" "closed ahead. Queuing traffic for 2 km\0"
+	"\x26" "closed ahead. Queuing traffic for 4 km\0"
+	"\x26" "closed ahead. Queuing traffic for 6 km\0"
+	"\x27" "closed ahead. Queuing traffic for 10 km\0"
+	"\x27" "closed ahead. Danger of queuing traffic\0"
+	"\x1A" "closed ahead. Slow traffic\0"
+	"\x23" "closed ahead. Slow traffic for 1 km\0"
+	"\x23" "closed ahead. Slow traffic for 2 km\0"
+	"\x23" "closed ahead. Slow traffic for 4 km\0"
+	"\x23" "closed ahead. Slow traffic for 6 km\0"
+	"\x24" "closed ahead. Slow traffic for 10 km\0"
+	"\x23" "closed ahead. Slow traffic expected\0"
+	"\x1B" "closed ahead. Heavy traffic\0"
+	"\x24" "closed ahead. Heavy traffic expected\0"
+	"\x24" "closed ahead. Traffic flowing freely\0"
+	"\x21" "closed ahead. Traffic building up\0"
+	"\x19" "closed ahead. Delays (%s)\0"
+	"\x22" "closed ahead. Delays (%s) expected\0"
+	"\x1E" "closed ahead. Long delays (%s)\0"
+	"\x21" "blocked ahead. Stationary traffic\0"
+	"\x2A" "blocked ahead. Stationary traffic for 1 km\0"
+	"\x2A" "blocked ahead. Stationary traffic for 2 km\0"
+	"\x2A" "blocked ahead. Stationary traffic for 4 km\0"
+	"\x2A" "blocked ahead. Stationary traffic for 6 km\0"
+	"\x2B" "blocked ahead. Stationary traffic for 10 km\0"
+	"\x2B" "blocked ahead. Danger of stationary traffic\0"
+	"\x1E" "blocked ahead. Queuing traffic\0"
+	"\x27" "blocked ahead. Queuing traffic for 1 km\0"
+	"\x27" "blocked ahead. Queuing traffic for 2 km\0"
+	"\x27" "blocked ahead. Queuing traffic for 4 km\0"
+	"\x27" "blocked ahead. Queuing traffic for 6 km\0"
+	"\x28" "blocked ahead. Queuing traffic for 10 km\0"
+	"\x28" "blocked ahead. Danger of queuing traffic\0"
+	"\x1B" "blocked ahead. Slow traffic\0"
+	"\x24" "blocked ahead. Slow traffic for 1 km\0"
+	"\x24" "blocked ahead. Slow traffic for 2 km\0"
+	"\x24" "blocked ahead. Slow traffic for 4 km\0"
+	"\x24" "blocked ahead. Slow traffic for 6 km\0"
+	"\x25" "blocked ahead. Slow traffic for 10 km\0"
+	"\x24" "blocked ahead. Slow traffic expected\0"
+	"\x1C" "blocked ahead. Heavy traffic\0"
+	"\x25" "blocked ahead. Heavy traffic expected\0"
+	"\x25" "blocked ahead. Traffic flowing freely\0"
+	"\x22" "blocked ahead. Traffic building up\0"
+	"\x1A" "blocked ahead. Delays (%s)\0"
+	"\x23" "blocked ahead. Delays (%s) expected\0"
+	"\x1F" "blocked ahead. Long delays (%s)\0"
+	"\x13" "slip roads reopened\0"
+	"\x08" "reopened\0"
+	"\x11" "message cancelled\0"
+	"\x0C" "closed ahead\0"
+	"\x0D" "blocked ahead\0"
+	"\x1E" "(%s) entry slip road(s) closed\0"
+	"\x1F" "(%s th) entry slip road blocked\0"
+	"\x0D" "entry blocked\0"
+	"\x1D" "(%s) exit slip road(s) closed\0"
+	"\x1E" "(%s th) exit slip road blocked\0"
+	"\x0C" "exit blocked\0"
+	"\x12" "slip roads blocked\0"
+	"\x1D" "connecting carriageway closed\0"
+	"\x1B" "parallel carriageway closed\0"
+	"\x26" "right-hand parallel carriageway closed\0"
+	"\x25" "left-hand parallel carriageway closed\0"
+	"\x14" "express lanes closed\0"
+	"\x1C" "through traffic lanes closed\0"
+	"\x12" "local lanes closed\0"
+	"\x1E" "connecting carriageway blocked\0"
+	"\x1C" "parallel carriageway blocked\0"
+	"\x27" "right-hand parallel carriageway blocked\0"
+	"\x26" "left-hand parallel carriageway blocked\0"
+	"\x15" "express lanes blocked\0"
+	"\x1D" "through traffic lanes blocked\0"
+	"\x13" "local lanes blocked\0"
+	"\x11" "no motor vehicles\0"
+	"\x0C" "restrictions\0"
+	"\x22" "closed for heavy lorries (over %s)\0"
+	"\x29" "closed ahead. Stationary traffic for 3 km\0"
+	"\x26" "closed ahead. Queuing traffic for 3 km\0"
+	"\x23" "closed ahead. Slow traffic for 3 km\0"
+	"\x2A" "blocked ahead. Stationary traffic for 3 km\0"
+	"\x27" "blocked ahead. Queuing traffic for 3 km\0"
+	"\x13" "(%s) lane(s) closed\0"
+	"\x19" "(%s) right lane(s) closed\0"
+	"\x1A" "(%s) centre lane(s) closed\0"
+	"\x18" "(%s) left lane(s) closed\0"
+	"\x14" "hard shoulder closed\0"
+	"\x10" "two lanes closed\0"
+	"\x12" "three lanes closed\0"
+	"\x1A" "(%s) right lane(s) blocked\0"
+	"\x1B" "(%s) centre lane(s) blocked\0"
+	"\x19" "(%s) left lane(s) blocked\0"
+	"\x15" "hard shoulder blocked\0"
+	"\x11" "two lanes blocked\0"
+	"\x13" "three lanes blocked\0"
+	"\x1D" "single alternate line traffic\0"
+	"\x2F" "carriageway reduced (from %s lanes) to one lane\0"
+	"\x30" "carriageway reduced (from %s lanes) to two lanes\0"
+	"\x32" "carriageway reduced (from %s lanes) to three lanes\0"
+	"\x0A" "contraflow\0"
+	"\x0C" "narrow lanes\0"
+	"\x1C" "contraflow with narrow lanes\0"
+	"\x14" "(%s) lane(s) blocked\0"
+	"\x25" "(%s) lanes closed. Stationary traffic\0"
+	"\x2E" "(%s) lanes closed. Stationary traffic for 1 km\0"
+	"\x2E" "(%s) lanes closed. Stationary traffic for 2 km\0"
+	"\x2E" "(%s) lanes closed. Stationary traffic for 4 km\0"
+	"\x2E" "(%s) lanes closed. Stationary traffic for 6 km\0"
+	"\x2F" "(%s) lanes closed. Stationary traffic for 10 km\0"
+	"\x2F" "(%s) lanes closed. Danger of stationary traffic\0"
+	"\x22" "(%s) lanes closed. Queuing traffic\0"
+	"\x2B" "(%s) lanes closed. Queuing traffic for 1 km\0"
+	"\x2B" "(%s) lanes closed. Queuing traffic for 2 km\0"
+	"\x2B" "(%s) lanes closed. Queuing traffic for 4 km\0"
+	"\x2B" "(%s) lanes closed. Queuing traffic for 6 km\0"
+	"\x2C" "(%s) lanes closed. Queuing traffic for 10 km\0"
+	"\x2C" "(%s) lanes closed. Danger of queuing traffic\0"
+	"\x1F" "(%s) lanes closed. Slow traffic\0"
+	"\x28" "(%s) lanes closed. Slow traffic for 1 km\0"
+	"\x28" "(%s) lanes closed. Slow traffic for 2 km\0"
+	"\x28" "(%s) lanes closed. Slow traffic for 4 km\0"
+	"\x28" "(%s) lanes closed. Slow traffic for 6 km\0"
+	"\x29" "(%s) lanes closed. Slow traffic for 10 km\0"
+	"\x28" "(%s) lanes closed. Slow traffic expected\0"
+	"\x20" "(%s) lanes closed. Heavy traffic\0"
+	"\x29" "(%s) lanes closed. Heavy traffic expected\0"
+	"\x28" "(%s)lanes closed. Traffic flowing freely\0"
+	"\x25" "(%s)lanes closed. Traffic building up\0"
+	"\x43" "carriageway reduced (from %s lanes) to one lane. Stationary traffic\0"
+	"\x4D" "carriageway reduced (from %s lanes) to one lane. Danger of stationary traffic\0"
+	"\x40" "carriageway reduced (from %s lanes) to one lane. Queuing traffic\0"
+	"\x4A" "carriageway reduced (from %s lanes) to one lane. Danger of queuing traffic\0"
+	"\x3D" "carriageway reduced (from %s lanes) to one lane. Slow traffic\0"
+	"\x46" "carriageway reduced (from %s lanes) to one lane. Slow traffic expected\0"
+	"\x3E" "carriageway reduced (from %s lanes) to one lane. Heavy traffic\0"
+	"\x47" "carriageway reduced (from %s lanes) to one lane. Heavy traffic expected\0"
+	"\x47" "carriageway reduced (from %s lanes) to one lane. Traffic flowing freely\0"
+	"\x44" "carriageway reduced (from %s lanes) to one lane. Traffic building up\0"
+	"\x44" "carriageway reduced (from %s lanes) to two lanes. Stationary traffic\0"
+	"\x4E" "carriageway reduced (from %s lanes) to two lanes. Danger of stationary traffic\0"
+	"\x41" "carriageway reduced (from %s lanes) to two lanes. Queuing traffic\0"
+	"\x4B" "carriageway reduced (from %s lanes) to two lanes. Danger of queuing traffic\0"
+	"\x3E" "carriageway reduced (from %s lanes) to two lanes. Slow traffic\0"
+	"\x47" "carriageway reduced (from %s lanes) to two lanes. Slow traffic expected\0"
+	"\x3F" "carriageway reduced (from %s lanes) to two lanes. Heavy traffic\0"
+	"\x48" "carriageway reduced (from %s lanes) to two lanes. Heavy traffic expected\0"
+	"\x48" "carriageway reduced (from %s lanes) to two lanes. Traffic flowing freely\0"
+	"\x45" "carriageway reduced (from %s lanes) to two lanes. Traffic building up\0"
+	"\x46" "carriageway reduced (from %s lanes) to three lanes. Stationary traffic\0"
+	"\x50" "carriageway reduced (from %s lanes) to three lanes. Danger of stationary traffic\0"
+	"\x43" "carriageway reduced (from %s lanes) to three lanes. Queuing traffic\0"
+	"\x4D" "carriageway reduced (from %s lanes) to three lanes. Danger of queuing traffic\0"
+	"\x40" "carriageway reduced (from %s lanes) to three lanes. Slow traffic\0"
+	"\x49" "carriageway reduced (from %s lanes) to three lanes. Slow traffic expected\0"
+	"\x41" "carriageway reduced (from %s lanes) to three lanes. Heavy traffic\0"
+	"\x4A" "carriageway reduced (from %s lanes) to three lanes. Heavy traffic expected\0"
+	"\x4A" "carriageway reduced (from %s lanes) to three lanes. Traffic flowing freely\0"
+	"\x47" "carriageway reduced (from %s lanes) to three lanes. Traffic building up\0"
+	"\x1E" "contraflow. Stationary traffic\0"
+	"\x27" "contraflow. Stationary traffic for 1 km\0"
+	"\x27" "contraflow. Stationary traffic for 2 km\0"
+	"\x27" "contraflow. Stationary traffic for 4 km\0"
+	"\x27" "contraflow. Stationary traffic for 6 km\0"
+	"\x28" "contraflow. Stationary traffic for 10 km\0"
+	"\x28" "contraflow. Danger of stationary traffic\0"
+	"\x1B" "contraflow. Queuing traffic\0"
+	"\x24" "contraflow. Queuing traffic for 1 km\0"
+	"\x24" "contraflow. Queuing traffic for 2 km\0"
+	"\x24" "contraflow. Queuing traffic for 4 km\0"
+	"\x24" "contraflow. Queuing traffic for 6 km\0"
+	"\x25" "contraflow. Queuing traffic for 10 km\0"
+	"\x25" "contraflow. Danger of queuing traffic\0"
+	"\x18" "contraflow. Slow traffic\0"
+	"\x21" "contraflow. Slow traffic for 1 km\0"
+	"\x21" "contraflow. Slow traffic for 2 km\0"
+	"\x21" "contraflow. Slow traffic for 4 km\0"
+	"\x21" "contraflow. Slow traffic for 6 km\0"
+	"\x22" "contraflow. Slow traffic for 10 km\0"
+	"\x21" "contraflow. Slow traffic expected\0"
+	"\x19" "contraflow. Heavy traffic\0"
+	"\x22" "contraflow. Heavy traffic expected\0"
+	"\x22" "contraflow. Traffic flowing freely\0"
+	"\x1F" "contraflow. Traffic building up\0"
+	"\x3B" "contraflow. Carriageway reduced (from %s lanes) to one lane\0"
+	"\x3C" "contraflow. Carriageway reduced (from %s lanes) to two lanes\0"
+	"\x3E" "contraflow. Carriageway reduced (from %s lanes) to three lanes\0"
+	"\x20" "narrow lanes. Stationary traffic\0"
+	"\x2A" "narrow lanes. Danger of stationary traffic\0"
+	"\x1D" "narrow lanes. Queuing traffic\0"
+	"\x27" "narrow lanes. Danger of queuing traffic\0"
+	"\x1A" "narrow lanes. Slow traffic\0"
+	"\x23" "narrow lanes. Slow traffic expected\0"
+	"\x1B" "narrow lanes. Heavy traffic\0"
+	"\x24" "narrow lanes. Heavy traffic expected\0"
+	"\x24" "narrow lanes. Traffic flowing freely\0"
+	"\x21" "narrow lanes. Traffic building up\0"
+	"\x30" "contraflow with narrow lanes. Stationary traffic\0"
+	"\x4E" "contraflow with narrow lanes. Stationary traffic. Danger of stationary traffic\0"
+	"\x2D" "contraflow with narrow lanes. Queuing traffic\0"
+	"\x37" "contraflow with narrow lanes. Danger of queuing traffic\0"
+	"\x2A" "contraflow with narrow lanes. Slow traffic\0"
+	"\x33" "contraflow with narrow lanes. Slow traffic expected\0"
+	"\x2B" "contraflow with narrow lanes. Heavy traffic\0"
+	"\x34" "contraflow with narrow lanes. Heavy traffic expected\0"
+	"\x34" "contraflow with narrow lanes. Traffic flowing freely\0"
+	"\x31" "contraflow with narrow lanes. Traffic building up\0"
+	"\x15" "lane closures removed\0"
+	"\x11" "message cancelled\0"
+	"\x24" "blocked ahead. Slow traffic for 3 km\0"
+	"\x2E" "no motor vehicles without catalytic converters\0"
+	"\x38" "no motor vehicles with even-numbered registration plates\0"
+	"\x37" "no motor vehicles with odd-numbered registration plates\0"
+	"\x04" "open\0"
+	"\x0C" "road cleared\0"
+	"\x0E" "entry reopened\0"
+	"\x0D" "exit reopened\0"
+	"\x19" "all carriageways reopened\0"
+	"\x21" "motor vehicle restrictions lifted\0"
+	"\x1B" "traffic restrictions lifted\0"
+	"\x15" "emergency lane closed\0"
+	"\x13" "turning lane closed\0"
+	"\x13" "crawler lane closed\0"
+	"\x18" "slow vehicle lane closed\0"
+	"\x0F" "one lane closed\0"
+	"\x16" "emergency lane blocked\0"
+	"\x14" "turning lane blocked\0"
+	"\x14" "crawler lane blocked\0"
+	"\x19" "slow vehicle lane blocked\0"
+	"\x10" "one lane blocked\0"
+	"\x25" "(%s person) carpool lane in operation\0"
+	"\x1F" "(%s person) carpool lane closed\0"
+	"\x20" "(%s person) carpool lane blocked\0"
+	"\x38" "carpool restrictions changed (to %s persons per vehicle)\0"
+	"\x2E" "(%s) lanes closed. Stationary traffic for 3 km\0"
+	"\x2B" "(%s) lanes closed. Queuing traffic for 3 km\0"
+	"\x28" "(%s) lanes closed. Slow traffic for 3 km\0"
+	"\x27" "contraflow. Stationary traffic for 3 km\0"
+	"\x24" "contraflow. Queuing traffic for 3 km\0"
+	"\x21" "contraflow. Slow traffic for 3 km\0"
+	"\x16" "lane blockages cleared\0"
+	"\x12" "contraflow removed\0"
+	"\x27" "(%s person) carpool restrictions lifted\0"
+	"\x18" "lane restrictions lifted\0"
+	"\x1C" "use of hard shoulder allowed\0"
+	"\x20" "normal lane regulations restored\0"
+	"\x18" "all carriageways cleared\0"
+	"\x12" "carriageway closed\0"
+	"\x16" "both directions closed\0"
+	"\x20" "intermittent short term closures\0"
+	"\x3C" "bus lane available for carpools (with at least %s occupants)\0"
+	"\x11" "message cancelled\0"
+	"\x11" "message cancelled\0"
+	"\x15" "(%s) salting vehicles\0"
+	"\x10" "bus lane blocked\0"
+	"\x19" "heavy vehicle lane closed\0"
+	"\x1A" "heavy vehicle lane blocked\0"
+	"\x1C" "reopened for through traffic\0"
+	"\x10" "(%s) snowploughs\0"
+	"\x16" "(%s sets of) roadworks\0"
+	"\x1C" "(%s sets of) major roadworks\0"
+	"\x1D" "(%s sets of) maintenance work\0"
+	"\x21" "(%s sections of) resurfacing work\0"
+	"\x25" "(%s sets of) central reservation work\0"
+	"\x1E" "(%s sets of) road marking work\0"
+	"\x27" "bridge maintenance work (at %s bridges)\0"
+	"\x25" "(%s sets of) temporary traffic lights\0"
+	"\x1E" "(%s sections of) blasting work\0"
+	"\x2A" "(%s sets of) roadworks. Stationary traffic\0"
+	"\x33" "(%s sets of) roadworks. Stationary traffic for 1 km\0"
+	"\x33" "(%s sets of) roadworks. Stationary traffic for 2 km\0"
+	"\x33" "(%s sets of) roadworks. Stationary traffic for 4 km\0"
+	"\x33" "(%s sets of) roadworks. Stationary traffic for 6 km\0"
+	"\x34" "(%s sets of) roadworks. Stationary traffic for 10 km\0"
+	"\x34" "(%s sets of) roadworks. Danger of stationary traffic\0"
+	"\x27" "(%s sets of) roadworks. Queuing traffic\0"
+	"\x30" "(%s sets of) roadworks. Queuing traffic for 1 km\0"
+	"\x30" "(%s sets of) roadworks. Queuing traffic for 2 km\0"
+	"\x30" "(%s sets of) roadworks. Queuing traffic for 4 km\0"
+	"\x30" "(%s sets of) roadworks. Queuing traffic for 6 km\0"
+	"\x31" "(%s sets of) roadworks. Queuing traffic for 10 km\0"
+	"\x31" "(%s sets of) roadworks. Danger of queuing traffic\0"
+	"\x24" "(%s sets of) roadworks. Slow traffic\0"
+	"\x2D" "(%s sets of) roadworks. Slow traffic for 1 km\0"
+	"\x2D" "(%s sets of) roadworks. Slow traffic for 2 km\0"
+	"\x2D" "(%s sets of) roadworks. Slow traffic for 4 km\0"
+	"\x2D" "(%s sets of) roadworks. Slow traffic for 6 km\0"
+	"\x2E" "(%s sets of) roadworks. Slow traffic for 10 km\0"
+	"\x2D" "(%s sets of) roadworks. Slow traffic expected\0"
+	"\x25" "(%s sets of) roadworks. Heavy traffic\0"
+	"\x2E" "(%s sets of) roadworks. Heavy traffic expected\0"
+	"\x2E" "(%s sets of) roadworks. Traffic flowing freely\0"
+	"\x2B" "(%s sets of) roadworks. Traffic building up\0"
+	"\x24" "closed due to (%s sets of) roadworks\0"
+	"\x29" "(%s sets of) roadworks. Right lane closed\0"
+	"\x2A" "(%s sets of) roadworks. Centre lane closed\0"
+	"\x28" "(%s sets of) roadworks. Left lane closed\0"
+	"\x2C" "(%s sets of) roadworks. Hard shoulder closed\0"
+	"\x28" "(%s sets of) roadworks. Two lanes closed\0"
+	"\x2A" "(%s sets of) roadworks. Three lanes closed\0"
+	"\x35" "(%s sets of) roadworks. Single alternate line traffic\0"
+	"\x3A" "roadworks. Carriageway reduced (from %s lanes) to one lane\0"
+	"\x3B" "roadworks. Carriageway reduced (from %s lanes) to two lanes\0"
+	"\x3D" "roadworks. Carriageway reduced (from %s lanes) to three lanes\0"
+	"\x22" "(%s sets of) roadworks. Contraflow\0"
+	"\x16" "roadworks. Delays (%s)\0"
+	"\x1F" "roadworks. Delays (%s) expected\0"
+	"\x1B" "roadworks. Long delays (%s)\0"
+	"\x35" "(%s sections of) resurfacing work. Stationary traffic\0"
+	"\x3E" "(%s sections of) resurfacing work. Stationary traffic for 1 km\0"
+	"\x3E" "(%s sections of) resurfacing work. Stationary traffic for 2 km\0"
+	"\x3E" "(%s sections of) resurfacing work. Stationary traffic for 4 km\0"
+	"\x3E" "(%s sections of) resurfacing work. Stationary traffic for 6 km\0"
+	"\x3F" "(%s sections of) resurfacing work. Stationary traffic for 10 km\0"
+	"\x3F" "(%s sections of) resurfacing work. Danger of stationary traffic\0"
+	"\x32" "(%s sections of) resurfacing work. Queuing traffic\0"
+	"\x3B" "(%s sections of) resurfacing work. Queuing traffic for 1 km\0"
+	"\x3B" "(%s sections of) resurfacing work. Queuing traffic for 2 km\0"
+	"\x3B" "(%s sections of) resurfacing work. Queuing traffic for 4 km\0"
+	"\x3B" "(%s sections of) resurfacing work. Queuing traffic for 6 km\0"
+	"\x3C" "(%s sections of) resurfacing work. Queuing traffic for 10 km\0"
+	"\x3C" "(%s sections of) resurfacing work. Danger of queuing traffic\0"
+	"\x2F" "(%s sections of) resurfacing work. Slow traffic\0"
+	"\x38" "(%s sections of) resurfacing work. Slow traffic for 1 km\0"
+	"\x38" "(%s sections of) resurfacing work. Slow traffic for 2 km\0"
+	"\x38" "(%s sections of) resurfacing work. Slow traffic for 4 km\0"
+	"\x38" "(%s sections of) resurfacing work. Slow traffic for 6 km\0"
+	"\x39" "(%s sections of) resurfacing work. Slow traffic for 10 km\0"
+	"\x38" "(%s sections of) resurfacing work. Slow traffic expected\0"
+	"\x30" "(%s sections of) resurfacing work. Heavy traffic\0"
+	"\x39" "(%s sections of) resurfacing work. Heavy traffic expected\0"
+	"\x39" "(%s sections of) resurfacing work. Traffic flowing freely\0"
+	"\x36" "(%s sections of) resurfacing work. Traffic building up\0"
+	"\x40" "(%s sections of) resurfacing work. Single alternate line traffic\0"
+	"\x41" "resurfacing work. Carriageway reduced (from %s lanes) to one lane\0"
+	"\x42" "resurfacing work. Carriageway reduced (from %s lanes) to two lanes\0"
+	"\x44" "resurfacing work. Carriageway reduced (from %s lanes) to three lanes\0"
+	"\x2D" "(%s sections of) resurfacing work. Contraflow\0"
+	"\x1D" "resurfacing work. Delays (%s)\0"
+	"\x26" "resurfacing work. Delays (%s) expected\0"
+	"\x22" "resurfacing work. Long delays (%s)\0"
+	"\x32" "(%s sets of) road marking work. Stationary traffic\0"
+	"\x3C" "(%s sets of) road marking work. Danger of stationary traffic\0"
+	"\x2F" "(%s sets of) road marking work. Queuing traffic\0"
+	"\x39" "(%s sets of) road marking work. Danger of queuing traffic\0"
+	"\x2C" "(%s sets of) road marking work. Slow traffic\0"
+	"\x35" "(%s sets of) road marking work. Slow traffic expected\0"
+	"\x2D" "(%s sets of) road marking work. Heavy traffic\0"
+	"\x36" "(%s sets of) road marking work. Heavy traffic expected\0"
+	"\x36" "(%s sets of) road marking work. Traffic flowing freely\0"
+	"\x33" "(%s sets of) road marking work. Traffic building up\0"
+	"\x31" "(%s sets of) road marking work. Right lane closed\0"
+	"\x32" "(%s sets of) road marking work. Centre lane closed\0"
+	"\x30" "(%s sets of) road marking work. Left lane closed\0"
+	"\x34" "(%s sets of) road marking work. Hard shoulder closed\0"
+	"\x30" "(%s sets of) road marking work. Two lanes closed\0"
+	"\x32" "(%s sets of) road marking work. Three lanes closed\0"
+	"\x31" "closed for bridge demolition work (at %s bridges)\0"
+	"\x11" "roadworks cleared\0"
+	"\x11" "message cancelled\0"
+	"\x20" "(%s sets of) long-term roadworks\0"
+	"\x1E" "(%s sets of) construction work\0"
+	"\x2D" "(%s sets of) slow moving maintenance vehicles\0"
+	"\x26" "bridge demolition work (at %s bridges)\0"
+	"\x1C" "(%s sets of) water main work\0"
+	"\x1A" "(%s sets of) gas main work\0"
+	"\x22" "(%s sets of) work on buried cables\0"
+	"\x24" "(%s sets of) work on buried services\0"
+	"\x14" "new roadworks layout\0"
+	"\x0F" "new road layout\0"
+	"\x33" "(%s sets of) roadworks. Stationary traffic for 3 km\0"
+	"\x30" "(%s sets of) roadworks. Queuing traffic for 3 km\0"
+	"\x2D" "(%s sets of) roadworks. Slow traffic for 3 km\0"
+	"\x2A" "(%s sets of) roadworks during the day time\0"
+	"\x2E" "(%s sets of) roadworks during off-peak periods\0"
+	"\x27" "(%s sets of) roadworks during the night\0"
+	"\x3E" "(%s sections of) resurfacing work. Stationary traffic for 3 km\0"
+	"\x3B" "(%s sections of) resurfacing work. Queuing traffic for 3 km\0"
+	"\x38" "(%s sections of) resurfacing work. Slow traffic for 3 km\0"
+	"\x31" "(%s sets of) resurfacing work during the day time\0"
+	"\x35" "(%s sets of) resurfacing work during off-peak periods\0"
+	"\x2E" "(%s sets of) resurfacing work during the night\0"
+	"\x26" "(%s sets of) road marking work. Danger\0"
+	"\x41" "(%s sets of) slow moving maintenance vehicles. Stationary traffic\0"
+	"\x4B" "(%s sets of) slow moving maintenance vehicles. Danger of stationary traffic\0"
+	"\x3E" "(%s sets of) slow moving maintenance vehicles. Queuing traffic\0"
+	"\x48" "(%s sets of) slow moving maintenance vehicles. Danger of queuing traffic\0"
+	"\x3B" "(%s sets of) slow moving maintenance vehicles. Slow traffic\0"
+	"\x44" "(%s sets of) slow moving maintenance vehicles. Slow traffic expected\0"
+	"\x3C" "(%s sets of) slow moving maintenance vehicles. Heavy traffic\0"
+	"\x45" "(%s sets of) slow moving maintenance vehicles. Heavy traffic expected\0"
+	"\x45" "(%s sets of) slow moving maintenance vehicles. Traffic flowing freely\0"
+	"\x42" "(%s sets of) slow moving maintenance vehicles. Traffic building up\0"
+	"\x40" "(%s sets of) slow moving maintenance vehicles. Right lane closed\0"
+	"\x41" "(%s sets of) slow moving maintenance vehicles. Centre lane closed\0"
+	"\x3F" "(%s sets of) slow moving maintenance vehicles. Left lane closed\0"
+	"\x3F" "(%s sets of) slow moving maintenance vehicles. Two lanes closed\0"
+	"\x41" "(%s sets of) slow moving maintenance vehicles. Three lanes closed\0"
+	"\x1C" "water main work. Delays (%s)\0"
+	"\x25" "water main work. Delays (%s) expected\0"
+	"\x21" "water main work. Long delays (%s)\0"
+	"\x1A" "gas main work. Delays (%s)\0"
+	"\x23" "gas main work. Delays (%s) expected\0"
+	"\x1F" "gas main work. Long delays (%s)\0"
+	"\x22" "work on buried cables. Delays (%s)\0"
+	"\x2B" "work on buried cables. Delays (%s) expected\0"
+	"\x27" "work on buried cables. Long delays (%s)\0"
+	"\x24" "work on buried services. Delays (%s)\0"
+	"\x2D" "work on buried services. Delays (%s) expected\0"
+	"\x29" "work on buried services. Long delays (%s)\0"
+	"\x1C" "construction traffic merging\0"
+	"\x1E" "roadwork clearance in progress\0"
+	"\x18" "maintenance work cleared\0"
+	"\x15" "road layout unchanged\0"
+	"\x24" "construction traffic merging. Danger\0"
+	"\x21" "(%s) unprotected accident area(s)\0"
+	"\x2A" "danger of(%s) unprotected accident area(s)\0"
+	"\x21" "(%s) unlit vehicle(s) on the road\0"
+	"\x2B" "danger of (%s) unlit vehicle(s) on the road\0"
+	"\x13" "snow and ice debris\0"
+	"\x1D" "danger of snow and ice debris\0"
+	"\x2D" "people throwing objects onto the road. Danger\0"
+	"\x1D" "obstruction warning withdrawn\0"
+	"\x2B" "clearance work in progress, road free again\0"
+	"\x11" "flooding expected\0"
+	"\x1E" "(%s) obstruction(s) on roadway\0"
+	"\x25" "(%s) obstructions on the road. Danger\0"
+	"\x14" "spillage on the road\0"
+	"\x0C" "storm damage\0"
+	"\x11" "(%s) fallen trees\0"
+	"\x19" "(%s) fallen trees. Danger\0"
+	"\x08" "flooding\0"
+	"\x10" "flooding. Danger\0"
+	"\x0C" "flash floods\0"
+	"\x16" "danger of flash floods\0"
+	"\x0A" "avalanches\0"
+	"\x0E" "avalanche risk\0"
+	"\x09" "rockfalls\0"
+	"\x09" "landslips\0"
+	"\x11" "earthquake damage\0"
+	"\x1E" "road surface in poor condition\0"
+	"\x0A" "subsidence\0"
+	"\x17" "(%s) collapsed sewer(s)\0"
+	"\x10" "burst water main\0"
+	"\x08" "gas leak\0"
+	"\x0C" "serious fire\0"
+	"\x12" "animals on roadway\0"
+	"\x1B" "animals on the road. Danger\0"
+	"\x0E" "clearance work\0"
+	"\x17" "blocked by storm damage\0"
+	"\x1C" "blocked by (%s) fallen trees\0"
+	"\x27" "(%s) fallen tree(s). Passable with care\0"
+	"\x1C" "flooding. Stationary traffic\0"
+	"\x26" "flooding. Danger of stationary traffic\0"
+	"\x19" "flooding. Queuing traffic\0"
+	"\x23" "flooding. Danger of queuing traffic\0"
+	"\x16" "flooding. Slow traffic\0"
+	"\x1F" "flooding. Slow traffic expected\0"
+	"\x17" "flooding. Heavy traffic\0"
+	"\x20" "flooding. Heavy traffic expected\0"
+	"\x20" "flooding. Traffic flowing freely\0"
+	"\x1D" "flooding. Traffic building up\0"
+	"\x16" "closed due to flooding\0"
+	"\x15" "flooding. Delays (%s)\0"
+	"\x1E" "flooding. Delays (%s) expected\0"
+	"\x1A" "flooding. Long delays (%s)\0"
+	"\x1C" "flooding. Passable with care\0"
+	"\x18" "closed due to avalanches\0"
+	"\x38" "avalanches. Passable with care (above %s hundred metres)\0"
+	"\x17" "closed due to rockfalls\0"
+	"\x1D" "rockfalls. Passable with care\0"
+	"\x1C" "road closed due to landslips\0"
+	"\x1D" "landslips. Passable with care\0"
+	"\x18" "closed due to subsidence\0"
+	"\x29" "subsidence. Single alternate line traffic\0"
+	"\x3B" "subsidence. Carriageway reduced (from %s lanes) to one lane\0"
+	"\x3C" "subsidence. Carriageway reduced (from %s lanes) to two lanes\0"
+	"\x3E" "subsidence. Carriageway reduced (from %s lanes) to three lanes\0"
+	"\x23" "subsidence. Contraflow in operation\0"
+	"\x1E" "subsidence. Passable with care\0"
+	"\x1C" "closed due to sewer collapse\0"
+	"\x23" "road closed due to burst water main\0"
+	"\x1D" "burst water main. Delays (%s)\0"
+	"\x26" "burst water main. Delays (%s) expected\0"
+	"\x22" "burst water main. Long delays (%s)\0"
+	"\x16" "closed due to gas leak\0"
+	"\x15" "gas leak. Delays (%s)\0"
+	"\x1E" "gas leak. Delays (%s) expected\0"
+	"\x1A" "gas leak. Long delays (%s)\0"
+	"\x1A" "closed due to serious fire\0"
+	"\x19" "serious fire. Delays (%s)\0"
+	"\x22" "serious fire. Delays (%s) expected\0"
+	"\x1E" "serious fire. Long delays (%s)\0"
+	"\x19" "closed for clearance work\0"
+	"\x0F" "road free again\0"
+	"\x11" "message cancelled\0"
+	"\x15" "storm damage expected\0"
+	"\x13" "fallen power cables\0"
+	"\x0E" "sewer overflow\0"
+	"\x0C" "ice build-up\0"
+	"\x09" "mud slide\0"
+	"\x0A" "grass fire\0"
+	"\x09" "air crash\0"
+	"\x0A" "rail crash\0"
+	"\x2A" "blocked by (%s) obstruction(s) on the road\0"
+	"\x31" "(%s) obstructions on the road. Passable with care\0"
+	"\x22" "blocked due to spillage on roadway\0"
+	"\x28" "spillage on the road. Passable with care\0"
+	"\x1C" "spillage on the road. Danger\0"
+	"\x20" "storm damage. Passable with care\0"
+	"\x14" "storm damage. Danger\0"
+	"\x1E" "blocked by fallen power cables\0"
+	"\x27" "fallen power cables. Passable with care\0"
+	"\x1B" "fallen power cables. Danger\0"
+	"\x16" "sewer overflow. Danger\0"
+	"\x14" "flash floods. Danger\0"
+	"\x12" "avalanches. Danger\0"
+	"\x1C" "closed due to avalanche risk\0"
+	"\x16" "avalanche risk. Danger\0"
+	"\x1A" "closed due to ice build-up\0"
+	"\x3A" "ice build-up. Passable with care (above %s hundred metres)\0"
+	"\x26" "ice build-up. Single alternate traffic\0"
+	"\x11" "rockfalls. Danger\0"
+	"\x11" "landslips. Danger\0"
+	"\x19" "earthquake damage. Danger\0"
+	"\x36" "hazardous driving conditions (above %s hundred metres)\0"
+	"\x15" "danger of aquaplaning\0"
+	"\x27" "slippery road (above %s hundred metres)\0"
+	"\x0B" "mud on road\0"
+	"\x0E" "leaves on road\0"
+	"\x1D" "ice (above %s hundred metres)\0"
+	"\x27" "danger of ice (above %s hundred metres)\0"
+	"\x23" "black ice (above %s hundred metres)\0"
+	"\x27" "freezing rain (above %s hundred metres)\0"
+	"\x2B" "wet and icy roads (above %s hundred metres)\0"
+	"\x1F" "slush (above %s hundred metres)\0"
+	"\x2A" "snow on the road (above %s hundred metres)\0"
+	"\x25" "packed snow (above %s hundred metres)\0"
+	"\x24" "fresh snow (above %s hundred metres)\0"
+	"\x23" "deep snow (above %s hundred metres)\0"
+	"\x25" "snow drifts (above %s hundred metres)\0"
+	"\x23" "slippery due to spillage on roadway\0"
+	"\x33" "slippery road (above %s hundred metres) due to snow\0"
+	"\x34" "slippery road (above %s hundred metres) due to frost\0"
+	"\x2E" "road blocked by snow (above %s hundred metres)\0"
+	"\x41" "snow on the road. Carriageway reduced (from %s lanes) to one lane\0"
+	"\x42" "snow on the road. Carriageway reduced (from %s lanes) to two lanes\0"
+	"\x44" "snow on the road. Carriageway reduced (from %s lanes) to three lanes\0"
+	"\x23" "conditions of road surface improved\0"
+	"\x11" "message cancelled\0"
+	"\x12" "subsidence. Danger\0"
+	"\x1B" "sewer collapse. Delays (%s)\0"
+	"\x24" "sewer collapse. Delays (%s) expected\0"
+	"\x20" "sewer collapse. Long delays (%s)\0"
+	"\x16" "sewer collapse. Danger\0"
+	"\x18" "burst water main. Danger\0"
+	"\x10" "gas leak. Danger\0"
+	"\x14" "serious fire. Danger\0"
+	"\x16" "clearance work. Danger\0"
+	"\x24" "impassable (above %s hundred metres)\0"
+	"\x2B" "almost impassable (above %s hundred metres)\0"
+	"\x40" "extremely hazardous driving conditions (above %s hundred metres)\0"
+	"\x36" "difficult driving conditions (above %s hundred metres)\0"
+	"\x2C" "passable with care (up to %s hundred metres)\0"
+	"\x22" "passable (up to %s hundred metres)\0"
+	"\x14" "surface water hazard\0"
+	"\x12" "loose sand on road\0"
+	"\x0F" "loose chippings\0"
+	"\x0B" "oil on road\0"
+	"\x0E" "petrol on road\0"
+	"\x26" "ice expected (above %s hundred metres)\0"
+	"\x25" "icy patches (above %s hundred metres)\0"
+	"\x2F" "danger of icy patches (above %s hundred metres)\0"
+	"\x2E" "icy patches expected (above %s hundred metres)\0"
+	"\x2D" "danger of black ice (above %s hundred metres)\0"
+	"\x2C" "black ice expected (above %s hundred metres)\0"
+	"\x30" "freezing rain expected (above %s hundred metres)\0"
+	"\x2E" "snow drifts expected (above %s hundred metres)\0"
+	"\x25" "slippery due to loose sand on roadway\0"
+	"\x13" "mud on road. Danger\0"
+	"\x17" "loose chippings. Danger\0"
+	"\x13" "oil on road. Danger\0"
+	"\x16" "petrol on road. Danger\0"
+	"\x26" "road surface in poor condition. Danger\0"
+	"\x30" "icy patches (above %s hundred metres) on bridges\0"
+	"\x3A" "danger of icy patches (above %s hundred metres) on bridges\0"
+	"\x53" "icy patches (above %s hundred metres) on bridges, in shaded areas and on slip roads\0"
+	"\x27" "impassable for heavy vehicles (over %s)\0"
+	"\x3F" "impassable (above %s hundred metres) for vehicles with trailers\0"
+	"\x1B" "driving conditions improved\0"
+	"\x2C" "rescue and recovery work in progress. Danger\0"
+	"\x18" "large animals on roadway\0"
+	"\x1B" "herds of animals on roadway\0"
+	"\x13" "skid hazard reduced\0"
+	"\x0C" "snow cleared\0"
+	"\x22" "road conditions forecast withdrawn\0"
+	"\x11" "message cancelled\0"
+	"\x49" "extremely hazardous driving conditions expected (above %s hundred meters)\0"
+	"\x30" "freezing rain expected (above %s hundred metres)\0"
+	"\x3E" "danger of road being blocked by snow (above %s hundred metres)\0"
+	"\x23" "temperature falling rapidly (to %s)\0"
+	"\x17" "extreme heat (up to %s)\0"
+	"\x14" "extreme cold (of %s)\0"
+	"\x19" "less extreme temperatures\0"
+	"\x18" "current temperature (%s)\0"
+	"\x0A" "house fire\0"
+	"\x0B" "forest fire\0"
+	"\x1A" "vehicle stuck under bridge\0"
+	"\x18" "volcano eruption warning\0"
+	"\x13" "heavy snowfall (%s)\0"
+	"\x30" "heavy snowfall (%s). Visibility reduced to <30 m\0"
+	"\x30" "heavy snowfall (%s). Visibility reduced to <50 m\0"
+	"\x0D" "snowfall (%s)\0"
+	"\x2B" "snowfall (%s). Visibility reduced to <100 m\0"
+	"\x1F" "hail (visibility reduced to %s)\0"
+	"\x20" "sleet (visibility reduced to %s)\0"
+	"\x28" "thunderstorms (visibility reduced to %s)\0"
+	"\x0F" "heavy rain (%s)\0"
+	"\x2C" "heavy rain (%s). Visibility reduced to <30 m\0"
+	"\x2C" "heavy rain (%s). Visibility reduced to <50 m\0"
+	"\x09" "rain (%s)\0"
+	"\x27" "rain (%s). Visibility reduced to <100 m\0"
+	"\x22" "showers (visibility reduced to %s)\0"
+	"\x0B" "heavy frost\0"
+	"\x05" "frost\0"
+	"\x24" "(%s probability of) overcast weather\0"
+	"\x21" "(%s probability of) mostly cloudy\0"
+	"\x21" "(%s probability of) partly cloudy\0"
+	"\x21" "(%s probability of) sunny periods\0"
+	"\x21" "(%s probability of) clear weather\0"
+	"\x21" "(%s probability of) sunny weather\0"
+	"\x26" "(%s probability of) mostly dry weather\0"
+	"\x1F" "(%s probability of) dry weather\0"
+	"\x32" "sunny periods and with (%s probability of) showers\0"
+	"\x1A" "weather situation improved\0"
+	"\x11" "message cancelled\0"
+	"\x27" "winter storm (visibility reduced to %s)\0"
+	"\x20" "(%s probability of) winter storm\0"
+	"\x23" "blizzard (visibility reduced to %s)\0"
+	"\x1C" "(%s probability of) blizzard\0"
+	"\x28" "damaging hail (visibility reduced to %s)\0"
+	"\x21" "(%s probability of) damaging hail\0"
+	"\x2A" "heavy snowfall. Visibility reduced (to %s)\0"
+	"\x24" "snowfall. Visibility reduced (to %s)\0"
+	"\x26" "heavy rain. Visibility reduced (to %s)\0"
+	"\x20" "rain. Visibility reduced (to %s)\0"
+	"\x21" "severe weather warnings cancelled\0"
+	"\x11" "message cancelled\0"
+	"\x1A" "weather forecast withdrawn\0"
+	"\x16" "fog forecast withdrawn\0"
+	"\x30" "slippery road expected (above %s hundred metres)\0"
+	"\x22" "(%s probability of) heavy snowfall\0"
+	"\x1C" "(%s probability of) snowfall\0"
+	"\x18" "(%s probability of) hail\0"
+	"\x19" "(%s probability of) sleet\0"
+	"\x21" "(%s probability of) thunderstorms\0"
+	"\x1E" "(%s probability of) heavy rain\0"
+	"\x18" "(%s probability of) rain\0"
+	"\x1B" "(%s probability of) showers\0"
+	"\x1F" "(%s probability of) heavy frost\0"
+	"\x19" "(%s probability of) frost\0"
+	"\x15" "rain changing to snow\0"
+	"\x15" "snow changing to rain\0"
+	"\x1C" "heavy snowfall (%s) expected\0"
+	"\x18" "heavy rain (%s) expected\0"
+	"\x1B" "weather expected to improve\0"
+	"\x31" "blizzard (with visibility reduced to %s) expected\0"
+	"\x36" "damaging hail (with visibility reduced to %s) expected\0"
+	"\x23" "reduced visibility (to %s) expected\0"
+	"\x4F" "freezing fog expected (with visibility reduced to %s). Danger of slippery roads\0"
+	"\x32" "dense fog (with visibility reduced to %s) expected\0"
+	"\x33" "patchy fog (with visibility reduced to %s) expected\0"
+	"\x1E" "visibility expected to improve\0"
+	"\x21" "adverse weather warning withdrawn\0"
+	"\x0B" "severe smog\0"
+	"\x18" "severe exhaust pollution\0"
+	"\x09" "tornadoes\0"
+	"\x1A" "hurricane force winds (%s)\0"
+	"\x0A" "gales (%s)\0"
+	"\x16" "storm force winds (%s)\0"
+	"\x11" "strong winds (%s)\0"
+	"\x13" "moderate winds (%s)\0"
+	"\x10" "light winds (%s)\0"
+	"\x0C" "calm weather\0"
+	"\x10" "gusty winds (%s)\0"
+	"\x0F" "crosswinds (%s)\0"
+	"\x2F" "strong winds (%s) affecting high-sided vehicles\0"
+	"\x37" "closed for high-sided vehicles due to strong winds (%s)\0"
+	"\x13" "strong winds easing\0"
+	"\x11" "message cancelled\0"
+	"\x2B" "restrictions for high-sided vehicles lifted\0"
+	"\x17" "tornado watch cancelled\0"
+	"\x15" "tornado warning ended\0"
+	"\x17" "wind forecast withdrawn\0"
+	"\x11" "message cancelled\0"
+	"\x1D" "(%s probability of) tornadoes\0"
+	"\x1A" "hurricane force winds (%s)\0"
+	"\x0A" "gales (%s)\0"
+	"\x16" "storm force winds (%s)\0"
+	"\x11" "strong winds (%s)\0"
+	"\x1E" "strong wind forecast withdrawn\0"
+	"\x34" "snowfall and fog (visibility reduced to %s) expected\0"
+	"\x24" "dense fog (visibility reduced to %s)\0"
+	"\x26" "dense fog. Visibility reduced to <30 m\0"
+	"\x26" "dense fog. Visibility reduced to <50 m\0"
+	"\x1E" "fog (visibility reduced to %s)\0"
+	"\x21" "fog. Visibility reduced to <100 m\0"
+	"\x17" "(%s probability of) fog\0"
+	"\x25" "patchy fog (visibility reduced to %s)\0"
+	"\x27" "freezing fog (visibility reduced to %s)\0"
+	"\x27" "smoke hazard (visibility reduced to %s)\0"
+	"\x27" "blowing dust (visibility reduced to %s)\0"
+	"\x2C" "(%s probability of) severe exhaust pollution\0"
+	"\x2B" "snowfall and fog (visibility reduced to %s)\0"
+	"\x13" "visibility improved\0"
+	"\x11" "message cancelled\0"
+	"\x1D" "(%s probability of) dense fog\0"
+	"\x1E" "(%s probability of) patchy fog\0"
+	"\x20" "(%s probability of) freezing fog\0"
+	"\x1A" "visibility reduced (to %s)\0"
+	"\x1B" "visibility reduced to <30 m\0"
+	"\x1B" "visibility reduced to <50 m\0"
+	"\x1C" "visibility reduced to <100 m\0"
+	"\x24" "white out (visibility reduced to %s)\0"
+	"\x27" "blowing snow (visibility reduced to %s)\0"
+	"\x27" "spray hazard (visibility reduced to %s)\0"
+	"\x0D" "low sun glare\0"
+	"\x25" "sandstorms (visibility reduced to %s)\0"
+	"\x1E" "(%s probability of) sandstorms\0"
+	"\x25" "(%s probability of) air quality: good\0"
+	"\x25" "(%s probability of) air quality: fair\0"
+	"\x25" "(%s probability of) air quality: poor\0"
+	"\x2A" "(%s probability of) air quality: very poor\0"
+	"\x0A" "smog alert\0"
+	"\x18" "(%s probability of) smog\0"
+	"\x26" "(%s probability of) pollen count: high\0"
+	"\x28" "(%s probability of) pollen count: medium\0"
+	"\x25" "(%s probability of) pollen count: low\0"
+	"\x37" "freezing fog (visibility reduced to %s). Slippery roads\0"
+	"\x23" "no motor vehicles due to smog alert\0"
+	"\x14" "air quality improved\0"
+	"\x2C" "swarms of insects (visibility reduced to %s)\0"
+	"\x0C" "fog clearing\0"
+	"\x16" "fog forecast withdrawn\0"
+	"\x1B" "maximum temperature (of %s)\0"
+	"\x1D" "hot, (maximum temperature %s)\0"
+	"\x1E" "warm, (maximum temperature %s)\0"
+	"\x1E" "mild, (maximum temperature %s)\0"
+	"\x1E" "cool, (maximum temperature %s)\0"
+	"\x1E" "cold, (maximum temperature %s)\0"
+	"\x23" "very cold, (maximum temperature %s)\0"
+	"\x11" "message cancelled\0"
+	"\x1A" "temperature rising (to %s)\0"
+	"\x23" "temperature falling rapidly (to %s)\0"
+	"\x10" "temperature (%s)\0"
+	"\x2B" "effective temperature, with wind chill (%s)\0"
+	"\x17" "extreme heat (up to %s)\0"
+	"\x14" "extreme cold (of %s)\0"
+	"\x1B" "minimum temperature (of %s)\0"
+	"\x22" "very warm (minimum temperature %s)\0"
+	"\x1D" "warm (minimum temperature %s)\0"
+	"\x1D" "mild (minimum temperature %s)\0"
+	"\x1D" "cool (minimum temperature %s)\0"
+	"\x1D" "cold (minimum temperature %s)\0"
+	"\x22" "very cold (minimum temperature %s)\0"
+	"\x22" "less extreme temperatures expected\0"
+	"\x1E" "emergency training in progress\0"
+	"\x1C" "international sports meeting\0"
+	"\x05" "match\0"
+	"\x0A" "tournament\0"
+	"\x11" "athletics meeting\0"
+	"\x09" "ball game\0"
+	"\x11" "boxing tournament\0"
+	"\x0A" "bull fight\0"
+	"\x0D" "cricket match\0"
+	"\x0A" "cycle race\0"
+	"\x0E" "football match\0"
+	"\x0F" "golf tournament\0"
+	"\x08" "marathon\0"
+	"\x0C" "race meeting\0"
+	"\x0B" "rugby match\0"
+	"\x0C" "show jumping\0"
+	"\x11" "tennis tournament\0"
+	"\x14" "water sports meeting\0"
+	"\x15" "winter sports meeting\0"
+	"\x07" "funfair\0"
+	"\x0A" "trade fair\0"
+	"\x0A" "procession\0"
+	"\x1D" "sightseers obstructing access\0"
+	"\x11" "people on roadway\0"
+	"\x13" "children on roadway\0"
+	"\x13" "cyclists on roadway\0"
+	"\x06" "strike\0"
+	"\x11" "security incident\0"
+	"\x11" "police checkpoint\0"
+	"\x12" "terrorist incident\0"
+	"\x1A" "gunfire on roadway, danger\0"
+	"\x0F" "civil emergency\0"
+	"\x10" "air raid, danger\0"
+	"\x19" "people on roadway. Danger\0"
+	"\x1B" "children on roadway. Danger\0"
+	"\x1B" "cyclists on roadway. Danger\0"
+	"\x1F" "closed due to security incident\0"
+	"\x1E" "security incident. Delays (%s)\0"
+	"\x27" "security incident. Delays (%s) expected\0"
+	"\x23" "security incident. Long delays (%s)\0"
+	"\x1E" "police checkpoint. Delays (%s)\0"
+	"\x27" "police checkpoint. Delays (%s) expected\0"
+	"\x23" "police checkpoint. Long delays (%s)\0"
+	"\x18" "security alert withdrawn\0"
+	"\x16" "sports traffic cleared\0"
+	"\x0A" "evacuation\0"
+	"\x19" "evacuation. Heavy traffic\0"
+	"\x1A" "traffic disruption cleared\0"
+	"\x1D" "military training in progress\0"
+	"\x17" "police activity ongoing\0"
+	"\x19" "medical emergency ongoing\0"
+	"\x1B" "child abduction in progress\0"
+	"\x0B" "major event\0"
+	"\x14" "sports event meeting\0"
+	"\x04" "show\0"
+	"\x08" "festival\0"
+	"\x0A" "exhibition\0"
+	"\x04" "fair\0"
+	"\x06" "market\0"
+	"\x10" "ceremonial event\0"
+	"\x0E" "state occasion\0"
+	"\x06" "parade\0"
+	"\x05" "crowd\0"
+	"\x05" "march\0"
+	"\x0D" "demonstration\0"
+	"\x12" "public disturbance\0"
+	"\x0E" "security alert\0"
+	"\x0A" "bomb alert\0"
+	"\x1F" "major event. Stationary traffic\0"
+	"\x29" "major event. Danger of stationary traffic\0"
+	"\x1C" "major event. Queuing traffic\0"
+	"\x26" "major event. Danger of queuing traffic\0"
+	"\x19" "major event. Slow traffic\0"
+	"\x22" "major event. Slow traffic expected\0"
+	"\x1A" "major event. Heavy traffic\0"
+	"\x23" "major event. Heavy traffic expected\0"
+	"\x23" "major event. Traffic flowing freely\0"
+	"\x20" "major event. Traffic building up\0"
+	"\x19" "closed due to major event\0"
+	"\x18" "major event. Delays (%s)\0"
+	"\x21" "major event. Delays (%s) expected\0"
+	"\x1D" "major event. Long delays (%s)\0"
+	"\x22" "sports meeting. Stationary traffic\0"
+	"\x2C" "sports meeting. Danger of stationary traffic\0"
+	"\x1F" "sports meeting. Queuing traffic\0"
+	"\x29" "sports meeting. Danger of queuing traffic\0"
+	"\x1C" "sports meeting. Slow traffic\0"
+	"\x25" "sports meeting. Slow traffic expected\0"
+	"\x1D" "sports meeting. Heavy traffic\0"
+	"\x26" "sports meeting. Heavy traffic expected\0"
+	"\x26" "sports meeting. Traffic flowing freely\0"
+	"\x23" "sports meeting. Traffic building up\0"
+	"\x1C" "closed due to sports meeting\0"
+	"\x1B" "sports meeting. Delays (%s)\0"
+	"\x24" "sports meeting. Delays (%s) expected\0"
+	"\x20" "sports meeting. Long delays (%s)\0"
+	"\x18" "fair. Stationary traffic\0"
+	"\x22" "fair. Danger of stationary traffic\0"
+	"\x15" "fair. Queuing traffic\0"
+	"\x1F" "fair. Danger of queuing traffic\0"
+	"\x12" "fair. Slow traffic\0"
+	"\x1B" "fair. Slow traffic expected\0"
+	"\x13" "fair. Heavy traffic\0"
+	"\x1C" "fair. Heavy traffic expected\0"
+	"\x1C" "fair. Traffic flowing freely\0"
+	"\x19" "fair. Traffic building up\0"
+	"\x12" "closed due to fair\0"
+	"\x11" "fair. Delays (%s)\0"
+	"\x1A" "fair. Delays (%s) expected\0"
+	"\x16" "fair. Long delays (%s)\0"
+	"\x14" "closed due to parade\0"
+	"\x13" "parade. Delays (%s)\0"
+	"\x1C" "parade. Delays (%s) expected\0"
+	"\x18" "parade. Long delays (%s)\0"
+	"\x14" "closed due to strike\0"
+	"\x13" "strike. Delays (%s)\0"
+	"\x1C" "strike. Delays (%s) expected\0"
+	"\x18" "strike. Long delays (%s)\0"
+	"\x1B" "closed due to demonstration\0"
+	"\x1A" "demonstration. Delays (%s)\0"
+	"\x23" "demonstration. Delays (%s) expected\0"
+	"\x1F" "demonstration. Long delays (%s)\0"
+	"\x22" "security alert. Stationary traffic\0"
+	"\x2C" "security alert. Danger of stationary traffic\0"
+	"\x1F" "security alert. Queuing traffic\0"
+	"\x29" "security alert. Danger of queuing traffic\0"
+	"\x1C" "security alert. Slow traffic\0"
+	"\x25" "security alert. Slow traffic expected\0"
+	"\x1D" "security alert. Heavy traffic\0"
+	"\x26" "security alert. Heavy traffic expected\0"
+	"\x23" "security alert. Traffic building up\0"
+	"\x1C" "closed due to security alert\0"
+	"\x1B" "security alert. Delays (%s)\0"
+	"\x24" "security alert. Delays (%s) expected\0"
+	"\x20" "security alert. Long delays (%s)\0"
+	"\x1E" "traffic has returned to normal\0"
+	"\x11" "message cancelled\0"
+	"\x26" "security alert. Traffic flowing freely\0"
+	"\x1A" "air raid warning cancelled\0"
+	"\x19" "civil emergency cancelled\0"
+	"\x11" "message cancelled\0"
+	"\x14" "several major events\0"
+	"\x2D" "information about major event no longer valid\0"
+	"\x0F" "automobile race\0"
+	"\x0D" "baseball game\0"
+	"\x0F" "basketball game\0"
+	"\x09" "boat race\0"
+	"\x07" "concert\0"
+	"\x0B" "hockey game\0"
+	"\x0B" "delays (%s)\0"
+	"\x17" "delays up to 15 minutes\0"
+	"\x17" "delays up to 30 minutes\0"
+	"\x15" "delays up to one hour\0"
+	"\x16" "delays up to two hours\0"
+	"\x17" "delays of several hours\0"
+	"\x14" "delays (%s) expected\0"
+	"\x10" "long delays (%s)\0"
+	"\x1E" "delays (%s) for heavy vehicles\0"
+	"\x2D" "delays up to 15 minutes for heavy lorr(y/ies)\0"
+	"\x2D" "delays up to 30 minutes for heavy lorr(y/ies)\0"
+	"\x2B" "delays up to one hour for heavy lorr(y/ies)\0"
+	"\x2C" "delays up to two hours for heavy lorr(y/ies)\0"
+	"\x2D" "delays of several hours for heavy lorr(y/ies)\0"
+	"\x1C" "service suspended (until %s)\0"
+	"\x16" "(%s) service withdrawn\0"
+	"\x1C" "(%s) service(s) fully booked\0"
+	"\x2F" "(%s) service(s) fully booked for heavy vehicles\0"
+	"\x17" "normal services resumed\0"
+	"\x11" "message cancelled\0"
+	"\x16" "delays up to 5 minutes\0"
+	"\x17" "delays up to 10 minutes\0"
+	"\x17" "delays up to 20 minutes\0"
+	"\x17" "delays up to 25 minutes\0"
+	"\x17" "delays up to 40 minutes\0"
+	"\x17" "delays up to 50 minutes\0"
+	"\x17" "delays up to 90 minutes\0"
+	"\x18" "delays up to three hours\0"
+	"\x17" "delays up to four hours\0"
+	"\x17" "delays up to five hours\0"
+	"\x15" "very long delays (%s)\0"
+	"\x1C" "delays of uncertain duration\0"
+	"\x1C" "delayed until further notice\0"
+	"\x0D" "cancellations\0"
+	"\x2E" "park and ride service not operating (until %s)\0"
+	"\x36" "special public transport services operating (until %s)\0"
+	"\x28" "normal services not operating (until %s)\0"
+	"\x26" "rail services not operating (until %s)\0"
+	"\x25" "bus services not operating (until %s)\0"
+	"\x24" "shuttle service operating (until %s)\0"
+	"\x29" "free shuttle service operating (until %s)\0"
+	"\x21" "delays (%s) for heavy lorr(y/ies)\0"
+	"\x15" "delays (%s) for buses\0"
+	"\x32" "(%s) service(s) fully booked for heavy lorr(y/ies)\0"
+	"\x26" "(%s) service(s) fully booked for buses\0"
+	"\x29" "next departure (%s) for heavy lorr(y/ies)\0"
+	"\x1D" "next departure (%s) for buses\0"
+	"\x0E" "delays cleared\0"
+	"\x2E" "rapid transit service not operating (until %s)\0"
+	"\x14" "delays (%s) possible\0"
+	"\x2C" "underground service not operating (until %s)\0"
+	"\x16" "cancellations expected\0"
+	"\x14" "long delays expected\0"
+	"\x19" "very long delays expected\0"
+	"\x24" "all services fully booked (until %s)\0"
+	"\x11" "next arrival (%s)\0"
+	"\x24" "rail services irregular. Delays (%s)\0"
+	"\x23" "bus services irregular. Delays (%s)\0"
+	"\x1E" "underground services irregular\0"
+	"\x28" "normal public transport services resumed\0"
+	"\x26" "ferry service not operating (until %s)\0"
+	"\x1C" "park and ride trip time (%s)\0"
+	"\x1C" "delay expected to be cleared\0"
+	"\x19" "demonstration by vehicles\0"
+	"\x1F" "delays (%s) have to be expected\0"
+	"\x2B" "delays of several hours have to be expected\0"
+	"\x2D" "closed ahead. Delays (%s) have to be expected\0"
+	"\x2A" "roadworks. Delays (%s) have to be expected\0"
+	"\x29" "flooding. Delays (%s) have to be expected\0"
+	"\x2C" "major event. Delays (%s) have to be expected\0"
+	"\x27" "strike. Delays (%s) have to be expected\0"
+	"\x3D" "delays of several hours for heavy lorries have to be expected\0"
+	"\x1F" "long delays have to be expected\0"
+	"\x24" "very long delays have to be expected\0"
+	"\x18" "delay forecast withdrawn\0"
+	"\x11" "message cancelled\0"
+	"\x16" "current trip time (%s)\0"
+	"\x17" "expected trip time (%s)\0"
+	"\x27" "(%s) slow moving maintenance vehicle(s)\0"
+	"\x24" "(%s) vehicle(s) on wrong carriageway\0"
+	"\x21" "dangerous vehicle warning cleared\0"
+	"\x11" "message cancelled\0"
+	"\x17" "(%s) reckless driver(s)\0"
+	"\x29" "(%s) prohibited vehicle(s) on the roadway\0"
+	"\x17" "(%s) emergency vehicles\0"
+	"\x22" "(%s) high-speed emergency vehicles\0"
+	"\x28" "high-speed chase (involving %s vehicles)\0"
+	"\x26" "spillage occurring from moving vehicle\0"
+	"\x23" "objects falling from moving vehicle\0"
+	"\x21" "emergency vehicle warning cleared\0"
+	"\x0C" "road cleared\0"
+	"\x17" "rail services irregular\0"
+	"\x27" "public transport services not operating\0"
+	"\x1D" "(%s) abnormal load(s), danger\0"
+	"\x19" "(%s) wide load(s), danger\0"
+	"\x19" "(%s) long load(s), danger\0"
+	"\x1C" "(%s) slow vehicle(s), danger\0"
+	"\x24" "(%s) track-laying vehicle(s), danger\0"
+	"\x34" "(%s) vehicle(s) carrying hazardous materials. Danger\0"
+	"\x16" "(%s) convoy(s), danger\0"
+	"\x1F" "(%s) military convoy(s), danger\0"
+	"\x1F" "(%s) overheight load(s), danger\0"
+	"\x2F" "abnormal load causing slow traffic. Delays (%s)\0"
+	"\x28" "convoy causing slow traffic. Delays (%s)\0"
+	"\x15" "(%s) abnormal load(s)\0"
+	"\x11" "(%s) wide load(s)\0"
+	"\x11" "(%s) long load(s)\0"
+	"\x14" "(%s) slow vehicle(s)\0"
+	"\x0E" "(%s) convoy(s)\0"
+	"\x1A" "abnormal load. Delays (%s)\0"
+	"\x23" "abnormal load. Delays (%s) expected\0"
+	"\x1F" "abnormal load. Long delays (%s)\0"
+	"\x1A" "convoy causing delays (%s)\0"
+	"\x1C" "convoy. Delays (%s) expected\0"
+	"\x1F" "convoy causing long delays (%s)\0"
+	"\x20" "exceptional load warning cleared\0"
+	"\x11" "message cancelled\0"
+	"\x1C" "(%s) track-laying vehicle(s)\0"
+	"\x2C" "(%s) vehicle(s) carrying hazardous materials\0"
+	"\x17" "(%s) military convoy(s)\0"
+	"\x24" "(%s) abnormal load(s). No overtaking\0"
+	"\x46" "Vehicles carrying hazardous materials have to stop at next safe place!\0"
+	"\x1E" "hazardous load warning cleared\0"
+	"\x0E" "convoy cleared\0"
+	"\x0F" "warning cleared\0"
+	"\x21" "cancellations have to be expected\0"
+	"\x24" "all services fully booked (until %s)\0"
+	"\x36" "park and ride service will not be operating (until %s)\0"
+	"\x30" "normal services will not be operating (until %s)\0"
+	"\x2E" "rail services will not be operating (until %s)\0"
+	"\x36" "rapid transit service will not be operating (until %s)\0"
+	"\x34" "underground service will not be operating (until %s)\0"
+	"\x22" "public transport will be on strike\0"
+	"\x2E" "ferry service will not be operating (until %s)\0"
+	"\x18" "normal services expected\0"
+	"\x11" "message cancelled\0"
+	"\x1E" "lane control signs not working\0"
+	"\x20" "emergency telephones not working\0"
+	"\x26" "emergency telephone number not working\0"
+	"\x27" "(%s sets of) traffic lights not working\0"
+	"\x2F" "(%s sets of) traffic lights working incorrectly\0"
+	"\x16" "level crossing failure\0"
+	"\x3B" "(%s sets of) traffic lights not working. Stationary traffic\0"
+	"\x45" "(%s sets of) traffic lights not working. Danger of stationary traffic\0"
+	"\x38" "(%s sets of) traffic lights not working. Queuing traffic\0"
+	"\x42" "(%s sets of) traffic lights not working. Danger of queuing traffic\0"
+	"\x35" "(%s sets of) traffic lights not working. Slow traffic\0"
+	"\x3E" "(%s sets of) traffic lights not working. Slow traffic expected\0"
+	"\x36" "(%s sets of) traffic lights not working. Heavy traffic\0"
+	"\x3F" "(%s sets of) traffic lights not working. Heavy traffic expected\0"
+	"\x3F" "(%s sets of) traffic lights not working. Traffic flowing freely\0"
+	"\x3C" "(%s sets of) traffic lights not working. Traffic building up\0"
+	"\x27" "traffic lights not working. Delays (%s)\0"
+	"\x30" "traffic lights not working. Delays (%s) expected\0"
+	"\x2C" "traffic lights not working. Long delays (%s)\0"
+	"\x2A" "level crossing failure. Stationary traffic\0"
+	"\x34" "level crossing failure. Danger of stationary traffic\0"
+	"\x27" "level crossing failure. Queuing traffic\0"
+	"\x31" "level crossing failure. Danger of queuing traffic\0"
+	"\x24" "level crossing failure. Slow traffic\0"
+	"\x2D" "level crossing failure. Slow traffic expected\0"
+	"\x25" "level crossing failure. Heavy traffic\0"
+	"\x2E" "level crossing failure. Heavy traffic expected\0"
+	"\x2E" "level crossing failure. Traffic flowing freely\0"
+	"\x2B" "level crossing failure. Traffic building up\0"
+	"\x23" "level crossing failure. Delays (%s)\0"
+	"\x2C" "level crossing failure. Delays (%s) expected\0"
+	"\x28" "level crossing failure. Long delays (%s)\0"
+	"\x19" "electronic signs repaired\0"
+	"\x22" "emergency call facilities restored\0"
+	"\x18" "traffic signals repaired\0"
+	"\x23" "level crossing now working normally\0"
+	"\x11" "message cancelled\0"
+	"\x26" "lane control signs working incorrectly\0"
+	"\x1C" "lane control signs operating\0"
+	"\x22" "variable message signs not working\0"
+	"\x2A" "variable message signs working incorrectly\0"
+	"\x20" "variable message signs operating\0"
+	"\x2D" "(%s sets of) ramp control signals not working\0"
+	"\x35" "(%s sets of) ramp control signals working incorrectly\0"
+	"\x31" "(%s sets of) temporary traffic lights not working\0"
+	"\x39" "(%s sets of) temporary traffic lights working incorrectly\0"
+	"\x2B" "traffic signal control computer not working\0"
+	"\x1E" "traffic signal timings changed\0"
+	"\x1E" "tunnel ventilation not working\0"
+	"\x26" "lane control signs not working. Danger\0"
+	"\x1A" "temporary width limit (%s)\0"
+	"\x1C" "temporary width limit lifted\0"
+	"\x25" "traffic regulations have been changed\0"
+	"\x25" "less than 50 parking spaces available\0"
+	"\x2B" "no parking information available (until %s)\0"
+	"\x11" "message cancelled\0"
+	"\x17" "Snowplough. Delays (%s)\0"
+	"\x1B" "temporary height limit (%s)\0"
+	"\x1D" "temporary height limit lifted\0"
+	"\x28" "(%s) automatic payment lanes not working\0"
+	"\x2E" "lane control signs working incorrectly. Danger\0"
+	"\x44" "emergency telephones out of order. Extra police patrols in operation\0"
+	"\x47" "emergency telephones out of order. In emergency, wait for police patrol\0"
+	"\x2F" "(%s sets of) traffic lights not working. Danger\0"
+	"\x2F" "traffic lights working incorrectly. Delays (%s)\0"
+	"\x38" "traffic lights working incorrectly. Delays (%s) expected\0"
+	"\x34" "traffic lights working incorrectly. Long delays (%s)\0"
+	"\x1E" "temporary axle load limit (%s)\0"
+	"\x21" "temporary gross weight limit (%s)\0"
+	"\x23" "temporary gross weight limit lifted\0"
+	"\x22" "temporary axle weight limit lifted\0"
+	"\x37" "(%s sets of) traffic lights working incorrectly. Danger\0"
+	"\x31" "temporary traffic lights not working. Delays (%s)\0"
+	"\x3A" "temporary traffic lights not working. Delays (%s) expected\0"
+	"\x36" "temporary traffic lights not working. Long delays (%s)\0"
+	"\x39" "(%s sets of) temporary traffic lights not working. Danger\0"
+	"\x38" "traffic signal control computer not working. Delays (%s)\0"
+	"\x1B" "temporary length limit (%s)\0"
+	"\x1D" "temporary length limit lifted\0"
+	"\x11" "message cancelled\0"
+	"\x41" "traffic signal control computer not working. Delays (%s) expected\0"
+	"\x3D" "traffic signal control computer not working. Long delays (%s)\0"
+	"\x22" "normal parking restrictions lifted\0"
+	"\x25" "special parking restrictions in force\0"
+	"\x08" "10% full\0"
+	"\x08" "20% full\0"
+	"\x08" "30% full\0"
+	"\x08" "40% full\0"
+	"\x08" "50% full\0"
+	"\x08" "60% full\0"
+	"\x08" "70% full\0"
+	"\x08" "80% full\0"
+	"\x08" "90% full\0"
+	"\x25" "less than 10 parking spaces available\0"
+	"\x25" "less than 20 parking spaces available\0"
+	"\x25" "less than 30 parking spaces available\0"
+	"\x25" "less than 40 parking spaces available\0"
+	"\x13" "next departure (%s)\0"
+	"\x26" "next departure (%s) for heavy vehicles\0"
+	"\x12" "car park (%s) full\0"
+	"\x17" "all car parks (%s) full\0"
+	"\x2B" "less than (%s) car parking spaces available\0"
+	"\x2A" "park and ride service operating (until %s)\0"
+	"\x0C" "(null event)\0"
+	"\x1D" "switch your car radio (to %s)\0"
+	"\x57" "alarm call: important new information on this frequency follows now in normal programme\0"
+	"\x54" "alarm set: new information will be broadcast between these times in normal programme\0"
+	"\x11" "message cancelled\0"
+	"\x1D" "switch your car radio (to %s)\0"
+	"\x23" "no information available (until %s)\0"
+	"\x41" "this message is for test purposes only (number %s), please ignore\0"
+	"\x3D" "no information available (until %s) due to technical problems\0"
+	"\x2F" "automatic toll system not working, pay manually\0"
+	"\x04" "full\0"
+	"\x23" "only a few parking spaces available\0"
+	"\x1D" "(%s) parking spaces available\0"
+	"\x1A" "expect car park to be full\0"
+	"\x22" "expect no parking spaces available\0"
+	"\x1A" "multi story car parks full\0"
+	"\x31" "no problems to report with park and ride services\0"
+	"\x1B" "no parking spaces available\0"
+	"\x15" "no parking (until %s)\0"
+	"\x23" "special parking restrictions lifted\0"
+	"\x47" "urgent information will be given (at %s) on normal programme broadcasts\0"
+	"\x29" "this TMC-service is not active (until %s)\0"
+	"\x49" "detailed information will be given (at %s) on normal programme broadcasts\0"
+	"\x37" "detailed information is provided by another TMC service\0"
+	"\x31" "no park and ride information available (until %s)\0"
+	"\x29" "park and ride information service resumed\0"
+	"\x2F" "travel information telephone service availiable\0"
+	"\x42" "additional regional information is provided by another TMC service\0"
+	"\x3F" "additional local information is provided by another TMC service\0"
+	"\x4A" "additional public transport information is provided by another TMC service\0"
+	"\x3F" "national traffic information is provided by another TMC service\0"
+	"\x2C" "this service provides major road information\0"
+	"\x31" "this service provides regional travel information\0"
+	"\x2E" "this service provides local travel information\0"
+	"\x39" "no detailed regional information provided by this service\0"
+	"\x36" "no detailed local information provided by this service\0"
+	"\x34" "no cross-border information provided by this service\0"
+	"\x23" "information restricted to this area\0"
+	"\x2F" "no new traffic information available (until %s)\0"
+	"\x29" "no public transport information available\0"
+	"\x2B" "this TMC-service is being suspended (at %s)\0"
+	"\x26" "active TMC-service will resume (at %s)\0"
+	"\x2D" "reference to audio programmes no longer valid\0"
+	"\x2F" "reference to other TMC services no longer valid\0"
+	"\x46" "previous announcement about this or other TMC services no longer valid\0"
+	"\x34" "allow emergency vehicles to pass in the carpool lane\0"
+	"\x27" "carpool lane available for all vehicles\0"
+	"\x2D" "police directing traffic via the carpool lane\0"
+	"\x26" "rail information service not available\0"
+	"\x20" "rail information service resumed\0"
+	"\x2F" "rapid transit information service not available\0"
+	"\x29" "rapid transit information service resumed\0"
+	"\x18" "police directing traffic\0"
+	"\x22" "buslane available for all vehicles\0"
+	"\x28" "police directing traffic via the buslane\0"
+	"\x20" "allow emergency vehicles to pass\0"
+	"\x32" "overtaking prohibited for heavy vehicles (over %s)\0"
+	"\x15" "overtaking prohibited\0"
+	"\x3A" "allow emergency vehicles to pass in the heavy vehicle lane\0"
+	"\x2D" "heavy vehicle lane available for all vehicles\0"
+	"\x33" "police directing traffic via the heavy vehicle lane\0"
+	"\x31" "overtaking prohibited for heavy lorries (over %s)\0"
+	"\x4D" "drivers of heavy lorries (over %s) are recommended to stop at next safe place\0"
+	"\x0E" "buslane closed\0"
+	"\x0D" "power failure\0"
+	"\x1D" "overtaking restriction lifted\0"
+	"\x26" "Low Emission Zone restriction in force\0"
+	"\x1A" "car park closed (until %s)\0"
+	"\x25" "danger of waiting vehicles on roadway\0"
+	"\x23" "number of parking spaces decreasing\0"
+	"\x21" "number of parking spaces constant\0"
+	"\x23" "number of parking spaces increasing\0"
+	"\x25" "dangerous situation on exit slip road\0"
+	"\x26" "dangerous situation on entry slip road\0"
+	"\x23" "closed due to smog alert (until %s)\0"
+	"\x32" "closed for vehicles with less than three occupants\0"
+	"\x2A" "closed for vehicles with only one occupant\0"
+	"\x11" "service area busy\0"
+	"\x33" "service not operating, substitute service available\0"
+	"\x17" "public transport strike\0"
+	"\x11" "message cancelled\0"
+	"\x11" "message cancelled\0"
+	"\x11" "message cancelled\0"
+	"\x11" "message cancelled\0"
+	"\x11" "message cancelled\0"
+	"\x11" "message cancelled\0"
+	"\x11" "message cancelled\0"
+	"\x11" "message cancelled\0"
+	"\x11" "message cancelled\0"
+	"\x11" "message cancelled\0"
+	"\x11" "nothing to report\0"
+	"\x1F" "ice build-up on cable structure\0"
+	"\x0B" "road salted\0"
+	"\x16" "danger of snow patches\0"
+	"\x0C" "snow patches\0"
+	"\x2A" "Convoy service required due to bad weather\0"
+	"\x0E" "(null message)\0"
+	;
+#endif
+#endif
+
+const TRDSTMCEventListEntry ISO14819_2_Events[ISO14819_2_EVENTS_COUNT] PROGMEM = {
+	{0x0001, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x0000, 0x0000)},
+	{0x0002, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x0011, 0x0004)},
+	{0x000B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 4 RDS_TMC_EVENT_STRING(0x0059, 0x0008)},
+	{0x000C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 3 RDS_TMC_EVENT_STRING(0x007E, 0x001A)},
+	{0x0010, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x00BD, 0x002C)},
+	{0x0014, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 9 RDS_TMC_EVENT_STRING(0x00EB, 0x003D)},
+	{0x0016, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 9 RDS_TMC_EVENT_STRING(0x0124, 0x0052)},
+	{0x0017, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 9 RDS_TMC_EVENT_STRING(0x0147, 0x005D)},
+	{0x0018, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 9 RDS_TMC_EVENT_STRING(0x0168, 0x0069)},
+	{0x0019, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 9 RDS_TMC_EVENT_STRING(0x0177, 0x006D)},
+	{0x001A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 6 RDS_TMC_EVENT_STRING(0x0186, 0x0074)},
+	{0x001B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 6 RDS_TMC_EVENT_STRING(0x0196, 0x0078)},
+	{0x001C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9 RDS_TMC_EVENT_STRING(0x01A6, 0x007F)},
+	{0x0024, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 9 RDS_TMC_EVENT_STRING(0x01C2, 0x008D)},
+	{0x0025, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 9 RDS_TMC_EVENT_STRING(0x01D9, 0x0096)},
+	{0x0027, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 39 RDS_TMC_EVENT_STRING(0x01EE, 0x00A0)},
+	{0x0028, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 9 RDS_TMC_EVENT_STRING(0x0211, 0x00AB)},
+	{0x0029, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x0223, 0x00B4)},
+	{0x002A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x0243, 0x00BB)},
+	{0x0033, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x0264, 0x00C2)},
+	{0x0034, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11 RDS_TMC_EVENT_STRING(0x028F, 0x00CB)},
+	{0x0035, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11 RDS_TMC_EVENT_STRING(0x02BC, 0x00D6)},
+	{0x0037, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2 RDS_TMC_EVENT_STRING(0x02EA, 0x00DE)},
+	{0x0038, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2 RDS_TMC_EVENT_STRING(0x0304, 0x00E3)},
+	{0x0039, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2 RDS_TMC_EVENT_STRING(0x0321, 0x00E7)},
+	{0x003D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12 RDS_TMC_EVENT_STRING(0x033A, 0x00EF)},
+	{0x003E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 12 RDS_TMC_EVENT_STRING(0x0355, 0x00F7)},
+	{0x003F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12 RDS_TMC_EVENT_STRING(0x0369, 0x00FF)},
+	{0x0040, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12 RDS_TMC_EVENT_STRING(0x038D, 0x0108)},
+	{0x0046, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x03A1, 0x010F)},
+	{0x0047, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x03CF, 0x0115)},
+	{0x0048, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x03FD, 0x011B)},
+	{0x0049, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x042B, 0x0121)},
+	{0x004A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x0459, 0x0127)},
+	{0x004B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x0487, 0x012D)},
+	{0x004C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x04B5, 0x0133)},
+	{0x0050, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, false, 32 RDS_TMC_EVENT_STRING(0x04E3, 0x0139)},
+	{0x0051, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 32 RDS_TMC_EVENT_STRING(0x0505, 0x0140)},
+	{0x0052, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, false, 32 RDS_TMC_EVENT_STRING(0x052C, 0x0148)},
+	{0x0053, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 32 RDS_TMC_EVENT_STRING(0x0566, 0x014C)},
+	{0x0054, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, false, 32 RDS_TMC_EVENT_STRING(0x058C, 0x014F)},
+	{0x0055, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, false, 32 RDS_TMC_EVENT_STRING(0x05BB, 0x0153)},
+	{0x0056, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, false, 32 RDS_TMC_EVENT_STRING(0x05ED, 0x0157)},
+	{0x0057, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, false, 32 RDS_TMC_EVENT_STRING(0x0615, 0x015B)},
+	{0x0058, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, false, 32 RDS_TMC_EVENT_STRING(0x0643, 0x0164)},
+	{0x0059, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 32 RDS_TMC_EVENT_STRING(0x066A, 0x0169)},
+	{0x005B, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0x067D, 0x016B)},
+	{0x0065, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x0693, 0x0171)},
+	{0x0066, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x06A7, 0x0174)},
+	{0x0067, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x06C4, 0x0179)},
+	{0x0068, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x06E1, 0x017E)},
+	{0x0069, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x06FE, 0x0183)},
+	{0x006A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x071B, 0x0188)},
+	{0x006B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2 RDS_TMC_EVENT_STRING(0x0739, 0x018D)},
+	{0x006C, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x0756, 0x0191)},
+	{0x006D, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x0780, 0x0194)},
+	{0x006E, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x07B3, 0x019A)},
+	{0x006F, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x07E6, 0x01A0)},
+	{0x0070, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x0819, 0x01A6)},
+	{0x0071, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x084C, 0x01AC)},
+	{0x0072, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2 RDS_TMC_EVENT_STRING(0x0880, 0x01B2)},
+	{0x0073, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x089A, 0x01B6)},
+	{0x0074, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x08C1, 0x01BA)},
+	{0x0075, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x08F1, 0x01C0)},
+	{0x0076, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x0921, 0x01C6)},
+	{0x0077, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x0951, 0x01CC)},
+	{0x0078, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x0981, 0x01D2)},
+	{0x0079, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2 RDS_TMC_EVENT_STRING(0x09B2, 0x01D8)},
+	{0x007A, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x09C9, 0x01DC)},
+	{0x007B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2 RDS_TMC_EVENT_STRING(0x09F1, 0x01E2)},
+	{0x007C, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1 RDS_TMC_EVENT_STRING(0x0A09, 0x01E8)},
+	{0x007D, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x0A3A, 0x01EF)},
+	{0x007E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1 RDS_TMC_EVENT_STRING(0x0A68, 0x01F4)},
+	{0x007F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1 RDS_TMC_EVENT_STRING(0x0A7F, 0x01FE)},
+	{0x0080, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x0A9B, 0x0203)},
+	{0x0081, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x0AAE, 0x0205)},
+	{0x0082, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x0ACB, 0x020A)},
+	{0x0083, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x0AE9, 0x020E)},
+	{0x0084, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x0B1C, 0x0214)},
+	{0x0085, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x0B50, 0x0218)},
+	{0x0086, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x0B76, 0x0222)},
+	{0x0087, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1 RDS_TMC_EVENT_STRING(0x0BA6, 0x0228)},
+	{0x0088, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x0BB6, 0x022E)},
+	{0x0089, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x0BE3, 0x0232)},
+	{0x008A, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x0C19, 0x0240)},
+	{0x008B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x0C57, 0x0250)},
+	{0x008C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x0C82, 0x0262)},
+	{0x008D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 3 RDS_TMC_EVENT_STRING(0x0CAC, 0x0274)},
+	{0x008E, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x0CDA, 0x0288)},
+	{0x008F, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x0D10, 0x0295)},
+	{0x00C8, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0x0D50, 0x02A9)},
+	{0x00C9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 3 RDS_TMC_EVENT_STRING(0x0D74, 0x02B7)},
+	{0x00CA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3 RDS_TMC_EVENT_STRING(0x0D86, 0x02B9)},
+	{0x00CB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3 RDS_TMC_EVENT_STRING(0x0DA0, 0x02BF)},
+	{0x00CC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3 RDS_TMC_EVENT_STRING(0x0DD0, 0x02D1)},
+	{0x00CD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3 RDS_TMC_EVENT_STRING(0x0DFD, 0x02DE)},
+	{0x00CE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3 RDS_TMC_EVENT_STRING(0x0E2D, 0x02E7)},
+	{0x00CF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3 RDS_TMC_EVENT_STRING(0x0E4D, 0x02F0)},
+	{0x00D0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1 RDS_TMC_EVENT_STRING(0x0E71, 0x02FC)},
+	{0x00D1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 3 RDS_TMC_EVENT_STRING(0x0E9F, 0x02FE)},
+	{0x00D2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 12 RDS_TMC_EVENT_STRING(0x0EC7, 0x030A)},
+	{0x00D3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 4 RDS_TMC_EVENT_STRING(0x0EDA, 0x030C)},
+	{0x00D4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 4 RDS_TMC_EVENT_STRING(0x0EF7, 0x030E)},
+	{0x00D5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 3 RDS_TMC_EVENT_STRING(0x0F1B, 0x0313)},
+	{0x00D6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 4 RDS_TMC_EVENT_STRING(0x0F31, 0x031A)},
+	{0x00D7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x0F43, 0x031F)},
+	{0x00D8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x0F69, 0x0322)},
+	{0x00D9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x0F98, 0x0326)},
+	{0x00DA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x0FC7, 0x032A)},
+	{0x00DB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x0FF6, 0x032E)},
+	{0x00DC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1025, 0x0332)},
+	{0x00DD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1055, 0x0336)},
+	{0x00DE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1085, 0x0339)},
+	{0x00DF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x10A8, 0x033C)},
+	{0x00E0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x10D4, 0x0340)},
+	{0x00E1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1100, 0x0344)},
+	{0x00E2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x112C, 0x0348)},
+	{0x00E3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1158, 0x034C)},
+	{0x00E4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1185, 0x0350)},
+	{0x00E5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x11B2, 0x0353)},
+	{0x00E6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x11D2, 0x0356)},
+	{0x00E7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x11FB, 0x035A)},
+	{0x00E8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1224, 0x035E)},
+	{0x00E9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x124D, 0x0362)},
+	{0x00EA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1276, 0x0366)},
+	{0x00EB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2 RDS_TMC_EVENT_STRING(0x12A0, 0x036A)},
+	{0x00EC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x12C9, 0x036D)},
+	{0x00ED, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2 RDS_TMC_EVENT_STRING(0x12EA, 0x0370)},
+	{0x00EE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1 RDS_TMC_EVENT_STRING(0x1314, 0x0373)},
+	{0x00EF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x133E, 0x0376)},
+	{0x00F0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x1365, 0x0379)},
+	{0x00F1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x138A, 0x037D)},
+	{0x00F2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x13B0, 0x0381)},
+	{0x00F3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x13D7, 0x0385)},
+	{0x00F4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x13FC, 0x0389)},
+	{0x00F5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x1425, 0x038E)},
+	{0x00F6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x144A, 0x0392)},
+	{0x00F7, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0x1471, 0x0396)},
+	{0x00F8, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0x1488, 0x039A)},
+	{0x00F9, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0x14A8, 0x039E)},
+	{0x00FA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x14C4, 0x03A2)},
+	{0x00FB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1506, 0x03A5)},
+	{0x00FC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1551, 0x03A9)},
+	{0x00FD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x159C, 0x03AD)},
+	{0x00FE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x15E7, 0x03B1)},
+	{0x00FF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1632, 0x03B5)},
+	{0x0100, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x167E, 0x03B9)},
+	{0x0101, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x16CA, 0x03BC)},
+	{0x0102, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1709, 0x03BF)},
+	{0x0103, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1751, 0x03C3)},
+	{0x0104, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1799, 0x03C7)},
+	{0x0105, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x17E1, 0x03CB)},
+	{0x0106, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1829, 0x03CF)},
+	{0x0107, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1872, 0x03D3)},
+	{0x0108, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x18BB, 0x03D6)},
+	{0x0109, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x18F7, 0x03D9)},
+	{0x010A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x193C, 0x03DD)},
+	{0x010B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1981, 0x03E1)},
+	{0x010C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x19C6, 0x03E5)},
+	{0x010D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1A0B, 0x03E9)},
+	{0x010E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2 RDS_TMC_EVENT_STRING(0x1A51, 0x03ED)},
+	{0x010F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1A96, 0x03F0)},
+	{0x0110, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2 RDS_TMC_EVENT_STRING(0x1AD3, 0x03F3)},
+	{0x0112, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1B19, 0x03F6)},
+	{0x0113, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0x1B5C, 0x03F9)},
+	{0x0114, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0x1B8F, 0x03FF)},
+	{0x0115, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0x1BCB, 0x0405)},
+	{0x0116, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1C03, 0x040B)},
+	{0x0117, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1C2A, 0x040E)},
+	{0x0118, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1C5A, 0x0412)},
+	{0x0119, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1C8A, 0x0416)},
+	{0x011A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1CBA, 0x041A)},
+	{0x011B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1CEA, 0x041E)},
+	{0x011C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1D1B, 0x0422)},
+	{0x011D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1D4C, 0x0425)},
+	{0x011E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1D70, 0x0428)},
+	{0x011F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1D9D, 0x042C)},
+	{0x0120, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1DCA, 0x0430)},
+	{0x0121, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1DF7, 0x0434)},
+	{0x0122, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1E24, 0x0438)},
+	{0x0123, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1E52, 0x043C)},
+	{0x0124, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1E80, 0x043F)},
+	{0x0125, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1EA1, 0x0442)},
+	{0x0126, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1ECB, 0x0446)},
+	{0x0127, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1EF5, 0x044A)},
+	{0x0128, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1F1F, 0x044E)},
+	{0x0129, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1F49, 0x0452)},
+	{0x012A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2 RDS_TMC_EVENT_STRING(0x1F74, 0x0456)},
+	{0x012B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x1F9E, 0x0459)},
+	{0x012C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2 RDS_TMC_EVENT_STRING(0x1FC0, 0x045C)},
+	{0x012D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1 RDS_TMC_EVENT_STRING(0x1FEB, 0x045F)},
+	{0x012E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x2016, 0x0462)},
+	{0x012F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x203E, 0x0465)},
+	{0x0130, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x205C, 0x0469)},
+	{0x0131, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x2083, 0x046D)},
+	{0x0132, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x20AB, 0x0471)},
+	{0x0133, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x20D1, 0x0475)},
+	{0x0134, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x20FB, 0x047A)},
+	{0x0135, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x2121, 0x047E)},
+	{0x0136, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0x2149, 0x0482)},
+	{0x0137, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0x2161, 0x0488)},
+	{0x0138, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0x2182, 0x048E)},
+	{0x0139, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x219F, 0x0494)},
+	{0x013A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x21D0, 0x0497)},
+	{0x013B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x220B, 0x049A)},
+	{0x013C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x2239, 0x049D)},
+	{0x013D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x2271, 0x04A0)},
+	{0x013E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2 RDS_TMC_EVENT_STRING(0x229C, 0x04A3)},
+	{0x013F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x22D0, 0x04A6)},
+	{0x0140, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2 RDS_TMC_EVENT_STRING(0x22FC, 0x04A9)},
+	{0x0141, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1 RDS_TMC_EVENT_STRING(0x2331, 0x04AC)},
+	{0x0142, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x2366, 0x04AF)},
+	{0x0143, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x2397, 0x04B5)},
+	{0x0144, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x23C0, 0x04BA)},
+	{0x0145, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x23F1, 0x04BE)},
+	{0x0146, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x2423, 0x04C2)},
+	{0x0147, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x2453, 0x04C6)},
+	{0x0148, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x2487, 0x04CB)},
+	{0x0149, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x24B7, 0x04CF)},
+	{0x014A, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0x24E9, 0x04D3)},
+	{0x014B, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0x250B, 0x04D8)},
+	{0x014C, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0x2536, 0x04DD)},
+	{0x014D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 3 RDS_TMC_EVENT_STRING(0x255D, 0x04E2)},
+	{0x014E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 3 RDS_TMC_EVENT_STRING(0x256F, 0x04E6)},
+	{0x014F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3 RDS_TMC_EVENT_STRING(0x2582, 0x04E8)},
+	{0x0150, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3 RDS_TMC_EVENT_STRING(0x25A5, 0x04F8)},
+	{0x0151, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 3 RDS_TMC_EVENT_STRING(0x25C4, 0x0501)},
+	{0x0152, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3 RDS_TMC_EVENT_STRING(0x25E0, 0x0503)},
+	{0x0153, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3 RDS_TMC_EVENT_STRING(0x2603, 0x0508)},
+	{0x0154, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3 RDS_TMC_EVENT_STRING(0x261F, 0x0517)},
+	{0x0155, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3 RDS_TMC_EVENT_STRING(0x263B, 0x0527)},
+	{0x0156, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 3 RDS_TMC_EVENT_STRING(0x2664, 0x053C)},
+	{0x0157, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 3 RDS_TMC_EVENT_STRING(0x2681, 0x0547)},
+	{0x0158, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 3 RDS_TMC_EVENT_STRING(0x269B, 0x054A)},
+	{0x0159, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 3 RDS_TMC_EVENT_STRING(0x26B8, 0x0556)},
+	{0x015A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 4 RDS_TMC_EVENT_STRING(0x26D4, 0x055F)},
+	{0x015B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 24 RDS_TMC_EVENT_STRING(0x26EE, 0x0567)},
+	{0x015C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x270A, 0x056E)},
+	{0x015D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x2739, 0x0572)},
+	{0x015E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x2765, 0x0576)},
+	{0x015F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3 RDS_TMC_EVENT_STRING(0x278E, 0x057A)},
+	{0x0160, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x27B2, 0x0583)},
+	{0x0161, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x27FD, 0x0587)},
+	{0x0162, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x2845, 0x058B)},
+	{0x0163, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 1 RDS_TMC_EVENT_STRING(0x288A, 0x058F)},
+	{0x0164, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x28C0, 0x0592)},
+	{0x0165, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x28F0, 0x0596)},
+	{0x0166, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x291D, 0x059A)},
+	{0x0167, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12 RDS_TMC_EVENT_STRING(0x2947, 0x059E)},
+	{0x0168, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x2962, 0x05A1)},
+	{0x0169, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x2992, 0x05A4)},
+	{0x016A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x29CC, 0x05A7)},
+	{0x016B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x29F9, 0x05AA)},
+	{0x016C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x2A30, 0x05AD)},
+	{0x016D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2 RDS_TMC_EVENT_STRING(0x2A5A, 0x05B0)},
+	{0x016E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x2A8D, 0x05B3)},
+	{0x016F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2 RDS_TMC_EVENT_STRING(0x2AB8, 0x05B6)},
+	{0x0170, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x2AEC, 0x05B9)},
+	{0x0171, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x2B1D, 0x05BC)},
+	{0x0172, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x2B44, 0x05C0)},
+	{0x0173, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x2B74, 0x05C4)},
+	{0x0174, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x2BA5, 0x05C8)},
+	{0x0175, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x2BD4, 0x05CC)},
+	{0x0176, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x2C03, 0x05D0)},
+	{0x0177, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0x2C34, 0x05D4)},
+	{0x0178, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0x2C55, 0x05DB)},
+	{0x0179, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0x2C7F, 0x05E2)},
+	{0x017A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3 RDS_TMC_EVENT_STRING(0x2CA5, 0x05E9)},
+	{0x017B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x2CC9, 0x05EC)},
+	{0x017C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x2CFD, 0x05F2)},
+	{0x017D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x2D3B, 0x05FC)},
+	{0x017E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x2D6C, 0x0601)},
+	{0x017F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x2DA7, 0x060B)},
+	{0x0181, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x2DD5, 0x0611)},
+	{0x0183, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x2E04, 0x0617)},
+	{0x0184, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0x2E39, 0x061D)},
+	{0x0186, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0x2E5E, 0x0627)},
+	{0x0187, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 3 RDS_TMC_EVENT_STRING(0x2E88, 0x0634)},
+	{0x0188, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3 RDS_TMC_EVENT_STRING(0x2EAD, 0x0641)},
+	{0x0189, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 4 RDS_TMC_EVENT_STRING(0x2ED1, 0x064B)},
+	{0x018A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 4 RDS_TMC_EVENT_STRING(0x2EF6, 0x064E)},
+	{0x018B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 4 RDS_TMC_EVENT_STRING(0x2F22, 0x0654)},
+	{0x018C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 4 RDS_TMC_EVENT_STRING(0x2F30, 0x0657)},
+	{0x018D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 4 RDS_TMC_EVENT_STRING(0x2F42, 0x065D)},
+	{0x018F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 8 RDS_TMC_EVENT_STRING(0x2F68, 0x066C)},
+	{0x0191, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 5 RDS_TMC_EVENT_STRING(0x2F7B, 0x066E)},
+	{0x0192, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x2F83, 0x0670)},
+	{0x0193, RDS_TMC_QUANTIFIER_TONNES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 9 RDS_TMC_EVENT_STRING(0x2F8C, 0x0672)},
+	{0x0194, RDS_TMC_QUANTIFIER_TONNES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 9 RDS_TMC_EVENT_STRING(0x2FB1, 0x0679)},
+	{0x0195, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 9 RDS_TMC_EVENT_STRING(0x2FE1, 0x0685)},
+	{0x0196, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 8 RDS_TMC_EVENT_STRING(0x2FF5, 0x068D)},
+	{0x0197, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 7 RDS_TMC_EVENT_STRING(0x3015, 0x0695)},
+	{0x0198, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 7 RDS_TMC_EVENT_STRING(0x3034, 0x069D)},
+	{0x0199, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 7 RDS_TMC_EVENT_STRING(0x3047, 0x06A2)},
+	{0x019A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x305F, 0x06A9)},
+	{0x019B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x3081, 0x06AC)},
+	{0x019C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x30AC, 0x06B0)},
+	{0x019D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x30D7, 0x06B4)},
+	{0x019E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x3102, 0x06B8)},
+	{0x019F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x312D, 0x06BC)},
+	{0x01A0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x3159, 0x06C0)},
+	{0x01A1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x3185, 0x06C3)},
+	{0x01A2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x31A4, 0x06C6)},
+	{0x01A3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x31CC, 0x06CA)},
+	{0x01A4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x31F4, 0x06CE)},
+	{0x01A5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x321C, 0x06D2)},
+	{0x01A6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x3244, 0x06D6)},
+	{0x01A7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x326D, 0x06DA)},
+	{0x01A8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x3296, 0x06DD)},
+	{0x01A9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x32B2, 0x06E0)},
+	{0x01AA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x32D7, 0x06E4)},
+	{0x01AB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x32FC, 0x06E8)},
+	{0x01AC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x3321, 0x06EC)},
+	{0x01AD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x3346, 0x06F0)},
+	{0x01AE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2 RDS_TMC_EVENT_STRING(0x336C, 0x06F4)},
+	{0x01AF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x3391, 0x06F7)},
+	{0x01B0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2 RDS_TMC_EVENT_STRING(0x33AE, 0x06FA)},
+	{0x01B1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 1 RDS_TMC_EVENT_STRING(0x33D4, 0x06FD)},
+	{0x01B2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x33FA, 0x0700)},
+	{0x01B3, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0x341D, 0x0703)},
+	{0x01B4, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0x3438, 0x0706)},
+	{0x01B5, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0x345C, 0x0709)},
+	{0x01B6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x347C, 0x070C)},
+	{0x01B7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x349F, 0x070F)},
+	{0x01B8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x34CB, 0x0713)},
+	{0x01B9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x34F7, 0x0717)},
+	{0x01BA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x3523, 0x071B)},
+	{0x01BB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x354F, 0x071F)},
+	{0x01BC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x357C, 0x0723)},
+	{0x01BD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x35A9, 0x0726)},
+	{0x01BE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x35C9, 0x0729)},
+	{0x01BF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x35F2, 0x072D)},
+	{0x01C0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x361B, 0x0731)},
+	{0x01C1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x3644, 0x0735)},
+	{0x01C2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x366D, 0x0739)},
+	{0x01C3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x3697, 0x073D)},
+	{0x01C4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x36C1, 0x0740)},
+	{0x01C5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x36DE, 0x0743)},
+	{0x01C6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x3704, 0x0747)},
+	{0x01C7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x372A, 0x074B)},
+	{0x01C8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x3750, 0x074F)},
+	{0x01C9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x3776, 0x0753)},
+	{0x01CA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2 RDS_TMC_EVENT_STRING(0x379D, 0x0757)},
+	{0x01CB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x37C3, 0x075A)},
+	{0x01CC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2 RDS_TMC_EVENT_STRING(0x37E1, 0x075D)},
+	{0x01CD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 1 RDS_TMC_EVENT_STRING(0x3808, 0x0760)},
+	{0x01CE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x382F, 0x0763)},
+	{0x01CF, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0x3853, 0x0766)},
+	{0x01D0, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0x386F, 0x0769)},
+	{0x01D1, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0x3894, 0x076C)},
+	{0x01D2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 7 RDS_TMC_EVENT_STRING(0x38B5, 0x076F)},
+	{0x01D3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 5 RDS_TMC_EVENT_STRING(0x38CA, 0x0775)},
+	{0x01D4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 9 RDS_TMC_EVENT_STRING(0x38D4, 0x0778)},
+	{0x01D5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 9 RDS_TMC_EVENT_STRING(0x38E7, 0x077A)},
+	{0x01D6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9 RDS_TMC_EVENT_STRING(0x38F5, 0x077C)},
+	{0x01D7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 8 RDS_TMC_EVENT_STRING(0x3904, 0x077E)},
+	{0x01D8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 8 RDS_TMC_EVENT_STRING(0x3924, 0x0787)},
+	{0x01D9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 8 RDS_TMC_EVENT_STRING(0x3945, 0x078F)},
+	{0x01DA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 7 RDS_TMC_EVENT_STRING(0x3954, 0x0793)},
+	{0x01DB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 7 RDS_TMC_EVENT_STRING(0x3973, 0x079C)},
+	{0x01DC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 7 RDS_TMC_EVENT_STRING(0x3993, 0x07A4)},
+	{0x01DD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 7 RDS_TMC_EVENT_STRING(0x39A1, 0x07A8)},
+	{0x01DE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 7 RDS_TMC_EVENT_STRING(0x39B5, 0x07AD)},
+	{0x01DF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 6 RDS_TMC_EVENT_STRING(0x39D4, 0x07B7)},
+	{0x01E0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 6 RDS_TMC_EVENT_STRING(0x39F1, 0x07BB)},
+	{0x01E1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 6 RDS_TMC_EVENT_STRING(0x3A19, 0x07C2)},
+	{0x01E2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 6 RDS_TMC_EVENT_STRING(0x3A40, 0x07C9)},
+	{0x01E3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 6 RDS_TMC_EVENT_STRING(0x3A56, 0x07D1)},
+	{0x01E4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 6 RDS_TMC_EVENT_STRING(0x3A74, 0x07D8)},
+	{0x01E5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 7 RDS_TMC_EVENT_STRING(0x3A88, 0x07DC)},
+	{0x01E6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 6 RDS_TMC_EVENT_STRING(0x3AA8, 0x07E6)},
+	{0x01E7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 6 RDS_TMC_EVENT_STRING(0x3AC6, 0x07EA)},
+	{0x01E8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 6 RDS_TMC_EVENT_STRING(0x3AEF, 0x07F1)},
+	{0x01E9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 6 RDS_TMC_EVENT_STRING(0x3B17, 0x07F8)},
+	{0x01EA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 6 RDS_TMC_EVENT_STRING(0x3B2E, 0x0801)},
+	{0x01EB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 6 RDS_TMC_EVENT_STRING(0x3B4D, 0x0809)},
+	{0x01EC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9 RDS_TMC_EVENT_STRING(0x3B62, 0x080E)},
+	{0x01ED, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 9 RDS_TMC_EVENT_STRING(0x3B75, 0x0812)},
+	{0x01EE, RDS_TMC_QUANTIFIER_TONNES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 9 RDS_TMC_EVENT_STRING(0x3B83, 0x0817)},
+	{0x01EF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x3BA7, 0x081C)},
+	{0x01F0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x3BD2, 0x0820)},
+	{0x01F1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x3BFA, 0x0824)},
+	{0x01F2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x3C1F, 0x0828)},
+	{0x01F3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x3C4B, 0x082C)},
+	{0x01F4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x3C74, 0x0830)},
+	{0x01F5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x3C89, 0x0834)},
+	{0x01F6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x3CA4, 0x083B)},
+	{0x01F7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x3CC0, 0x0842)},
+	{0x01F8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x3CDA, 0x0849)},
+	{0x01F9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x3CF0, 0x084E)},
+	{0x01FA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x3D02, 0x0853)},
+	{0x01FB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x3D16, 0x0858)},
+	{0x01FC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x3D32, 0x085F)},
+	{0x01FD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x3D4F, 0x0866)},
+	{0x01FE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5 RDS_TMC_EVENT_STRING(0x3D6A, 0x086D)},
+	{0x01FF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x3D81, 0x0872)},
+	{0x0200, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x3D94, 0x0878)},
+	{0x0201, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 5 RDS_TMC_EVENT_STRING(0x3DA9, 0x087E)},
+	{0x0202, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x3DC8, 0x0885)},
+	{0x0203, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x3DF9, 0x0887)},
+	{0x0204, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x3E2B, 0x0889)},
+	{0x0205, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 5 RDS_TMC_EVENT_STRING(0x3E5F, 0x088B)},
+	{0x0206, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x3E6B, 0x088D)},
+	{0x0207, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 5 RDS_TMC_EVENT_STRING(0x3E79, 0x088F)},
+	{0x0208, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x3E97, 0x0891)},
+	{0x0209, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x3EAD, 0x0895)},
+	{0x020A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x3ED4, 0x0898)},
+	{0x020B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x3F04, 0x089C)},
+	{0x020C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x3F34, 0x08A0)},
+	{0x020D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x3F64, 0x08A4)},
+	{0x020E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x3F94, 0x08A8)},
+	{0x020F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x3FC5, 0x08AC)},
+	{0x0210, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x3FF6, 0x08AF)},
+	{0x0211, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x401A, 0x08B2)},
+	{0x0212, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4047, 0x08B6)},
+	{0x0213, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4074, 0x08BA)},
+	{0x0214, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x40A1, 0x08BE)},
+	{0x0215, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x40CE, 0x08C2)},
+	{0x0216, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x40FC, 0x08C6)},
+	{0x0217, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x412A, 0x08C9)},
+	{0x0218, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x414B, 0x08CC)},
+	{0x0219, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4175, 0x08D0)},
+	{0x021A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x419F, 0x08D4)},
+	{0x021B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x41C9, 0x08D8)},
+	{0x021C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x41F3, 0x08DC)},
+	{0x021D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2 RDS_TMC_EVENT_STRING(0x421E, 0x08E0)},
+	{0x021E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4248, 0x08E3)},
+	{0x021F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2 RDS_TMC_EVENT_STRING(0x426A, 0x08E6)},
+	{0x0220, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1 RDS_TMC_EVENT_STRING(0x4295, 0x08E9)},
+	{0x0221, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x42BF, 0x08ED)},
+	{0x0222, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x42E6, 0x08F1)},
+	{0x0223, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x432B, 0x08F4)},
+	{0x0224, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x437A, 0x08F7)},
+	{0x0225, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x43BC, 0x08FA)},
+	{0x0226, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4408, 0x08FD)},
+	{0x0227, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2 RDS_TMC_EVENT_STRING(0x4447, 0x0900)},
+	{0x0228, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x448F, 0x0903)},
+	{0x0229, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2 RDS_TMC_EVENT_STRING(0x44CF, 0x0906)},
+	{0x022A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1 RDS_TMC_EVENT_STRING(0x4518, 0x0909)},
+	{0x022B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4561, 0x090C)},
+	{0x022C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x45A7, 0x090F)},
+	{0x022D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x45ED, 0x0912)},
+	{0x022E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x463D, 0x0915)},
+	{0x022F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4680, 0x0918)},
+	{0x0230, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x46CD, 0x091B)},
+	{0x0231, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2 RDS_TMC_EVENT_STRING(0x470D, 0x091E)},
+	{0x0232, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4756, 0x0921)},
+	{0x0233, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2 RDS_TMC_EVENT_STRING(0x4797, 0x0924)},
+	{0x0234, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1 RDS_TMC_EVENT_STRING(0x47E1, 0x0927)},
+	{0x0235, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x482B, 0x092A)},
+	{0x0236, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4872, 0x092D)},
+	{0x0237, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x48BA, 0x0930)},
+	{0x0238, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x490C, 0x0933)},
+	{0x0239, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4951, 0x0936)},
+	{0x023A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x49A0, 0x0939)},
+	{0x023B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2 RDS_TMC_EVENT_STRING(0x49E2, 0x093C)},
+	{0x023C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4A2D, 0x093F)},
+	{0x023D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2 RDS_TMC_EVENT_STRING(0x4A70, 0x0942)},
+	{0x023E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1 RDS_TMC_EVENT_STRING(0x4ABC, 0x0945)},
+	{0x023F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4B08, 0x0948)},
+	{0x0240, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4B51, 0x094B)},
+	{0x0241, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4B71, 0x094E)},
+	{0x0242, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4B9A, 0x0952)},
+	{0x0243, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4BC3, 0x0956)},
+	{0x0244, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4BEC, 0x095A)},
+	{0x0245, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4C15, 0x095E)},
+	{0x0246, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4C3F, 0x0962)},
+	{0x0247, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4C69, 0x0965)},
+	{0x0248, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4C86, 0x0968)},
+	{0x0249, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4CAC, 0x096C)},
+	{0x024A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4CD2, 0x0970)},
+	{0x024B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4CF8, 0x0974)},
+	{0x024C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4D1E, 0x0978)},
+	{0x024D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4D45, 0x097C)},
+	{0x024E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4D6C, 0x097F)},
+	{0x024F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4D86, 0x0982)},
+	{0x0250, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4DA9, 0x0986)},
+	{0x0251, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4DCC, 0x098A)},
+	{0x0252, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4DEF, 0x098E)},
+	{0x0253, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4E12, 0x0992)},
+	{0x0254, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2 RDS_TMC_EVENT_STRING(0x4E36, 0x0996)},
+	{0x0255, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4E59, 0x0999)},
+	{0x0256, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2 RDS_TMC_EVENT_STRING(0x4E74, 0x099C)},
+	{0x0257, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1 RDS_TMC_EVENT_STRING(0x4E98, 0x099F)},
+	{0x0258, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4EBC, 0x09A2)},
+	{0x0259, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x4EDD, 0x09A5)},
+	{0x025A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x4F1A, 0x09A9)},
+	{0x025B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x4F58, 0x09AD)},
+	{0x025C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4F98, 0x09B1)},
+	{0x025D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4FBA, 0x09B4)},
+	{0x025E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x4FE6, 0x09B7)},
+	{0x025F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x5005, 0x09BA)},
+	{0x0260, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x502E, 0x09BD)},
+	{0x0261, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2 RDS_TMC_EVENT_STRING(0x504A, 0x09C0)},
+	{0x0262, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x506F, 0x09C3)},
+	{0x0263, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2 RDS_TMC_EVENT_STRING(0x508C, 0x09C6)},
+	{0x0264, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1 RDS_TMC_EVENT_STRING(0x50B2, 0x09C9)},
+	{0x0265, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x50D8, 0x09CC)},
+	{0x0266, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x50FB, 0x09CF)},
+	{0x0267, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x512D, 0x09D2)},
+	{0x0268, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x517D, 0x09D6)},
+	{0x0269, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x51AC, 0x09D9)},
+	{0x026A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x51E5, 0x09DC)},
+	{0x026B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2 RDS_TMC_EVENT_STRING(0x5211, 0x09DF)},
+	{0x026C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x5246, 0x09E2)},
+	{0x026D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2 RDS_TMC_EVENT_STRING(0x5273, 0x09E5)},
+	{0x026E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1 RDS_TMC_EVENT_STRING(0x52A9, 0x09E8)},
+	{0x026F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x52DF, 0x09EB)},
+	{0x0270, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 5 RDS_TMC_EVENT_STRING(0x5312, 0x09EE)},
+	{0x0271, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 5 RDS_TMC_EVENT_STRING(0x5329, 0x09FB)},
+	{0x0272, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x533C, 0x09FD)},
+	{0x0273, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9 RDS_TMC_EVENT_STRING(0x5362, 0x0A01)},
+	{0x0274, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9 RDS_TMC_EVENT_STRING(0x5392, 0x0A17)},
+	{0x0275, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9 RDS_TMC_EVENT_STRING(0x53CC, 0x0A2E)},
+	{0x0276, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x5405, 0x0A44)},
+	{0x0277, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 5 RDS_TMC_EVENT_STRING(0x540B, 0x0A47)},
+	{0x0278, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 8 RDS_TMC_EVENT_STRING(0x5419, 0x0A4A)},
+	{0x0279, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 7 RDS_TMC_EVENT_STRING(0x5429, 0x0A4F)},
+	{0x027A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 6 RDS_TMC_EVENT_STRING(0x5438, 0x0A54)},
+	{0x027B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 9 RDS_TMC_EVENT_STRING(0x5453, 0x0A5F)},
+	{0x027C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 9 RDS_TMC_EVENT_STRING(0x5476, 0x0A66)},
+	{0x027D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x5493, 0x0A6A)},
+	{0x027E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x54AA, 0x0A6D)},
+	{0x027F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x54BF, 0x0A73)},
+	{0x0280, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x54D4, 0x0A7A)},
+	{0x0281, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x54EE, 0x0A80)},
+	{0x0282, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5 RDS_TMC_EVENT_STRING(0x54FF, 0x0A84)},
+	{0x0283, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5 RDS_TMC_EVENT_STRING(0x5517, 0x0A88)},
+	{0x0284, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5 RDS_TMC_EVENT_STRING(0x552D, 0x0A8F)},
+	{0x0285, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5 RDS_TMC_EVENT_STRING(0x5543, 0x0A97)},
+	{0x0286, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x555E, 0x0A9E)},
+	{0x0287, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 10 RDS_TMC_EVENT_STRING(0x5570, 0x0AA3)},
+	{0x0288, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 10 RDS_TMC_EVENT_STRING(0x5597, 0x0AAD)},
+	{0x0289, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 10 RDS_TMC_EVENT_STRING(0x55B8, 0x0AB1)},
+	{0x028A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 10 RDS_TMC_EVENT_STRING(0x55DA, 0x0AB6)},
+	{0x028B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x5614, 0x0ACA)},
+	{0x028C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x5644, 0x0ACE)},
+	{0x028D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x5671, 0x0AD2)},
+	{0x028E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x569B, 0x0AD6)},
+	{0x028F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x56C4, 0x0ADA)},
+	{0x0290, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x56EA, 0x0ADE)},
+	{0x0291, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 5 RDS_TMC_EVENT_STRING(0x570D, 0x0AE2)},
+	{0x0292, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 5 RDS_TMC_EVENT_STRING(0x5725, 0x0AEB)},
+	{0x0293, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 10 RDS_TMC_EVENT_STRING(0x5739, 0x0AF3)},
+	{0x0294, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 9 RDS_TMC_EVENT_STRING(0x5762, 0x0AF8)},
+	{0x0295, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 9 RDS_TMC_EVENT_STRING(0x577C, 0x0AFD)},
+	{0x0296, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 9 RDS_TMC_EVENT_STRING(0x579A, 0x0B09)},
+	{0x0297, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 6 RDS_TMC_EVENT_STRING(0x57BC, 0x0B16)},
+	{0x0298, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x57D6, 0x0B20)},
+	{0x0299, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 5 RDS_TMC_EVENT_STRING(0x57EA, 0x0B24)},
+	{0x029A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 5 RDS_TMC_EVENT_STRING(0x5802, 0x0B2E)},
+	{0x029F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 10 RDS_TMC_EVENT_STRING(0x5824, 0x0B44)},
+	{0x02A0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 6 RDS_TMC_EVENT_STRING(0x5862, 0x0B63)},
+	{0x02A1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 7 RDS_TMC_EVENT_STRING(0x5875, 0x0B65)},
+	{0x02A3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 23 RDS_TMC_EVENT_STRING(0x5888, 0x0B67)},
+	{0x02A4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 6 RDS_TMC_EVENT_STRING(0x589F, 0x0B6E)},
+	{0x02A6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x58B1, 0x0B73)},
+	{0x02A7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x58CC, 0x0B77)},
+	{0x02A8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 9 RDS_TMC_EVENT_STRING(0x58E8, 0x0B7C)},
+	{0x02A9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 23 RDS_TMC_EVENT_STRING(0x5906, 0x0B86)},
+	{0x02BD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11 RDS_TMC_EVENT_STRING(0x5918, 0x0B90)},
+	{0x02BE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11 RDS_TMC_EVENT_STRING(0x5930, 0x0B92)},
+	{0x02BF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 11 RDS_TMC_EVENT_STRING(0x594E, 0x0B97)},
+	{0x02C0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11 RDS_TMC_EVENT_STRING(0x596D, 0x0B9C)},
+	{0x02C1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11 RDS_TMC_EVENT_STRING(0x5990, 0x0B9E)},
+	{0x02C2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 13 RDS_TMC_EVENT_STRING(0x59B7, 0x0BAB)},
+	{0x02C3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11 RDS_TMC_EVENT_STRING(0x59D7, 0x0BAD)},
+	{0x02C4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 11 RDS_TMC_EVENT_STRING(0x5A00, 0x0BBB)},
+	{0x02C5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 11 RDS_TMC_EVENT_STRING(0x5A27, 0x0BC6)},
+	{0x02C6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x5A47, 0x0BCE)},
+	{0x02C7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x5A73, 0x0BD1)},
+	{0x02C8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x5AA8, 0x0BD5)},
+	{0x02C9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x5ADD, 0x0BD9)},
+	{0x02CA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x5B12, 0x0BDD)},
+	{0x02CB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x5B47, 0x0BE1)},
+	{0x02CC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x5B7D, 0x0BE5)},
+	{0x02CD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x5BB3, 0x0BE8)},
+	{0x02CE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x5BDC, 0x0BEB)},
+	{0x02CF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x5C0E, 0x0BEF)},
+	{0x02D0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x5C40, 0x0BF3)},
+	{0x02D1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x5C72, 0x0BF7)},
+	{0x02D2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x5CA4, 0x0BFB)},
+	{0x02D3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x5CD7, 0x0BFF)},
+	{0x02D4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x5D0A, 0x0C02)},
+	{0x02D5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x5D30, 0x0C05)},
+	{0x02D6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x5D5F, 0x0C09)},
+	{0x02D7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x5D8E, 0x0C0D)},
+	{0x02D8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x5DBD, 0x0C11)},
+	{0x02D9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x5DEC, 0x0C15)},
+	{0x02DA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2 RDS_TMC_EVENT_STRING(0x5E1C, 0x0C19)},
+	{0x02DB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x5E4B, 0x0C1C)},
+	{0x02DC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2 RDS_TMC_EVENT_STRING(0x5E72, 0x0C1F)},
+	{0x02DD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1 RDS_TMC_EVENT_STRING(0x5EA2, 0x0C22)},
+	{0x02DE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x5ED2, 0x0C25)},
+	{0x02DF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 5 RDS_TMC_EVENT_STRING(0x5EFF, 0x0C28)},
+	{0x02E0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x5F25, 0x0C2B)},
+	{0x02E1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x5F50, 0x0C30)},
+	{0x02E2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x5F7C, 0x0C35)},
+	{0x02E3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x5FA6, 0x0C3A)},
+	{0x02E4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x5FD4, 0x0C3F)},
+	{0x02E5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x5FFE, 0x0C44)},
+	{0x02E6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 5 RDS_TMC_EVENT_STRING(0x602A, 0x0C49)},
+	{0x02E7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x6061, 0x0C4F)},
+	{0x02E8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x609D, 0x0C53)},
+	{0x02E9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x60DA, 0x0C57)},
+	{0x02EA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 5 RDS_TMC_EVENT_STRING(0x6119, 0x0C5B)},
+	{0x02EB, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0x613D, 0x0C63)},
+	{0x02EC, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0x6155, 0x0C66)},
+	{0x02ED, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0x6176, 0x0C69)},
+	{0x02EE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x6193, 0x0C6C)},
+	{0x02EF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x61CA, 0x0C6F)},
+	{0x02F0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x620A, 0x0C73)},
+	{0x02F1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x624A, 0x0C77)},
+	{0x02F2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x628A, 0x0C7B)},
+	{0x02F3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x62CA, 0x0C7F)},
+	{0x02F4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x630B, 0x0C83)},
+	{0x02F5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x634C, 0x0C86)},
+	{0x02F6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x6380, 0x0C89)},
+	{0x02F7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x63BD, 0x0C8D)},
+	{0x02F8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x63FA, 0x0C91)},
+	{0x02F9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x6437, 0x0C95)},
+	{0x02FA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x6474, 0x0C99)},
+	{0x02FB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x64B2, 0x0C9D)},
+	{0x02FC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x64F0, 0x0CA0)},
+	{0x02FD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x6521, 0x0CA3)},
+	{0x02FE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x655B, 0x0CA7)},
+	{0x02FF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x6595, 0x0CAB)},
+	{0x0300, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x65CF, 0x0CAF)},
+	{0x0301, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x6609, 0x0CB3)},
+	{0x0302, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2 RDS_TMC_EVENT_STRING(0x6644, 0x0CB7)},
+	{0x0303, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x667E, 0x0CBA)},
+	{0x0304, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2 RDS_TMC_EVENT_STRING(0x66B0, 0x0CBD)},
+	{0x0305, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1 RDS_TMC_EVENT_STRING(0x66EB, 0x0CC0)},
+	{0x0306, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x6726, 0x0CC3)},
+	{0x0307, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 5 RDS_TMC_EVENT_STRING(0x675E, 0x0CC6)},
+	{0x0308, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x67A0, 0x0CCC)},
+	{0x0309, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x67E3, 0x0CD0)},
+	{0x030A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x6827, 0x0CD4)},
+	{0x030B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 5 RDS_TMC_EVENT_STRING(0x686D, 0x0CD8)},
+	{0x030C, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0x689C, 0x0CE0)},
+	{0x030D, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0x68BB, 0x0CE3)},
+	{0x030E, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0x68E3, 0x0CE6)},
+	{0x030F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x6907, 0x0CE9)},
+	{0x0310, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x693B, 0x0CEC)},
+	{0x0311, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x6979, 0x0CEF)},
+	{0x0312, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x69AA, 0x0CF2)},
+	{0x0313, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x69E5, 0x0CF5)},
+	{0x0314, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2 RDS_TMC_EVENT_STRING(0x6A13, 0x0CF8)},
+	{0x0315, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x6A4A, 0x0CFB)},
+	{0x0316, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2 RDS_TMC_EVENT_STRING(0x6A79, 0x0CFE)},
+	{0x0317, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1 RDS_TMC_EVENT_STRING(0x6AB1, 0x0D01)},
+	{0x0318, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x6AE9, 0x0D04)},
+	{0x0319, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5 RDS_TMC_EVENT_STRING(0x6B1E, 0x0D07)},
+	{0x031A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5 RDS_TMC_EVENT_STRING(0x6B51, 0x0D0C)},
+	{0x031B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5 RDS_TMC_EVENT_STRING(0x6B85, 0x0D11)},
+	{0x031C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5 RDS_TMC_EVENT_STRING(0x6BB7, 0x0D16)},
+	{0x031D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5 RDS_TMC_EVENT_STRING(0x6BED, 0x0D1B)},
+	{0x031E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5 RDS_TMC_EVENT_STRING(0x6C1F, 0x0D20)},
+	{0x031F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 5 RDS_TMC_EVENT_STRING(0x6C53, 0x0D25)},
+	{0x0320, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 11 RDS_TMC_EVENT_STRING(0x6C86, 0x0D38)},
+	{0x0321, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 11 RDS_TMC_EVENT_STRING(0x6C99, 0x0D3D)},
+	{0x0322, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11 RDS_TMC_EVENT_STRING(0x6CAC, 0x0D3F)},
+	{0x0323, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11 RDS_TMC_EVENT_STRING(0x6CCE, 0x0D49)},
+	{0x0324, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 23 RDS_TMC_EVENT_STRING(0x6CEE, 0x0D50)},
+	{0x0325, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 11 RDS_TMC_EVENT_STRING(0x6D1D, 0x0D52)},
+	{0x0326, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 11 RDS_TMC_EVENT_STRING(0x6D45, 0x0D63)},
+	{0x0327, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 11 RDS_TMC_EVENT_STRING(0x6D63, 0x0D67)},
+	{0x0328, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 11 RDS_TMC_EVENT_STRING(0x6D7F, 0x0D6B)},
+	{0x0329, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 11 RDS_TMC_EVENT_STRING(0x6DA3, 0x0D6F)},
+	{0x032A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 11 RDS_TMC_EVENT_STRING(0x6DC9, 0x0D73)},
+	{0x032B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 11 RDS_TMC_EVENT_STRING(0x6DDF, 0x0D7E)},
+	{0x032C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x6DF0, 0x0D87)},
+	{0x032D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x6E25, 0x0D8B)},
+	{0x032E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x6E57, 0x0D8F)},
+	{0x032F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11 RDS_TMC_EVENT_STRING(0x6E86, 0x0D93)},
+	{0x0330, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11 RDS_TMC_EVENT_STRING(0x6EB2, 0x0DA1)},
+	{0x0331, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11 RDS_TMC_EVENT_STRING(0x6EE2, 0x0DB5)},
+	{0x0332, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x6F0B, 0x0DBF)},
+	{0x0333, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x6F4B, 0x0DC3)},
+	{0x0334, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x6F88, 0x0DC7)},
+	{0x0335, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11 RDS_TMC_EVENT_STRING(0x6FC2, 0x0DCB)},
+	{0x0336, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11 RDS_TMC_EVENT_STRING(0x6FF5, 0x0DD9)},
+	{0x0337, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11 RDS_TMC_EVENT_STRING(0x702C, 0x0DED)},
+	{0x0338, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 13 RDS_TMC_EVENT_STRING(0x705C, 0x0DF7)},
+	{0x0339, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x7084, 0x0DFA)},
+	{0x033A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x70C7, 0x0DFD)},
+	{0x033B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x7114, 0x0E00)},
+	{0x033C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x7154, 0x0E03)},
+	{0x033D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x719E, 0x0E06)},
+	{0x033E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2 RDS_TMC_EVENT_STRING(0x71DB, 0x0E09)},
+	{0x033F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x7221, 0x0E0C)},
+	{0x0340, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2 RDS_TMC_EVENT_STRING(0x725F, 0x0E0F)},
+	{0x0341, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 1 RDS_TMC_EVENT_STRING(0x72A6, 0x0E12)},
+	{0x0342, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x72ED, 0x0E15)},
+	{0x0343, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x7331, 0x0E18)},
+	{0x0344, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x7373, 0x0E1D)},
+	{0x0345, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x73B6, 0x0E22)},
+	{0x0346, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x73F7, 0x0E27)},
+	{0x0347, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x7438, 0x0E2C)},
+	{0x0348, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0x747B, 0x0E31)},
+	{0x0349, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0x7499, 0x0E35)},
+	{0x034A, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0x74C0, 0x0E39)},
+	{0x034B, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0x74E3, 0x0E3D)},
+	{0x034C, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0x74FF, 0x0E41)},
+	{0x034D, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0x7524, 0x0E45)},
+	{0x034E, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0x7545, 0x0E49)},
+	{0x034F, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0x7569, 0x0E4D)},
+	{0x0350, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0x7596, 0x0E51)},
+	{0x0351, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0x75BF, 0x0E55)},
+	{0x0352, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0x75E5, 0x0E59)},
+	{0x0353, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0x7614, 0x0E5D)},
+	{0x0354, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 13 RDS_TMC_EVENT_STRING(0x763F, 0x0E61)},
+	{0x0355, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 11 RDS_TMC_EVENT_STRING(0x765D, 0x0E6C)},
+	{0x0356, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 11 RDS_TMC_EVENT_STRING(0x767D, 0x0E74)},
+	{0x0357, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 11 RDS_TMC_EVENT_STRING(0x7697, 0x0E7A)},
+	{0x0358, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 13 RDS_TMC_EVENT_STRING(0x76AE, 0x0E84)},
+	{0x0359, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 13 RDS_TMC_EVENT_STRING(0x76D4, 0x0E90)},
+	{0x035A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 13 RDS_TMC_EVENT_STRING(0x76F7, 0x0E9E)},
+	{0x035B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 13 RDS_TMC_EVENT_STRING(0x7723, 0x0EB1)},
+	{0x035C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 13 RDS_TMC_EVENT_STRING(0x7746, 0x0EBB)},
+	{0x035D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 13 RDS_TMC_EVENT_STRING(0x7773, 0x0EC6)},
+	{0x035E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 13 RDS_TMC_EVENT_STRING(0x7788, 0x0ED1)},
+	{0x0381, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_XURGENT, false, false, true, 13 RDS_TMC_EVENT_STRING(0x77A7, 0x0EDD)},
+	{0x0382, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 12 RDS_TMC_EVENT_STRING(0x77D6, 0x0EF2)},
+	{0x0383, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 12 RDS_TMC_EVENT_STRING(0x77F5, 0x0EFC)},
+	{0x0384, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 12 RDS_TMC_EVENT_STRING(0x7822, 0x0F0A)},
+	{0x0385, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12 RDS_TMC_EVENT_STRING(0x7835, 0x0F0F)},
+	{0x0386, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12 RDS_TMC_EVENT_STRING(0x7855, 0x0F17)},
+	{0x0387, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 12 RDS_TMC_EVENT_STRING(0x787C, 0x0F20)},
+	{0x0388, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 12 RDS_TMC_EVENT_STRING(0x7892, 0x0F25)},
+	{0x0389, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 12 RDS_TMC_EVENT_STRING(0x78A0, 0x0F28)},
+	{0x038A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12 RDS_TMC_EVENT_STRING(0x78B3, 0x0F2C)},
+	{0x038B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12 RDS_TMC_EVENT_STRING(0x78CE, 0x0F31)},
+	{0x038C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12 RDS_TMC_EVENT_STRING(0x78D8, 0x0F33)},
+	{0x038D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12 RDS_TMC_EVENT_STRING(0x78EA, 0x0F36)},
+	{0x038E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12 RDS_TMC_EVENT_STRING(0x78F8, 0x0F3E)},
+	{0x038F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12 RDS_TMC_EVENT_STRING(0x7910, 0x0F4B)},
+	{0x0390, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12 RDS_TMC_EVENT_STRING(0x791C, 0x0F4F)},
+	{0x0391, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12 RDS_TMC_EVENT_STRING(0x792C, 0x0F57)},
+	{0x0392, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12 RDS_TMC_EVENT_STRING(0x7937, 0x0F5B)},
+	{0x0393, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12 RDS_TMC_EVENT_STRING(0x7942, 0x0F5F)},
+	{0x0394, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14 RDS_TMC_EVENT_STRING(0x7955, 0x0F6B)},
+	{0x0395, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 12 RDS_TMC_EVENT_STRING(0x7975, 0x0F76)},
+	{0x0396, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12 RDS_TMC_EVENT_STRING(0x7981, 0x0F79)},
+	{0x0397, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 12 RDS_TMC_EVENT_STRING(0x799A, 0x0F83)},
+	{0x0398, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 12 RDS_TMC_EVENT_STRING(0x79AC, 0x0F86)},
+	{0x0399, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 12 RDS_TMC_EVENT_STRING(0x79B6, 0x0F89)},
+	{0x039A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 13 RDS_TMC_EVENT_STRING(0x79C4, 0x0F8C)},
+	{0x039B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 13 RDS_TMC_EVENT_STRING(0x79D8, 0x0F90)},
+	{0x039C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 4 RDS_TMC_EVENT_STRING(0x79F5, 0x0F95)},
+	{0x039D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x7A05, 0x0F99)},
+	{0x039E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x7A1E, 0x0F9E)},
+	{0x039F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12 RDS_TMC_EVENT_STRING(0x7A3C, 0x0FA4)},
+	{0x03A0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x7A65, 0x0FAB)},
+	{0x03A1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x7A83, 0x0FAE)},
+	{0x03A2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x7AAB, 0x0FB1)},
+	{0x03A3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x7AC6, 0x0FB4)},
+	{0x03A4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0x7AEB, 0x0FB7)},
+	{0x03A5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2 RDS_TMC_EVENT_STRING(0x7B03, 0x0FBA)},
+	{0x03A6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x7B24, 0x0FBD)},
+	{0x03A7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2 RDS_TMC_EVENT_STRING(0x7B3D, 0x0FC0)},
+	{0x03A8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1 RDS_TMC_EVENT_STRING(0x7B5F, 0x0FC3)},
+	{0x03A9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0x7B81, 0x0FC6)},
+	{0x03AA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9 RDS_TMC_EVENT_STRING(0x7BA0, 0x0FC9)},
+	{0x03AB, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0x7BB8, 0x0FD3)},
+	{0x03AC, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0x7BCF, 0x0FD6)},
+	{0x03AD, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 20 RDS_TMC_EVENT_STRING(0x7BEF, 0x0FD9)},
+	{0x03AE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12 RDS_TMC_EVENT_STRING(0x7C0B, 0x0FDC)},
+	{0x03AF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9 RDS_TMC_EVENT_STRING(0x7C29, 0x0FE0)},
+	{0x03B0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12 RDS_TMC_EVENT_STRING(0x7C43, 0x0FE5)},
+	{0x03B1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9 RDS_TMC_EVENT_STRING(0x7C7D, 0x0FEE)},
+	{0x03B2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12 RDS_TMC_EVENT_STRING(0x7C96, 0x0FF3)},
+	{0x03B3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 5 RDS_TMC_EVENT_STRING(0x7CB5, 0x0FF9)},
+	{0x03B4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12 RDS_TMC_EVENT_STRING(0x7CD3, 0x0FFF)},
+	{0x03B5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 9 RDS_TMC_EVENT_STRING(0x7CF2, 0x1005)},
+	{0x03B6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12 RDS_TMC_EVENT_STRING(0x7D0C, 0x1009)},
+	{0x03B7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x7D37, 0x1010)},
+	{0x03B8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x7D74, 0x1015)},
+	{0x03B9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5 RDS_TMC_EVENT_STRING(0x7DB2, 0x101A)},
+	{0x03BA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 5 RDS_TMC_EVENT_STRING(0x7DF2, 0x101F)},
+	{0x03BB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 12 RDS_TMC_EVENT_STRING(0x7E17, 0x102E)},
+	{0x03BC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 5 RDS_TMC_EVENT_STRING(0x7E37, 0x1033)},
+	{0x03BD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x7E55, 0x1037)},
+	{0x03BE, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0x7E7A, 0x103C)},
+	{0x03BF, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0x7E99, 0x1040)},
+	{0x03C0, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0x7EC1, 0x1044)},
+	{0x03C1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 5 RDS_TMC_EVENT_STRING(0x7EE5, 0x1048)},
+	{0x03C2, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0x7EFD, 0x104C)},
+	{0x03C3, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0x7F14, 0x1050)},
+	{0x03C4, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0x7F34, 0x1054)},
+	{0x03C5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 5 RDS_TMC_EVENT_STRING(0x7F50, 0x1058)},
+	{0x03C6, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0x7F6C, 0x105C)},
+	{0x03C7, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0x7F87, 0x1060)},
+	{0x03C8, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0x7FAB, 0x1064)},
+	{0x03C9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x7FCB, 0x1068)},
+	{0x03CA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 12 RDS_TMC_EVENT_STRING(0x7FE6, 0x106E)},
+	{0x03CB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 12 RDS_TMC_EVENT_STRING(0x7FF7, 0x1077)},
+	{0x03CC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, true, 12 RDS_TMC_EVENT_STRING(0x800A, 0x1079)},
+	{0x03CD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 12 RDS_TMC_EVENT_STRING(0x8021, 0x1080)},
+	{0x03CE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12 RDS_TMC_EVENT_STRING(0x8036, 0x1085)},
+	{0x03CF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12 RDS_TMC_EVENT_STRING(0x8046, 0x108D)},
+	{0x03D0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12 RDS_TMC_EVENT_STRING(0x8054, 0x1090)},
+	{0x03D1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 12 RDS_TMC_EVENT_STRING(0x805F, 0x109A)},
+	{0x03D2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12 RDS_TMC_EVENT_STRING(0x806B, 0x10A1)},
+	{0x03D3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12 RDS_TMC_EVENT_STRING(0x8076, 0x10A7)},
+	{0x03D4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x8082, 0x10AD)},
+	{0x03D5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12 RDS_TMC_EVENT_STRING(0x80AE, 0x10B8)},
+	{0x03D6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x80E1, 0x10C3)},
+	{0x03D7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12 RDS_TMC_EVENT_STRING(0x8105, 0x10CC)},
+	{0x03D8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 12 RDS_TMC_EVENT_STRING(0x812F, 0x10D3)},
+	{0x03D9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12 RDS_TMC_EVENT_STRING(0x814D, 0x10D8)},
+	{0x03DA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12 RDS_TMC_EVENT_STRING(0x816F, 0x10DD)},
+	{0x03DB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 5 RDS_TMC_EVENT_STRING(0x8185, 0x10E1)},
+	{0x03DC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12 RDS_TMC_EVENT_STRING(0x81A5, 0x10EC)},
+	{0x03DD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12 RDS_TMC_EVENT_STRING(0x81CE, 0x10F3)},
+	{0x03DE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12 RDS_TMC_EVENT_STRING(0x81EB, 0x10F9)},
+	{0x03DF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12 RDS_TMC_EVENT_STRING(0x8203, 0x1102)},
+	{0x03E0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12 RDS_TMC_EVENT_STRING(0x8219, 0x110B)},
+	{0x03E1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9 RDS_TMC_EVENT_STRING(0x822D, 0x1110)},
+	{0x03E2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12 RDS_TMC_EVENT_STRING(0x824B, 0x1119)},
+	{0x03E3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9 RDS_TMC_EVENT_STRING(0x8263, 0x1122)},
+	{0x03E4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12 RDS_TMC_EVENT_STRING(0x827F, 0x1126)},
+	{0x03E5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12 RDS_TMC_EVENT_STRING(0x82BB, 0x112E)},
+	{0x03E6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12 RDS_TMC_EVENT_STRING(0x82E3, 0x1135)},
+	{0x03E7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12 RDS_TMC_EVENT_STRING(0x82F6, 0x113A)},
+	{0x03E8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12 RDS_TMC_EVENT_STRING(0x8309, 0x113F)},
+	{0x03E9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14 RDS_TMC_EVENT_STRING(0x8324, 0x114C)},
+	{0x03EA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14 RDS_TMC_EVENT_STRING(0x835C, 0x1153)},
+	{0x03EB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14 RDS_TMC_EVENT_STRING(0x8373, 0x115D)},
+	{0x03EC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14 RDS_TMC_EVENT_STRING(0x839C, 0x1162)},
+	{0x03ED, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14 RDS_TMC_EVENT_STRING(0x83A9, 0x1169)},
+	{0x03EE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14 RDS_TMC_EVENT_STRING(0x83B9, 0x1171)},
+	{0x03EF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14 RDS_TMC_EVENT_STRING(0x83D8, 0x1174)},
+	{0x03F0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14 RDS_TMC_EVENT_STRING(0x8401, 0x1178)},
+	{0x03F1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14 RDS_TMC_EVENT_STRING(0x8426, 0x117F)},
+	{0x03F2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14 RDS_TMC_EVENT_STRING(0x844F, 0x1187)},
+	{0x03F3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 14 RDS_TMC_EVENT_STRING(0x847C, 0x1191)},
+	{0x03F4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14 RDS_TMC_EVENT_STRING(0x849D, 0x1198)},
+	{0x03F5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14 RDS_TMC_EVENT_STRING(0x84C9, 0x119D)},
+	{0x03F6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14 RDS_TMC_EVENT_STRING(0x84F0, 0x11A4)},
+	{0x03F7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14 RDS_TMC_EVENT_STRING(0x8516, 0x11AB)},
+	{0x03F8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14 RDS_TMC_EVENT_STRING(0x853B, 0x11B3)},
+	{0x03F9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 14 RDS_TMC_EVENT_STRING(0x8562, 0x11BD)},
+	{0x03FA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14 RDS_TMC_EVENT_STRING(0x8587, 0x11C5)},
+	{0x03FB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14 RDS_TMC_EVENT_STRING(0x85BC, 0x11CE)},
+	{0x03FC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14 RDS_TMC_EVENT_STRING(0x85F2, 0x11D9)},
+	{0x03FD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5 RDS_TMC_EVENT_STRING(0x8622, 0x11DF)},
+	{0x03FE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5 RDS_TMC_EVENT_STRING(0x8665, 0x11E4)},
+	{0x03FF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5 RDS_TMC_EVENT_STRING(0x86A9, 0x11E9)},
+	{0x0400, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 14 RDS_TMC_EVENT_STRING(0x86EF, 0x11EE)},
+	{0x0401, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 14 RDS_TMC_EVENT_STRING(0x8714, 0x11F7)},
+	{0x0402, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 12 RDS_TMC_EVENT_STRING(0x8727, 0x11F9)},
+	{0x0403, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0x873B, 0x11FD)},
+	{0x0404, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0x8758, 0x1201)},
+	{0x0405, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0x877E, 0x1205)},
+	{0x0406, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12 RDS_TMC_EVENT_STRING(0x87A0, 0x1209)},
+	{0x0407, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12 RDS_TMC_EVENT_STRING(0x87B8, 0x120D)},
+	{0x0408, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12 RDS_TMC_EVENT_STRING(0x87D2, 0x1211)},
+	{0x0409, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12 RDS_TMC_EVENT_STRING(0x87E4, 0x1215)},
+	{0x040A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 4 RDS_TMC_EVENT_STRING(0x87FA, 0x1219)},
+	{0x040B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14 RDS_TMC_EVENT_STRING(0x8812, 0x121E)},
+	{0x040C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14 RDS_TMC_EVENT_STRING(0x8838, 0x1223)},
+	{0x040D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14 RDS_TMC_EVENT_STRING(0x8865, 0x122D)},
+	{0x040E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14 RDS_TMC_EVENT_STRING(0x88A7, 0x1237)},
+	{0x040F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 14 RDS_TMC_EVENT_STRING(0x88DF, 0x1244)},
+	{0x0410, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 14 RDS_TMC_EVENT_STRING(0x890D, 0x124E)},
+	{0x0411, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 14 RDS_TMC_EVENT_STRING(0x8931, 0x1255)},
+	{0x0412, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14 RDS_TMC_EVENT_STRING(0x8947, 0x125C)},
+	{0x0413, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14 RDS_TMC_EVENT_STRING(0x895B, 0x1265)},
+	{0x0414, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 14 RDS_TMC_EVENT_STRING(0x896C, 0x1271)},
+	{0x0415, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 14 RDS_TMC_EVENT_STRING(0x8979, 0x1277)},
+	{0x0416, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 34 RDS_TMC_EVENT_STRING(0x8989, 0x127E)},
+	{0x0417, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14 RDS_TMC_EVENT_STRING(0x89B1, 0x1283)},
+	{0x0418, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14 RDS_TMC_EVENT_STRING(0x89D8, 0x1286)},
+	{0x0419, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 34 RDS_TMC_EVENT_STRING(0x8A09, 0x128A)},
+	{0x041A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14 RDS_TMC_EVENT_STRING(0x8A39, 0x1290)},
+	{0x041B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 34 RDS_TMC_EVENT_STRING(0x8A68, 0x1298)},
+	{0x041C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 34 RDS_TMC_EVENT_STRING(0x8A96, 0x12A1)},
+	{0x041D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 34 RDS_TMC_EVENT_STRING(0x8AC8, 0x12A9)},
+	{0x041E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14 RDS_TMC_EVENT_STRING(0x8AF8, 0x12B3)},
+	{0x041F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14 RDS_TMC_EVENT_STRING(0x8B1F, 0x12BF)},
+	{0x0420, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14 RDS_TMC_EVENT_STRING(0x8B34, 0x12C7)},
+	{0x0421, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 14 RDS_TMC_EVENT_STRING(0x8B4D, 0x12D4)},
+	{0x0422, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 14 RDS_TMC_EVENT_STRING(0x8B62, 0x12DB)},
+	{0x0423, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14 RDS_TMC_EVENT_STRING(0x8B7A, 0x12E3)},
+	{0x0424, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14 RDS_TMC_EVENT_STRING(0x8BA2, 0x12EF)},
+	{0x0425, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14 RDS_TMC_EVENT_STRING(0x8BD4, 0x12F7)},
+	{0x0426, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14 RDS_TMC_EVENT_STRING(0x8C10, 0x1300)},
+	{0x0427, RDS_TMC_QUANTIFIER_TONNES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14 RDS_TMC_EVENT_STRING(0x8C65, 0x1317)},
+	{0x0428, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14 RDS_TMC_EVENT_STRING(0x8C8E, 0x1320)},
+	{0x0429, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 14 RDS_TMC_EVENT_STRING(0x8CCF, 0x132F)},
+	{0x042A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 4 RDS_TMC_EVENT_STRING(0x8CEC, 0x1334)},
+	{0x042B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 13 RDS_TMC_EVENT_STRING(0x8D1A, 0x1344)},
+	{0x042C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 13 RDS_TMC_EVENT_STRING(0x8D34, 0x134C)},
+	{0x042D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 14 RDS_TMC_EVENT_STRING(0x8D51, 0x1355)},
+	{0x042E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 14 RDS_TMC_EVENT_STRING(0x8D66, 0x1363)},
+	{0x042F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 34 RDS_TMC_EVENT_STRING(0x8D74, 0x1367)},
+	{0x0430, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 34 RDS_TMC_EVENT_STRING(0x8D98, 0x136F)},
+	{0x0431, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 14 RDS_TMC_EVENT_STRING(0x8DAB, 0x1371)},
+	{0x0432, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 14 RDS_TMC_EVENT_STRING(0x8DF6, 0x1383)},
+	{0x0433, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 14 RDS_TMC_EVENT_STRING(0x8E28, 0x138B)},
+	{0x0437, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 15 RDS_TMC_EVENT_STRING(0x8E68, 0x1395)},
+	{0x0438, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 15 RDS_TMC_EVENT_STRING(0x8E8D, 0x13A0)},
+	{0x0439, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 15 RDS_TMC_EVENT_STRING(0x8EA6, 0x13AD)},
+	{0x043A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 15 RDS_TMC_EVENT_STRING(0x8EBC, 0x13BA)},
+	{0x043B, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 15 RDS_TMC_EVENT_STRING(0x8ED7, 0x13C6)},
+	{0x043C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 12 RDS_TMC_EVENT_STRING(0x8EF1, 0x13CF)},
+	{0x043D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12 RDS_TMC_EVENT_STRING(0x8EFD, 0x13D7)},
+	{0x043E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 12 RDS_TMC_EVENT_STRING(0x8F0A, 0x13DF)},
+	{0x0442, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12 RDS_TMC_EVENT_STRING(0x8F26, 0x13EC)},
+	{0x044D, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16 RDS_TMC_EVENT_STRING(0x8F40, 0x13FA)},
+	{0x044E, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16 RDS_TMC_EVENT_STRING(0x8F55, 0x13FE)},
+	{0x044F, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16 RDS_TMC_EVENT_STRING(0x8F87, 0x1405)},
+	{0x0450, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16 RDS_TMC_EVENT_STRING(0x8FB9, 0x140C)},
+	{0x0451, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16 RDS_TMC_EVENT_STRING(0x8FC8, 0x1410)},
+	{0x0452, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16 RDS_TMC_EVENT_STRING(0x8FF5, 0x1417)},
+	{0x0453, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16 RDS_TMC_EVENT_STRING(0x9016, 0x141C)},
+	{0x0454, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16 RDS_TMC_EVENT_STRING(0x9038, 0x1423)},
+	{0x0455, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16 RDS_TMC_EVENT_STRING(0x9062, 0x142C)},
+	{0x0456, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16 RDS_TMC_EVENT_STRING(0x9073, 0x1430)},
+	{0x0457, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16 RDS_TMC_EVENT_STRING(0x90A1, 0x1437)},
+	{0x0458, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16 RDS_TMC_EVENT_STRING(0x90CF, 0x143E)},
+	{0x0459, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16 RDS_TMC_EVENT_STRING(0x90DA, 0x1442)},
+	{0x045A, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16 RDS_TMC_EVENT_STRING(0x9103, 0x1449)},
+	{0x045B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 15 RDS_TMC_EVENT_STRING(0x9127, 0x1450)},
+	{0x045C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 15 RDS_TMC_EVENT_STRING(0x9134, 0x1457)},
+	{0x045D, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33 RDS_TMC_EVENT_STRING(0x913B, 0x145B)},
+	{0x045E, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33 RDS_TMC_EVENT_STRING(0x9161, 0x1463)},
+	{0x045F, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33 RDS_TMC_EVENT_STRING(0x9184, 0x146E)},
+	{0x0460, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33 RDS_TMC_EVENT_STRING(0x91A7, 0x1478)},
+	{0x0461, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33 RDS_TMC_EVENT_STRING(0x91CA, 0x1483)},
+	{0x0462, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33 RDS_TMC_EVENT_STRING(0x91ED, 0x148A)},
+	{0x0463, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33 RDS_TMC_EVENT_STRING(0x9210, 0x1492)},
+	{0x0464, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33 RDS_TMC_EVENT_STRING(0x9238, 0x149D)},
+	{0x0465, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33 RDS_TMC_EVENT_STRING(0x9259, 0x14A4)},
+	{0x0466, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 16 RDS_TMC_EVENT_STRING(0x928D, 0x14B7)},
+	{0x0467, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 15 RDS_TMC_EVENT_STRING(0x92A9, 0x14C1)},
+	{0x0468, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16 RDS_TMC_EVENT_STRING(0x92BC, 0x14C3)},
+	{0x0469, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 33 RDS_TMC_EVENT_STRING(0x92E5, 0x14CC)},
+	{0x046A, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16 RDS_TMC_EVENT_STRING(0x9307, 0x14D4)},
+	{0x046B, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 33 RDS_TMC_EVENT_STRING(0x932C, 0x14DC)},
+	{0x046C, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16 RDS_TMC_EVENT_STRING(0x934A, 0x14E3)},
+	{0x046D, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 33 RDS_TMC_EVENT_STRING(0x9374, 0x14EC)},
+	{0x046E, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16 RDS_TMC_EVENT_STRING(0x9397, 0x14F4)},
+	{0x046F, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16 RDS_TMC_EVENT_STRING(0x93C3, 0x14FA)},
+	{0x0470, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16 RDS_TMC_EVENT_STRING(0x93E9, 0x14FF)},
+	{0x0471, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16 RDS_TMC_EVENT_STRING(0x9411, 0x1505)},
+	{0x0472, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 33 RDS_TMC_EVENT_STRING(0x9433, 0x150A)},
+	{0x0473, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 33 RDS_TMC_EVENT_STRING(0x9456, 0x1515)},
+	{0x0474, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 33 RDS_TMC_EVENT_STRING(0x9469, 0x1517)},
+	{0x0475, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 33 RDS_TMC_EVENT_STRING(0x9485, 0x151C)},
+	{0x0477, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 34 RDS_TMC_EVENT_STRING(0x949D, 0x1521)},
+	{0x047F, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 33 RDS_TMC_EVENT_STRING(0x94CF, 0x1527)},
+	{0x0480, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33 RDS_TMC_EVENT_STRING(0x94F3, 0x152C)},
+	{0x0481, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33 RDS_TMC_EVENT_STRING(0x9511, 0x1530)},
+	{0x0482, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33 RDS_TMC_EVENT_STRING(0x952B, 0x1534)},
+	{0x0483, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33 RDS_TMC_EVENT_STRING(0x9546, 0x153A)},
+	{0x0484, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33 RDS_TMC_EVENT_STRING(0x9569, 0x1544)},
+	{0x0485, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33 RDS_TMC_EVENT_STRING(0x9589, 0x1549)},
+	{0x0486, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33 RDS_TMC_EVENT_STRING(0x95A3, 0x154D)},
+	{0x0487, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33 RDS_TMC_EVENT_STRING(0x95C0, 0x1554)},
+	{0x0488, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33 RDS_TMC_EVENT_STRING(0x95E1, 0x155C)},
+	{0x048D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14 RDS_TMC_EVENT_STRING(0x95FC, 0x1562)},
+	{0x048E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14 RDS_TMC_EVENT_STRING(0x9613, 0x156B)},
+	{0x0492, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 16 RDS_TMC_EVENT_STRING(0x962A, 0x1574)},
+	{0x0493, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 16 RDS_TMC_EVENT_STRING(0x9648, 0x1579)},
+	{0x0494, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, true, 16 RDS_TMC_EVENT_STRING(0x9662, 0x157E)},
+	{0x0495, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 16 RDS_TMC_EVENT_STRING(0x967F, 0x1589)},
+	{0x0496, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 16 RDS_TMC_EVENT_STRING(0x96B2, 0x1591)},
+	{0x0497, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, true, 16 RDS_TMC_EVENT_STRING(0x96EA, 0x159A)},
+	{0x0498, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 16 RDS_TMC_EVENT_STRING(0x970F, 0x15A4)},
+	{0x0499, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 16 RDS_TMC_EVENT_STRING(0x9760, 0x15B5)},
+	{0x049A, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 16 RDS_TMC_EVENT_STRING(0x9794, 0x15BA)},
+	{0x049B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, true, 16 RDS_TMC_EVENT_STRING(0x97C9, 0x15C4)},
+	{0x049C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 16 RDS_TMC_EVENT_STRING(0x97E9, 0x15D0)},
+	{0x04A6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 17 RDS_TMC_EVENT_STRING(0x980C, 0x15DD)},
+	{0x04A7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 17 RDS_TMC_EVENT_STRING(0x9819, 0x15E2)},
+	{0x04B1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 17 RDS_TMC_EVENT_STRING(0x9833, 0x15F0)},
+	{0x04B2, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 17 RDS_TMC_EVENT_STRING(0x983E, 0x15F6)},
+	{0x04B3, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 17 RDS_TMC_EVENT_STRING(0x985A, 0x1603)},
+	{0x04B4, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 17 RDS_TMC_EVENT_STRING(0x9866, 0x1609)},
+	{0x04B5, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 17 RDS_TMC_EVENT_STRING(0x987E, 0x1610)},
+	{0x04B6, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 36 RDS_TMC_EVENT_STRING(0x9891, 0x1615)},
+	{0x04B7, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 36 RDS_TMC_EVENT_STRING(0x98A6, 0x161F)},
+	{0x04B8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 36 RDS_TMC_EVENT_STRING(0x98B8, 0x1626)},
+	{0x04B9, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 17 RDS_TMC_EVENT_STRING(0x98C6, 0x162D)},
+	{0x04BA, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 17 RDS_TMC_EVENT_STRING(0x98D8, 0x1634)},
+	{0x04BB, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 17 RDS_TMC_EVENT_STRING(0x98E9, 0x1639)},
+	{0x04BC, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9 RDS_TMC_EVENT_STRING(0x991A, 0x164B)},
+	{0x04BD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 17 RDS_TMC_EVENT_STRING(0x9953, 0x165A)},
+	{0x04BE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 17 RDS_TMC_EVENT_STRING(0x9968, 0x1663)},
+	{0x04BF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, true, true, 9 RDS_TMC_EVENT_STRING(0x997B, 0x1665)},
+	{0x04C0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 36 RDS_TMC_EVENT_STRING(0x99A8, 0x1672)},
+	{0x04C1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 17 RDS_TMC_EVENT_STRING(0x99C1, 0x167E)},
+	{0x04C2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 36 RDS_TMC_EVENT_STRING(0x99D8, 0x1689)},
+	{0x04C3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 36 RDS_TMC_EVENT_STRING(0x99F1, 0x168F)},
+	{0x04E3, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 36 RDS_TMC_EVENT_STRING(0x9A04, 0x1691)},
+	{0x04E4, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 36 RDS_TMC_EVENT_STRING(0x9A23, 0x169A)},
+	{0x04E5, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 36 RDS_TMC_EVENT_STRING(0x9A3F, 0x16A7)},
+	{0x04E6, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 36 RDS_TMC_EVENT_STRING(0x9A4B, 0x16AD)},
+	{0x04E7, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 36 RDS_TMC_EVENT_STRING(0x9A63, 0x16B4)},
+	{0x04E8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 36 RDS_TMC_EVENT_STRING(0x9A76, 0x16B9)},
+	{0x0514, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 33 RDS_TMC_EVENT_STRING(0x9A96, 0x16C1)},
+	{0x0515, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16 RDS_TMC_EVENT_STRING(0x9ACC, 0x16CA)},
+	{0x0516, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16 RDS_TMC_EVENT_STRING(0x9AF2, 0x16CF)},
+	{0x0517, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16 RDS_TMC_EVENT_STRING(0x9B1A, 0x16D6)},
+	{0x0518, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16 RDS_TMC_EVENT_STRING(0x9B42, 0x16DD)},
+	{0x0519, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16 RDS_TMC_EVENT_STRING(0x9B62, 0x16E2)},
+	{0x051A, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33 RDS_TMC_EVENT_STRING(0x9B85, 0x16E9)},
+	{0x051B, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16 RDS_TMC_EVENT_STRING(0x9B9E, 0x16EF)},
+	{0x051C, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16 RDS_TMC_EVENT_STRING(0x9BC5, 0x16F7)},
+	{0x051D, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16 RDS_TMC_EVENT_STRING(0x9BEE, 0x16FE)},
+	{0x051E, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16 RDS_TMC_EVENT_STRING(0x9C17, 0x1708)},
+	{0x051F, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 35 RDS_TMC_EVENT_STRING(0x9C40, 0x1713)},
+	{0x0520, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16 RDS_TMC_EVENT_STRING(0x9C6E, 0x1722)},
+	{0x0521, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 16 RDS_TMC_EVENT_STRING(0x9C9B, 0x172A)},
+	{0x0522, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 16 RDS_TMC_EVENT_STRING(0x9CB0, 0x1730)},
+	{0x0523, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 33 RDS_TMC_EVENT_STRING(0x9CC3, 0x1732)},
+	{0x0524, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33 RDS_TMC_EVENT_STRING(0x9CE2, 0x1736)},
+	{0x0525, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 33 RDS_TMC_EVENT_STRING(0x9D02, 0x173F)},
+	{0x0526, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16 RDS_TMC_EVENT_STRING(0x9D24, 0x174A)},
+	{0x0527, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16 RDS_TMC_EVENT_STRING(0x9D40, 0x174E)},
+	{0x0528, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16 RDS_TMC_EVENT_STRING(0x9D5D, 0x1754)},
+	{0x0529, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16 RDS_TMC_EVENT_STRING(0x9D7A, 0x175A)},
+	{0x052A, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16 RDS_TMC_EVENT_STRING(0x9D98, 0x1760)},
+	{0x052B, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16 RDS_TMC_EVENT_STRING(0x9DBE, 0x1769)},
+	{0x052C, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16 RDS_TMC_EVENT_STRING(0x9DE7, 0x1772)},
+	{0x052D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 16 RDS_TMC_EVENT_STRING(0x9E10, 0x177B)},
+	{0x052E, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16 RDS_TMC_EVENT_STRING(0x9E1F, 0x1784)},
+	{0x052F, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 33 RDS_TMC_EVENT_STRING(0x9E46, 0x178C)},
+	{0x0530, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 35 RDS_TMC_EVENT_STRING(0x9E66, 0x1794)},
+	{0x0531, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 35 RDS_TMC_EVENT_STRING(0x9E8D, 0x179D)},
+	{0x0532, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 35 RDS_TMC_EVENT_STRING(0x9EB4, 0x17A4)},
+	{0x0533, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 35 RDS_TMC_EVENT_STRING(0x9EDB, 0x17AB)},
+	{0x0534, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 9 RDS_TMC_EVENT_STRING(0x9F07, 0x17B4)},
+	{0x0535, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 35 RDS_TMC_EVENT_STRING(0x9F13, 0x17B9)},
+	{0x0536, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 35 RDS_TMC_EVENT_STRING(0x9F2D, 0x17BD)},
+	{0x0537, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 35 RDS_TMC_EVENT_STRING(0x9F55, 0x17CB)},
+	{0x0538, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 35 RDS_TMC_EVENT_STRING(0x9F7F, 0x17DC)},
+	{0x0539, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16 RDS_TMC_EVENT_STRING(0x9FA6, 0x17EA)},
+	{0x053A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9 RDS_TMC_EVENT_STRING(0x9FDF, 0x17F9)},
+	{0x053B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 35 RDS_TMC_EVENT_STRING(0xA004, 0x1803)},
+	{0x053C, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16 RDS_TMC_EVENT_STRING(0xA01A, 0x180A)},
+	{0x0541, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 16 RDS_TMC_EVENT_STRING(0xA048, 0x1816)},
+	{0x0542, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 16 RDS_TMC_EVENT_STRING(0xA056, 0x181D)},
+	{0x0547, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37 RDS_TMC_EVENT_STRING(0xA06E, 0x1822)},
+	{0x0548, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37 RDS_TMC_EVENT_STRING(0xA08B, 0x182A)},
+	{0x0549, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37 RDS_TMC_EVENT_STRING(0xA0AA, 0x1830)},
+	{0x054A, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37 RDS_TMC_EVENT_STRING(0xA0CA, 0x1835)},
+	{0x054B, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37 RDS_TMC_EVENT_STRING(0xA0EA, 0x183B)},
+	{0x054C, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37 RDS_TMC_EVENT_STRING(0xA10A, 0x1842)},
+	{0x054D, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37 RDS_TMC_EVENT_STRING(0xA12A, 0x1847)},
+	{0x054E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 37 RDS_TMC_EVENT_STRING(0xA14F, 0x184E)},
+	{0x054F, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37 RDS_TMC_EVENT_STRING(0xA162, 0x1850)},
+	{0x0550, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37 RDS_TMC_EVENT_STRING(0xA17E, 0x1858)},
+	{0x0551, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37 RDS_TMC_EVENT_STRING(0xA1A3, 0x1863)},
+	{0x0552, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37 RDS_TMC_EVENT_STRING(0xA1B5, 0x1867)},
+	{0x0554, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37 RDS_TMC_EVENT_STRING(0xA1E2, 0x1881)},
+	{0x0555, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37 RDS_TMC_EVENT_STRING(0xA1FB, 0x188E)},
+	{0x0579, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37 RDS_TMC_EVENT_STRING(0xA211, 0x189B)},
+	{0x057A, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37 RDS_TMC_EVENT_STRING(0xA22E, 0x18A3)},
+	{0x057B, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37 RDS_TMC_EVENT_STRING(0xA252, 0x18AA)},
+	{0x057C, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37 RDS_TMC_EVENT_STRING(0xA271, 0x18AF)},
+	{0x057D, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37 RDS_TMC_EVENT_STRING(0xA290, 0x18B5)},
+	{0x057E, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37 RDS_TMC_EVENT_STRING(0xA2AF, 0x18BD)},
+	{0x057F, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37 RDS_TMC_EVENT_STRING(0xA2CE, 0x18C2)},
+	{0x0580, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37 RDS_TMC_EVENT_STRING(0xA2F2, 0x18C9)},
+	{0x05A9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xA316, 0x18D6)},
+	{0x05AA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 18 RDS_TMC_EVENT_STRING(0xA336, 0x18DF)},
+	{0x05AB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xA354, 0x18E8)},
+	{0x05AC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 18 RDS_TMC_EVENT_STRING(0xA35B, 0x18EB)},
+	{0x05AD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xA367, 0x18F0)},
+	{0x05AE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xA37A, 0x18F9)},
+	{0x05AF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xA385, 0x18FE)},
+	{0x05B0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xA398, 0x1907)},
+	{0x05B1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xA3A4, 0x1910)},
+	{0x05B2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xA3B3, 0x191A)},
+	{0x05B3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xA3BF, 0x1922)},
+	{0x05B4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xA3CF, 0x192B)},
+	{0x05B5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xA3E0, 0x1934)},
+	{0x05B6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xA3EA, 0x193A)},
+	{0x05B7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xA3F8, 0x1940)},
+	{0x05B8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xA405, 0x1948)},
+	{0x05B9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xA413, 0x1952)},
+	{0x05BA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xA426, 0x195D)},
+	{0x05BB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xA43C, 0x1961)},
+	{0x05BC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xA453, 0x1967)},
+	{0x05BD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 18 RDS_TMC_EVENT_STRING(0xA45C, 0x196B)},
+	{0x05BE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xA468, 0x1971)},
+	{0x05BF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 13 RDS_TMC_EVENT_STRING(0xA474, 0x1979)},
+	{0x05C0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 13 RDS_TMC_EVENT_STRING(0xA493, 0x198E)},
+	{0x05C1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 13 RDS_TMC_EVENT_STRING(0xA4A6, 0x1995)},
+	{0x05C2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 13 RDS_TMC_EVENT_STRING(0xA4BB, 0x199D)},
+	{0x05C3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 18 RDS_TMC_EVENT_STRING(0xA4D0, 0x19A6)},
+	{0x05C4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 19 RDS_TMC_EVENT_STRING(0xA4D8, 0x19A9)},
+	{0x05C5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 19 RDS_TMC_EVENT_STRING(0xA4EB, 0x19AC)},
+	{0x05C6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 19 RDS_TMC_EVENT_STRING(0xA4FE, 0x19AF)},
+	{0x05C7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_XURGENT, false, true, true, 19 RDS_TMC_EVENT_STRING(0xA512, 0x19B9)},
+	{0x05C8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 19 RDS_TMC_EVENT_STRING(0xA52E, 0x19C3)},
+	{0x05C9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_XURGENT, false, true, true, 19 RDS_TMC_EVENT_STRING(0xA53F, 0x19CB)},
+	{0x05CA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 13 RDS_TMC_EVENT_STRING(0xA551, 0x19D3)},
+	{0x05CB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 13 RDS_TMC_EVENT_STRING(0xA56C, 0x19DB)},
+	{0x05CC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 13 RDS_TMC_EVENT_STRING(0xA589, 0x19E4)},
+	{0x05CD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 9 RDS_TMC_EVENT_STRING(0xA5A6, 0x19EE)},
+	{0x05CE, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0xA5C7, 0x19F2)},
+	{0x05CF, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0xA5E7, 0x19F6)},
+	{0x05D0, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 20 RDS_TMC_EVENT_STRING(0xA610, 0x19FA)},
+	{0x05D1, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xA635, 0x19FE)},
+	{0x05D2, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xA655, 0x1A02)},
+	{0x05D3, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 20 RDS_TMC_EVENT_STRING(0xA67E, 0x1A06)},
+	{0x05D4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 19 RDS_TMC_EVENT_STRING(0xA6A3, 0x1A0A)},
+	{0x05D5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 18 RDS_TMC_EVENT_STRING(0xA6BD, 0x1A12)},
+	{0x05D6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 19 RDS_TMC_EVENT_STRING(0xA6D5, 0x1A17)},
+	{0x05D7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0xA6E1, 0x1A1E)},
+	{0x05D8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 18 RDS_TMC_EVENT_STRING(0xA6FC, 0x1A26)},
+	{0x05D9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xA718, 0x1A32)},
+	{0x05DA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 13 RDS_TMC_EVENT_STRING(0xA737, 0x1A3E)},
+	{0x05DB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 13 RDS_TMC_EVENT_STRING(0xA750, 0x1A4A)},
+	{0x05DC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_XURGENT, false, false, true, 19 RDS_TMC_EVENT_STRING(0xA76B, 0x1A55)},
+	{0x05DD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 18 RDS_TMC_EVENT_STRING(0xA788, 0x1A62)},
+	{0x05DE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xA795, 0x1A64)},
+	{0x05DF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xA7AB, 0x1A6D)},
+	{0x05E0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xA7B1, 0x1A71)},
+	{0x05E1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 18 RDS_TMC_EVENT_STRING(0xA7BB, 0x1A77)},
+	{0x05E2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xA7C7, 0x1A7E)},
+	{0x05E3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xA7CD, 0x1A80)},
+	{0x05E4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xA7D5, 0x1A86)},
+	{0x05E5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xA7E7, 0x1A90)},
+	{0x05E6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xA7F7, 0x1A9C)},
+	{0x05E7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xA7FF, 0x1A9F)},
+	{0x05E8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xA806, 0x1AA4)},
+	{0x05E9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xA80D, 0x1AA8)},
+	{0x05EA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 18 RDS_TMC_EVENT_STRING(0xA81C, 0x1AAB)},
+	{0x05EB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 19 RDS_TMC_EVENT_STRING(0xA830, 0x1AB7)},
+	{0x05EC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 19 RDS_TMC_EVENT_STRING(0xA840, 0x1AB9)},
+	{0x05ED, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0xA84C, 0x1AC1)},
+	{0x05EE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0xA86D, 0x1AC4)},
+	{0x05EF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0xA898, 0x1AC7)},
+	{0x05F0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0xA8B6, 0x1ACA)},
+	{0x05F1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0xA8DE, 0x1ACD)},
+	{0x05F2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2 RDS_TMC_EVENT_STRING(0xA8F9, 0x1AD0)},
+	{0x05F3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0xA91D, 0x1AD3)},
+	{0x05F4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2 RDS_TMC_EVENT_STRING(0xA939, 0x1AD6)},
+	{0x05F5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1 RDS_TMC_EVENT_STRING(0xA95E, 0x1AD9)},
+	{0x05F6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0xA983, 0x1ADC)},
+	{0x05F7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9 RDS_TMC_EVENT_STRING(0xA9A5, 0x1ADF)},
+	{0x05F8, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xA9C0, 0x1AE2)},
+	{0x05F9, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0xA9DA, 0x1AE5)},
+	{0x05FA, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 20 RDS_TMC_EVENT_STRING(0xA9FD, 0x1AE8)},
+	{0x05FB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0xAA1C, 0x1AEB)},
+	{0x05FC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0xAA40, 0x1AEE)},
+	{0x05FD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0xAA6E, 0x1AF1)},
+	{0x05FE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0xAA8F, 0x1AF4)},
+	{0x05FF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0xAABA, 0x1AF7)},
+	{0x0600, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2 RDS_TMC_EVENT_STRING(0xAAD8, 0x1AFA)},
+	{0x0601, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0xAAFF, 0x1AFD)},
+	{0x0602, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2 RDS_TMC_EVENT_STRING(0xAB1E, 0x1B00)},
+	{0x0603, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1 RDS_TMC_EVENT_STRING(0xAB46, 0x1B03)},
+	{0x0604, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0xAB6E, 0x1B06)},
+	{0x0605, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9 RDS_TMC_EVENT_STRING(0xAB93, 0x1B09)},
+	{0x0606, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xABB1, 0x1B0C)},
+	{0x0607, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xABCE, 0x1B0F)},
+	{0x0608, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0xABF4, 0x1B12)},
+	{0x0609, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0xAC16, 0x1B15)},
+	{0x060A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0xAC30, 0x1B18)},
+	{0x060B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0xAC54, 0x1B1B)},
+	{0x060C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0xAC6B, 0x1B1E)},
+	{0x060D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0xAC8C, 0x1B21)},
+	{0x060E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2 RDS_TMC_EVENT_STRING(0xACA0, 0x1B24)},
+	{0x060F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0xACBD, 0x1B27)},
+	{0x0610, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2 RDS_TMC_EVENT_STRING(0xACD2, 0x1B2A)},
+	{0x0611, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1 RDS_TMC_EVENT_STRING(0xACF0, 0x1B2D)},
+	{0x0612, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0xAD0E, 0x1B30)},
+	{0x0613, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9 RDS_TMC_EVENT_STRING(0xAD29, 0x1B33)},
+	{0x0614, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xAD3D, 0x1B3C)},
+	{0x0615, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xAD50, 0x1B3F)},
+	{0x0616, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0xAD6C, 0x1B42)},
+	{0x0617, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9 RDS_TMC_EVENT_STRING(0xAD84, 0x1B45)},
+	{0x0618, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xAD9A, 0x1B49)},
+	{0x0619, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0xADAF, 0x1B4D)},
+	{0x061A, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0xADCD, 0x1B51)},
+	{0x061B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9 RDS_TMC_EVENT_STRING(0xADE7, 0x1B55)},
+	{0x061C, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0xADFD, 0x1B59)},
+	{0x061D, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0xAE12, 0x1B5D)},
+	{0x061E, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 20 RDS_TMC_EVENT_STRING(0xAE30, 0x1B61)},
+	{0x061F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9 RDS_TMC_EVENT_STRING(0xAE4A, 0x1B65)},
+	{0x0620, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xAE67, 0x1B69)},
+	{0x0621, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0xAE83, 0x1B6D)},
+	{0x0622, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0xAEA8, 0x1B71)},
+	{0x0623, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0xAEC9, 0x1B75)},
+	{0x0624, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0xAEED, 0x1B78)},
+	{0x0625, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0xAF1B, 0x1B7B)},
+	{0x0626, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0xAF3C, 0x1B7E)},
+	{0x0627, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0xAF67, 0x1B81)},
+	{0x0628, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2 RDS_TMC_EVENT_STRING(0xAF85, 0x1B84)},
+	{0x0629, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0xAFAC, 0x1B87)},
+	{0x062A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2 RDS_TMC_EVENT_STRING(0xAFCB, 0x1B8A)},
+	{0x062B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0xAFF3, 0x1B8D)},
+	{0x062C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9 RDS_TMC_EVENT_STRING(0xB018, 0x1B90)},
+	{0x062D, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xB036, 0x1B93)},
+	{0x062E, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xB053, 0x1B96)},
+	{0x062F, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0xB079, 0x1B99)},
+	{0x0630, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1 RDS_TMC_EVENT_STRING(0xB09B, 0x1B9C)},
+	{0x0631, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 18 RDS_TMC_EVENT_STRING(0xB0BB, 0x1BAB)},
+	{0x0632, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1 RDS_TMC_EVENT_STRING(0xB0CE, 0x1BAD)},
+	{0x0633, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 19 RDS_TMC_EVENT_STRING(0xB0F6, 0x1BB0)},
+	{0x0634, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 19 RDS_TMC_EVENT_STRING(0xB112, 0x1BBB)},
+	{0x0635, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 2 RDS_TMC_EVENT_STRING(0xB12D, 0x1BC4)},
+	{0x0636, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 18 RDS_TMC_EVENT_STRING(0xB140, 0x1BC6)},
+	{0x0637, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 18 RDS_TMC_EVENT_STRING(0xB156, 0x1BCB)},
+	{0x0638, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xB185, 0x1BD9)},
+	{0x0639, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xB196, 0x1BE5)},
+	{0x063A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xB1A5, 0x1BED)},
+	{0x063B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xB1B6, 0x1BF8)},
+	{0x063C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xB1C1, 0x1BFF)},
+	{0x063D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18 RDS_TMC_EVENT_STRING(0xB1CA, 0x1C04)},
+	{0x0641, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xB1D7, 0x1C0D)},
+	{0x0642, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xB1E4, 0x1C10)},
+	{0x0643, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xB1FD, 0x1C17)},
+	{0x0644, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xB216, 0x1C1D)},
+	{0x0645, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0xB22D, 0x1C24)},
+	{0x0646, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0xB245, 0x1C2D)},
+	{0x0647, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xB25E, 0x1C32)},
+	{0x0648, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0xB274, 0x1C37)},
+	{0x0649, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xB286, 0x1C3C)},
+	{0x064A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xB2A6, 0x1C41)},
+	{0x064B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xB2D5, 0x1C4B)},
+	{0x064C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xB304, 0x1C54)},
+	{0x064D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0xB331, 0x1C5F)},
+	{0x064E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0xB35F, 0x1C6A)},
+	{0x064F, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, true, false, 21 RDS_TMC_EVENT_STRING(0xB38E, 0x1C71)},
+	{0x0650, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 21 RDS_TMC_EVENT_STRING(0xB3AC, 0x1C7B)},
+	{0x0651, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 21 RDS_TMC_EVENT_STRING(0xB3C4, 0x1C80)},
+	{0x0652, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 21 RDS_TMC_EVENT_STRING(0xB3E2, 0x1C84)},
+	{0x0653, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 21 RDS_TMC_EVENT_STRING(0xB413, 0x1C8B)},
+	{0x0654, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xB42C, 0x1C90)},
+	{0x0655, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xB43F, 0x1C92)},
+	{0x0656, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xB457, 0x1C98)},
+	{0x0657, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xB470, 0x1C9D)},
+	{0x0658, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xB489, 0x1CA2)},
+	{0x0659, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xB4A2, 0x1CA9)},
+	{0x065A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xB4BB, 0x1CAE)},
+	{0x065B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0xB4D4, 0x1CB4)},
+	{0x065C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0xB4ED, 0x1CB9)},
+	{0x065D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 20 RDS_TMC_EVENT_STRING(0xB507, 0x1CC2)},
+	{0x065E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 20 RDS_TMC_EVENT_STRING(0xB520, 0x1CCC)},
+	{0x065F, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 20 RDS_TMC_EVENT_STRING(0xB539, 0x1CD6)},
+	{0x0660, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xB550, 0x1CDD)},
+	{0x0661, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 21 RDS_TMC_EVENT_STRING(0xB56E, 0x1CEA)},
+	{0x0662, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 21 RDS_TMC_EVENT_STRING(0xB58C, 0x1CFC)},
+	{0x0663, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 21 RDS_TMC_EVENT_STRING(0xB59B, 0x1D03)},
+	{0x0664, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 21 RDS_TMC_EVENT_STRING(0xB5CB, 0x1D08)},
+	{0x0665, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 21 RDS_TMC_EVENT_STRING(0xB603, 0x1D13)},
+	{0x0666, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 21 RDS_TMC_EVENT_STRING(0xB62D, 0x1D18)},
+	{0x0667, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 21 RDS_TMC_EVENT_STRING(0xB655, 0x1D1E)},
+	{0x0668, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 21 RDS_TMC_EVENT_STRING(0xB67C, 0x1D24)},
+	{0x0669, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 21 RDS_TMC_EVENT_STRING(0xB6A2, 0x1D2E)},
+	{0x066A, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xB6CD, 0x1D3B)},
+	{0x066B, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xB6F0, 0x1D40)},
+	{0x066C, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 21 RDS_TMC_EVENT_STRING(0xB707, 0x1D47)},
+	{0x066D, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 21 RDS_TMC_EVENT_STRING(0xB73B, 0x1D4E)},
+	{0x066E, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, true, false, 22 RDS_TMC_EVENT_STRING(0xB763, 0x1D57)},
+	{0x066F, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, true, false, 22 RDS_TMC_EVENT_STRING(0xB78E, 0x1D5E)},
+	{0x0670, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 20 RDS_TMC_EVENT_STRING(0xB7AD, 0x1D67)},
+	{0x0671, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 21 RDS_TMC_EVENT_STRING(0xB7BD, 0x1D6B)},
+	{0x0672, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xB7ED, 0x1D70)},
+	{0x0673, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 21 RDS_TMC_EVENT_STRING(0xB803, 0x1D7A)},
+	{0x0674, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 21 RDS_TMC_EVENT_STRING(0xB831, 0x1D83)},
+	{0x0675, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0xB849, 0x1D8B)},
+	{0x0676, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 20 RDS_TMC_EVENT_STRING(0xB85F, 0x1D8F)},
+	{0x0677, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, true, false, 21 RDS_TMC_EVENT_STRING(0xB87A, 0x1D95)},
+	{0x0678, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, true, false, 22 RDS_TMC_EVENT_STRING(0xB8A0, 0x1D9F)},
+	{0x0679, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 21 RDS_TMC_EVENT_STRING(0xB8B3, 0x1DA7)},
+	{0x067A, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 21 RDS_TMC_EVENT_STRING(0xB8D9, 0x1DAD)},
+	{0x067B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 21 RDS_TMC_EVENT_STRING(0xB8FE, 0x1DB3)},
+	{0x067C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 21 RDS_TMC_EVENT_STRING(0xB91E, 0x1DBC)},
+	{0x067D, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 21 RDS_TMC_EVENT_STRING(0xB948, 0x1DC4)},
+	{0x067E, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 22 RDS_TMC_EVENT_STRING(0xB970, 0x1DCB)},
+	{0x067F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xB98E, 0x1DD6)},
+	{0x0680, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 18 RDS_TMC_EVENT_STRING(0xB9AC, 0x1DE3)},
+	{0x0690, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, false, 38 RDS_TMC_EVENT_STRING(0xB9C7, 0x1DEA)},
+	{0x0691, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 38 RDS_TMC_EVENT_STRING(0xB9E8, 0x1DF0)},
+	{0x0692, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 38 RDS_TMC_EVENT_STRING(0xBA15, 0x1DF7)},
+	{0x0693, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, false, 38 RDS_TMC_EVENT_STRING(0xBA44, 0x1DFB)},
+	{0x0694, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 38 RDS_TMC_EVENT_STRING(0xBA70, 0x1DFF)},
+	{0x0695, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 38 RDS_TMC_EVENT_STRING(0xBA9B, 0x1E03)},
+	{0x0696, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 38 RDS_TMC_EVENT_STRING(0xBAC9, 0x1E07)},
+	{0x0697, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 38 RDS_TMC_EVENT_STRING(0xBAF2, 0x1E0C)},
+	{0x0698, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 38 RDS_TMC_EVENT_STRING(0xBB31, 0x1E17)},
+	{0x0699, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 38 RDS_TMC_EVENT_STRING(0xBB52, 0x1E1C)},
+	{0x069A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 38 RDS_TMC_EVENT_STRING(0xBB78, 0x1E23)},
+	{0x069B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 38 RDS_TMC_EVENT_STRING(0xBB92, 0x1E29)},
+	{0x069F, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 22 RDS_TMC_EVENT_STRING(0xBBA5, 0x1E2B)},
+	{0x06A0, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 22 RDS_TMC_EVENT_STRING(0xBBBD, 0x1E38)},
+	{0x06A4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12 RDS_TMC_EVENT_STRING(0xBBD6, 0x1E41)},
+	{0x06A5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_XURGENT, false, true, true, 23 RDS_TMC_EVENT_STRING(0xBBFF, 0x1E46)},
+	{0x06A6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 23 RDS_TMC_EVENT_STRING(0xBC25, 0x1E53)},
+	{0x06A7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 23 RDS_TMC_EVENT_STRING(0xBC48, 0x1E5D)},
+	{0x06A8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 23 RDS_TMC_EVENT_STRING(0xBC5B, 0x1E5F)},
+	{0x06A9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 23 RDS_TMC_EVENT_STRING(0xBC74, 0x1E6B)},
+	{0x06AA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 23 RDS_TMC_EVENT_STRING(0xBC9F, 0x1E76)},
+	{0x06AB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_XURGENT, false, false, false, 23 RDS_TMC_EVENT_STRING(0xBCB8, 0x1E7A)},
+	{0x06AC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_XURGENT, false, true, false, 23 RDS_TMC_EVENT_STRING(0xBCDC, 0x1E83)},
+	{0x06AD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12 RDS_TMC_EVENT_STRING(0xBD06, 0x1E96)},
+	{0x06AE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 23 RDS_TMC_EVENT_STRING(0xBD2E, 0x1EA6)},
+	{0x06AF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 23 RDS_TMC_EVENT_STRING(0xBD53, 0x1EB6)},
+	{0x06B0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 12 RDS_TMC_EVENT_STRING(0xBD76, 0x1EBC)},
+	{0x06B8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 21 RDS_TMC_EVENT_STRING(0xBD84, 0x1EBF)},
+	{0x06B9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 21 RDS_TMC_EVENT_STRING(0xBD9D, 0x1EC4)},
+	{0x06C3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 24 RDS_TMC_EVENT_STRING(0xBDC6, 0x1ECC)},
+	{0x06C4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 24 RDS_TMC_EVENT_STRING(0xBDE5, 0x1ED2)},
+	{0x06C5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 24 RDS_TMC_EVENT_STRING(0xBE00, 0x1ED9)},
+	{0x06C6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 24 RDS_TMC_EVENT_STRING(0xBE1B, 0x1EE0)},
+	{0x06C7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 24 RDS_TMC_EVENT_STRING(0xBE39, 0x1EE7)},
+	{0x06C8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 23 RDS_TMC_EVENT_STRING(0xBE5F, 0x1EF4)},
+	{0x06C9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 24 RDS_TMC_EVENT_STRING(0xBE95, 0x1F01)},
+	{0x06CA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 24 RDS_TMC_EVENT_STRING(0xBEAD, 0x1F07)},
+	{0x06CB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 24 RDS_TMC_EVENT_STRING(0xBECE, 0x1F12)},
+	{0x06CC, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0xBEEF, 0x1F1A)},
+	{0x06CD, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0xBF20, 0x1F23)},
+	{0x06D7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 24 RDS_TMC_EVENT_STRING(0xBF4A, 0x1F2B)},
+	{0x06D8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 24 RDS_TMC_EVENT_STRING(0xBF61, 0x1F31)},
+	{0x06D9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 24 RDS_TMC_EVENT_STRING(0xBF74, 0x1F38)},
+	{0x06DA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 24 RDS_TMC_EVENT_STRING(0xBF87, 0x1F3F)},
+	{0x06DB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 24 RDS_TMC_EVENT_STRING(0xBF9D, 0x1F44)},
+	{0x06DC, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0xBFAD, 0x1F48)},
+	{0x06DD, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xBFC9, 0x1F4C)},
+	{0x06DE, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0xBFEE, 0x1F50)},
+	{0x06DF, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xC00F, 0x1F54)},
+	{0x06E0, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xC02B, 0x1F5B)},
+	{0x06E1, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0xC049, 0x1F5F)},
+	{0x06E2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 24 RDS_TMC_EVENT_STRING(0xC06A, 0x1F68)},
+	{0x06E3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 24 RDS_TMC_EVENT_STRING(0xC08C, 0x1F74)},
+	{0x06E4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 24 RDS_TMC_EVENT_STRING(0xC09F, 0x1F76)},
+	{0x06E5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 23 RDS_TMC_EVENT_STRING(0xC0BD, 0x1F81)},
+	{0x06E6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 24 RDS_TMC_EVENT_STRING(0xC0EB, 0x1F8D)},
+	{0x06E7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 24 RDS_TMC_EVENT_STRING(0xC104, 0x1F96)},
+	{0x06E8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 23 RDS_TMC_EVENT_STRING(0xC12A, 0x1FA6)},
+	{0x06E9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 23 RDS_TMC_EVENT_STRING(0xC172, 0x1FC7)},
+	{0x06EA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 24 RDS_TMC_EVENT_STRING(0xC192, 0x1FCF)},
+	{0x06EB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 13 RDS_TMC_EVENT_STRING(0xC1A2, 0x1FD3)},
+	{0x06F4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, false, 39 RDS_TMC_EVENT_STRING(0xC1B3, 0x1FD6)},
+	{0x06F5, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, true, false, 39 RDS_TMC_EVENT_STRING(0xC1D6, 0x1FDF)},
+	{0x06F6, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, true, true, 39 RDS_TMC_EVENT_STRING(0xC1FC, 0x1FE9)},
+	{0x06F7, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, true, true, 39 RDS_TMC_EVENT_STRING(0xC234, 0x1FEE)},
+	{0x06F8, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, true, true, 39 RDS_TMC_EVENT_STRING(0xC266, 0x1FF3)},
+	{0x06F9, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, true, true, 39 RDS_TMC_EVENT_STRING(0xC296, 0x1FF9)},
+	{0x06FA, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, true, true, 39 RDS_TMC_EVENT_STRING(0xC2CE, 0x1FFE)},
+	{0x06FB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 39 RDS_TMC_EVENT_STRING(0xC304, 0x2007)},
+	{0x06FC, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, true, true, 39 RDS_TMC_EVENT_STRING(0xC328, 0x2010)},
+	{0x06FD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 39 RDS_TMC_EVENT_STRING(0xC358, 0x2017)},
+	{0x06FE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 39 RDS_TMC_EVENT_STRING(0xC372, 0x201B)},
+	{0x0709, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 25 RDS_TMC_EVENT_STRING(0xC385, 0x201D)},
+	{0x070A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 25 RDS_TMC_EVENT_STRING(0xC3A5, 0x2021)},
+	{0x070B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 25 RDS_TMC_EVENT_STRING(0xC3C7, 0x2027)},
+	{0x070C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 25 RDS_TMC_EVENT_STRING(0xC3EF, 0x2030)},
+	{0x070D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 25 RDS_TMC_EVENT_STRING(0xC418, 0x2032)},
+	{0x070E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 25 RDS_TMC_EVENT_STRING(0xC449, 0x2038)},
+	{0x070F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0xC461, 0x203A)},
+	{0x0710, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0xC49E, 0x203D)},
+	{0x0711, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0xC4E5, 0x2040)},
+	{0x0712, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0xC51F, 0x2043)},
+	{0x0713, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0xC563, 0x2046)},
+	{0x0714, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2 RDS_TMC_EVENT_STRING(0xC59A, 0x2049)},
+	{0x0715, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0xC5DA, 0x204C)},
+	{0x0716, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2 RDS_TMC_EVENT_STRING(0xC612, 0x204F)},
+	{0x0717, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1 RDS_TMC_EVENT_STRING(0xC653, 0x2052)},
+	{0x0718, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0xC694, 0x2055)},
+	{0x0719, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xC6D2, 0x2058)},
+	{0x071A, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xC6FB, 0x205D)},
+	{0x071B, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0xC72D, 0x2062)},
+	{0x071C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0xC75B, 0x2067)},
+	{0x071D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0xC787, 0x206A)},
+	{0x071E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0xC7BD, 0x206D)},
+	{0x071F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0xC7E6, 0x2070)},
+	{0x0720, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1 RDS_TMC_EVENT_STRING(0xC819, 0x2073)},
+	{0x0721, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2 RDS_TMC_EVENT_STRING(0xC83F, 0x2076)},
+	{0x0722, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0xC86E, 0x2079)},
+	{0x0723, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2 RDS_TMC_EVENT_STRING(0xC895, 0x207C)},
+	{0x0724, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1 RDS_TMC_EVENT_STRING(0xC8C5, 0x207F)},
+	{0x0725, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1 RDS_TMC_EVENT_STRING(0xC8F5, 0x2082)},
+	{0x0726, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xC922, 0x2085)},
+	{0x0727, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xC947, 0x2088)},
+	{0x0728, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0xC975, 0x208B)},
+	{0x0729, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 25 RDS_TMC_EVENT_STRING(0xC99F, 0x208E)},
+	{0x072A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 25 RDS_TMC_EVENT_STRING(0xC9BA, 0x20A0)},
+	{0x072B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 25 RDS_TMC_EVENT_STRING(0xC9DE, 0x20AF)},
+	{0x072C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 25 RDS_TMC_EVENT_STRING(0xC9F8, 0x20BA)},
+	{0x072D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 25 RDS_TMC_EVENT_STRING(0xCA1D, 0x20CA)},
+	{0x072E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 25 RDS_TMC_EVENT_STRING(0xCA30, 0x20CC)},
+	{0x072F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 25 RDS_TMC_EVENT_STRING(0xCA58, 0x20D0)},
+	{0x0730, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 25 RDS_TMC_EVENT_STRING(0xCA76, 0x20D5)},
+	{0x0731, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 25 RDS_TMC_EVENT_STRING(0xCA9A, 0x20E0)},
+	{0x0732, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 25 RDS_TMC_EVENT_STRING(0xCAC6, 0x20EB)},
+	{0x0733, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 25 RDS_TMC_EVENT_STRING(0xCAE8, 0x20F7)},
+	{0x0734, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 25 RDS_TMC_EVENT_STRING(0xCB17, 0x2104)},
+	{0x0735, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 25 RDS_TMC_EVENT_STRING(0xCB4E, 0x2111)},
+	{0x0736, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 25 RDS_TMC_EVENT_STRING(0xCB81, 0x2116)},
+	{0x0737, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 25 RDS_TMC_EVENT_STRING(0xCBBC, 0x211E)},
+	{0x0738, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 25 RDS_TMC_EVENT_STRING(0xCBE9, 0x2121)},
+	{0x0739, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 25 RDS_TMC_EVENT_STRING(0xCC09, 0x212C)},
+	{0x073A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 25 RDS_TMC_EVENT_STRING(0xCC29, 0x2139)},
+	{0x073B, RDS_TMC_QUANTIFIER_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 26 RDS_TMC_EVENT_STRING(0xCC51, 0x213E)},
+	{0x073C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 26 RDS_TMC_EVENT_STRING(0xCC6D, 0x2146)},
+	{0x073E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 9 RDS_TMC_EVENT_STRING(0xCC8B, 0x214E)},
+	{0x073F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28 RDS_TMC_EVENT_STRING(0xCCB2, 0x215F)},
+	{0x0740, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28 RDS_TMC_EVENT_STRING(0xCCD9, 0x2165)},
+	{0x0741, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 26 RDS_TMC_EVENT_STRING(0xCD06, 0x216B)},
+	{0x0742, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xCD19, 0x216D)},
+	{0x0745, RDS_TMC_QUANTIFIER_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 26 RDS_TMC_EVENT_STRING(0xCD32, 0x2178)},
+	{0x0746, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 26 RDS_TMC_EVENT_STRING(0xCD4F, 0x217F)},
+	{0x0747, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 25 RDS_TMC_EVENT_STRING(0xCD6E, 0x2186)},
+	{0x0748, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 25 RDS_TMC_EVENT_STRING(0xCD98, 0x219A)},
+	{0x0749, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 25 RDS_TMC_EVENT_STRING(0xCDC8, 0x219F)},
+	{0x074A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 25 RDS_TMC_EVENT_STRING(0xCE0E, 0x21BE)},
+	{0x074B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 25 RDS_TMC_EVENT_STRING(0xCE57, 0x21DD)},
+	{0x074C, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xCE88, 0x21E0)},
+	{0x074D, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xCEB9, 0x21E5)},
+	{0x074E, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0xCEF3, 0x21EA)},
+	{0x074F, RDS_TMC_QUANTIFIER_TONNES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 26 RDS_TMC_EVENT_STRING(0xCF29, 0x21EF)},
+	{0x0750, RDS_TMC_QUANTIFIER_TONNES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 26 RDS_TMC_EVENT_STRING(0xCF49, 0x21FB)},
+	{0x0751, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 26 RDS_TMC_EVENT_STRING(0xCF6C, 0x2209)},
+	{0x0752, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 26 RDS_TMC_EVENT_STRING(0xCF91, 0x2217)},
+	{0x0753, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 25 RDS_TMC_EVENT_STRING(0xCFB5, 0x2224)},
+	{0x0754, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xCFEE, 0x222B)},
+	{0x0755, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xD021, 0x2231)},
+	{0x0756, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0xD05D, 0x2237)},
+	{0x0757, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 25 RDS_TMC_EVENT_STRING(0xD095, 0x223D)},
+	{0x0758, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xD0D0, 0x2243)},
+	{0x0759, RDS_TMC_QUANTIFIER_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 26 RDS_TMC_EVENT_STRING(0xD10A, 0x2247)},
+	{0x075A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 26 RDS_TMC_EVENT_STRING(0xD127, 0x2250)},
+	{0x075B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 27 RDS_TMC_EVENT_STRING(0xD146, 0x2259)},
+	{0x075C, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20 RDS_TMC_EVENT_STRING(0xD159, 0x225B)},
+	{0x075D, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20 RDS_TMC_EVENT_STRING(0xD19C, 0x225F)},
+	{0x075E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 27 RDS_TMC_EVENT_STRING(0xD1DB, 0x2263)},
+	{0x075F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 27 RDS_TMC_EVENT_STRING(0xD1FF, 0x226A)},
+	{0x0760, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28 RDS_TMC_EVENT_STRING(0xD226, 0x2278)},
+	{0x0761, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28 RDS_TMC_EVENT_STRING(0xD230, 0x227C)},
+	{0x0762, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28 RDS_TMC_EVENT_STRING(0xD23A, 0x2280)},
+	{0x0763, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28 RDS_TMC_EVENT_STRING(0xD244, 0x2284)},
+	{0x0764, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28 RDS_TMC_EVENT_STRING(0xD24E, 0x2288)},
+	{0x0765, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28 RDS_TMC_EVENT_STRING(0xD258, 0x228C)},
+	{0x0766, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28 RDS_TMC_EVENT_STRING(0xD262, 0x2290)},
+	{0x0767, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28 RDS_TMC_EVENT_STRING(0xD26C, 0x2294)},
+	{0x0768, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28 RDS_TMC_EVENT_STRING(0xD276, 0x2298)},
+	{0x0769, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28 RDS_TMC_EVENT_STRING(0xD280, 0x229C)},
+	{0x076A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28 RDS_TMC_EVENT_STRING(0xD2A7, 0x22A2)},
+	{0x076B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28 RDS_TMC_EVENT_STRING(0xD2CE, 0x22A8)},
+	{0x076C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28 RDS_TMC_EVENT_STRING(0xD2F5, 0x22AE)},
+	{0x076D, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, true, false, 22 RDS_TMC_EVENT_STRING(0xD31C, 0x22B4)},
+	{0x076E, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, true, false, 22 RDS_TMC_EVENT_STRING(0xD331, 0x22B7)},
+	{0x076F, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 28 RDS_TMC_EVENT_STRING(0xD359, 0x22BE)},
+	{0x0770, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 28 RDS_TMC_EVENT_STRING(0xD36D, 0x22C6)},
+	{0x0771, RDS_TMC_QUANTIFIER_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28 RDS_TMC_EVENT_STRING(0xD386, 0x22D1)},
+	{0x0772, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 21 RDS_TMC_EVENT_STRING(0xD3B3, 0x22D9)},
+	{0x0773, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 31 RDS_TMC_EVENT_STRING(0xD3DF, 0x22DF)},
+	{0x0774, RDS_TMC_QUANTIFIER_MHZ, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 29 RDS_TMC_EVENT_STRING(0xD3ED, 0x22E8)},
+	{0x0775, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, true, false, 29 RDS_TMC_EVENT_STRING(0xD40C, 0x22FB)},
+	{0x0776, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, true, true, false, 29 RDS_TMC_EVENT_STRING(0xD465, 0x2329)},
+	{0x0777, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 29 RDS_TMC_EVENT_STRING(0xD4BB, 0x2351)},
+	{0x0779, RDS_TMC_QUANTIFIER_KHZ, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 29 RDS_TMC_EVENT_STRING(0xD4CE, 0x2353)},
+	{0x077A, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 30 RDS_TMC_EVENT_STRING(0xD4ED, 0x2366)},
+	{0x077B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 31 RDS_TMC_EVENT_STRING(0xD512, 0x236A)},
+	{0x077C, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 30 RDS_TMC_EVENT_STRING(0xD555, 0x238F)},
+	{0x077D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 25 RDS_TMC_EVENT_STRING(0xD594, 0x23A2)},
+	{0x077E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 28 RDS_TMC_EVENT_STRING(0xD5C5, 0x23C0)},
+	{0x0780, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28 RDS_TMC_EVENT_STRING(0xD5CB, 0x23C3)},
+	{0x0781, RDS_TMC_QUANTIFIER_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28 RDS_TMC_EVENT_STRING(0xD5F0, 0x23CD)},
+	{0x0782, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, true, 28 RDS_TMC_EVENT_STRING(0xD60F, 0x23D1)},
+	{0x0783, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 28 RDS_TMC_EVENT_STRING(0xD62B, 0x23DF)},
+	{0x0784, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 28 RDS_TMC_EVENT_STRING(0xD64F, 0x23E7)},
+	{0x0785, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28 RDS_TMC_EVENT_STRING(0xD66B, 0x23F7)},
+	{0x0786, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 28 RDS_TMC_EVENT_STRING(0xD69E, 0x2407)},
+	{0x0787, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 27 RDS_TMC_EVENT_STRING(0xD6BB, 0x240B)},
+	{0x0788, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 27 RDS_TMC_EVENT_STRING(0xD6D2, 0x2411)},
+	{0x0789, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, true, true, 29 RDS_TMC_EVENT_STRING(0xD6F7, 0x241B)},
+	{0x078A, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 30 RDS_TMC_EVENT_STRING(0xD740, 0x2439)},
+	{0x078B, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, true, true, 29 RDS_TMC_EVENT_STRING(0xD76B, 0x244A)},
+	{0x078C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 30 RDS_TMC_EVENT_STRING(0xD7B6, 0x2465)},
+	{0x078E, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28 RDS_TMC_EVENT_STRING(0xD7EF, 0x246A)},
+	{0x0792, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28 RDS_TMC_EVENT_STRING(0xD822, 0x2470)},
+	{0x0793, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 30 RDS_TMC_EVENT_STRING(0xD84D, 0x2477)},
+	{0x0794, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 30 RDS_TMC_EVENT_STRING(0xD87E, 0x248B)},
+	{0x0795, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 30 RDS_TMC_EVENT_STRING(0xD8C2, 0x2498)},
+	{0x0796, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 30 RDS_TMC_EVENT_STRING(0xD903, 0x24A3)},
+	{0x0797, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 30 RDS_TMC_EVENT_STRING(0xD94F, 0x24AE)},
+	{0x0798, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 30 RDS_TMC_EVENT_STRING(0xD990, 0x24B7)},
+	{0x0799, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 30 RDS_TMC_EVENT_STRING(0xD9BE, 0x24C3)},
+	{0x079A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 30 RDS_TMC_EVENT_STRING(0xD9F1, 0x24D4)},
+	{0x079B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 30 RDS_TMC_EVENT_STRING(0xDA21, 0x24E4)},
+	{0x079C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 30 RDS_TMC_EVENT_STRING(0xDA5C, 0x24F6)},
+	{0x079D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 30 RDS_TMC_EVENT_STRING(0xDA94, 0x2506)},
+	{0x079E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 30 RDS_TMC_EVENT_STRING(0xDACA, 0x2519)},
+	{0x079F, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 30 RDS_TMC_EVENT_STRING(0xDAEF, 0x2525)},
+	{0x07A0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 30 RDS_TMC_EVENT_STRING(0xDB20, 0x252E)},
+	{0x07A1, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 30 RDS_TMC_EVENT_STRING(0xDB4B, 0x2535)},
+	{0x07A2, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, true, true, 30 RDS_TMC_EVENT_STRING(0xDB78, 0x254D)},
+	{0x07A3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 29 RDS_TMC_EVENT_STRING(0xDBA0, 0x2560)},
+	{0x07A4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 30 RDS_TMC_EVENT_STRING(0xDBCF, 0x2574)},
+	{0x07A5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 30 RDS_TMC_EVENT_STRING(0xDC00, 0x2580)},
+	{0x07A9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 9 RDS_TMC_EVENT_STRING(0xDC48, 0x259D)},
+	{0x07AA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 10 RDS_TMC_EVENT_STRING(0xDC7E, 0x25AF)},
+	{0x07AB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 10 RDS_TMC_EVENT_STRING(0xDCA7, 0x25B7)},
+	{0x07AC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 30 RDS_TMC_EVENT_STRING(0xDCD6, 0x25C4)},
+	{0x07AD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 30 RDS_TMC_EVENT_STRING(0xDCFE, 0x25CD)},
+	{0x07AE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 30 RDS_TMC_EVENT_STRING(0xDD20, 0x25D4)},
+	{0x07AF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 30 RDS_TMC_EVENT_STRING(0xDD51, 0x25DD)},
+	{0x07B3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 9 RDS_TMC_EVENT_STRING(0xDD7C, 0x25E4)},
+	{0x07B4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 9 RDS_TMC_EVENT_STRING(0xDD96, 0x25E7)},
+	{0x07B5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 9 RDS_TMC_EVENT_STRING(0xDDBA, 0x25EF)},
+	{0x07B6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 9 RDS_TMC_EVENT_STRING(0xDDE4, 0x25FC)},
+	{0x07B7, RDS_TMC_QUANTIFIER_TONNES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9 RDS_TMC_EVENT_STRING(0xDE06, 0x2608)},
+	{0x07B8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 9 RDS_TMC_EVENT_STRING(0xDE3A, 0x2613)},
+	{0x07B9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 9 RDS_TMC_EVENT_STRING(0xDE51, 0x2619)},
+	{0x07BA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 9 RDS_TMC_EVENT_STRING(0xDE8D, 0x262B)},
+	{0x07BB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 9 RDS_TMC_EVENT_STRING(0xDEBC, 0x2633)},
+	{0x07BC, RDS_TMC_QUANTIFIER_TONNES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 9 RDS_TMC_EVENT_STRING(0xDEF1, 0x2640)},
+	{0x07BD, RDS_TMC_QUANTIFIER_TONNES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 9 RDS_TMC_EVENT_STRING(0xDF24, 0x2649)},
+	{0x07BE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 6 RDS_TMC_EVENT_STRING(0xDF73, 0x266B)},
+	{0x07BF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 25 RDS_TMC_EVENT_STRING(0xDF83, 0x266F)},
+	{0x07C1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 9 RDS_TMC_EVENT_STRING(0xDF92, 0x2676)},
+	{0x07C2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 9 RDS_TMC_EVENT_STRING(0xDFB1, 0x267E)},
+	{0x07C6, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28 RDS_TMC_EVENT_STRING(0xDFD9, 0x2695)},
+	{0x07C7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 13 RDS_TMC_EVENT_STRING(0xDFF5, 0x269E)},
+	{0x07C9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 28 RDS_TMC_EVENT_STRING(0xE01C, 0x26A6)},
+	{0x07CA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 28 RDS_TMC_EVENT_STRING(0xE041, 0x26B4)},
+	{0x07CB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 28 RDS_TMC_EVENT_STRING(0xE064, 0x26BF)},
+	{0x07CE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 7 RDS_TMC_EVENT_STRING(0xE089, 0x26CC)},
+	{0x07CF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 8 RDS_TMC_EVENT_STRING(0xE0B0, 0x26DD)},
+	{0x07D0, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, true, true, 9 RDS_TMC_EVENT_STRING(0xE0D8, 0x26EE)},
+	{0x07D6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 10 RDS_TMC_EVENT_STRING(0xE0FD, 0x26F7)},
+	{0x07D7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 10 RDS_TMC_EVENT_STRING(0xE131, 0x2709)},
+	{0x07DD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 9 RDS_TMC_EVENT_STRING(0xE15D, 0x2719)},
+	{0x07E5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 21 RDS_TMC_EVENT_STRING(0xE170, 0x2720)},
+	{0x07E6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 21 RDS_TMC_EVENT_STRING(0xE1A5, 0x2732)},
+	{0x07EC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 4 RDS_TMC_EVENT_STRING(0xE1BE, 0x2737)},
+	{0x07ED, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 10 RDS_TMC_EVENT_STRING(0xE1D1, 0x2739)},
+	{0x07EE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 13 RDS_TMC_EVENT_STRING(0xE1E4, 0x273B)},
+	{0x07F0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 35 RDS_TMC_EVENT_STRING(0xE1F7, 0x273D)},
+	{0x07F1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 19 RDS_TMC_EVENT_STRING(0xE20A, 0x273F)},
+	{0x07F2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 21 RDS_TMC_EVENT_STRING(0xE21D, 0x2741)},
+	{0x07F3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 22 RDS_TMC_EVENT_STRING(0xE230, 0x2743)},
+	{0x07F6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 28 RDS_TMC_EVENT_STRING(0xE243, 0x2745)},
+	{0x07F7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 30 RDS_TMC_EVENT_STRING(0xE256, 0x2747)},
+	{0x07F8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 31 RDS_TMC_EVENT_STRING(0xE269, 0x2749)},
+	{0x07F9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, true, true, 31 RDS_TMC_EVENT_STRING(0xE27C, 0x274B)},
+	{0x07FA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 13 RDS_TMC_EVENT_STRING(0xE28F, 0x2755)},
+	{0x07FB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 14 RDS_TMC_EVENT_STRING(0xE2B0, 0x2764)},
+	{0x07FC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14 RDS_TMC_EVENT_STRING(0xE2BD, 0x276A)},
+	{0x07FD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14 RDS_TMC_EVENT_STRING(0xE2D5, 0x2771)},
+	{0x07FE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 9 RDS_TMC_EVENT_STRING(0xE2E3, 0x2777)},
+	{0x07FF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, true, true, 31 RDS_TMC_EVENT_STRING(0xE30F, 0x278C)},
+};
+
+#if defined(WITH_RDS_TMC_DIRECT_INDEX)
+const uint16_t ISO14819_2_EventIndex[2048] PROGMEM = {
+	0xFFFF, 0x0000, 0x0001, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0x0002, 0x0003, 0xFFFF, 0xFFFF, 0xFFFF,
+	0x0004, 0xFFFF, 0xFFFF, 0xFFFF, 0x0005, 0xFFFF, 0x0006, 0x0007,
+	0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x000D, 0x000E, 0xFFFF, 0x000F,
+	0x0010, 0x0011, 0x0012, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0x0013, 0x0014, 0x0015, 0xFFFF, 0x0016,
+	0x0017, 0x0018, 0xFFFF, 0xFFFF, 0xFFFF, 0x0019, 0x001A, 0x001B,
+	0x001C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x001D, 0x001E,
+	0x001F, 0x0020, 0x0021, 0x0022, 0x0023, 0xFFFF, 0xFFFF, 0xFFFF,
+	0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B,
+	0x002C, 0x002D, 0xFFFF, 0x002E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x002F, 0x0030, 0x0031,
+	0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039,
+	0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041,
+	0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049,
+	0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051,
+	0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0x0061,
+	0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069,
+	0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071,
+	0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079,
+	0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0080, 0x0081,
+	0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089,
+	0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090, 0x0091,
+	0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099,
+	0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, 0x00A0, 0x00A1,
+	0x00A2, 0xFFFF, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8,
+	0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0,
+	0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8,
+	0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0,
+	0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7, 0x00C8,
+	0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF, 0x00D0,
+	0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7, 0x00D8,
+	0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x00DF, 0x00E0,
+	0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7, 0x00E8,
+	0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF, 0x00F0,
+	0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7, 0x00F8,
+	0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF, 0x0100,
+	0x0101, 0x0102, 0x0103, 0x0104, 0x0105, 0x0106, 0x0107, 0x0108,
+	0x0109, 0x010A, 0x010B, 0x010C, 0x010D, 0x010E, 0x010F, 0x0110,
+	0xFFFF, 0x0111, 0xFFFF, 0x0112, 0x0113, 0xFFFF, 0x0114, 0x0115,
+	0x0116, 0x0117, 0x0118, 0x0119, 0x011A, 0x011B, 0xFFFF, 0x011C,
+	0xFFFF, 0x011D, 0x011E, 0x011F, 0x0120, 0x0121, 0x0122, 0x0123,
+	0x0124, 0x0125, 0x0126, 0x0127, 0x0128, 0x0129, 0x012A, 0x012B,
+	0x012C, 0x012D, 0x012E, 0x012F, 0x0130, 0x0131, 0x0132, 0x0133,
+	0x0134, 0x0135, 0x0136, 0x0137, 0x0138, 0x0139, 0x013A, 0x013B,
+	0x013C, 0x013D, 0x013E, 0x013F, 0x0140, 0x0141, 0x0142, 0x0143,
+	0x0144, 0x0145, 0x0146, 0x0147, 0x0148, 0x0149, 0x014A, 0x014B,
+	0x014C, 0x014D, 0x014E, 0x014F, 0x0150, 0x0151, 0x0152, 0x0153,
+	0x0154, 0x0155, 0x0156, 0x0157, 0x0158, 0x0159, 0x015A, 0x015B,
+	0x015C, 0x015D, 0x015E, 0x015F, 0x0160, 0x0161, 0x0162, 0x0163,
+	0x0164, 0x0165, 0x0166, 0x0167, 0x0168, 0x0169, 0x016A, 0x016B,
+	0x016C, 0x016D, 0x016E, 0x016F, 0x0170, 0x0171, 0x0172, 0x0173,
+	0x0174, 0x0175, 0x0176, 0x0177, 0x0178, 0x0179, 0x017A, 0x017B,
+	0x017C, 0x017D, 0x017E, 0x017F, 0x0180, 0x0181, 0x0182, 0x0183,
+	0x0184, 0x0185, 0x0186, 0x0187, 0x0188, 0x0189, 0x018A, 0x018B,
+	0x018C, 0x018D, 0x018E, 0x018F, 0x0190, 0x0191, 0x0192, 0x0193,
+	0x0194, 0x0195, 0x0196, 0x0197, 0x0198, 0x0199, 0x019A, 0x019B,
+	0x019C, 0x019D, 0x019E, 0x019F, 0x01A0, 0x01A1, 0x01A2, 0x01A3,
+	0x01A4, 0x01A5, 0x01A6, 0x01A7, 0x01A8, 0x01A9, 0x01AA, 0x01AB,
+	0x01AC, 0x01AD, 0x01AE, 0x01AF, 0x01B0, 0x01B1, 0x01B2, 0x01B3,
+	0x01B4, 0x01B5, 0x01B6, 0x01B7, 0x01B8, 0x01B9, 0x01BA, 0x01BB,
+	0x01BC, 0x01BD, 0x01BE, 0x01BF, 0x01C0, 0x01C1, 0x01C2, 0x01C3,
+	0x01C4, 0x01C5, 0x01C6, 0x01C7, 0x01C8, 0x01C9, 0x01CA, 0x01CB,
+	0x01CC, 0x01CD, 0x01CE, 0x01CF, 0x01D0, 0x01D1, 0x01D2, 0x01D3,
+	0x01D4, 0x01D5, 0x01D6, 0x01D7, 0x01D8, 0x01D9, 0x01DA, 0x01DB,
+	0x01DC, 0x01DD, 0x01DE, 0x01DF, 0x01E0, 0x01E1, 0x01E2, 0x01E3,
+	0x01E4, 0x01E5, 0x01E6, 0x01E7, 0x01E8, 0x01E9, 0x01EA, 0x01EB,
+	0x01EC, 0x01ED, 0x01EE, 0x01EF, 0x01F0, 0x01F1, 0x01F2, 0x01F3,
+	0x01F4, 0x01F5, 0x01F6, 0x01F7, 0x01F8, 0x01F9, 0x01FA, 0x01FB,
+	0x01FC, 0x01FD, 0x01FE, 0x01FF, 0x0200, 0x0201, 0x0202, 0x0203,
+	0x0204, 0x0205, 0x0206, 0x0207, 0x0208, 0x0209, 0x020A, 0x020B,
+	0x020C, 0x020D, 0x020E, 0x020F, 0x0210, 0x0211, 0x0212, 0x0213,
+	0x0214, 0x0215, 0x0216, 0x0217, 0x0218, 0x0219, 0x021A, 0x021B,
+	0x021C, 0x021D, 0x021E, 0x021F, 0x0220, 0x0221, 0x0222, 0x0223,
+	0x0224, 0x0225, 0x0226, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0227,
+	0x0228, 0x0229, 0xFFFF, 0x022A, 0x022B, 0xFFFF, 0x022C, 0x022D,
+	0x022E, 0x022F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0230, 0x0231, 0x0232,
+	0x0233, 0x0234, 0x0235, 0x0236, 0x0237, 0x0238, 0x0239, 0x023A,
+	0x023B, 0x023C, 0x023D, 0x023E, 0x023F, 0x0240, 0x0241, 0x0242,
+	0x0243, 0x0244, 0x0245, 0x0246, 0x0247, 0x0248, 0x0249, 0x024A,
+	0x024B, 0x024C, 0x024D, 0x024E, 0x024F, 0x0250, 0x0251, 0x0252,
+	0x0253, 0x0254, 0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A,
+	0x025B, 0x025C, 0x025D, 0x025E, 0x025F, 0x0260, 0x0261, 0x0262,
+	0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026A,
+	0x026B, 0x026C, 0x026D, 0x026E, 0x026F, 0x0270, 0x0271, 0x0272,
+	0x0273, 0x0274, 0x0275, 0x0276, 0x0277, 0x0278, 0x0279, 0x027A,
+	0x027B, 0x027C, 0x027D, 0x027E, 0x027F, 0x0280, 0x0281, 0x0282,
+	0x0283, 0x0284, 0x0285, 0x0286, 0x0287, 0x0288, 0x0289, 0x028A,
+	0x028B, 0x028C, 0x028D, 0x028E, 0x028F, 0x0290, 0x0291, 0x0292,
+	0x0293, 0x0294, 0x0295, 0x0296, 0x0297, 0x0298, 0x0299, 0x029A,
+	0x029B, 0x029C, 0x029D, 0x029E, 0x029F, 0x02A0, 0x02A1, 0x02A2,
+	0x02A3, 0x02A4, 0x02A5, 0x02A6, 0x02A7, 0x02A8, 0x02A9, 0x02AA,
+	0x02AB, 0x02AC, 0x02AD, 0x02AE, 0x02AF, 0x02B0, 0x02B1, 0x02B2,
+	0x02B3, 0x02B4, 0x02B5, 0x02B6, 0x02B7, 0x02B8, 0x02B9, 0x02BA,
+	0x02BB, 0x02BC, 0x02BD, 0x02BE, 0x02BF, 0x02C0, 0x02C1, 0x02C2,
+	0x02C3, 0x02C4, 0x02C5, 0x02C6, 0x02C7, 0x02C8, 0x02C9, 0x02CA,
+	0x02CB, 0x02CC, 0x02CD, 0x02CE, 0x02CF, 0x02D0, 0x02D1, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0x02D2, 0x02D3, 0x02D4, 0x02D5, 0x02D6, 0x02D7, 0x02D8,
+	0x02D9, 0x02DA, 0x02DB, 0x02DC, 0x02DD, 0x02DE, 0x02DF, 0x02E0,
+	0x02E1, 0x02E2, 0x02E3, 0x02E4, 0x02E5, 0x02E6, 0x02E7, 0x02E8,
+	0x02E9, 0x02EA, 0x02EB, 0x02EC, 0x02ED, 0x02EE, 0x02EF, 0x02F0,
+	0x02F1, 0x02F2, 0x02F3, 0x02F4, 0x02F5, 0x02F6, 0x02F7, 0x02F8,
+	0x02F9, 0x02FA, 0x02FB, 0x02FC, 0x02FD, 0x02FE, 0x02FF, 0x0300,
+	0x0301, 0x0302, 0x0303, 0x0304, 0x0305, 0x0306, 0x0307, 0x0308,
+	0x0309, 0x030A, 0x030B, 0x030C, 0x030D, 0x030E, 0x030F, 0x0310,
+	0x0311, 0x0312, 0x0313, 0x0314, 0x0315, 0x0316, 0x0317, 0x0318,
+	0x0319, 0x031A, 0x031B, 0x031C, 0x031D, 0x031E, 0x031F, 0x0320,
+	0x0321, 0x0322, 0x0323, 0x0324, 0x0325, 0x0326, 0x0327, 0x0328,
+	0x0329, 0x032A, 0x032B, 0x032C, 0x032D, 0x032E, 0x032F, 0x0330,
+	0x0331, 0x0332, 0x0333, 0x0334, 0x0335, 0x0336, 0x0337, 0x0338,
+	0x0339, 0x033A, 0x033B, 0x033C, 0x033D, 0x033E, 0x033F, 0x0340,
+	0x0341, 0x0342, 0x0343, 0x0344, 0x0345, 0x0346, 0x0347, 0x0348,
+	0x0349, 0x034A, 0x034B, 0x034C, 0x034D, 0x034E, 0x034F, 0x0350,
+	0x0351, 0x0352, 0x0353, 0x0354, 0x0355, 0x0356, 0x0357, 0x0358,
+	0x0359, 0x035A, 0x035B, 0x035C, 0x035D, 0x035E, 0x035F, 0x0360,
+	0x0361, 0x0362, 0x0363, 0x0364, 0x0365, 0x0366, 0x0367, 0x0368,
+	0x0369, 0x036A, 0x036B, 0x036C, 0x036D, 0x036E, 0x036F, 0x0370,
+	0x0371, 0x0372, 0x0373, 0x0374, 0x0375, 0x0376, 0x0377, 0x0378,
+	0x0379, 0x037A, 0x037B, 0x037C, 0x037D, 0x037E, 0x037F, 0x0380,
+	0x0381, 0x0382, 0x0383, 0x0384, 0xFFFF, 0xFFFF, 0xFFFF, 0x0385,
+	0x0386, 0x0387, 0x0388, 0x0389, 0x038A, 0x038B, 0x038C, 0xFFFF,
+	0xFFFF, 0xFFFF, 0x038D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x038E, 0x038F, 0x0390,
+	0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398,
+	0x0399, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x039F, 0x03A0,
+	0x03A1, 0x03A2, 0x03A3, 0x03A4, 0x03A5, 0x03A6, 0x03A7, 0x03A8,
+	0x03A9, 0x03AA, 0x03AB, 0x03AC, 0x03AD, 0x03AE, 0x03AF, 0x03B0,
+	0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0xFFFF, 0x03B7,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03B8,
+	0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF, 0x03C0,
+	0x03C1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03C2, 0x03C3, 0xFFFF,
+	0xFFFF, 0xFFFF, 0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8, 0x03C9,
+	0x03CA, 0x03CB, 0x03CC, 0x03CD, 0x03CE, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03CF, 0x03D0,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0x03D1, 0x03D2, 0x03D3, 0x03D4, 0x03D5, 0x03D6, 0x03D7,
+	0x03D8, 0x03D9, 0x03DA, 0x03DB, 0x03DC, 0x03DD, 0x03DE, 0x03DF,
+	0x03E0, 0x03E1, 0x03E2, 0x03E3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0x03E4, 0x03E5, 0x03E6, 0x03E7, 0x03E8,
+	0x03E9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03EA, 0x03EB, 0x03EC, 0x03ED,
+	0x03EE, 0x03EF, 0x03F0, 0x03F1, 0x03F2, 0x03F3, 0x03F4, 0x03F5,
+	0x03F6, 0x03F7, 0x03F8, 0x03F9, 0x03FA, 0x03FB, 0x03FC, 0x03FD,
+	0x03FE, 0x03FF, 0x0400, 0x0401, 0x0402, 0x0403, 0x0404, 0x0405,
+	0x0406, 0x0407, 0x0408, 0x0409, 0x040A, 0x040B, 0x040C, 0x040D,
+	0x040E, 0x040F, 0x0410, 0x0411, 0x0412, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0x0413, 0x0414, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0415,
+	0x0416, 0x0417, 0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D,
+	0x041E, 0x041F, 0x0420, 0xFFFF, 0x0421, 0x0422, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427, 0x0428, 0x0429,
+	0x042A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0x042B, 0x042C, 0x042D, 0x042E, 0x042F, 0x0430, 0x0431,
+	0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437, 0x0438, 0x0439,
+	0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F, 0x0440, 0x0441,
+	0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449,
+	0x044A, 0x044B, 0x044C, 0x044D, 0x044E, 0x044F, 0x0450, 0x0451,
+	0x0452, 0x0453, 0x0454, 0x0455, 0x0456, 0x0457, 0x0458, 0x0459,
+	0x045A, 0x045B, 0x045C, 0x045D, 0x045E, 0x045F, 0x0460, 0x0461,
+	0x0462, 0x0463, 0x0464, 0x0465, 0x0466, 0x0467, 0x0468, 0x0469,
+	0x046A, 0x046B, 0x046C, 0x046D, 0x046E, 0x046F, 0x0470, 0x0471,
+	0x0472, 0x0473, 0x0474, 0x0475, 0x0476, 0x0477, 0x0478, 0x0479,
+	0x047A, 0x047B, 0x047C, 0x047D, 0x047E, 0x047F, 0x0480, 0x0481,
+	0x0482, 0x0483, 0x0484, 0x0485, 0x0486, 0x0487, 0x0488, 0x0489,
+	0x048A, 0x048B, 0x048C, 0x048D, 0x048E, 0x048F, 0x0490, 0x0491,
+	0x0492, 0x0493, 0x0494, 0x0495, 0x0496, 0x0497, 0x0498, 0x0499,
+	0x049A, 0x049B, 0x049C, 0x049D, 0x049E, 0x049F, 0x04A0, 0x04A1,
+	0x04A2, 0x04A3, 0x04A4, 0x04A5, 0x04A6, 0x04A7, 0x04A8, 0x04A9,
+	0x04AA, 0x04AB, 0x04AC, 0x04AD, 0x04AE, 0x04AF, 0x04B0, 0x04B1,
+	0x04B2, 0x04B3, 0x04B4, 0x04B5, 0x04B6, 0x04B7, 0x04B8, 0x04B9,
+	0x04BA, 0x04BB, 0x04BC, 0x04BD, 0x04BE, 0x04BF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0x04C0, 0x04C1, 0x04C2, 0x04C3, 0x04C4, 0x04C5, 0x04C6,
+	0x04C7, 0x04C8, 0x04C9, 0x04CA, 0x04CB, 0x04CC, 0x04CD, 0x04CE,
+	0x04CF, 0x04D0, 0x04D1, 0x04D2, 0x04D3, 0x04D4, 0x04D5, 0x04D6,
+	0x04D7, 0x04D8, 0x04D9, 0x04DA, 0x04DB, 0x04DC, 0x04DD, 0x04DE,
+	0x04DF, 0x04E0, 0x04E1, 0x04E2, 0x04E3, 0x04E4, 0x04E5, 0x04E6,
+	0x04E7, 0x04E8, 0x04E9, 0x04EA, 0x04EB, 0x04EC, 0x04ED, 0x04EE,
+	0x04EF, 0x04F0, 0x04F1, 0x04F2, 0x04F3, 0x04F4, 0x04F5, 0x04F6,
+	0x04F7, 0x04F8, 0x04F9, 0x04FA, 0x04FB, 0x04FC, 0x04FD, 0x04FE,
+	0x04FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0x0500, 0x0501, 0x0502, 0x0503, 0x0504, 0x0505, 0x0506, 0x0507,
+	0x0508, 0x0509, 0x050A, 0x050B, 0xFFFF, 0xFFFF, 0xFFFF, 0x050C,
+	0x050D, 0xFFFF, 0xFFFF, 0xFFFF, 0x050E, 0x050F, 0x0510, 0x0511,
+	0x0512, 0x0513, 0x0514, 0x0515, 0x0516, 0x0517, 0x0518, 0x0519,
+	0x051A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0x051B, 0x051C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0x051D, 0x051E, 0x051F, 0x0520, 0x0521,
+	0x0522, 0x0523, 0x0524, 0x0525, 0x0526, 0x0527, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0528,
+	0x0529, 0x052A, 0x052B, 0x052C, 0x052D, 0x052E, 0x052F, 0x0530,
+	0x0531, 0x0532, 0x0533, 0x0534, 0x0535, 0x0536, 0x0537, 0x0538,
+	0x0539, 0x053A, 0x053B, 0x053C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x053D, 0x053E, 0x053F, 0x0540,
+	0x0541, 0x0542, 0x0543, 0x0544, 0x0545, 0x0546, 0x0547, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0x0548, 0x0549, 0x054A, 0x054B, 0x054C, 0x054D, 0x054E,
+	0x054F, 0x0550, 0x0551, 0x0552, 0x0553, 0x0554, 0x0555, 0x0556,
+	0x0557, 0x0558, 0x0559, 0x055A, 0x055B, 0x055C, 0x055D, 0x055E,
+	0x055F, 0x0560, 0x0561, 0x0562, 0x0563, 0x0564, 0x0565, 0x0566,
+	0x0567, 0x0568, 0x0569, 0x056A, 0x056B, 0x056C, 0x056D, 0x056E,
+	0x056F, 0x0570, 0x0571, 0x0572, 0x0573, 0x0574, 0x0575, 0x0576,
+	0x0577, 0x0578, 0x0579, 0x057A, 0x057B, 0xFFFF, 0x057C, 0x057D,
+	0x057E, 0x057F, 0x0580, 0xFFFF, 0xFFFF, 0x0581, 0x0582, 0x0583,
+	0x0584, 0x0585, 0x0586, 0x0587, 0x0588, 0x0589, 0x058A, 0x058B,
+	0x058C, 0x058D, 0x058E, 0x058F, 0x0590, 0x0591, 0x0592, 0x0593,
+	0x0594, 0x0595, 0x0596, 0x0597, 0x0598, 0x0599, 0x059A, 0x059B,
+	0x059C, 0x059D, 0x059E, 0x059F, 0x05A0, 0x05A1, 0x05A2, 0x05A3,
+	0x05A4, 0x05A5, 0x05A6, 0x05A7, 0x05A8, 0x05A9, 0x05AA, 0x05AB,
+	0x05AC, 0x05AD, 0x05AE, 0x05AF, 0x05B0, 0x05B1, 0x05B2, 0x05B3,
+	0xFFFF, 0x05B4, 0x05B5, 0x05B6, 0x05B7, 0x05B8, 0x05B9, 0xFFFF,
+	0x05BA, 0x05BB, 0x05BC, 0x05BD, 0x05BE, 0x05BF, 0x05C0, 0x05C1,
+	0x05C2, 0x05C3, 0x05C4, 0x05C5, 0x05C6, 0xFFFF, 0x05C7, 0xFFFF,
+	0xFFFF, 0xFFFF, 0x05C8, 0x05C9, 0x05CA, 0x05CB, 0x05CC, 0x05CD,
+	0x05CE, 0x05CF, 0x05D0, 0x05D1, 0x05D2, 0x05D3, 0x05D4, 0x05D5,
+	0x05D6, 0x05D7, 0x05D8, 0x05D9, 0x05DA, 0x05DB, 0xFFFF, 0xFFFF,
+	0xFFFF, 0x05DC, 0x05DD, 0x05DE, 0x05DF, 0x05E0, 0x05E1, 0x05E2,
+	0xFFFF, 0xFFFF, 0xFFFF, 0x05E3, 0x05E4, 0x05E5, 0x05E6, 0x05E7,
+	0x05E8, 0x05E9, 0x05EA, 0x05EB, 0x05EC, 0x05ED, 0x05EE, 0x05EF,
+	0xFFFF, 0x05F0, 0x05F1, 0xFFFF, 0xFFFF, 0xFFFF, 0x05F2, 0x05F3,
+	0xFFFF, 0x05F4, 0x05F5, 0x05F6, 0xFFFF, 0xFFFF, 0x05F7, 0x05F8,
+	0x05F9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x05FA, 0x05FB,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x05FC, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x05FD, 0x05FE, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x05FF, 0x0600, 0x0601, 0xFFFF,
+	0x0602, 0x0603, 0x0604, 0x0605, 0xFFFF, 0xFFFF, 0x0606, 0x0607,
+	0x0608, 0x0609, 0x060A, 0x060B, 0x060C, 0x060D, 0x060E, 0x060F,
+};
+#endif
+
+#endif
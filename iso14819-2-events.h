@@ -7,12427 +7,23 @@
 #define _ISO14819_2_EVENTS_H_INCLUDED
 #ifdef WITH_RDS_TMC_EVENTS
 
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-const char Event_S_0001[] PROGMEM = "traffic problem";
-const char Event_S_0002[] PROGMEM = "queuing traffic (with average speeds %s). Danger of stationary traffic";
-const char Event_S_000B[] PROGMEM = "overheight warning system triggered";
-const char Event_S_000C[] PROGMEM = "(%s) accident(s), traffic being directed around accident area";
-const char Event_S_0010[] PROGMEM = "closed, rescue and recovery work in progress";
-const char Event_S_0014[] PROGMEM = "service area overcrowded, drive to another service area";
-const char Event_S_0016[] PROGMEM = "service area, fuel station closed";
-const char Event_S_0017[] PROGMEM = "service area, restaurant closed";
-const char Event_S_0018[] PROGMEM = "bridge closed";
-const char Event_S_0019[] PROGMEM = "tunnel closed";
-const char Event_S_001A[] PROGMEM = "bridge blocked";
-const char Event_S_001B[] PROGMEM = "tunnel blocked";
-const char Event_S_001C[] PROGMEM = "road closed intermittently";
-const char Event_S_0024[] PROGMEM = "fuel station reopened";
-const char Event_S_0025[] PROGMEM = "restaurant reopened";
-const char Event_S_0027[] PROGMEM = "reopening of bridge expected (%s)";
-const char Event_S_0028[] PROGMEM = "smog alert ended";
-const char Event_S_0029[] PROGMEM = "(%s) overtaking lane(s) closed";
-const char Event_S_002A[] PROGMEM = "(%s) overtaking lane(s) blocked";
-const char Event_S_0033[] PROGMEM = "roadworks, (%s) overtaking lane(s) closed";
-const char Event_S_0034[] PROGMEM = "(%s sets of) roadworks on the hard shoulder";
-const char Event_S_0035[] PROGMEM = "(%s sets of) roadworks in the emergency lane";
-const char Event_S_0037[] PROGMEM = "traffic problem expected";
-const char Event_S_0038[] PROGMEM = "traffic congestion expected";
-const char Event_S_0039[] PROGMEM = "normal traffic expected";
-const char Event_S_003D[] PROGMEM = "(%s) object(s) on roadway";
-const char Event_S_003E[] PROGMEM = "(%s) burst pipe(s)";
-const char Event_S_003F[] PROGMEM = "(%s) object(s) on the road. Danger";
-const char Event_S_0040[] PROGMEM = "burst pipe. Danger";
-const char Event_S_0046[] PROGMEM = "traffic congestion, average speed of 10 km/h";
-const char Event_S_0047[] PROGMEM = "traffic congestion, average speed of 20 km/h";
-const char Event_S_0048[] PROGMEM = "traffic congestion, average speed of 30 km/h";
-const char Event_S_0049[] PROGMEM = "traffic congestion, average speed of 40 km/h";
-const char Event_S_004A[] PROGMEM = "traffic congestion, average speed of 50 km/h";
-const char Event_S_004B[] PROGMEM = "traffic congestion, average speed of 60 km/h";
-const char Event_S_004C[] PROGMEM = "traffic congestion, average speed of 70 km/h";
-const char Event_S_0050[] PROGMEM = "heavy traffic has to be expected";
-const char Event_S_0051[] PROGMEM = "traffic congestion has to be expected";
-const char Event_S_0052[] PROGMEM = "(%s sets of) roadworks. Heavy traffic has to be expected";
-const char Event_S_0053[] PROGMEM = "closed ahead. Heavy traffic expected";
-const char Event_S_0054[] PROGMEM = "major event. Heavy traffic has to be expected";
-const char Event_S_0055[] PROGMEM = "sports meeting. Heavy traffic has to be expected";
-const char Event_S_0056[] PROGMEM = "fair. Heavy traffic has to be expected";
-const char Event_S_0057[] PROGMEM = "evacuation. Heavy traffic has to be expected";
-const char Event_S_0058[] PROGMEM = "traffic congestion forecast withdrawn";
-const char Event_S_0059[] PROGMEM = "message cancelled";
-const char Event_S_005B[] PROGMEM = "delays (%s) for cars";
-const char Event_S_0065[] PROGMEM = "stationary traffic";
-const char Event_S_0066[] PROGMEM = "stationary traffic for 1 km";
-const char Event_S_0067[] PROGMEM = "stationary traffic for 2 km";
-const char Event_S_0068[] PROGMEM = "stationary traffic for 4 km";
-const char Event_S_0069[] PROGMEM = "stationary traffic for 6 km";
-const char Event_S_006A[] PROGMEM = "stationary traffic for 10 km";
-const char Event_S_006B[] PROGMEM = "stationary traffic expected";
-const char Event_S_006C[] PROGMEM = "queuing traffic (with average speeds %s)";
-const char Event_S_006D[] PROGMEM = "queuing traffic for 1 km (with average speeds %s)";
-const char Event_S_006E[] PROGMEM = "queuing traffic for 2 km (with average speeds %s)";
-const char Event_S_006F[] PROGMEM = "queuing traffic for 4 km (with average speeds %s)";
-const char Event_S_0070[] PROGMEM = "queuing traffic for 6 km (with average speeds %s)";
-const char Event_S_0071[] PROGMEM = "queuing traffic for 10 km (with average speeds %s)";
-const char Event_S_0072[] PROGMEM = "queuing traffic expected";
-const char Event_S_0073[] PROGMEM = "slow traffic (with average speeds %s)";
-const char Event_S_0074[] PROGMEM = "slow traffic for 1 km (with average speeds %s)";
-const char Event_S_0075[] PROGMEM = "slow traffic for 2 km (with average speeds %s)";
-const char Event_S_0076[] PROGMEM = "slow traffic for 4 km (with average speeds %s)";
-const char Event_S_0077[] PROGMEM = "slow traffic for 6 km (with average speeds %s)";
-const char Event_S_0078[] PROGMEM = "slow traffic for 10 km (with average speeds %s)";
-const char Event_S_0079[] PROGMEM = "slow traffic expected";
-const char Event_S_007A[] PROGMEM = "heavy traffic (with average speeds %s)";
-const char Event_S_007B[] PROGMEM = "heavy traffic expected";
-const char Event_S_007C[] PROGMEM = "traffic flowing freely (with average speeds %s)";
-const char Event_S_007D[] PROGMEM = "traffic building up (with average speeds %s)";
-const char Event_S_007E[] PROGMEM = "no problems to report";
-const char Event_S_007F[] PROGMEM = "traffic congestion cleared";
-const char Event_S_0080[] PROGMEM = "message cancelled";
-const char Event_S_0081[] PROGMEM = "stationary traffic for 3 km";
-const char Event_S_0082[] PROGMEM = "danger of stationary traffic";
-const char Event_S_0083[] PROGMEM = "queuing traffic for 3 km (with average speeds %s)";
-const char Event_S_0084[] PROGMEM = "danger of queuing traffic (with average speeds %s)";
-const char Event_S_0085[] PROGMEM = "long queues (with average speeds %s)";
-const char Event_S_0086[] PROGMEM = "slow traffic for 3 km (with average speeds %s)";
-const char Event_S_0087[] PROGMEM = "traffic easing";
-const char Event_S_0088[] PROGMEM = "traffic congestion (with average speeds %s)";
-const char Event_S_0089[] PROGMEM = "traffic lighter than normal (with average speeds %s)";
-const char Event_S_008A[] PROGMEM = "queuing traffic (with average speeds %s). Approach with care";
-const char Event_S_008B[] PROGMEM = "queuing traffic around a bend in the road";
-const char Event_S_008C[] PROGMEM = "queuing traffic over the crest of a hill";
-const char Event_S_008D[] PROGMEM = "all accidents cleared, no problems to report";
-const char Event_S_008E[] PROGMEM = "traffic heavier than normal (with average speeds %s)";
-const char Event_S_008F[] PROGMEM = "traffic very much heavier than normal (with average speeds %s)";
-const char Event_S_00C8[] PROGMEM = "multi vehicle pile up. Delays (%s)";
-const char Event_S_00C9[] PROGMEM = "(%s) accident(s)";
-const char Event_S_00CA[] PROGMEM = "(%s) serious accident(s)";
-const char Event_S_00CB[] PROGMEM = "multi-vehicle accident (involving %s vehicles)";
-const char Event_S_00CC[] PROGMEM = "accident involving (a/%s) heavy lorr(y/ies)";
-const char Event_S_00CD[] PROGMEM = "(%s) accident(s) involving hazardous materials";
-const char Event_S_00CE[] PROGMEM = "(%s) fuel spillage accident(s)";
-const char Event_S_00CF[] PROGMEM = "(%s) chemical spillage accident(s)";
-const char Event_S_00D0[] PROGMEM = "vehicles slowing to look at (%s) accident(s)";
-const char Event_S_00D1[] PROGMEM = "(%s) accident(s) in the opposing lanes";
-const char Event_S_00D2[] PROGMEM = "(%s) shed load(s)";
-const char Event_S_00D3[] PROGMEM = "(%s) broken down vehicle(s)";
-const char Event_S_00D4[] PROGMEM = "(%s) broken down heavy lorr(y/ies)";
-const char Event_S_00D5[] PROGMEM = "(%s) vehicle fire(s)";
-const char Event_S_00D6[] PROGMEM = "(%s) incident(s)";
-const char Event_S_00D7[] PROGMEM = "(%s) accident(s). Stationary traffic";
-const char Event_S_00D8[] PROGMEM = "(%s) accident(s). Stationary traffic for 1 km";
-const char Event_S_00D9[] PROGMEM = "(%s) accident(s). Stationary traffic for 2 km";
-const char Event_S_00DA[] PROGMEM = "(%s) accident(s). Stationary traffic for 4 km";
-const char Event_S_00DB[] PROGMEM = "(%s) accident(s). Stationary traffic for 6 km";
-const char Event_S_00DC[] PROGMEM = "(%s) accident(s). Stationary traffic for 10 km";
-const char Event_S_00DD[] PROGMEM = "(%s) accident(s). Danger of stationary traffic";
-const char Event_S_00DE[] PROGMEM = "(%s) accident(s). Queuing traffic";
-const char Event_S_00DF[] PROGMEM = "(%s) accident(s). Queuing traffic for 1 km";
-const char Event_S_00E0[] PROGMEM = "(%s) accident(s). Queuing traffic for 2 km";
-const char Event_S_00E1[] PROGMEM = "(%s) accident(s). Queuing traffic for 4 km";
-const char Event_S_00E2[] PROGMEM = "(%s) accident(s). Queuing traffic for 6 km";
-const char Event_S_00E3[] PROGMEM = "(%s) accident(s). Queuing traffic for 10 km";
-const char Event_S_00E4[] PROGMEM = "(%s) accident(s). Danger of queuing traffic";
-const char Event_S_00E5[] PROGMEM = "(%s) accident(s). Slow traffic";
-const char Event_S_00E6[] PROGMEM = "(%s) accident(s). Slow traffic for 1 km";
-const char Event_S_00E7[] PROGMEM = "(%s) accident(s). Slow traffic for 2 km";
-const char Event_S_00E8[] PROGMEM = "(%s) accident(s). Slow traffic for 4 km";
-const char Event_S_00E9[] PROGMEM = "(%s) accident(s). Slow traffic for 6 km";
-const char Event_S_00EA[] PROGMEM = "(%s) accident(s). Slow traffic for 10 km";
-const char Event_S_00EB[] PROGMEM = "(%s) accident(s). Slow traffic expected";
-const char Event_S_00EC[] PROGMEM = "(%s) accident(s). Heavy traffic";
-const char Event_S_00ED[] PROGMEM = "(%s) accident(s). Heavy traffic expected";
-const char Event_S_00EE[] PROGMEM = "(%s) accident(s). Traffic flowing freely";
-const char Event_S_00EF[] PROGMEM = "(%s) accident(s). Traffic building up";
-const char Event_S_00F0[] PROGMEM = "road closed due to (%s) accident(s)";
-const char Event_S_00F1[] PROGMEM = "(%s) accident(s). Right lane blocked";
-const char Event_S_00F2[] PROGMEM = "(%s) accident(s). Centre lane blocked";
-const char Event_S_00F3[] PROGMEM = "(%s) accident(s). Left lane blocked";
-const char Event_S_00F4[] PROGMEM = "(%s) accident(s). Hard shoulder blocked";
-const char Event_S_00F5[] PROGMEM = "(%s) accident(s). Two lanes blocked";
-const char Event_S_00F6[] PROGMEM = "(%s) accident(s). Three lanes blocked";
-const char Event_S_00F7[] PROGMEM = "accident. Delays (%s)";
-const char Event_S_00F8[] PROGMEM = "accident. Delays (%s) expected";
-const char Event_S_00F9[] PROGMEM = "accident. Long delays (%s)";
-const char Event_S_00FA[] PROGMEM = "vehicles slowing to look at (%s) accident(s). Stationary traffic";
-const char Event_S_00FB[] PROGMEM = "vehicles slowing to look at (%s) accident(s). Stationary traffic for 1 km";
-const char Event_S_00FC[] PROGMEM = "vehicles slowing to look at (%s) accident(s). Stationary traffic for 2 km";
-const char Event_S_00FD[] PROGMEM = "vehicles slowing to look at (%s) accident(s). Stationary traffic for 4 km";
-const char Event_S_00FE[] PROGMEM = "vehicles slowing to look at (%s) accident(s). Stationary traffic for 6 km";
-const char Event_S_00FF[] PROGMEM = "vehicles slowing to look at (%s) accident(s). Stationary traffic for 10 km";
-const char Event_S_0100[] PROGMEM = "vehicles slowing to look at (%s) accident(s). Danger of stationary traffic";
-const char Event_S_0101[] PROGMEM = "vehicles slowing to look at (%s) accident(s). Queuing traffic";
-const char Event_S_0102[] PROGMEM = "vehicles slowing to look at (%s) accident(s). Queuing traffic for 1 km";
-const char Event_S_0103[] PROGMEM = "vehicles slowing to look at (%s) accident(s). Queuing traffic for 2 km";
-const char Event_S_0104[] PROGMEM = "vehicles slowing to look at (%s) accident(s). Queuing traffic for 4 km";
-const char Event_S_0105[] PROGMEM = "vehicles slowing to look at (%s) accident(s). Queuing traffic for 6 km";
-const char Event_S_0106[] PROGMEM = "vehicles slowing to look at (%s) accident(s). Queuing traffic for 10 km";
-const char Event_S_0107[] PROGMEM = "vehicles slowing to look at (%s) accident(s). Danger of queuing traffic";
-const char Event_S_0108[] PROGMEM = "vehicles slowing to look at (%s) accident(s). Slow traffic";
-const char Event_S_0109[] PROGMEM = "vehicles slowing to look at (%s) accident(s). Slow traffic for 1 km";
-const char Event_S_010A[] PROGMEM = "vehicles slowing to look at (%s) accident(s). Slow traffic for 2 km";
-const char Event_S_010B[] PROGMEM = "vehicles slowing to look at (%s) accident(s). Slow traffic for 4 km";
-const char Event_S_010C[] PROGMEM = "vehicles slowing to look at (%s) accident(s). Slow traffic for 6 km";
-const char Event_S_010D[] PROGMEM = "vehicles slowing to look at (%s) accident(s). Slow traffic for 10 km";
-const char Event_S_010E[] PROGMEM = "vehicles slowing to look at (%s) accident(s). Slow traffic expected";
-const char Event_S_010F[] PROGMEM = "vehicles slowing to look at (%s) accident(s). Heavy traffic";
-const char Event_S_0110[] PROGMEM = "vehicles slowing to look at (%s) accident(s). Heavy traffic expected";
-const char Event_S_0112[] PROGMEM = "vehicles slowing to look at (%s) accident(s). Traffic building up";
-const char Event_S_0113[] PROGMEM = "vehicles slowing to look at accident. Delays (%s)";
-const char Event_S_0114[] PROGMEM = "vehicles slowing to look at accident. Delays (%s) expected";
-const char Event_S_0115[] PROGMEM = "vehicles slowing to look at accident. Long delays (%s)";
-const char Event_S_0116[] PROGMEM = "(%s) shed load(s). Stationary traffic";
-const char Event_S_0117[] PROGMEM = "(%s) shed load(s). Stationary traffic for 1 km";
-const char Event_S_0118[] PROGMEM = "(%s) shed load(s). Stationary traffic for 2 km";
-const char Event_S_0119[] PROGMEM = "(%s) shed load(s). Stationary traffic for 4 km";
-const char Event_S_011A[] PROGMEM = "(%s) shed load(s). Stationary traffic for 6 km";
-const char Event_S_011B[] PROGMEM = "(%s) shed load(s). Stationary traffic for 10 km";
-const char Event_S_011C[] PROGMEM = "(%s) shed load(s). Danger of stationary traffic";
-const char Event_S_011D[] PROGMEM = "(%s) shed load(s). Queuing traffic";
-const char Event_S_011E[] PROGMEM = "(%s) shed load(s). Queuing traffic for 1 km";
-const char Event_S_011F[] PROGMEM = "(%s) shed load(s). Queuing traffic for 2 km";
-const char Event_S_0120[] PROGMEM = "(%s) shed load(s). Queuing traffic for 4 km";
-const char Event_S_0121[] PROGMEM = "(%s) shed load(s). Queuing traffic for 6 km";
-const char Event_S_0122[] PROGMEM = "(%s) shed load(s). Queuing traffic for 10 km";
-const char Event_S_0123[] PROGMEM = "(%s) shed load(s). Danger of queuing traffic";
-const char Event_S_0124[] PROGMEM = "(%s) shed load(s). Slow traffic";
-const char Event_S_0125[] PROGMEM = "(%s) shed load(s). Slow traffic for 1 km";
-const char Event_S_0126[] PROGMEM = "(%s) shed load(s). Slow traffic for 2 km";
-const char Event_S_0127[] PROGMEM = "(%s) shed load(s). Slow traffic for 4 km";
-const char Event_S_0128[] PROGMEM = "(%s) shed load(s). Slow traffic for 6 km";
-const char Event_S_0129[] PROGMEM = "(%s) shed load(s). Slow traffic for 10 km";
-const char Event_S_012A[] PROGMEM = "(%s) shed load(s). Slow traffic expected";
-const char Event_S_012B[] PROGMEM = "(%s) shed load(s). Heavy traffic";
-const char Event_S_012C[] PROGMEM = "(%s) shed load(s). Heavy traffic expected";
-const char Event_S_012D[] PROGMEM = "(%s) shed load(s). Traffic flowing freely";
-const char Event_S_012E[] PROGMEM = "(%s) shed load(s). Traffic building up";
-const char Event_S_012F[] PROGMEM = "blocked by (%s) shed load(s)";
-const char Event_S_0130[] PROGMEM = "(%s) shed load(s). Right lane blocked";
-const char Event_S_0131[] PROGMEM = "(%s) shed load(s). Centre lane blocked";
-const char Event_S_0132[] PROGMEM = "(%s) shed load(s). Left lane blocked";
-const char Event_S_0133[] PROGMEM = "(%s) shed load(s). Hard shoulder blocked";
-const char Event_S_0134[] PROGMEM = "(%s) shed load(s). Two lanes blocked";
-const char Event_S_0135[] PROGMEM = "(%s) shed load(s). Three lanes blocked";
-const char Event_S_0136[] PROGMEM = "shed load. Delays (%s)";
-const char Event_S_0137[] PROGMEM = "shed load. Delays (%s) expected";
-const char Event_S_0138[] PROGMEM = "shed load. Long delays (%s)";
-const char Event_S_0139[] PROGMEM = "(%s) broken down vehicle(s). Stationary traffic";
-const char Event_S_013A[] PROGMEM = "(%s) broken down vehicle(s). Danger of stationary traffic";
-const char Event_S_013B[] PROGMEM = "(%s) broken down vehicle(s). Queuing traffic";
-const char Event_S_013C[] PROGMEM = "(%s) broken down vehicle(s). Danger of queuing traffic";
-const char Event_S_013D[] PROGMEM = "(%s) broken down vehicle(s). Slow traffic";
-const char Event_S_013E[] PROGMEM = "(%s) broken down vehicle(s). Slow traffic expected";
-const char Event_S_013F[] PROGMEM = "(%s) broken down vehicle(s). Heavy traffic";
-const char Event_S_0140[] PROGMEM = "(%s) broken down vehicle(s). Heavy traffic expected";
-const char Event_S_0141[] PROGMEM = "(%s) broken down vehicle(s). Traffic flowing freely";
-const char Event_S_0142[] PROGMEM = "(%s) broken down vehicle(s).Traffic building up";
-const char Event_S_0143[] PROGMEM = "blocked by (%s) broken down vehicle(s).";
-const char Event_S_0144[] PROGMEM = "(%s) broken down vehicle(s). Right lane blocked";
-const char Event_S_0145[] PROGMEM = "(%s) broken down vehicle(s). Centre lane blocked";
-const char Event_S_0146[] PROGMEM = "(%s) broken down vehicle(s). Left lane blocked";
-const char Event_S_0147[] PROGMEM = "(%s) broken down vehicle(s). Hard shoulder blocked";
-const char Event_S_0148[] PROGMEM = "(%s) broken down vehicle(s). Two lanes blocked";
-const char Event_S_0149[] PROGMEM = "(%s) broken down vehicle(s). Three lanes blocked";
-const char Event_S_014A[] PROGMEM = "broken down vehicle. Delays (%s)";
-const char Event_S_014B[] PROGMEM = "broken down vehicle. Delays (%s) expected";
-const char Event_S_014C[] PROGMEM = "broken down vehicle. Long delays (%s)";
-const char Event_S_014D[] PROGMEM = "accident cleared";
-const char Event_S_014E[] PROGMEM = "message cancelled";
-const char Event_S_014F[] PROGMEM = "accident involving (a/%s) bus(es)";
-const char Event_S_0150[] PROGMEM = "(%s) oil spillage accident(s)";
-const char Event_S_0151[] PROGMEM = "(%s) overturned vehicle(s)";
-const char Event_S_0152[] PROGMEM = "(%s) overturned heavy lorr(y/ies)";
-const char Event_S_0153[] PROGMEM = "(%s) jackknifed trailer(s)";
-const char Event_S_0154[] PROGMEM = "(%s) jackknifed caravan(s)";
-const char Event_S_0155[] PROGMEM = "(%s) jackknifed articulated lorr(y/ies)";
-const char Event_S_0156[] PROGMEM = "(%s) vehicle(s) spun around";
-const char Event_S_0157[] PROGMEM = "(%s) earlier accident(s)";
-const char Event_S_0158[] PROGMEM = "accident investigation work";
-const char Event_S_0159[] PROGMEM = "(%s) secondary accident(s)";
-const char Event_S_015A[] PROGMEM = "(%s) broken down bus(es)";
-const char Event_S_015B[] PROGMEM = "(%s) overheight vehicle(s)";
-const char Event_S_015C[] PROGMEM = "(%s) accident(s). Stationary traffic for 3 km";
-const char Event_S_015D[] PROGMEM = "(%s) accident(s). Queuing traffic for 3 km";
-const char Event_S_015E[] PROGMEM = "(%s) accident(s). Slow traffic for 3 km";
-const char Event_S_015F[] PROGMEM = "(%s) accident(s) in roadworks area";
-const char Event_S_0160[] PROGMEM = "vehicles slowing to look at (%s) accident(s). Stationary traffic for 3 km";
-const char Event_S_0161[] PROGMEM = "vehicles slowing to look at (%s) accident(s). Queuing traffic for 3 km";
-const char Event_S_0162[] PROGMEM = "vehicles slowing to look at (%s) accident(s). Slow traffic for 3 km";
-const char Event_S_0163[] PROGMEM = "vehicles slowing to look at (%s) accident(s). Danger";
-const char Event_S_0164[] PROGMEM = "(%s) shed load(s). Stationary traffic for 3 km";
-const char Event_S_0165[] PROGMEM = "(%s) shed load(s). Queuing traffic for 3 km";
-const char Event_S_0166[] PROGMEM = "(%s) shed load(s). Slow traffic for 3 km";
-const char Event_S_0167[] PROGMEM = "(%s) shed load(s). Danger";
-const char Event_S_0168[] PROGMEM = "(%s) overturned vehicle(s). Stationary traffic";
-const char Event_S_0169[] PROGMEM = "(%s) overturned vehicle(s). Danger of stationary traffic";
-const char Event_S_016A[] PROGMEM = "(%s) overturned vehicle(s). Queuing traffic";
-const char Event_S_016B[] PROGMEM = "(%s) overturned vehicle(s). Danger of queuing traffic";
-const char Event_S_016C[] PROGMEM = "(%s) overturned vehicle(s). Slow traffic";
-const char Event_S_016D[] PROGMEM = "(%s) overturned vehicle(s). Slow traffic expected";
-const char Event_S_016E[] PROGMEM = "(%s) overturned vehicle(s). Heavy traffic";
-const char Event_S_016F[] PROGMEM = "(%s) overturned vehicle(s). Heavy traffic expected";
-const char Event_S_0170[] PROGMEM = "(%s) overturned vehicle(s). Traffic building up";
-const char Event_S_0171[] PROGMEM = "blocked by (%s) overturned vehicle(s)";
-const char Event_S_0172[] PROGMEM = "(%s) overturned vehicle(s). Right lane blocked";
-const char Event_S_0173[] PROGMEM = "(%s) overturned vehicle(s). Centre lane blocked";
-const char Event_S_0174[] PROGMEM = "(%s) overturned vehicle(s). Left lane blocked";
-const char Event_S_0175[] PROGMEM = "(%s) overturned vehicle(s). Two lanes blocked";
-const char Event_S_0176[] PROGMEM = "(%s) overturned vehicle(s). Three lanes blocked";
-const char Event_S_0177[] PROGMEM = "overturned vehicle. Delays (%s)";
-const char Event_S_0178[] PROGMEM = "overturned vehicle. Delays (%s) expected";
-const char Event_S_0179[] PROGMEM = "overturned vehicle. Long delays (%s)";
-const char Event_S_017A[] PROGMEM = "(%s) overturned vehicle(s). Danger";
-const char Event_S_017B[] PROGMEM = "Stationary traffic due to (%s) earlier accident(s)";
-const char Event_S_017C[] PROGMEM = "Danger of stationary traffic due to (%s) earlier accident(s)";
-const char Event_S_017D[] PROGMEM = "Queuing traffic due to (%s) earlier accident(s)";
-const char Event_S_017E[] PROGMEM = "Danger of queuing traffic due to (%s) earlier accident(s)";
-const char Event_S_017F[] PROGMEM = "Slow traffic due to (%s) earlier accident(s)";
-const char Event_S_0181[] PROGMEM = "Heavy traffic due to (%s) earlier accident(s)";
-const char Event_S_0183[] PROGMEM = "Traffic building up due to (%s) earlier accident(s)";
-const char Event_S_0184[] PROGMEM = "Delays (%s) due to earlier accident";
-const char Event_S_0186[] PROGMEM = "Long delays (%s) due to earlier accident";
-const char Event_S_0187[] PROGMEM = "accident investigation work. Danger";
-const char Event_S_0188[] PROGMEM = "(%s) secondary accident(s). Danger";
-const char Event_S_0189[] PROGMEM = "(%s) broken down vehicle(s). Danger";
-const char Event_S_018A[] PROGMEM = "(%s) broken down heavy lorr(y/ies). Danger";
-const char Event_S_018B[] PROGMEM = "road cleared";
-const char Event_S_018C[] PROGMEM = "incident cleared";
-const char Event_S_018D[] PROGMEM = "rescue and recovery work in progress";
-const char Event_S_018F[] PROGMEM = "message cancelled";
-const char Event_S_0191[] PROGMEM = "closed";
-const char Event_S_0192[] PROGMEM = "blocked";
-const char Event_S_0193[] PROGMEM = "closed for heavy vehicles (over %s)";
-const char Event_S_0194[] PROGMEM = "no through traffic for heavy lorries (over %s)";
-const char Event_S_0195[] PROGMEM = "no through traffic";
-const char Event_S_0196[] PROGMEM = "(%s th) entry slip road closed";
-const char Event_S_0197[] PROGMEM = "(%s th) exit slip road closed";
-const char Event_S_0198[] PROGMEM = "slip roads closed";
-const char Event_S_0199[] PROGMEM = "slip road restrictions";
-const char Event_S_019A[] PROGMEM = "closed ahead. Stationary traffic";
-const char Event_S_019B[] PROGMEM = "closed ahead. Stationary traffic for 1 km";
-const char Event_S_019C[] PROGMEM = "closed ahead. Stationary traffic for 2 km";
-const char Event_S_019D[] PROGMEM = "closed ahead. Stationary traffic for 4 km";
-const char Event_S_019E[] PROGMEM = "closed ahead. Stationary traffic for 6 km";
-const char Event_S_019F[] PROGMEM = "closed ahead. Stationary traffic for 10 km";
-const char Event_S_01A0[] PROGMEM = "closed ahead. Danger of stationary traffic";
-const char Event_S_01A1[] PROGMEM = "closed ahead. Queuing traffic";
-const char Event_S_01A2[] PROGMEM = "closed ahead. Queuing traffic for 1 km";
-const char Event_S_01A3[] PROGMEM = "closed ahead. Queuing traffic for 2 km";
-const char Event_S_01A4[] PROGMEM = "closed ahead. Queuing traffic for 4 km";
-const char Event_S_01A5[] PROGMEM = "closed ahead. Queuing traffic for 6 km";
-const char Event_S_01A6[] PROGMEM = "closed ahead. Queuing traffic for 10 km";
-const char Event_S_01A7[] PROGMEM = "closed ahead. Danger of queuing traffic";
-const char Event_S_01A8[] PROGMEM = "closed ahead. Slow traffic";
-const char Event_S_01A9[] PROGMEM = "closed ahead. Slow traffic for 1 km";
-const char Event_S_01AA[] PROGMEM = "closed ahead. Slow traffic for 2 km";
-const char Event_S_01AB[] PROGMEM = "closed ahead. Slow traffic for 4 km";
-const char Event_S_01AC[] PROGMEM = "closed ahead. Slow traffic for 6 km";
-const char Event_S_01AD[] PROGMEM = "closed ahead. Slow traffic for 10 km";
-const char Event_S_01AE[] PROGMEM = "closed ahead. Slow traffic expected";
-const char Event_S_01AF[] PROGMEM = "closed ahead. Heavy traffic";
-const char Event_S_01B0[] PROGMEM = "closed ahead. Heavy traffic expected";
-const char Event_S_01B1[] PROGMEM = "closed ahead. Traffic flowing freely";
-const char Event_S_01B2[] PROGMEM = "closed ahead. Traffic building up";
-const char Event_S_01B3[] PROGMEM = "closed ahead. Delays (%s)";
-const char Event_S_01B4[] PROGMEM = "closed ahead. Delays (%s) expected";
-const char Event_S_01B5[] PROGMEM = "closed ahead. Long delays (%s)";
-const char Event_S_01B6[] PROGMEM = "blocked ahead. Stationary traffic";
-const char Event_S_01B7[] PROGMEM = "blocked ahead. Stationary traffic for 1 km";
-const char Event_S_01B8[] PROGMEM = "blocked ahead. Stationary traffic for 2 km";
-const char Event_S_01B9[] PROGMEM = "blocked ahead. Stationary traffic for 4 km";
-const char Event_S_01BA[] PROGMEM = "blocked ahead. Stationary traffic for 6 km";
-const char Event_S_01BB[] PROGMEM = "blocked ahead. Stationary traffic for 10 km";
-const char Event_S_01BC[] PROGMEM = "blocked ahead. Danger of stationary traffic";
-const char Event_S_01BD[] PROGMEM = "blocked ahead. Queuing traffic";
-const char Event_S_01BE[] PROGMEM = "blocked ahead. Queuing traffic for 1 km";
-const char Event_S_01BF[] PROGMEM = "blocked ahead. Queuing traffic for 2 km";
-const char Event_S_01C0[] PROGMEM = "blocked ahead. Queuing traffic for 4 km";
-const char Event_S_01C1[] PROGMEM = "blocked ahead. Queuing traffic for 6 km";
-const char Event_S_01C2[] PROGMEM = "blocked ahead. Queuing traffic for 10 km";
-const char Event_S_01C3[] PROGMEM = "blocked ahead. Danger of queuing traffic";
-const char Event_S_01C4[] PROGMEM = "blocked ahead. Slow traffic";
-const char Event_S_01C5[] PROGMEM = "blocked ahead. Slow traffic for 1 km";
-const char Event_S_01C6[] PROGMEM = "blocked ahead. Slow traffic for 2 km";
-const char Event_S_01C7[] PROGMEM = "blocked ahead. Slow traffic for 4 km";
-const char Event_S_01C8[] PROGMEM = "blocked ahead. Slow traffic for 6 km";
-const char Event_S_01C9[] PROGMEM = "blocked ahead. Slow traffic for 10 km";
-const char Event_S_01CA[] PROGMEM = "blocked ahead. Slow traffic expected";
-const char Event_S_01CB[] PROGMEM = "blocked ahead. Heavy traffic";
-const char Event_S_01CC[] PROGMEM = "blocked ahead. Heavy traffic expected";
-const char Event_S_01CD[] PROGMEM = "blocked ahead. Traffic flowing freely";
-const char Event_S_01CE[] PROGMEM = "blocked ahead. Traffic building up";
-const char Event_S_01CF[] PROGMEM = "blocked ahead. Delays (%s)";
-const char Event_S_01D0[] PROGMEM = "blocked ahead. Delays (%s) expected";
-const char Event_S_01D1[] PROGMEM = "blocked ahead. Long delays (%s)";
-const char Event_S_01D2[] PROGMEM = "slip roads reopened";
-const char Event_S_01D3[] PROGMEM = "reopened";
-const char Event_S_01D4[] PROGMEM = "message cancelled";
-const char Event_S_01D5[] PROGMEM = "closed ahead";
-const char Event_S_01D6[] PROGMEM = "blocked ahead";
-const char Event_S_01D7[] PROGMEM = "(%s) entry slip road(s) closed";
-const char Event_S_01D8[] PROGMEM = "(%s th) entry slip road blocked";
-const char Event_S_01D9[] PROGMEM = "entry blocked";
-const char Event_S_01DA[] PROGMEM = "(%s) exit slip road(s) closed";
-const char Event_S_01DB[] PROGMEM = "(%s th) exit slip road blocked";
-const char Event_S_01DC[] PROGMEM = "exit blocked";
-const char Event_S_01DD[] PROGMEM = "slip roads blocked";
-const char Event_S_01DE[] PROGMEM = "connecting carriageway closed";
-const char Event_S_01DF[] PROGMEM = "parallel carriageway closed";
-const char Event_S_01E0[] PROGMEM = "right-hand parallel carriageway closed";
-const char Event_S_01E1[] PROGMEM = "left-hand parallel carriageway closed";
-const char Event_S_01E2[] PROGMEM = "express lanes closed";
-const char Event_S_01E3[] PROGMEM = "through traffic lanes closed";
-const char Event_S_01E4[] PROGMEM = "local lanes closed";
-const char Event_S_01E5[] PROGMEM = "connecting carriageway blocked";
-const char Event_S_01E6[] PROGMEM = "parallel carriageway blocked";
-const char Event_S_01E7[] PROGMEM = "right-hand parallel carriageway blocked";
-const char Event_S_01E8[] PROGMEM = "left-hand parallel carriageway blocked";
-const char Event_S_01E9[] PROGMEM = "express lanes blocked";
-const char Event_S_01EA[] PROGMEM = "through traffic lanes blocked";
-const char Event_S_01EB[] PROGMEM = "local lanes blocked";
-const char Event_S_01EC[] PROGMEM = "no motor vehicles";
-const char Event_S_01ED[] PROGMEM = "restrictions";
-const char Event_S_01EE[] PROGMEM = "closed for heavy lorries (over %s)";
-const char Event_S_01EF[] PROGMEM = "closed ahead. Stationary traffic for 3 km";
-const char Event_S_01F0[] PROGMEM = "closed ahead. Queuing traffic for 3 km";
-const char Event_S_01F1[] PROGMEM = "closed ahead. Slow traffic for 3 km";
-const char Event_S_01F2[] PROGMEM = "blocked ahead. Stationary traffic for 3 km";
-const char Event_S_01F3[] PROGMEM = "blocked ahead. Queuing traffic for 3 km";
-const char Event_S_01F4[] PROGMEM = "(%s) lane(s) closed";
-const char Event_S_01F5[] PROGMEM = "(%s) right lane(s) closed";
-const char Event_S_01F6[] PROGMEM = "(%s) centre lane(s) closed";
-const char Event_S_01F7[] PROGMEM = "(%s) left lane(s) closed";
-const char Event_S_01F8[] PROGMEM = "hard shoulder closed";
-const char Event_S_01F9[] PROGMEM = "two lanes closed";
-const char Event_S_01FA[] PROGMEM = "three lanes closed";
-const char Event_S_01FB[] PROGMEM = "(%s) right lane(s) blocked";
-const char Event_S_01FC[] PROGMEM = "(%s) centre lane(s) blocked";
-const char Event_S_01FD[] PROGMEM = "(%s) left lane(s) blocked";
-const char Event_S_01FE[] PROGMEM = "hard shoulder blocked";
-const char Event_S_01FF[] PROGMEM = "two lanes blocked";
-const char Event_S_0200[] PROGMEM = "three lanes blocked";
-const char Event_S_0201[] PROGMEM = "single alternate line traffic";
-const char Event_S_0202[] PROGMEM = "carriageway reduced (from %s lanes) to one lane";
-const char Event_S_0203[] PROGMEM = "carriageway reduced (from %s lanes) to two lanes";
-const char Event_S_0204[] PROGMEM = "carriageway reduced (from %s lanes) to three lanes";
-const char Event_S_0205[] PROGMEM = "contraflow";
-const char Event_S_0206[] PROGMEM = "narrow lanes";
-const char Event_S_0207[] PROGMEM = "contraflow with narrow lanes";
-const char Event_S_0208[] PROGMEM = "(%s) lane(s) blocked";
-const char Event_S_0209[] PROGMEM = "(%s) lanes closed. Stationary traffic";
-const char Event_S_020A[] PROGMEM = "(%s) lanes closed. Stationary traffic for 1 km";
-const char Event_S_020B[] PROGMEM = "(%s) lanes closed. Stationary traffic for 2 km";
-const char Event_S_020C[] PROGMEM = "(%s) lanes closed. Stationary traffic for 4 km";
-const char Event_S_020D[] PROGMEM = "(%s) lanes closed. Stationary traffic for 6 km";
-const char Event_S_020E[] PROGMEM = "(%s) lanes closed. Stationary traffic for 10 km";
-const char Event_S_020F[] PROGMEM = "(%s) lanes closed. Danger of stationary traffic";
-const char Event_S_0210[] PROGMEM = "(%s) lanes closed. Queuing traffic";
-const char Event_S_0211[] PROGMEM = "(%s) lanes closed. Queuing traffic for 1 km";
-const char Event_S_0212[] PROGMEM = "(%s) lanes closed. Queuing traffic for 2 km";
-const char Event_S_0213[] PROGMEM = "(%s) lanes closed. Queuing traffic for 4 km";
-const char Event_S_0214[] PROGMEM = "(%s) lanes closed. Queuing traffic for 6 km";
-const char Event_S_0215[] PROGMEM = "(%s) lanes closed. Queuing traffic for 10 km";
-const char Event_S_0216[] PROGMEM = "(%s) lanes closed. Danger of queuing traffic";
-const char Event_S_0217[] PROGMEM = "(%s) lanes closed. Slow traffic";
-const char Event_S_0218[] PROGMEM = "(%s) lanes closed. Slow traffic for 1 km";
-const char Event_S_0219[] PROGMEM = "(%s) lanes closed. Slow traffic for 2 km";
-const char Event_S_021A[] PROGMEM = "(%s) lanes closed. Slow traffic for 4 km";
-const char Event_S_021B[] PROGMEM = "(%s) lanes closed. Slow traffic for 6 km";
-const char Event_S_021C[] PROGMEM = "(%s) lanes closed. Slow traffic for 10 km";
-const char Event_S_021D[] PROGMEM = "(%s) lanes closed. Slow traffic expected";
-const char Event_S_021E[] PROGMEM = "(%s) lanes closed. Heavy traffic";
-const char Event_S_021F[] PROGMEM = "(%s) lanes closed. Heavy traffic expected";
-const char Event_S_0220[] PROGMEM = "(%s)lanes closed. Traffic flowing freely";
-const char Event_S_0221[] PROGMEM = "(%s)lanes closed. Traffic building up";
-const char Event_S_0222[] PROGMEM = "carriageway reduced (from %s lanes) to one lane. Stationary traffic";
-const char Event_S_0223[] PROGMEM = "carriageway reduced (from %s lanes) to one lane. Danger of stationary traffic";
-const char Event_S_0224[] PROGMEM = "carriageway reduced (from %s lanes) to one lane. Queuing traffic";
-const char Event_S_0225[] PROGMEM = "carriageway reduced (from %s lanes) to one lane. Danger of queuing traffic";
-const char Event_S_0226[] PROGMEM = "carriageway reduced (from %s lanes) to one lane. Slow traffic";
-const char Event_S_0227[] PROGMEM = "carriageway reduced (from %s lanes) to one lane. Slow traffic expected";
-const char Event_S_0228[] PROGMEM = "carriageway reduced (from %s lanes) to one lane. Heavy traffic";
-const char Event_S_0229[] PROGMEM = "carriageway reduced (from %s lanes) to one lane. Heavy traffic expected";
-const char Event_S_022A[] PROGMEM = "carriageway reduced (from %s lanes) to one lane. Traffic flowing freely";
-const char Event_S_022B[] PROGMEM = "carriageway reduced (from %s lanes) to one lane. Traffic building up";
-const char Event_S_022C[] PROGMEM = "carriageway reduced (from %s lanes) to two lanes. Stationary traffic";
-const char Event_S_022D[] PROGMEM = "carriageway reduced (from %s lanes) to two lanes. Danger of stationary traffic";
-const char Event_S_022E[] PROGMEM = "carriageway reduced (from %s lanes) to two lanes. Queuing traffic";
-const char Event_S_022F[] PROGMEM = "carriageway reduced (from %s lanes) to two lanes. Danger of queuing traffic";
-const char Event_S_0230[] PROGMEM = "carriageway reduced (from %s lanes) to two lanes. Slow traffic";
-const char Event_S_0231[] PROGMEM = "carriageway reduced (from %s lanes) to two lanes. Slow traffic expected";
-const char Event_S_0232[] PROGMEM = "carriageway reduced (from %s lanes) to two lanes. Heavy traffic";
-const char Event_S_0233[] PROGMEM = "carriageway reduced (from %s lanes) to two lanes. Heavy traffic expected";
-const char Event_S_0234[] PROGMEM = "carriageway reduced (from %s lanes) to two lanes. Traffic flowing freely";
-const char Event_S_0235[] PROGMEM = "carriageway reduced (from %s lanes) to two lanes. Traffic building up";
-const char Event_S_0236[] PROGMEM = "carriageway reduced (from %s lanes) to three lanes. Stationary traffic";
-const char Event_S_0237[] PROGMEM = "carriageway reduced (from %s lanes) to three lanes. Danger of stationary traffic";
-const char Event_S_0238[] PROGMEM = "carriageway reduced (from %s lanes) to three lanes. Queuing traffic";
-const char Event_S_0239[] PROGMEM = "carriageway reduced (from %s lanes) to three lanes. Danger of queuing traffic";
-const char Event_S_023A[] PROGMEM = "carriageway reduced (from %s lanes) to three lanes. Slow traffic";
-const char Event_S_023B[] PROGMEM = "carriageway reduced (from %s lanes) to three lanes. Slow traffic expected";
-const char Event_S_023C[] PROGMEM = "carriageway reduced (from %s lanes) to three lanes. Heavy traffic";
-const char Event_S_023D[] PROGMEM = "carriageway reduced (from %s lanes) to three lanes. Heavy traffic expected";
-const char Event_S_023E[] PROGMEM = "carriageway reduced (from %s lanes) to three lanes. Traffic flowing freely";
-const char Event_S_023F[] PROGMEM = "carriageway reduced (from %s lanes) to three lanes. Traffic building up";
-const char Event_S_0240[] PROGMEM = "contraflow. Stationary traffic";
-const char Event_S_0241[] PROGMEM = "contraflow. Stationary traffic for 1 km";
-const char Event_S_0242[] PROGMEM = "contraflow. Stationary traffic for 2 km";
-const char Event_S_0243[] PROGMEM = "contraflow. Stationary traffic for 4 km";
-const char Event_S_0244[] PROGMEM = "contraflow. Stationary traffic for 6 km";
-const char Event_S_0245[] PROGMEM = "contraflow. Stationary traffic for 10 km";
-const char Event_S_0246[] PROGMEM = "contraflow. Danger of stationary traffic";
-const char Event_S_0247[] PROGMEM = "contraflow. Queuing traffic";
-const char Event_S_0248[] PROGMEM = "contraflow. Queuing traffic for 1 km";
-const char Event_S_0249[] PROGMEM = "contraflow. Queuing traffic for 2 km";
-const char Event_S_024A[] PROGMEM = "contraflow. Queuing traffic for 4 km";
-const char Event_S_024B[] PROGMEM = "contraflow. Queuing traffic for 6 km";
-const char Event_S_024C[] PROGMEM = "contraflow. Queuing traffic for 10 km";
-const char Event_S_024D[] PROGMEM = "contraflow. Danger of queuing traffic";
-const char Event_S_024E[] PROGMEM = "contraflow. Slow traffic";
-const char Event_S_024F[] PROGMEM = "contraflow. Slow traffic for 1 km";
-const char Event_S_0250[] PROGMEM = "contraflow. Slow traffic for 2 km";
-const char Event_S_0251[] PROGMEM = "contraflow. Slow traffic for 4 km";
-const char Event_S_0252[] PROGMEM = "contraflow. Slow traffic for 6 km";
-const char Event_S_0253[] PROGMEM = "contraflow. Slow traffic for 10 km";
-const char Event_S_0254[] PROGMEM = "contraflow. Slow traffic expected";
-const char Event_S_0255[] PROGMEM = "contraflow. Heavy traffic";
-const char Event_S_0256[] PROGMEM = "contraflow. Heavy traffic expected";
-const char Event_S_0257[] PROGMEM = "contraflow. Traffic flowing freely";
-const char Event_S_0258[] PROGMEM = "contraflow. Traffic building up";
-const char Event_S_0259[] PROGMEM = "contraflow. Carriageway reduced (from %s lanes) to one lane";
-const char Event_S_025A[] PROGMEM = "contraflow. Carriageway reduced (from %s lanes) to two lanes";
-const char Event_S_025B[] PROGMEM = "contraflow. Carriageway reduced (from %s lanes) to three lanes";
-const char Event_S_025C[] PROGMEM = "narrow lanes. Stationary traffic";
-const char Event_S_025D[] PROGMEM = "narrow lanes. Danger of stationary traffic";
-const char Event_S_025E[] PROGMEM = "narrow lanes. Queuing traffic";
-const char Event_S_025F[] PROGMEM = "narrow lanes. Danger of queuing traffic";
-const char Event_S_0260[] PROGMEM = "narrow lanes. Slow traffic";
-const char Event_S_0261[] PROGMEM = "narrow lanes. Slow traffic expected";
-const char Event_S_0262[] PROGMEM = "narrow lanes. Heavy traffic";
-const char Event_S_0263[] PROGMEM = "narrow lanes. Heavy traffic expected";
-const char Event_S_0264[] PROGMEM = "narrow lanes. Traffic flowing freely";
-const char Event_S_0265[] PROGMEM = "narrow lanes. Traffic building up";
-const char Event_S_0266[] PROGMEM = "contraflow with narrow lanes. Stationary traffic";
-const char Event_S_0267[] PROGMEM = "contraflow with narrow lanes. Stationary traffic. Danger of stationary traffic";
-const char Event_S_0268[] PROGMEM = "contraflow with narrow lanes. Queuing traffic";
-const char Event_S_0269[] PROGMEM = "contraflow with narrow lanes. Danger of queuing traffic";
-const char Event_S_026A[] PROGMEM = "contraflow with narrow lanes. Slow traffic";
-const char Event_S_026B[] PROGMEM = "contraflow with narrow lanes. Slow traffic expected";
-const char Event_S_026C[] PROGMEM = "contraflow with narrow lanes. Heavy traffic";
-const char Event_S_026D[] PROGMEM = "contraflow with narrow lanes. Heavy traffic expected";
-const char Event_S_026E[] PROGMEM = "contraflow with narrow lanes. Traffic flowing freely";
-const char Event_S_026F[] PROGMEM = "contraflow with narrow lanes. Traffic building up";
-const char Event_S_0270[] PROGMEM = "lane closures removed";
-const char Event_S_0271[] PROGMEM = "message cancelled";
-const char Event_S_0272[] PROGMEM = "blocked ahead. Slow traffic for 3 km";
-const char Event_S_0273[] PROGMEM = "no motor vehicles without catalytic converters";
-const char Event_S_0274[] PROGMEM = "no motor vehicles with even-numbered registration plates";
-const char Event_S_0275[] PROGMEM = "no motor vehicles with odd-numbered registration plates";
-const char Event_S_0276[] PROGMEM = "open";
-const char Event_S_0277[] PROGMEM = "road cleared";
-const char Event_S_0278[] PROGMEM = "entry reopened";
-const char Event_S_0279[] PROGMEM = "exit reopened";
-const char Event_S_027A[] PROGMEM = "all carriageways reopened";
-const char Event_S_027B[] PROGMEM = "motor vehicle restrictions lifted";
-const char Event_S_027C[] PROGMEM = "traffic restrictions lifted";
-const char Event_S_027D[] PROGMEM = "emergency lane closed";
-const char Event_S_027E[] PROGMEM = "turning lane closed";
-const char Event_S_027F[] PROGMEM = "crawler lane closed";
-const char Event_S_0280[] PROGMEM = "slow vehicle lane closed";
-const char Event_S_0281[] PROGMEM = "one lane closed";
-const char Event_S_0282[] PROGMEM = "emergency lane blocked";
-const char Event_S_0283[] PROGMEM = "turning lane blocked";
-const char Event_S_0284[] PROGMEM = "crawler lane blocked";
-const char Event_S_0285[] PROGMEM = "slow vehicle lane blocked";
-const char Event_S_0286[] PROGMEM = "one lane blocked";
-const char Event_S_0287[] PROGMEM = "(%s person) carpool lane in operation";
-const char Event_S_0288[] PROGMEM = "(%s person) carpool lane closed";
-const char Event_S_0289[] PROGMEM = "(%s person) carpool lane blocked";
-const char Event_S_028A[] PROGMEM = "carpool restrictions changed (to %s persons per vehicle)";
-const char Event_S_028B[] PROGMEM = "(%s) lanes closed. Stationary traffic for 3 km";
-const char Event_S_028C[] PROGMEM = "(%s) lanes closed. Queuing traffic for 3 km";
-const char Event_S_028D[] PROGMEM = "(%s) lanes closed. Slow traffic for 3 km";
-const char Event_S_028E[] PROGMEM = "contraflow. Stationary traffic for 3 km";
-const char Event_S_028F[] PROGMEM = "contraflow. Queuing traffic for 3 km";
-const char Event_S_0290[] PROGMEM = "contraflow. Slow traffic for 3 km";
-const char Event_S_0291[] PROGMEM = "lane blockages cleared";
-const char Event_S_0292[] PROGMEM = "contraflow removed";
-const char Event_S_0293[] PROGMEM = "(%s person) carpool restrictions lifted";
-const char Event_S_0294[] PROGMEM = "lane restrictions lifted";
-const char Event_S_0295[] PROGMEM = "use of hard shoulder allowed";
-const char Event_S_0296[] PROGMEM = "normal lane regulations restored";
-const char Event_S_0297[] PROGMEM = "all carriageways cleared";
-const char Event_S_0298[] PROGMEM = "carriageway closed";
-const char Event_S_0299[] PROGMEM = "both directions closed";
-const char Event_S_029A[] PROGMEM = "intermittent short term closures";
-const char Event_S_029F[] PROGMEM = "bus lane available for carpools (with at least %s occupants)";
-const char Event_S_02A0[] PROGMEM = "message cancelled";
-const char Event_S_02A1[] PROGMEM = "message cancelled";
-const char Event_S_02A3[] PROGMEM = "(%s) salting vehicles";
-const char Event_S_02A4[] PROGMEM = "bus lane blocked";
-const char Event_S_02A6[] PROGMEM = "heavy vehicle lane closed";
-const char Event_S_02A7[] PROGMEM = "heavy vehicle lane blocked";
-const char Event_S_02A8[] PROGMEM = "reopened for through traffic";
-const char Event_S_02A9[] PROGMEM = "(%s) snowploughs";
-const char Event_S_02BD[] PROGMEM = "(%s sets of) roadworks";
-const char Event_S_02BE[] PROGMEM = "(%s sets of) major roadworks";
-const char Event_S_02BF[] PROGMEM = "(%s sets of) maintenance work";
-const char Event_S_02C0[] PROGMEM = "(%s sections of) resurfacing work";
-const char Event_S_02C1[] PROGMEM = "(%s sets of) central reservation work";
-const char Event_S_02C2[] PROGMEM = "(%s sets of) road marking work";
-const char Event_S_02C3[] PROGMEM = "bridge maintenance work (at %s bridges)";
-const char Event_S_02C4[] PROGMEM = "(%s sets of) temporary traffic lights";
-const char Event_S_02C5[] PROGMEM = "(%s sections of) blasting work";
-const char Event_S_02C6[] PROGMEM = "(%s sets of) roadworks. Stationary traffic";
-const char Event_S_02C7[] PROGMEM = "(%s sets of) roadworks. Stationary traffic for 1 km";
-const char Event_S_02C8[] PROGMEM = "(%s sets of) roadworks. Stationary traffic for 2 km";
-const char Event_S_02C9[] PROGMEM = "(%s sets of) roadworks. Stationary traffic for 4 km";
-const char Event_S_02CA[] PROGMEM = "(%s sets of) roadworks. Stationary traffic for 6 km";
-const char Event_S_02CB[] PROGMEM = "(%s sets of) roadworks. Stationary traffic for 10 km";
-const char Event_S_02CC[] PROGMEM = "(%s sets of) roadworks. Danger of stationary traffic";
-const char Event_S_02CD[] PROGMEM = "(%s sets of) roadworks. Queuing traffic";
-const char Event_S_02CE[] PROGMEM = "(%s sets of) roadworks. Queuing traffic for 1 km";
-const char Event_S_02CF[] PROGMEM = "(%s sets of) roadworks. Queuing traffic for 2 km";
-const char Event_S_02D0[] PROGMEM = "(%s sets of) roadworks. Queuing traffic for 4 km";
-const char Event_S_02D1[] PROGMEM = "(%s sets of) roadworks. Queuing traffic for 6 km";
-const char Event_S_02D2[] PROGMEM = "(%s sets of) roadworks. Queuing traffic for 10 km";
-const char Event_S_02D3[] PROGMEM = "(%s sets of) roadworks. Danger of queuing traffic";
-const char Event_S_02D4[] PROGMEM = "(%s sets of) roadworks. Slow traffic";
-const char Event_S_02D5[] PROGMEM = "(%s sets of) roadworks. Slow traffic for 1 km";
-const char Event_S_02D6[] PROGMEM = "(%s sets of) roadworks. Slow traffic for 2 km";
-const char Event_S_02D7[] PROGMEM = "(%s sets of) roadworks. Slow traffic for 4 km";
-const char Event_S_02D8[] PROGMEM = "(%s sets of) roadworks. Slow traffic for 6 km";
-const char Event_S_02D9[] PROGMEM = "(%s sets of) roadworks. Slow traffic for 10 km";
-const char Event_S_02DA[] PROGMEM = "(%s sets of) roadworks. Slow traffic expected";
-const char Event_S_02DB[] PROGMEM = "(%s sets of) roadworks. Heavy traffic";
-const char Event_S_02DC[] PROGMEM = "(%s sets of) roadworks. Heavy traffic expected";
-const char Event_S_02DD[] PROGMEM = "(%s sets of) roadworks. Traffic flowing freely";
-const char Event_S_02DE[] PROGMEM = "(%s sets of) roadworks. Traffic building up";
-const char Event_S_02DF[] PROGMEM = "closed due to (%s sets of) roadworks";
-const char Event_S_02E0[] PROGMEM = "(%s sets of) roadworks. Right lane closed";
-const char Event_S_02E1[] PROGMEM = "(%s sets of) roadworks. Centre lane closed";
-const char Event_S_02E2[] PROGMEM = "(%s sets of) roadworks. Left lane closed";
-const char Event_S_02E3[] PROGMEM = "(%s sets of) roadworks. Hard shoulder closed";
-const char Event_S_02E4[] PROGMEM = "(%s sets of) roadworks. Two lanes closed";
-const char Event_S_02E5[] PROGMEM = "(%s sets of) roadworks. Three lanes closed";
-const char Event_S_02E6[] PROGMEM = "(%s sets of) roadworks. Single alternate line traffic";
-const char Event_S_02E7[] PROGMEM = "roadworks. Carriageway reduced (from %s lanes) to one lane";
-const char Event_S_02E8[] PROGMEM = "roadworks. Carriageway reduced (from %s lanes) to two lanes";
-const char Event_S_02E9[] PROGMEM = "roadworks. Carriageway reduced (from %s lanes) to three lanes";
-const char Event_S_02EA[] PROGMEM = "(%s sets of) roadworks. Contraflow";
-const char Event_S_02EB[] PROGMEM = "roadworks. Delays (%s)";
-const char Event_S_02EC[] PROGMEM = "roadworks. Delays (%s) expected";
-const char Event_S_02ED[] PROGMEM = "roadworks. Long delays (%s)";
-const char Event_S_02EE[] PROGMEM = "(%s sections of) resurfacing work. Stationary traffic";
-const char Event_S_02EF[] PROGMEM = "(%s sections of) resurfacing work. Stationary traffic for 1 km";
-const char Event_S_02F0[] PROGMEM = "(%s sections of) resurfacing work. Stationary traffic for 2 km";
-const char Event_S_02F1[] PROGMEM = "(%s sections of) resurfacing work. Stationary traffic for 4 km";
-const char Event_S_02F2[] PROGMEM = "(%s sections of) resurfacing work. Stationary traffic for 6 km";
-const char Event_S_02F3[] PROGMEM = "(%s sections of) resurfacing work. Stationary traffic for 10 km";
-const char Event_S_02F4[] PROGMEM = "(%s sections of) resurfacing work. Danger of stationary traffic";
-const char Event_S_02F5[] PROGMEM = "(%s sections of) resurfacing work. Queuing traffic";
-const char Event_S_02F6[] PROGMEM = "(%s sections of) resurfacing work. Queuing traffic for 1 km";
-const char Event_S_02F7[] PROGMEM = "(%s sections of) resurfacing work. Queuing traffic for 2 km";
-const char Event_S_02F8[] PROGMEM = "(%s sections of) resurfacing work. Queuing traffic for 4 km";
-const char Event_S_02F9[] PROGMEM = "(%s sections of) resurfacing work. Queuing traffic for 6 km";
-const char Event_S_02FA[] PROGMEM = "(%s sections of) resurfacing work. Queuing traffic for 10 km";
-const char Event_S_02FB[] PROGMEM = "(%s sections of) resurfacing work. Danger of queuing traffic";
-const char Event_S_02FC[] PROGMEM = "(%s sections of) resurfacing work. Slow traffic";
-const char Event_S_02FD[] PROGMEM = "(%s sections of) resurfacing work. Slow traffic for 1 km";
-const char Event_S_02FE[] PROGMEM = "(%s sections of) resurfacing work. Slow traffic for 2 km";
-const char Event_S_02FF[] PROGMEM = "(%s sections of) resurfacing work. Slow traffic for 4 km";
-const char Event_S_0300[] PROGMEM = "(%s sections of) resurfacing work. Slow traffic for 6 km";
-const char Event_S_0301[] PROGMEM = "(%s sections of) resurfacing work. Slow traffic for 10 km";
-const char Event_S_0302[] PROGMEM = "(%s sections of) resurfacing work. Slow traffic expected";
-const char Event_S_0303[] PROGMEM = "(%s sections of) resurfacing work. Heavy traffic";
-const char Event_S_0304[] PROGMEM = "(%s sections of) resurfacing work. Heavy traffic expected";
-const char Event_S_0305[] PROGMEM = "(%s sections of) resurfacing work. Traffic flowing freely";
-const char Event_S_0306[] PROGMEM = "(%s sections of) resurfacing work. Traffic building up";
-const char Event_S_0307[] PROGMEM = "(%s sections of) resurfacing work. Single alternate line traffic";
-const char Event_S_0308[] PROGMEM = "resurfacing work. Carriageway reduced (from %s lanes) to one lane";
-const char Event_S_0309[] PROGMEM = "resurfacing work. Carriageway reduced (from %s lanes) to two lanes";
-const char Event_S_030A[] PROGMEM = "resurfacing work. Carriageway reduced (from %s lanes) to three lanes";
-const char Event_S_030B[] PROGMEM = "(%s sections of) resurfacing work. Contraflow";
-const char Event_S_030C[] PROGMEM = "resurfacing work. Delays (%s)";
-const char Event_S_030D[] PROGMEM = "resurfacing work. Delays (%s) expected";
-const char Event_S_030E[] PROGMEM = "resurfacing work. Long delays (%s)";
-const char Event_S_030F[] PROGMEM = "(%s sets of) road marking work. Stationary traffic";
-const char Event_S_0310[] PROGMEM = "(%s sets of) road marking work. Danger of stationary traffic";
-const char Event_S_0311[] PROGMEM = "(%s sets of) road marking work. Queuing traffic";
-const char Event_S_0312[] PROGMEM = "(%s sets of) road marking work. Danger of queuing traffic";
-const char Event_S_0313[] PROGMEM = "(%s sets of) road marking work. Slow traffic";
-const char Event_S_0314[] PROGMEM = "(%s sets of) road marking work. Slow traffic expected";
-const char Event_S_0315[] PROGMEM = "(%s sets of) road marking work. Heavy traffic";
-const char Event_S_0316[] PROGMEM = "(%s sets of) road marking work. Heavy traffic expected";
-const char Event_S_0317[] PROGMEM = "(%s sets of) road marking work. Traffic flowing freely";
-const char Event_S_0318[] PROGMEM = "(%s sets of) road marking work. Traffic building up";
-const char Event_S_0319[] PROGMEM = "(%s sets of) road marking work. Right lane closed";
-const char Event_S_031A[] PROGMEM = "(%s sets of) road marking work. Centre lane closed";
-const char Event_S_031B[] PROGMEM = "(%s sets of) road marking work. Left lane closed";
-const char Event_S_031C[] PROGMEM = "(%s sets of) road marking work. Hard shoulder closed";
-const char Event_S_031D[] PROGMEM = "(%s sets of) road marking work. Two lanes closed";
-const char Event_S_031E[] PROGMEM = "(%s sets of) road marking work. Three lanes closed";
-const char Event_S_031F[] PROGMEM = "closed for bridge demolition work (at %s bridges)";
-const char Event_S_0320[] PROGMEM = "roadworks cleared";
-const char Event_S_0321[] PROGMEM = "message cancelled";
-const char Event_S_0322[] PROGMEM = "(%s sets of) long-term roadworks";
-const char Event_S_0323[] PROGMEM = "(%s sets of) construction work";
-const char Event_S_0324[] PROGMEM = "(%s sets of) slow moving maintenance vehicles";
-const char Event_S_0325[] PROGMEM = "bridge demolition work (at %s bridges)";
-const char Event_S_0326[] PROGMEM = "(%s sets of) water main work";
-const char Event_S_0327[] PROGMEM = "(%s sets of) gas main work";
-const char Event_S_0328[] PROGMEM = "(%s sets of) work on buried cables";
-const char Event_S_0329[] PROGMEM = "(%s sets of) work on buried services";
-const char Event_S_032A[] PROGMEM = "new roadworks layout";
-const char Event_S_032B[] PROGMEM = "new road layout";
-const char Event_S_032C[] PROGMEM = "(%s sets of) roadworks. Stationary traffic for 3 km";
-const char Event_S_032D[] PROGMEM = "(%s sets of) roadworks. Queuing traffic for 3 km";
-const char Event_S_032E[] PROGMEM = "(%s sets of) roadworks. Slow traffic for 3 km";
-const char Event_S_032F[] PROGMEM = "(%s sets of) roadworks during the day time";
-const char Event_S_0330[] PROGMEM = "(%s sets of) roadworks during off-peak periods";
-const char Event_S_0331[] PROGMEM = "(%s sets of) roadworks during the night";
-const char Event_S_0332[] PROGMEM = "(%s sections of) resurfacing work. Stationary traffic for 3 km";
-const char Event_S_0333[] PROGMEM = "(%s sections of) resurfacing work. Queuing traffic for 3 km";
-const char Event_S_0334[] PROGMEM = "(%s sections of) resurfacing work. Slow traffic for 3 km";
-const char Event_S_0335[] PROGMEM = "(%s sets of) resurfacing work during the day time";
-const char Event_S_0336[] PROGMEM = "(%s sets of) resurfacing work during off-peak periods";
-const char Event_S_0337[] PROGMEM = "(%s sets of) resurfacing work during the night";
-const char Event_S_0338[] PROGMEM = "(%s sets of) road marking work. Danger";
-const char Event_S_0339[] PROGMEM = "(%s sets of) slow moving maintenance vehicles. Stationary traffic";
-const char Event_S_033A[] PROGMEM = "(%s sets of) slow moving maintenance vehicles. Danger of stationary traffic";
-const char Event_S_033B[] PROGMEM = "(%s sets of) slow moving maintenance vehicles. Queuing traffic";
-const char Event_S_033C[] PROGMEM = "(%s sets of) slow moving maintenance vehicles. Danger of queuing traffic";
-const char Event_S_033D[] PROGMEM = "(%s sets of) slow moving maintenance vehicles. Slow traffic";
-const char Event_S_033E[] PROGMEM = "(%s sets of) slow moving maintenance vehicles. Slow traffic expected";
-const char Event_S_033F[] PROGMEM = "(%s sets of) slow moving maintenance vehicles. Heavy traffic";
-const char Event_S_0340[] PROGMEM = "(%s sets of) slow moving maintenance vehicles. Heavy traffic expected";
-const char Event_S_0341[] PROGMEM = "(%s sets of) slow moving maintenance vehicles. Traffic flowing freely";
-const char Event_S_0342[] PROGMEM = "(%s sets of) slow moving maintenance vehicles. Traffic building up";
-const char Event_S_0343[] PROGMEM = "(%s sets of) slow moving maintenance vehicles. Right lane closed";
-const char Event_S_0344[] PROGMEM = "(%s sets of) slow moving maintenance vehicles. Centre lane closed";
-const char Event_S_0345[] PROGMEM = "(%s sets of) slow moving maintenance vehicles. Left lane closed";
-const char Event_S_0346[] PROGMEM = "(%s sets of) slow moving maintenance vehicles. Two lanes closed";
-const char Event_S_0347[] PROGMEM = "(%s sets of) slow moving maintenance vehicles. Three lanes closed";
-const char Event_S_0348[] PROGMEM = "water main work. Delays (%s)";
-const char Event_S_0349[] PROGMEM = "water main work. Delays (%s) expected";
-const char Event_S_034A[] PROGMEM = "water main work. Long delays (%s)";
-const char Event_S_034B[] PROGMEM = "gas main work. Delays (%s)";
-const char Event_S_034C[] PROGMEM = "gas main work. Delays (%s) expected";
-const char Event_S_034D[] PROGMEM = "gas main work. Long delays (%s)";
-const char Event_S_034E[] PROGMEM = "work on buried cables. Delays (%s)";
-const char Event_S_034F[] PROGMEM = "work on buried cables. Delays (%s) expected";
-const char Event_S_0350[] PROGMEM = "work on buried cables. Long delays (%s)";
-const char Event_S_0351[] PROGMEM = "work on buried services. Delays (%s)";
-const char Event_S_0352[] PROGMEM = "work on buried services. Delays (%s) expected";
-const char Event_S_0353[] PROGMEM = "work on buried services. Long delays (%s)";
-const char Event_S_0354[] PROGMEM = "construction traffic merging";
-const char Event_S_0355[] PROGMEM = "roadwork clearance in progress";
-const char Event_S_0356[] PROGMEM = "maintenance work cleared";
-const char Event_S_0357[] PROGMEM = "road layout unchanged";
-const char Event_S_0358[] PROGMEM = "construction traffic merging. Danger";
-const char Event_S_0359[] PROGMEM = "(%s) unprotected accident area(s)";
-const char Event_S_035A[] PROGMEM = "danger of(%s) unprotected accident area(s)";
-const char Event_S_035B[] PROGMEM = "(%s) unlit vehicle(s) on the road";
-const char Event_S_035C[] PROGMEM = "danger of (%s) unlit vehicle(s) on the road";
-const char Event_S_035D[] PROGMEM = "snow and ice debris";
-const char Event_S_035E[] PROGMEM = "danger of snow and ice debris";
-const char Event_S_0381[] PROGMEM = "people throwing objects onto the road. Danger";
-const char Event_S_0382[] PROGMEM = "obstruction warning withdrawn";
-const char Event_S_0383[] PROGMEM = "clearance work in progress, road free again";
-const char Event_S_0384[] PROGMEM = "flooding expected";
-const char Event_S_0385[] PROGMEM = "(%s) obstruction(s) on roadway";
-const char Event_S_0386[] PROGMEM = "(%s) obstructions on the road. Danger";
-const char Event_S_0387[] PROGMEM = "spillage on the road";
-const char Event_S_0388[] PROGMEM = "storm damage";
-const char Event_S_0389[] PROGMEM = "(%s) fallen trees";
-const char Event_S_038A[] PROGMEM = "(%s) fallen trees. Danger";
-const char Event_S_038B[] PROGMEM = "flooding";
-const char Event_S_038C[] PROGMEM = "flooding. Danger";
-const char Event_S_038D[] PROGMEM = "flash floods";
-const char Event_S_038E[] PROGMEM = "danger of flash floods";
-const char Event_S_038F[] PROGMEM = "avalanches";
-const char Event_S_0390[] PROGMEM = "avalanche risk";
-const char Event_S_0391[] PROGMEM = "rockfalls";
-const char Event_S_0392[] PROGMEM = "landslips";
-const char Event_S_0393[] PROGMEM = "earthquake damage";
-const char Event_S_0394[] PROGMEM = "road surface in poor condition";
-const char Event_S_0395[] PROGMEM = "subsidence";
-const char Event_S_0396[] PROGMEM = "(%s) collapsed sewer(s)";
-const char Event_S_0397[] PROGMEM = "burst water main";
-const char Event_S_0398[] PROGMEM = "gas leak";
-const char Event_S_0399[] PROGMEM = "serious fire";
-const char Event_S_039A[] PROGMEM = "animals on roadway";
-const char Event_S_039B[] PROGMEM = "animals on the road. Danger";
-const char Event_S_039C[] PROGMEM = "clearance work";
-const char Event_S_039D[] PROGMEM = "blocked by storm damage";
-const char Event_S_039E[] PROGMEM = "blocked by (%s) fallen trees";
-const char Event_S_039F[] PROGMEM = "(%s) fallen tree(s). Passable with care";
-const char Event_S_03A0[] PROGMEM = "flooding. Stationary traffic";
-const char Event_S_03A1[] PROGMEM = "flooding. Danger of stationary traffic";
-const char Event_S_03A2[] PROGMEM = "flooding. Queuing traffic";
-const char Event_S_03A3[] PROGMEM = "flooding. Danger of queuing traffic";
-const char Event_S_03A4[] PROGMEM = "flooding. Slow traffic";
-const char Event_S_03A5[] PROGMEM = "flooding. Slow traffic expected";
-const char Event_S_03A6[] PROGMEM = "flooding. Heavy traffic";
-const char Event_S_03A7[] PROGMEM = "flooding. Heavy traffic expected";
-const char Event_S_03A8[] PROGMEM = "flooding. Traffic flowing freely";
-const char Event_S_03A9[] PROGMEM = "flooding. Traffic building up";
-const char Event_S_03AA[] PROGMEM = "closed due to flooding";
-const char Event_S_03AB[] PROGMEM = "flooding. Delays (%s)";
-const char Event_S_03AC[] PROGMEM = "flooding. Delays (%s) expected";
-const char Event_S_03AD[] PROGMEM = "flooding. Long delays (%s)";
-const char Event_S_03AE[] PROGMEM = "flooding. Passable with care";
-const char Event_S_03AF[] PROGMEM = "closed due to avalanches";
-const char Event_S_03B0[] PROGMEM = "avalanches. Passable with care (above %s hundred metres)";
-const char Event_S_03B1[] PROGMEM = "closed due to rockfalls";
-const char Event_S_03B2[] PROGMEM = "rockfalls. Passable with care";
-const char Event_S_03B3[] PROGMEM = "road closed due to landslips";
-const char Event_S_03B4[] PROGMEM = "landslips. Passable with care";
-const char Event_S_03B5[] PROGMEM = "closed due to subsidence";
-const char Event_S_03B6[] PROGMEM = "subsidence. Single alternate line traffic";
-const char Event_S_03B7[] PROGMEM = "subsidence. Carriageway reduced (from %s lanes) to one lane";
-const char Event_S_03B8[] PROGMEM = "subsidence. Carriageway reduced (from %s lanes) to two lanes";
-const char Event_S_03B9[] PROGMEM = "subsidence. Carriageway reduced (from %s lanes) to three lanes";
-const char Event_S_03BA[] PROGMEM = "subsidence. Contraflow in operation";
-const char Event_S_03BB[] PROGMEM = "subsidence. Passable with care";
-const char Event_S_03BC[] PROGMEM = "closed due to sewer collapse";
-const char Event_S_03BD[] PROGMEM = "road closed due to burst water main";
-const char Event_S_03BE[] PROGMEM = "burst water main. Delays (%s)";
-const char Event_S_03BF[] PROGMEM = "burst water main. Delays (%s) expected";
-const char Event_S_03C0[] PROGMEM = "burst water main. Long delays (%s)";
-const char Event_S_03C1[] PROGMEM = "closed due to gas leak";
-const char Event_S_03C2[] PROGMEM = "gas leak. Delays (%s)";
-const char Event_S_03C3[] PROGMEM = "gas leak. Delays (%s) expected";
-const char Event_S_03C4[] PROGMEM = "gas leak. Long delays (%s)";
-const char Event_S_03C5[] PROGMEM = "closed due to serious fire";
-const char Event_S_03C6[] PROGMEM = "serious fire. Delays (%s)";
-const char Event_S_03C7[] PROGMEM = "serious fire. Delays (%s) expected";
-const char Event_S_03C8[] PROGMEM = "serious fire. Long delays (%s)";
-const char Event_S_03C9[] PROGMEM = "closed for clearance work";
-const char Event_S_03CA[] PROGMEM = "road free again";
-const char Event_S_03CB[] PROGMEM = "message cancelled";
-const char Event_S_03CC[] PROGMEM = "storm damage expected";
-const char Event_S_03CD[] PROGMEM = "fallen power cables";
-const char Event_S_03CE[] PROGMEM = "sewer overflow";
-const char Event_S_03CF[] PROGMEM = "ice build-up";
-const char Event_S_03D0[] PROGMEM = "mud slide";
-const char Event_S_03D1[] PROGMEM = "grass fire";
-const char Event_S_03D2[] PROGMEM = "air crash";
-const char Event_S_03D3[] PROGMEM = "rail crash";
-const char Event_S_03D4[] PROGMEM = "blocked by (%s) obstruction(s) on the road";
-const char Event_S_03D5[] PROGMEM = "(%s) obstructions on the road. Passable with care";
-const char Event_S_03D6[] PROGMEM = "blocked due to spillage on roadway";
-const char Event_S_03D7[] PROGMEM = "spillage on the road. Passable with care";
-const char Event_S_03D8[] PROGMEM = "spillage on the road. Danger";
-const char Event_S_03D9[] PROGMEM = "storm damage. Passable with care";
-const char Event_S_03DA[] PROGMEM = "storm damage. Danger";
-const char Event_S_03DB[] PROGMEM = "blocked by fallen power cables";
-const char Event_S_03DC[] PROGMEM = "fallen power cables. Passable with care";
-const char Event_S_03DD[] PROGMEM = "fallen power cables. Danger";
-const char Event_S_03DE[] PROGMEM = "sewer overflow. Danger";
-const char Event_S_03DF[] PROGMEM = "flash floods. Danger";
-const char Event_S_03E0[] PROGMEM = "avalanches. Danger";
-const char Event_S_03E1[] PROGMEM = "closed due to avalanche risk";
-const char Event_S_03E2[] PROGMEM = "avalanche risk. Danger";
-const char Event_S_03E3[] PROGMEM = "closed due to ice build-up";
-const char Event_S_03E4[] PROGMEM = "ice build-up. Passable with care (above %s hundred metres)";
-const char Event_S_03E5[] PROGMEM = "ice build-up. Single alternate traffic";
-const char Event_S_03E6[] PROGMEM = "rockfalls. Danger";
-const char Event_S_03E7[] PROGMEM = "landslips. Danger";
-const char Event_S_03E8[] PROGMEM = "earthquake damage. Danger";
-const char Event_S_03E9[] PROGMEM = "hazardous driving conditions (above %s hundred metres)";
-const char Event_S_03EA[] PROGMEM = "danger of aquaplaning";
-const char Event_S_03EB[] PROGMEM = "slippery road (above %s hundred metres)";
-const char Event_S_03EC[] PROGMEM = "mud on road";
-const char Event_S_03ED[] PROGMEM = "leaves on road";
-const char Event_S_03EE[] PROGMEM = "ice (above %s hundred metres)";
-const char Event_S_03EF[] PROGMEM = "danger of ice (above %s hundred metres)";
-const char Event_S_03F0[] PROGMEM = "black ice (above %s hundred metres)";
-const char Event_S_03F1[] PROGMEM = "freezing rain (above %s hundred metres)";
-const char Event_S_03F2[] PROGMEM = "wet and icy roads (above %s hundred metres)";
-const char Event_S_03F3[] PROGMEM = "slush (above %s hundred metres)";
-const char Event_S_03F4[] PROGMEM = "snow on the road (above %s hundred metres)";
-const char Event_S_03F5[] PROGMEM = "packed snow (above %s hundred metres)";
-const char Event_S_03F6[] PROGMEM = "fresh snow (above %s hundred metres)";
-const char Event_S_03F7[] PROGMEM = "deep snow (above %s hundred metres)";
-const char Event_S_03F8[] PROGMEM = "snow drifts (above %s hundred metres)";
-const char Event_S_03F9[] PROGMEM = "slippery due to spillage on roadway";
-const char Event_S_03FA[] PROGMEM = "slippery road (above %s hundred metres) due to snow";
-const char Event_S_03FB[] PROGMEM = "slippery road (above %s hundred metres) due to frost";
-const char Event_S_03FC[] PROGMEM = "road blocked by snow (above %s hundred metres)";
-const char Event_S_03FD[] PROGMEM = "snow on the road. Carriageway reduced (from %s lanes) to one lane";
-const char Event_S_03FE[] PROGMEM = "snow on the road. Carriageway reduced (from %s lanes) to two lanes";
-const char Event_S_03FF[] PROGMEM = "snow on the road. Carriageway reduced (from %s lanes) to three lanes";
-const char Event_S_0400[] PROGMEM = "conditions of road surface improved";
-const char Event_S_0401[] PROGMEM = "message cancelled";
-const char Event_S_0402[] PROGMEM = "subsidence. Danger";
-const char Event_S_0403[] PROGMEM = "sewer collapse. Delays (%s)";
-const char Event_S_0404[] PROGMEM = "sewer collapse. Delays (%s) expected";
-const char Event_S_0405[] PROGMEM = "sewer collapse. Long delays (%s)";
-const char Event_S_0406[] PROGMEM = "sewer collapse. Danger";
-const char Event_S_0407[] PROGMEM = "burst water main. Danger";
-const char Event_S_0408[] PROGMEM = "gas leak. Danger";
-const char Event_S_0409[] PROGMEM = "serious fire. Danger";
-const char Event_S_040A[] PROGMEM = "clearance work. Danger";
-const char Event_S_040B[] PROGMEM = "impassable (above %s hundred metres)";
-const char Event_S_040C[] PROGMEM = "almost impassable (above %s hundred metres)";
-const char Event_S_040D[] PROGMEM = "extremely hazardous driving conditions (above %s hundred metres)";
-const char Event_S_040E[] PROGMEM = "difficult driving conditions (above %s hundred metres)";
-const char Event_S_040F[] PROGMEM = "passable with care (up to %s hundred metres)";
-const char Event_S_0410[] PROGMEM = "passable (up to %s hundred metres)";
-const char Event_S_0411[] PROGMEM = "surface water hazard";
-const char Event_S_0412[] PROGMEM = "loose sand on road";
-const char Event_S_0413[] PROGMEM = "loose chippings";
-const char Event_S_0414[] PROGMEM = "oil on road";
-const char Event_S_0415[] PROGMEM = "petrol on road";
-const char Event_S_0416[] PROGMEM = "ice expected (above %s hundred metres)";
-const char Event_S_0417[] PROGMEM = "icy patches (above %s hundred metres)";
-const char Event_S_0418[] PROGMEM = "danger of icy patches (above %s hundred metres)";
-const char Event_S_0419[] PROGMEM = "icy patches expected (above %s hundred metres)";
-const char Event_S_041A[] PROGMEM = "danger of black ice (above %s hundred metres)";
-const char Event_S_041B[] PROGMEM = "black ice expected (above %s hundred metres)";
-const char Event_S_041C[] PROGMEM = "freezing rain expected (above %s hundred metres)";
-const char Event_S_041D[] PROGMEM = "snow drifts expected (above %s hundred metres)";
-const char Event_S_041E[] PROGMEM = "slippery due to loose sand on roadway";
-const char Event_S_041F[] PROGMEM = "mud on road. Danger";
-const char Event_S_0420[] PROGMEM = "loose chippings. Danger";
-const char Event_S_0421[] PROGMEM = "oil on road. Danger";
-const char Event_S_0422[] PROGMEM = "petrol on road. Danger";
-const char Event_S_0423[] PROGMEM = "road surface in poor condition. Danger";
-const char Event_S_0424[] PROGMEM = "icy patches (above %s hundred metres) on bridges";
-const char Event_S_0425[] PROGMEM = "danger of icy patches (above %s hundred metres) on bridges";
-const char Event_S_0426[] PROGMEM = "icy patches (above %s hundred metres) on bridges, in shaded areas and on slip roads";
-const char Event_S_0427[] PROGMEM = "impassable for heavy vehicles (over %s)";
-const char Event_S_0428[] PROGMEM = "impassable (above %s hundred metres) for vehicles with trailers";
-const char Event_S_0429[] PROGMEM = "driving conditions improved";
-const char Event_S_042A[] PROGMEM = "rescue and recovery work in progress. Danger";
-const char Event_S_042B[] PROGMEM = "large animals on roadway";
-const char Event_S_042C[] PROGMEM = "herds of animals on roadway";
-const char Event_S_042D[] PROGMEM = "skid hazard reduced";
-const char Event_S_042E[] PROGMEM = "snow cleared";
-const char Event_S_042F[] PROGMEM = "road conditions forecast withdrawn";
-const char Event_S_0430[] PROGMEM = "message cancelled";
-const char Event_S_0431[] PROGMEM = "extremely hazardous driving conditions expected (above %s hundred meters)";
-const char Event_S_0432[] PROGMEM = "freezing rain expected (above %s hundred metres)";
-const char Event_S_0433[] PROGMEM = "danger of road being blocked by snow (above %s hundred metres)";
-const char Event_S_0437[] PROGMEM = "temperature falling rapidly (to %s)";
-const char Event_S_0438[] PROGMEM = "extreme heat (up to %s)";
-const char Event_S_0439[] PROGMEM = "extreme cold (of %s)";
-const char Event_S_043A[] PROGMEM = "less extreme temperatures";
-const char Event_S_043B[] PROGMEM = "current temperature (%s)";
-const char Event_S_043C[] PROGMEM = "house fire";
-const char Event_S_043D[] PROGMEM = "forest fire";
-const char Event_S_043E[] PROGMEM = "vehicle stuck under bridge";
-const char Event_S_0442[] PROGMEM = "volcano eruption warning";
-const char Event_S_044D[] PROGMEM = "heavy snowfall (%s)";
-const char Event_S_044E[] PROGMEM = "heavy snowfall (%s). Visibility reduced to <30 m";
-const char Event_S_044F[] PROGMEM = "heavy snowfall (%s). Visibility reduced to <50 m";
-const char Event_S_0450[] PROGMEM = "snowfall (%s)";
-const char Event_S_0451[] PROGMEM = "snowfall (%s). Visibility reduced to <100 m";
-const char Event_S_0452[] PROGMEM = "hail (visibility reduced to %s)";
-const char Event_S_0453[] PROGMEM = "sleet (visibility reduced to %s)";
-const char Event_S_0454[] PROGMEM = "thunderstorms (visibility reduced to %s)";
-const char Event_S_0455[] PROGMEM = "heavy rain (%s)";
-const char Event_S_0456[] PROGMEM = "heavy rain (%s). Visibility reduced to <30 m";
-const char Event_S_0457[] PROGMEM = "heavy rain (%s). Visibility reduced to <50 m";
-const char Event_S_0458[] PROGMEM = "rain (%s)";
-const char Event_S_0459[] PROGMEM = "rain (%s). Visibility reduced to <100 m";
-const char Event_S_045A[] PROGMEM = "showers (visibility reduced to %s)";
-const char Event_S_045B[] PROGMEM = "heavy frost";
-const char Event_S_045C[] PROGMEM = "frost";
-const char Event_S_045D[] PROGMEM = "(%s probability of) overcast weather";
-const char Event_S_045E[] PROGMEM = "(%s probability of) mostly cloudy";
-const char Event_S_045F[] PROGMEM = "(%s probability of) partly cloudy";
-const char Event_S_0460[] PROGMEM = "(%s probability of) sunny periods";
-const char Event_S_0461[] PROGMEM = "(%s probability of) clear weather";
-const char Event_S_0462[] PROGMEM = "(%s probability of) sunny weather";
-const char Event_S_0463[] PROGMEM = "(%s probability of) mostly dry weather";
-const char Event_S_0464[] PROGMEM = "(%s probability of) dry weather";
-const char Event_S_0465[] PROGMEM = "sunny periods and with (%s probability of) showers";
-const char Event_S_0466[] PROGMEM = "weather situation improved";
-const char Event_S_0467[] PROGMEM = "message cancelled";
-const char Event_S_0468[] PROGMEM = "winter storm (visibility reduced to %s)";
-const char Event_S_0469[] PROGMEM = "(%s probability of) winter storm";
-const char Event_S_046A[] PROGMEM = "blizzard (visibility reduced to %s)";
-const char Event_S_046B[] PROGMEM = "(%s probability of) blizzard";
-const char Event_S_046C[] PROGMEM = "damaging hail (visibility reduced to %s)";
-const char Event_S_046D[] PROGMEM = "(%s probability of) damaging hail";
-const char Event_S_046E[] PROGMEM = "heavy snowfall. Visibility reduced (to %s)";
-const char Event_S_046F[] PROGMEM = "snowfall. Visibility reduced (to %s)";
-const char Event_S_0470[] PROGMEM = "heavy rain. Visibility reduced (to %s)";
-const char Event_S_0471[] PROGMEM = "rain. Visibility reduced (to %s)";
-const char Event_S_0472[] PROGMEM = "severe weather warnings cancelled";
-const char Event_S_0473[] PROGMEM = "message cancelled";
-const char Event_S_0474[] PROGMEM = "weather forecast withdrawn";
-const char Event_S_0475[] PROGMEM = "fog forecast withdrawn";
-const char Event_S_0477[] PROGMEM = "slippery road expected (above %s hundred metres)";
-const char Event_S_047F[] PROGMEM = "(%s probability of) heavy snowfall";
-const char Event_S_0480[] PROGMEM = "(%s probability of) snowfall";
-const char Event_S_0481[] PROGMEM = "(%s probability of) hail";
-const char Event_S_0482[] PROGMEM = "(%s probability of) sleet";
-const char Event_S_0483[] PROGMEM = "(%s probability of) thunderstorms";
-const char Event_S_0484[] PROGMEM = "(%s probability of) heavy rain";
-const char Event_S_0485[] PROGMEM = "(%s probability of) rain";
-const char Event_S_0486[] PROGMEM = "(%s probability of) showers";
-const char Event_S_0487[] PROGMEM = "(%s probability of) heavy frost";
-const char Event_S_0488[] PROGMEM = "(%s probability of) frost";
-const char Event_S_048D[] PROGMEM = "rain changing to snow";
-const char Event_S_048E[] PROGMEM = "snow changing to rain";
-const char Event_S_0492[] PROGMEM = "heavy snowfall (%s) expected";
-const char Event_S_0493[] PROGMEM = "heavy rain (%s) expected";
-const char Event_S_0494[] PROGMEM = "weather expected to improve";
-const char Event_S_0495[] PROGMEM = "blizzard (with visibility reduced to %s) expected";
-const char Event_S_0496[] PROGMEM = "damaging hail (with visibility reduced to %s) expected";
-const char Event_S_0497[] PROGMEM = "reduced visibility (to %s) expected";
-const char Event_S_0498[] PROGMEM = "freezing fog expected (with visibility reduced to %s). Danger of slippery roads";
-const char Event_S_0499[] PROGMEM = "dense fog (with visibility reduced to %s) expected";
-const char Event_S_049A[] PROGMEM = "patchy fog (with visibility reduced to %s) expected";
-const char Event_S_049B[] PROGMEM = "visibility expected to improve";
-const char Event_S_049C[] PROGMEM = "adverse weather warning withdrawn";
-const char Event_S_04A6[] PROGMEM = "severe smog";
-const char Event_S_04A7[] PROGMEM = "severe exhaust pollution";
-const char Event_S_04B1[] PROGMEM = "tornadoes";
-const char Event_S_04B2[] PROGMEM = "hurricane force winds (%s)";
-const char Event_S_04B3[] PROGMEM = "gales (%s)";
-const char Event_S_04B4[] PROGMEM = "storm force winds (%s)";
-const char Event_S_04B5[] PROGMEM = "strong winds (%s)";
-const char Event_S_04B6[] PROGMEM = "moderate winds (%s)";
-const char Event_S_04B7[] PROGMEM = "light winds (%s)";
-const char Event_S_04B8[] PROGMEM = "calm weather";
-const char Event_S_04B9[] PROGMEM = "gusty winds (%s)";
-const char Event_S_04BA[] PROGMEM = "crosswinds (%s)";
-const char Event_S_04BB[] PROGMEM = "strong winds (%s) affecting high-sided vehicles";
-const char Event_S_04BC[] PROGMEM = "closed for high-sided vehicles due to strong winds (%s)";
-const char Event_S_04BD[] PROGMEM = "strong winds easing";
-const char Event_S_04BE[] PROGMEM = "message cancelled";
-const char Event_S_04BF[] PROGMEM = "restrictions for high-sided vehicles lifted";
-const char Event_S_04C0[] PROGMEM = "tornado watch cancelled";
-const char Event_S_04C1[] PROGMEM = "tornado warning ended";
-const char Event_S_04C2[] PROGMEM = "wind forecast withdrawn";
-const char Event_S_04C3[] PROGMEM = "message cancelled";
-const char Event_S_04E3[] PROGMEM = "(%s probability of) tornadoes";
-const char Event_S_04E4[] PROGMEM = "hurricane force winds (%s)";
-const char Event_S_04E5[] PROGMEM = "gales (%s)";
-const char Event_S_04E6[] PROGMEM = "storm force winds (%s)";
-const char Event_S_04E7[] PROGMEM = "strong winds (%s)";
-const char Event_S_04E8[] PROGMEM = "strong wind forecast withdrawn";
-const char Event_S_0514[] PROGMEM = "snowfall and fog (visibility reduced to %s) expected";
-const char Event_S_0515[] PROGMEM = "dense fog (visibility reduced to %s)";
-const char Event_S_0516[] PROGMEM = "dense fog. Visibility reduced to <30 m";
-const char Event_S_0517[] PROGMEM = "dense fog. Visibility reduced to <50 m";
-const char Event_S_0518[] PROGMEM = "fog (visibility reduced to %s)";
-const char Event_S_0519[] PROGMEM = "fog. Visibility reduced to <100 m";
-const char Event_S_051A[] PROGMEM = "(%s probability of) fog";
-const char Event_S_051B[] PROGMEM = "patchy fog (visibility reduced to %s)";
-const char Event_S_051C[] PROGMEM = "freezing fog (visibility reduced to %s)";
-const char Event_S_051D[] PROGMEM = "smoke hazard (visibility reduced to %s)";
-const char Event_S_051E[] PROGMEM = "blowing dust (visibility reduced to %s)";
-const char Event_S_051F[] PROGMEM = "(%s probability of) severe exhaust pollution";
-const char Event_S_0520[] PROGMEM = "snowfall and fog (visibility reduced to %s)";
-const char Event_S_0521[] PROGMEM = "visibility improved";
-const char Event_S_0522[] PROGMEM = "message cancelled";
-const char Event_S_0523[] PROGMEM = "(%s probability of) dense fog";
-const char Event_S_0524[] PROGMEM = "(%s probability of) patchy fog";
-const char Event_S_0525[] PROGMEM = "(%s probability of) freezing fog";
-const char Event_S_0526[] PROGMEM = "visibility reduced (to %s)";
-const char Event_S_0527[] PROGMEM = "visibility reduced to <30 m";
-const char Event_S_0528[] PROGMEM = "visibility reduced to <50 m";
-const char Event_S_0529[] PROGMEM = "visibility reduced to <100 m";
-const char Event_S_052A[] PROGMEM = "white out (visibility reduced to %s)";
-const char Event_S_052B[] PROGMEM = "blowing snow (visibility reduced to %s)";
-const char Event_S_052C[] PROGMEM = "spray hazard (visibility reduced to %s)";
-const char Event_S_052D[] PROGMEM = "low sun glare";
-const char Event_S_052E[] PROGMEM = "sandstorms (visibility reduced to %s)";
-const char Event_S_052F[] PROGMEM = "(%s probability of) sandstorms";
-const char Event_S_0530[] PROGMEM = "(%s probability of) air quality: good";
-const char Event_S_0531[] PROGMEM = "(%s probability of) air quality: fair";
-const char Event_S_0532[] PROGMEM = "(%s probability of) air quality: poor";
-const char Event_S_0533[] PROGMEM = "(%s probability of) air quality: very poor";
-const char Event_S_0534[] PROGMEM = "smog alert";
-const char Event_S_0535[] PROGMEM = "(%s probability of) smog";
-const char Event_S_0536[] PROGMEM = "(%s probability of) pollen count: high";
-const char Event_S_0537[] PROGMEM = "(%s probability of) pollen count: medium";
-const char Event_S_0538[] PROGMEM = "(%s probability of) pollen count: low";
-const char Event_S_0539[] PROGMEM = "freezing fog (visibility reduced to %s). Slippery roads";
-const char Event_S_053A[] PROGMEM = "no motor vehicles due to smog alert";
-const char Event_S_053B[] PROGMEM = "air quality improved";
-const char Event_S_053C[] PROGMEM = "swarms of insects (visibility reduced to %s)";
-const char Event_S_0541[] PROGMEM = "fog clearing";
-const char Event_S_0542[] PROGMEM = "fog forecast withdrawn";
-const char Event_S_0547[] PROGMEM = "maximum temperature (of %s)";
-const char Event_S_0548[] PROGMEM = "hot, (maximum temperature %s)";
-const char Event_S_0549[] PROGMEM = "warm, (maximum temperature %s)";
-const char Event_S_054A[] PROGMEM = "mild, (maximum temperature %s)";
-const char Event_S_054B[] PROGMEM = "cool, (maximum temperature %s)";
-const char Event_S_054C[] PROGMEM = "cold, (maximum temperature %s)";
-const char Event_S_054D[] PROGMEM = "very cold, (maximum temperature %s)";
-const char Event_S_054E[] PROGMEM = "message cancelled";
-const char Event_S_054F[] PROGMEM = "temperature rising (to %s)";
-const char Event_S_0550[] PROGMEM = "temperature falling rapidly (to %s)";
-const char Event_S_0551[] PROGMEM = "temperature (%s)";
-const char Event_S_0552[] PROGMEM = "effective temperature, with wind chill (%s)";
-const char Event_S_0554[] PROGMEM = "extreme heat (up to %s)";
-const char Event_S_0555[] PROGMEM = "extreme cold (of %s)";
-const char Event_S_0579[] PROGMEM = "minimum temperature (of %s)";
-const char Event_S_057A[] PROGMEM = "very warm (minimum temperature %s)";
-const char Event_S_057B[] PROGMEM = "warm (minimum temperature %s)";
-const char Event_S_057C[] PROGMEM = "mild (minimum temperature %s)";
-const char Event_S_057D[] PROGMEM = "cool (minimum temperature %s)";
-const char Event_S_057E[] PROGMEM = "cold (minimum temperature %s)";
-const char Event_S_057F[] PROGMEM = "very cold (minimum temperature %s)";
-const char Event_S_0580[] PROGMEM = "less extreme temperatures expected";
-const char Event_S_05A9[] PROGMEM = "emergency training in progress";
-const char Event_S_05AA[] PROGMEM = "international sports meeting";
-const char Event_S_05AB[] PROGMEM = "match";
-const char Event_S_05AC[] PROGMEM = "tournament";
-const char Event_S_05AD[] PROGMEM = "athletics meeting";
-const char Event_S_05AE[] PROGMEM = "ball game";
-const char Event_S_05AF[] PROGMEM = "boxing tournament";
-const char Event_S_05B0[] PROGMEM = "bull fight";
-const char Event_S_05B1[] PROGMEM = "cricket match";
-const char Event_S_05B2[] PROGMEM = "cycle race";
-const char Event_S_05B3[] PROGMEM = "football match";
-const char Event_S_05B4[] PROGMEM = "golf tournament";
-const char Event_S_05B5[] PROGMEM = "marathon";
-const char Event_S_05B6[] PROGMEM = "race meeting";
-const char Event_S_05B7[] PROGMEM = "rugby match";
-const char Event_S_05B8[] PROGMEM = "show jumping";
-const char Event_S_05B9[] PROGMEM = "tennis tournament";
-const char Event_S_05BA[] PROGMEM = "water sports meeting";
-const char Event_S_05BB[] PROGMEM = "winter sports meeting";
-const char Event_S_05BC[] PROGMEM = "funfair";
-const char Event_S_05BD[] PROGMEM = "trade fair";
-const char Event_S_05BE[] PROGMEM = "procession";
-const char Event_S_05BF[] PROGMEM = "sightseers obstructing access";
-const char Event_S_05C0[] PROGMEM = "people on roadway";
-const char Event_S_05C1[] PROGMEM = "children on roadway";
-const char Event_S_05C2[] PROGMEM = "cyclists on roadway";
-const char Event_S_05C3[] PROGMEM = "strike";
-const char Event_S_05C4[] PROGMEM = "security incident";
-const char Event_S_05C5[] PROGMEM = "police checkpoint";
-const char Event_S_05C6[] PROGMEM = "terrorist incident";
-const char Event_S_05C7[] PROGMEM = "gunfire on roadway, danger";
-const char Event_S_05C8[] PROGMEM = "civil emergency";
-const char Event_S_05C9[] PROGMEM = "air raid, danger";
-const char Event_S_05CA[] PROGMEM = "people on roadway. Danger";
-const char Event_S_05CB[] PROGMEM = "children on roadway. Danger";
-const char Event_S_05CC[] PROGMEM = "cyclists on roadway. Danger";
-const char Event_S_05CD[] PROGMEM = "closed due to security incident";
-const char Event_S_05CE[] PROGMEM = "security incident. Delays (%s)";
-const char Event_S_05CF[] PROGMEM = "security incident. Delays (%s) expected";
-const char Event_S_05D0[] PROGMEM = "security incident. Long delays (%s)";
-const char Event_S_05D1[] PROGMEM = "police checkpoint. Delays (%s)";
-const char Event_S_05D2[] PROGMEM = "police checkpoint. Delays (%s) expected";
-const char Event_S_05D3[] PROGMEM = "police checkpoint. Long delays (%s)";
-const char Event_S_05D4[] PROGMEM = "security alert withdrawn";
-const char Event_S_05D5[] PROGMEM = "sports traffic cleared";
-const char Event_S_05D6[] PROGMEM = "evacuation";
-const char Event_S_05D7[] PROGMEM = "evacuation. Heavy traffic";
-const char Event_S_05D8[] PROGMEM = "traffic disruption cleared";
-const char Event_S_05D9[] PROGMEM = "military training in progress";
-const char Event_S_05DA[] PROGMEM = "police activity ongoing";
-const char Event_S_05DB[] PROGMEM = "medical emergency ongoing";
-const char Event_S_05DC[] PROGMEM = "child abduction in progress";
-const char Event_S_05DD[] PROGMEM = "major event";
-const char Event_S_05DE[] PROGMEM = "sports event meeting";
-const char Event_S_05DF[] PROGMEM = "show";
-const char Event_S_05E0[] PROGMEM = "festival";
-const char Event_S_05E1[] PROGMEM = "exhibition";
-const char Event_S_05E2[] PROGMEM = "fair";
-const char Event_S_05E3[] PROGMEM = "market";
-const char Event_S_05E4[] PROGMEM = "ceremonial event";
-const char Event_S_05E5[] PROGMEM = "state occasion";
-const char Event_S_05E6[] PROGMEM = "parade";
-const char Event_S_05E7[] PROGMEM = "crowd";
-const char Event_S_05E8[] PROGMEM = "march";
-const char Event_S_05E9[] PROGMEM = "demonstration";
-const char Event_S_05EA[] PROGMEM = "public disturbance";
-const char Event_S_05EB[] PROGMEM = "security alert";
-const char Event_S_05EC[] PROGMEM = "bomb alert";
-const char Event_S_05ED[] PROGMEM = "major event. Stationary traffic";
-const char Event_S_05EE[] PROGMEM = "major event. Danger of stationary traffic";
-const char Event_S_05EF[] PROGMEM = "major event. Queuing traffic";
-const char Event_S_05F0[] PROGMEM = "major event. Danger of queuing traffic";
-const char Event_S_05F1[] PROGMEM = "major event. Slow traffic";
-const char Event_S_05F2[] PROGMEM = "major event. Slow traffic expected";
-const char Event_S_05F3[] PROGMEM = "major event. Heavy traffic";
-const char Event_S_05F4[] PROGMEM = "major event. Heavy traffic expected";
-const char Event_S_05F5[] PROGMEM = "major event. Traffic flowing freely";
-const char Event_S_05F6[] PROGMEM = "major event. Traffic building up";
-const char Event_S_05F7[] PROGMEM = "closed due to major event";
-const char Event_S_05F8[] PROGMEM = "major event. Delays (%s)";
-const char Event_S_05F9[] PROGMEM = "major event. Delays (%s) expected";
-const char Event_S_05FA[] PROGMEM = "major event. Long delays (%s)";
-const char Event_S_05FB[] PROGMEM = "sports meeting. Stationary traffic";
-const char Event_S_05FC[] PROGMEM = "sports meeting. Danger of stationary traffic";
-const char Event_S_05FD[] PROGMEM = "sports meeting. Queuing traffic";
-const char Event_S_05FE[] PROGMEM = "sports meeting. Danger of queuing traffic";
-const char Event_S_05FF[] PROGMEM = "sports meeting. Slow traffic";
-const char Event_S_0600[] PROGMEM = "sports meeting. Slow traffic expected";
-const char Event_S_0601[] PROGMEM = "sports meeting. Heavy traffic";
-const char Event_S_0602[] PROGMEM = "sports meeting. Heavy traffic expected";
-const char Event_S_0603[] PROGMEM = "sports meeting. Traffic flowing freely";
-const char Event_S_0604[] PROGMEM = "sports meeting. Traffic building up";
-const char Event_S_0605[] PROGMEM = "closed due to sports meeting";
-const char Event_S_0606[] PROGMEM = "sports meeting. Delays (%s)";
-const char Event_S_0607[] PROGMEM = "sports meeting. Delays (%s) expected";
-const char Event_S_0608[] PROGMEM = "sports meeting. Long delays (%s)";
-const char Event_S_0609[] PROGMEM = "fair. Stationary traffic";
-const char Event_S_060A[] PROGMEM = "fair. Danger of stationary traffic";
-const char Event_S_060B[] PROGMEM = "fair. Queuing traffic";
-const char Event_S_060C[] PROGMEM = "fair. Danger of queuing traffic";
-const char Event_S_060D[] PROGMEM = "fair. Slow traffic";
-const char Event_S_060E[] PROGMEM = "fair. Slow traffic expected";
-const char Event_S_060F[] PROGMEM = "fair. Heavy traffic";
-const char Event_S_0610[] PROGMEM = "fair. Heavy traffic expected";
-const char Event_S_0611[] PROGMEM = "fair. Traffic flowing freely";
-const char Event_S_0612[] PROGMEM = "fair. Traffic building up";
-const char Event_S_0613[] PROGMEM = "closed due to fair";
-const char Event_S_0614[] PROGMEM = "fair. Delays (%s)";
-const char Event_S_0615[] PROGMEM = "fair. Delays (%s) expected";
-const char Event_S_0616[] PROGMEM = "fair. Long delays (%s)";
-const char Event_S_0617[] PROGMEM = "closed due to parade";
-const char Event_S_0618[] PROGMEM = "parade. Delays (%s)";
-const char Event_S_0619[] PROGMEM = "parade. Delays (%s) expected";
-const char Event_S_061A[] PROGMEM = "parade. Long delays (%s)";
-const char Event_S_061B[] PROGMEM = "closed due to strike";
-const char Event_S_061C[] PROGMEM = "strike. Delays (%s)";
-const char Event_S_061D[] PROGMEM = "strike. Delays (%s) expected";
-const char Event_S_061E[] PROGMEM = "strike. Long delays (%s)";
-const char Event_S_061F[] PROGMEM = "closed due to demonstration";
-const char Event_S_0620[] PROGMEM = "demonstration. Delays (%s)";
-const char Event_S_0621[] PROGMEM = "demonstration. Delays (%s) expected";
-const char Event_S_0622[] PROGMEM = "demonstration. Long delays (%s)";
-const char Event_S_0623[] PROGMEM = "security alert. Stationary traffic";
-const char Event_S_0624[] PROGMEM = "security alert. Danger of stationary traffic";
-const char Event_S_0625[] PROGMEM = "security alert. Queuing traffic";
-const char Event_S_0626[] PROGMEM = "security alert. Danger of queuing traffic";
-const char Event_S_0627[] PROGMEM = "security alert. Slow traffic";
-const char Event_S_0628[] PROGMEM = "security alert. Slow traffic expected";
-const char Event_S_0629[] PROGMEM = "security alert. Heavy traffic";
-const char Event_S_062A[] PROGMEM = "security alert. Heavy traffic expected";
-const char Event_S_062B[] PROGMEM = "security alert. Traffic building up";
-const char Event_S_062C[] PROGMEM = "closed due to security alert";
-const char Event_S_062D[] PROGMEM = "security alert. Delays (%s)";
-const char Event_S_062E[] PROGMEM = "security alert. Delays (%s) expected";
-const char Event_S_062F[] PROGMEM = "security alert. Long delays (%s)";
-const char Event_S_0630[] PROGMEM = "traffic has returned to normal";
-const char Event_S_0631[] PROGMEM = "message cancelled";
-const char Event_S_0632[] PROGMEM = "security alert. Traffic flowing freely";
-const char Event_S_0633[] PROGMEM = "air raid warning cancelled";
-const char Event_S_0634[] PROGMEM = "civil emergency cancelled";
-const char Event_S_0635[] PROGMEM = "message cancelled";
-const char Event_S_0636[] PROGMEM = "several major events";
-const char Event_S_0637[] PROGMEM = "information about major event no longer valid";
-const char Event_S_0638[] PROGMEM = "automobile race";
-const char Event_S_0639[] PROGMEM = "baseball game";
-const char Event_S_063A[] PROGMEM = "basketball game";
-const char Event_S_063B[] PROGMEM = "boat race";
-const char Event_S_063C[] PROGMEM = "concert";
-const char Event_S_063D[] PROGMEM = "hockey game";
-const char Event_S_0641[] PROGMEM = "delays (%s)";
-const char Event_S_0642[] PROGMEM = "delays up to 15 minutes";
-const char Event_S_0643[] PROGMEM = "delays up to 30 minutes";
-const char Event_S_0644[] PROGMEM = "delays up to one hour";
-const char Event_S_0645[] PROGMEM = "delays up to two hours";
-const char Event_S_0646[] PROGMEM = "delays of several hours";
-const char Event_S_0647[] PROGMEM = "delays (%s) expected";
-const char Event_S_0648[] PROGMEM = "long delays (%s)";
-const char Event_S_0649[] PROGMEM = "delays (%s) for heavy vehicles";
-const char Event_S_064A[] PROGMEM = "delays up to 15 minutes for heavy lorr(y/ies)";
-const char Event_S_064B[] PROGMEM = "delays up to 30 minutes for heavy lorr(y/ies)";
-const char Event_S_064C[] PROGMEM = "delays up to one hour for heavy lorr(y/ies)";
-const char Event_S_064D[] PROGMEM = "delays up to two hours for heavy lorr(y/ies)";
-const char Event_S_064E[] PROGMEM = "delays of several hours for heavy lorr(y/ies)";
-const char Event_S_064F[] PROGMEM = "service suspended (until %s)";
-const char Event_S_0650[] PROGMEM = "(%s) service withdrawn";
-const char Event_S_0651[] PROGMEM = "(%s) service(s) fully booked";
-const char Event_S_0652[] PROGMEM = "(%s) service(s) fully booked for heavy vehicles";
-const char Event_S_0653[] PROGMEM = "normal services resumed";
-const char Event_S_0654[] PROGMEM = "message cancelled";
-const char Event_S_0655[] PROGMEM = "delays up to 5 minutes";
-const char Event_S_0656[] PROGMEM = "delays up to 10 minutes";
-const char Event_S_0657[] PROGMEM = "delays up to 20 minutes";
-const char Event_S_0658[] PROGMEM = "delays up to 25 minutes";
-const char Event_S_0659[] PROGMEM = "delays up to 40 minutes";
-const char Event_S_065A[] PROGMEM = "delays up to 50 minutes";
-const char Event_S_065B[] PROGMEM = "delays up to 90 minutes";
-const char Event_S_065C[] PROGMEM = "delays up to three hours";
-const char Event_S_065D[] PROGMEM = "delays up to four hours";
-const char Event_S_065E[] PROGMEM = "delays up to five hours";
-const char Event_S_065F[] PROGMEM = "very long delays (%s)";
-const char Event_S_0660[] PROGMEM = "delays of uncertain duration";
-const char Event_S_0661[] PROGMEM = "delayed until further notice";
-const char Event_S_0662[] PROGMEM = "cancellations";
-const char Event_S_0663[] PROGMEM = "park and ride service not operating (until %s)";
-const char Event_S_0664[] PROGMEM = "special public transport services operating (until %s)";
-const char Event_S_0665[] PROGMEM = "normal services not operating (until %s)";
-const char Event_S_0666[] PROGMEM = "rail services not operating (until %s)";
-const char Event_S_0667[] PROGMEM = "bus services not operating (until %s)";
-const char Event_S_0668[] PROGMEM = "shuttle service operating (until %s)";
-const char Event_S_0669[] PROGMEM = "free shuttle service operating (until %s)";
-const char Event_S_066A[] PROGMEM = "delays (%s) for heavy lorr(y/ies)";
-const char Event_S_066B[] PROGMEM = "delays (%s) for buses";
-const char Event_S_066C[] PROGMEM = "(%s) service(s) fully booked for heavy lorr(y/ies)";
-const char Event_S_066D[] PROGMEM = "(%s) service(s) fully booked for buses";
-const char Event_S_066E[] PROGMEM = "next departure (%s) for heavy lorr(y/ies)";
-const char Event_S_066F[] PROGMEM = "next departure (%s) for buses";
-const char Event_S_0670[] PROGMEM = "delays cleared";
-const char Event_S_0671[] PROGMEM = "rapid transit service not operating (until %s)";
-const char Event_S_0672[] PROGMEM = "delays (%s) possible";
-const char Event_S_0673[] PROGMEM = "underground service not operating (until %s)";
-const char Event_S_0674[] PROGMEM = "cancellations expected";
-const char Event_S_0675[] PROGMEM = "long delays expected";
-const char Event_S_0676[] PROGMEM = "very long delays expected";
-const char Event_S_0677[] PROGMEM = "all services fully booked (until %s)";
-const char Event_S_0678[] PROGMEM = "next arrival (%s)";
-const char Event_S_0679[] PROGMEM = "rail services irregular. Delays (%s)";
-const char Event_S_067A[] PROGMEM = "bus services irregular. Delays (%s)";
-const char Event_S_067B[] PROGMEM = "underground services irregular";
-const char Event_S_067C[] PROGMEM = "normal public transport services resumed";
-const char Event_S_067D[] PROGMEM = "ferry service not operating (until %s)";
-const char Event_S_067E[] PROGMEM = "park and ride trip time (%s)";
-const char Event_S_067F[] PROGMEM = "delay expected to be cleared";
-const char Event_S_0680[] PROGMEM = "demonstration by vehicles";
-const char Event_S_0690[] PROGMEM = "delays (%s) have to be expected";
-const char Event_S_0691[] PROGMEM = "delays of several hours have to be expected";
-const char Event_S_0692[] PROGMEM = "closed ahead. Delays (%s) have to be expected";
-const char Event_S_0693[] PROGMEM = "roadworks. Delays (%s) have to be expected";
-const char Event_S_0694[] PROGMEM = "flooding. Delays (%s) have to be expected";
-const char Event_S_0695[] PROGMEM = "major event. Delays (%s) have to be expected";
-const char Event_S_0696[] PROGMEM = "strike. Delays (%s) have to be expected";
-const char Event_S_0697[] PROGMEM = "delays of several hours for heavy lorries have to be expected";
-const char Event_S_0698[] PROGMEM = "long delays have to be expected";
-const char Event_S_0699[] PROGMEM = "very long delays have to be expected";
-const char Event_S_069A[] PROGMEM = "delay forecast withdrawn";
-const char Event_S_069B[] PROGMEM = "message cancelled";
-const char Event_S_069F[] PROGMEM = "current trip time (%s)";
-const char Event_S_06A0[] PROGMEM = "expected trip time (%s)";
-const char Event_S_06A4[] PROGMEM = "(%s) slow moving maintenance vehicle(s)";
-const char Event_S_06A5[] PROGMEM = "(%s) vehicle(s) on wrong carriageway";
-const char Event_S_06A6[] PROGMEM = "dangerous vehicle warning cleared";
-const char Event_S_06A7[] PROGMEM = "message cancelled";
-const char Event_S_06A8[] PROGMEM = "(%s) reckless driver(s)";
-const char Event_S_06A9[] PROGMEM = "(%s) prohibited vehicle(s) on the roadway";
-const char Event_S_06AA[] PROGMEM = "(%s) emergency vehicles";
-const char Event_S_06AB[] PROGMEM = "(%s) high-speed emergency vehicles";
-const char Event_S_06AC[] PROGMEM = "high-speed chase (involving %s vehicles)";
-const char Event_S_06AD[] PROGMEM = "spillage occurring from moving vehicle";
-const char Event_S_06AE[] PROGMEM = "objects falling from moving vehicle";
-const char Event_S_06AF[] PROGMEM = "emergency vehicle warning cleared";
-const char Event_S_06B0[] PROGMEM = "road cleared";
-const char Event_S_06B8[] PROGMEM = "rail services irregular";
-const char Event_S_06B9[] PROGMEM = "public transport services not operating";
-const char Event_S_06C3[] PROGMEM = "(%s) abnormal load(s), danger";
-const char Event_S_06C4[] PROGMEM = "(%s) wide load(s), danger";
-const char Event_S_06C5[] PROGMEM = "(%s) long load(s), danger";
-const char Event_S_06C6[] PROGMEM = "(%s) slow vehicle(s), danger";
-const char Event_S_06C7[] PROGMEM = "(%s) track-laying vehicle(s), danger";
-const char Event_S_06C8[] PROGMEM = "(%s) vehicle(s) carrying hazardous materials. Danger";
-const char Event_S_06C9[] PROGMEM = "(%s) convoy(s), danger";
-const char Event_S_06CA[] PROGMEM = "(%s) military convoy(s), danger";
-const char Event_S_06CB[] PROGMEM = "(%s) overheight load(s), danger";
-const char Event_S_06CC[] PROGMEM = "abnormal load causing slow traffic. Delays (%s)";
-const char Event_S_06CD[] PROGMEM = "convoy causing slow traffic. Delays (%s)";
-const char Event_S_06D7[] PROGMEM = "(%s) abnormal load(s)";
-const char Event_S_06D8[] PROGMEM = "(%s) wide load(s)";
-const char Event_S_06D9[] PROGMEM = "(%s) long load(s)";
-const char Event_S_06DA[] PROGMEM = "(%s) slow vehicle(s)";
-const char Event_S_06DB[] PROGMEM = "(%s) convoy(s)";
-const char Event_S_06DC[] PROGMEM = "abnormal load. Delays (%s)";
-const char Event_S_06DD[] PROGMEM = "abnormal load. Delays (%s) expected";
-const char Event_S_06DE[] PROGMEM = "abnormal load. Long delays (%s)";
-const char Event_S_06DF[] PROGMEM = "convoy causing delays (%s)";
-const char Event_S_06E0[] PROGMEM = "convoy. Delays (%s) expected";
-const char Event_S_06E1[] PROGMEM = "convoy causing long delays (%s)";
-const char Event_S_06E2[] PROGMEM = "exceptional load warning cleared";
-const char Event_S_06E3[] PROGMEM = "message cancelled";
-const char Event_S_06E4[] PROGMEM = "(%s) track-laying vehicle(s)";
-const char Event_S_06E5[] PROGMEM = "(%s) vehicle(s) carrying hazardous materials";
-const char Event_S_06E6[] PROGMEM = "(%s) military convoy(s)";
-const char Event_S_06E7[] PROGMEM = "(%s) abnormal load(s). No overtaking";
-const char Event_S_06E8[] PROGMEM = "Vehicles carrying hazardous materials have to stop at next safe place!";
-const char Event_S_06E9[] PROGMEM = "hazardous load warning cleared";
-const char Event_S_06EA[] PROGMEM = "convoy cleared";
-const char Event_S_06EB[] PROGMEM = "warning cleared";
-const char Event_S_06F4[] PROGMEM = "cancellations have to be expected";
-const char Event_S_06F5[] PROGMEM = "all services fully booked (until %s)";
-const char Event_S_06F6[] PROGMEM = "park and ride service will not be operating (until %s)";
-const char Event_S_06F7[] PROGMEM = "normal services will not be operating (until %s)";
-const char Event_S_06F8[] PROGMEM = "rail services will not be operating (until %s)";
-const char Event_S_06F9[] PROGMEM = "rapid transit service will not be operating (until %s)";
-const char Event_S_06FA[] PROGMEM = "underground service will not be operating (until %s)";
-const char Event_S_06FB[] PROGMEM = "public transport will be on strike";
-const char Event_S_06FC[] PROGMEM = "ferry service will not be operating (until %s)";
-const char Event_S_06FD[] PROGMEM = "normal services expected";
-const char Event_S_06FE[] PROGMEM = "message cancelled";
-const char Event_S_0709[] PROGMEM = "lane control signs not working";
-const char Event_S_070A[] PROGMEM = "emergency telephones not working";
-const char Event_S_070B[] PROGMEM = "emergency telephone number not working";
-const char Event_S_070C[] PROGMEM = "(%s sets of) traffic lights not working";
-const char Event_S_070D[] PROGMEM = "(%s sets of) traffic lights working incorrectly";
-const char Event_S_070E[] PROGMEM = "level crossing failure";
-const char Event_S_070F[] PROGMEM = "(%s sets of) traffic lights not working. Stationary traffic";
-const char Event_S_0710[] PROGMEM = "(%s sets of) traffic lights not working. Danger of stationary traffic";
-const char Event_S_0711[] PROGMEM = "(%s sets of) traffic lights not working. Queuing traffic";
-const char Event_S_0712[] PROGMEM = "(%s sets of) traffic lights not working. Danger of queuing traffic";
-const char Event_S_0713[] PROGMEM = "(%s sets of) traffic lights not working. Slow traffic";
-const char Event_S_0714[] PROGMEM = "(%s sets of) traffic lights not working. Slow traffic expected";
-const char Event_S_0715[] PROGMEM = "(%s sets of) traffic lights not working. Heavy traffic";
-const char Event_S_0716[] PROGMEM = "(%s sets of) traffic lights not working. Heavy traffic expected";
-const char Event_S_0717[] PROGMEM = "(%s sets of) traffic lights not working. Traffic flowing freely";
-const char Event_S_0718[] PROGMEM = "(%s sets of) traffic lights not working. Traffic building up";
-const char Event_S_0719[] PROGMEM = "traffic lights not working. Delays (%s)";
-const char Event_S_071A[] PROGMEM = "traffic lights not working. Delays (%s) expected";
-const char Event_S_071B[] PROGMEM = "traffic lights not working. Long delays (%s)";
-const char Event_S_071C[] PROGMEM = "level crossing failure. Stationary traffic";
-const char Event_S_071D[] PROGMEM = "level crossing failure. Danger of stationary traffic";
-const char Event_S_071E[] PROGMEM = "level crossing failure. Queuing traffic";
-const char Event_S_071F[] PROGMEM = "level crossing failure. Danger of queuing traffic";
-const char Event_S_0720[] PROGMEM = "level crossing failure. Slow traffic";
-const char Event_S_0721[] PROGMEM = "level crossing failure. Slow traffic expected";
-const char Event_S_0722[] PROGMEM = "level crossing failure. Heavy traffic";
-const char Event_S_0723[] PROGMEM = "level crossing failure. Heavy traffic expected";
-const char Event_S_0724[] PROGMEM = "level crossing failure. Traffic flowing freely";
-const char Event_S_0725[] PROGMEM = "level crossing failure. Traffic building up";
-const char Event_S_0726[] PROGMEM = "level crossing failure. Delays (%s)";
-const char Event_S_0727[] PROGMEM = "level crossing failure. Delays (%s) expected";
-const char Event_S_0728[] PROGMEM = "level crossing failure. Long delays (%s)";
-const char Event_S_0729[] PROGMEM = "electronic signs repaired";
-const char Event_S_072A[] PROGMEM = "emergency call facilities restored";
-const char Event_S_072B[] PROGMEM = "traffic signals repaired";
-const char Event_S_072C[] PROGMEM = "level crossing now working normally";
-const char Event_S_072D[] PROGMEM = "message cancelled";
-const char Event_S_072E[] PROGMEM = "lane control signs working incorrectly";
-const char Event_S_072F[] PROGMEM = "lane control signs operating";
-const char Event_S_0730[] PROGMEM = "variable message signs not working";
-const char Event_S_0731[] PROGMEM = "variable message signs working incorrectly";
-const char Event_S_0732[] PROGMEM = "variable message signs operating";
-const char Event_S_0733[] PROGMEM = "(%s sets of) ramp control signals not working";
-const char Event_S_0734[] PROGMEM = "(%s sets of) ramp control signals working incorrectly";
-const char Event_S_0735[] PROGMEM = "(%s sets of) temporary traffic lights not working";
-const char Event_S_0736[] PROGMEM = "(%s sets of) temporary traffic lights working incorrectly";
-const char Event_S_0737[] PROGMEM = "traffic signal control computer not working";
-const char Event_S_0738[] PROGMEM = "traffic signal timings changed";
-const char Event_S_0739[] PROGMEM = "tunnel ventilation not working";
-const char Event_S_073A[] PROGMEM = "lane control signs not working. Danger";
-const char Event_S_073B[] PROGMEM = "temporary width limit (%s)";
-const char Event_S_073C[] PROGMEM = "temporary width limit lifted";
-const char Event_S_073E[] PROGMEM = "traffic regulations have been changed";
-const char Event_S_073F[] PROGMEM = "less than 50 parking spaces available";
-const char Event_S_0740[] PROGMEM = "no parking information available (until %s)";
-const char Event_S_0741[] PROGMEM = "message cancelled";
-const char Event_S_0742[] PROGMEM = "Snowplough. Delays (%s)";
-const char Event_S_0745[] PROGMEM = "temporary height limit (%s)";
-const char Event_S_0746[] PROGMEM = "temporary height limit lifted";
-const char Event_S_0747[] PROGMEM = "(%s) automatic payment lanes not working";
-const char Event_S_0748[] PROGMEM = "lane control signs working incorrectly. Danger";
-const char Event_S_0749[] PROGMEM = "emergency telephones out of order. Extra police patrols in operation";
-const char Event_S_074A[] PROGMEM = "emergency telephones out of order. In emergency, wait for police patrol";
-const char Event_S_074B[] PROGMEM = "(%s sets of) traffic lights not working. Danger";
-const char Event_S_074C[] PROGMEM = "traffic lights working incorrectly. Delays (%s)";
-const char Event_S_074D[] PROGMEM = "traffic lights working incorrectly. Delays (%s) expected";
-const char Event_S_074E[] PROGMEM = "traffic lights working incorrectly. Long delays (%s)";
-const char Event_S_074F[] PROGMEM = "temporary axle load limit (%s)";
-const char Event_S_0750[] PROGMEM = "temporary gross weight limit (%s)";
-const char Event_S_0751[] PROGMEM = "temporary gross weight limit lifted";
-const char Event_S_0752[] PROGMEM = "temporary axle weight limit lifted";
-const char Event_S_0753[] PROGMEM = "(%s sets of) traffic lights working incorrectly. Danger";
-const char Event_S_0754[] PROGMEM = "temporary traffic lights not working. Delays (%s)";
-const char Event_S_0755[] PROGMEM = "temporary traffic lights not working. Delays (%s) expected";
-const char Event_S_0756[] PROGMEM = "temporary traffic lights not working. Long delays (%s)";
-const char Event_S_0757[] PROGMEM = "(%s sets of) temporary traffic lights not working. Danger";
-const char Event_S_0758[] PROGMEM = "traffic signal control computer not working. Delays (%s)";
-const char Event_S_0759[] PROGMEM = "temporary length limit (%s)";
-const char Event_S_075A[] PROGMEM = "temporary length limit lifted";
-const char Event_S_075B[] PROGMEM = "message cancelled";
-const char Event_S_075C[] PROGMEM = "traffic signal control computer not working. Delays (%s) expected";
-const char Event_S_075D[] PROGMEM = "traffic signal control computer not working. Long delays (%s)";
-const char Event_S_075E[] PROGMEM = "normal parking restrictions lifted";
-const char Event_S_075F[] PROGMEM = "special parking restrictions in force";
-const char Event_S_0760[] PROGMEM = "10% full";
-const char Event_S_0761[] PROGMEM = "20% full";
-const char Event_S_0762[] PROGMEM = "30% full";
-const char Event_S_0763[] PROGMEM = "40% full";
-const char Event_S_0764[] PROGMEM = "50% full";
-const char Event_S_0765[] PROGMEM = "60% full";
-const char Event_S_0766[] PROGMEM = "70% full";
-const char Event_S_0767[] PROGMEM = "80% full";
-const char Event_S_0768[] PROGMEM = "90% full";
-const char Event_S_0769[] PROGMEM = "less than 10 parking spaces available";
-const char Event_S_076A[] PROGMEM = "less than 20 parking spaces available";
-const char Event_S_076B[] PROGMEM = "less than 30 parking spaces available";
-const char Event_S_076C[] PROGMEM = "less than 40 parking spaces available";
-const char Event_S_076D[] PROGMEM = "next departure (%s)";
-const char Event_S_076E[] PROGMEM = "next departure (%s) for heavy vehicles";
-const char Event_S_076F[] PROGMEM = "car park (%s) full";
-const char Event_S_0770[] PROGMEM = "all car parks (%s) full";
-const char Event_S_0771[] PROGMEM = "less than (%s) car parking spaces available";
-const char Event_S_0772[] PROGMEM = "park and ride service operating (until %s)";
-const char Event_S_0773[] PROGMEM = "(null event)";
-const char Event_S_0774[] PROGMEM = "switch your car radio (to %s)";
-const char Event_S_0775[] PROGMEM = "alarm call: important new information on this frequency follows now in normal programme";
-const char Event_S_0776[] PROGMEM = "alarm set: new information will be broadcast between these times in normal programme";
-const char Event_S_0777[] PROGMEM = "message cancelled";
-const char Event_S_0779[] PROGMEM = "switch your car radio (to %s)";
-const char Event_S_077A[] PROGMEM = "no information available (until %s)";
-const char Event_S_077B[] PROGMEM = "this message is for test purposes only (number %s), please ignore";
-const char Event_S_077C[] PROGMEM = "no information available (until %s) due to technical problems";
-const char Event_S_077D[] PROGMEM = "automatic toll system not working, pay manually";
-const char Event_S_077E[] PROGMEM = "full";
-const char Event_S_0780[] PROGMEM = "only a few parking spaces available";
-const char Event_S_0781[] PROGMEM = "(%s) parking spaces available";
-const char Event_S_0782[] PROGMEM = "expect car park to be full";
-const char Event_S_0783[] PROGMEM = "expect no parking spaces available";
-const char Event_S_0784[] PROGMEM = "multi story car parks full";
-const char Event_S_0785[] PROGMEM = "no problems to report with park and ride services";
-const char Event_S_0786[] PROGMEM = "no parking spaces available";
-const char Event_S_0787[] PROGMEM = "no parking (until %s)";
-const char Event_S_0788[] PROGMEM = "special parking restrictions lifted";
-const char Event_S_0789[] PROGMEM = "urgent information will be given (at %s) on normal programme broadcasts";
-const char Event_S_078A[] PROGMEM = "this TMC-service is not active (until %s)";
-const char Event_S_078B[] PROGMEM = "detailed information will be given (at %s) on normal programme broadcasts";
-const char Event_S_078C[] PROGMEM = "detailed information is provided by another TMC service";
-const char Event_S_078E[] PROGMEM = "no park and ride information available (until %s)";
-const char Event_S_0792[] PROGMEM = "park and ride information service resumed";
-const char Event_S_0793[] PROGMEM = "travel information telephone service availiable";
-const char Event_S_0794[] PROGMEM = "additional regional information is provided by another TMC service";
-const char Event_S_0795[] PROGMEM = "additional local information is provided by another TMC service";
-const char Event_S_0796[] PROGMEM = "additional public transport information is provided by another TMC service";
-const char Event_S_0797[] PROGMEM = "national traffic information is provided by another TMC service";
-const char Event_S_0798[] PROGMEM = "this service provides major road information";
-const char Event_S_0799[] PROGMEM = "this service provides regional travel information";
-const char Event_S_079A[] PROGMEM = "this service provides local travel information";
-const char Event_S_079B[] PROGMEM = "no detailed regional information provided by this service";
-const char Event_S_079C[] PROGMEM = "no detailed local information provided by this service";
-const char Event_S_079D[] PROGMEM = "no cross-border information provided by this service";
-const char Event_S_079E[] PROGMEM = "information restricted to this area";
-const char Event_S_079F[] PROGMEM = "no new traffic information available (until %s)";
-const char Event_S_07A0[] PROGMEM = "no public transport information available";
-const char Event_S_07A1[] PROGMEM = "this TMC-service is being suspended (at %s)";
-const char Event_S_07A2[] PROGMEM = "active TMC-service will resume (at %s)";
-const char Event_S_07A3[] PROGMEM = "reference to audio programmes no longer valid";
-const char Event_S_07A4[] PROGMEM = "reference to other TMC services no longer valid";
-const char Event_S_07A5[] PROGMEM = "previous announcement about this or other TMC services no longer valid";
-const char Event_S_07A9[] PROGMEM = "allow emergency vehicles to pass in the carpool lane";
-const char Event_S_07AA[] PROGMEM = "carpool lane available for all vehicles";
-const char Event_S_07AB[] PROGMEM = "police directing traffic via the carpool lane";
-const char Event_S_07AC[] PROGMEM = "rail information service not available";
-const char Event_S_07AD[] PROGMEM = "rail information service resumed";
-const char Event_S_07AE[] PROGMEM = "rapid transit information service not available";
-const char Event_S_07AF[] PROGMEM = "rapid transit information service resumed";
-const char Event_S_07B3[] PROGMEM = "police directing traffic";
-const char Event_S_07B4[] PROGMEM = "buslane available for all vehicles";
-const char Event_S_07B5[] PROGMEM = "police directing traffic via the buslane";
-const char Event_S_07B6[] PROGMEM = "allow emergency vehicles to pass";
-const char Event_S_07B7[] PROGMEM = "overtaking prohibited for heavy vehicles (over %s)";
-const char Event_S_07B8[] PROGMEM = "overtaking prohibited";
-const char Event_S_07B9[] PROGMEM = "allow emergency vehicles to pass in the heavy vehicle lane";
-const char Event_S_07BA[] PROGMEM = "heavy vehicle lane available for all vehicles";
-const char Event_S_07BB[] PROGMEM = "police directing traffic via the heavy vehicle lane";
-const char Event_S_07BC[] PROGMEM = "overtaking prohibited for heavy lorries (over %s)";
-const char Event_S_07BD[] PROGMEM = "drivers of heavy lorries (over %s) are recommended to stop at next safe place";
-const char Event_S_07BE[] PROGMEM = "buslane closed";
-const char Event_S_07BF[] PROGMEM = "power failure";
-const char Event_S_07C1[] PROGMEM = "overtaking restriction lifted";
-const char Event_S_07C2[] PROGMEM = "Low Emission Zone restriction in force";
-const char Event_S_07C6[] PROGMEM = "car park closed (until %s)";
-const char Event_S_07C7[] PROGMEM = "danger of waiting vehicles on roadway";
-const char Event_S_07C9[] PROGMEM = "number of parking spaces decreasing";
-const char Event_S_07CA[] PROGMEM = "number of parking spaces constant";
-const char Event_S_07CB[] PROGMEM = "number of parking spaces increasing";
-const char Event_S_07CE[] PROGMEM = "dangerous situation on exit slip road";
-const char Event_S_07CF[] PROGMEM = "dangerous situation on entry slip road";
-const char Event_S_07D0[] PROGMEM = "closed due to smog alert (until %s)";
-const char Event_S_07D6[] PROGMEM = "closed for vehicles with less than three occupants";
-const char Event_S_07D7[] PROGMEM = "closed for vehicles with only one occupant";
-const char Event_S_07DD[] PROGMEM = "service area busy";
-const char Event_S_07E5[] PROGMEM = "service not operating, substitute service available";
-const char Event_S_07E6[] PROGMEM = "public transport strike";
-const char Event_S_07EC[] PROGMEM = "message cancelled";
-const char Event_S_07ED[] PROGMEM = "message cancelled";
-const char Event_S_07EE[] PROGMEM = "message cancelled";
-const char Event_S_07F0[] PROGMEM = "message cancelled";
-const char Event_S_07F1[] PROGMEM = "message cancelled";
-const char Event_S_07F2[] PROGMEM = "message cancelled";
-const char Event_S_07F3[] PROGMEM = "message cancelled";
-const char Event_S_07F6[] PROGMEM = "message cancelled";
-const char Event_S_07F7[] PROGMEM = "message cancelled";
-const char Event_S_07F8[] PROGMEM = "message cancelled";
-const char Event_S_07F9[] PROGMEM = "nothing to report";
-const char Event_S_07FA[] PROGMEM = "ice build-up on cable structure";
-const char Event_S_07FB[] PROGMEM = "road salted";
-const char Event_S_07FC[] PROGMEM = "danger of snow patches";
-const char Event_S_07FD[] PROGMEM = "snow patches";
-const char Event_S_07FE[] PROGMEM = "Convoy service required due to bad weather";
-const char Event_S_07FF[] PROGMEM = "(null message)";
-#endif
+#define ISO14819_2_EVENTS_COUNT 1552
+#define ISO14819_2_EVENT_TEXT_SIZE 88
 
-const TRDSTMCEventListEntry ISO14819_2_Events[1552] PROGMEM = {
-	{0x0001, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0001
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0000
-#endif
-},
-	{0x0002, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0002
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0010
-#endif
-},
-	{0x000B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 4
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_000B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0057
-#endif
-},
-	{0x000C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 3
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_000C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x007B
-#endif
-},
-	{0x0010, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0010
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x00B9
-#endif
-},
-	{0x0014, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0014
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x00E6
-#endif
-},
-	{0x0016, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0016
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x011E
-#endif
-},
-	{0x0017, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0017
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0140
-#endif
-},
-	{0x0018, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0018
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0160
-#endif
-},
-	{0x0019, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0019
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x016E
-#endif
-},
-	{0x001A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 6
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_001A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x017C
-#endif
-},
-	{0x001B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 6
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_001B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x018B
-#endif
-},
-	{0x001C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_001C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x019A
-#endif
-},
-	{0x0024, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0024
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x01B5
-#endif
-},
-	{0x0025, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0025
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x01CB
-#endif
-},
-	{0x0027, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 39
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0027
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x01DF
-#endif
-},
-	{0x0028, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0028
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0201
-#endif
-},
-	{0x0029, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0029
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0212
-#endif
-},
-	{0x002A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_002A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0231
-#endif
-},
-	{0x0033, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0033
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0251
-#endif
-},
-	{0x0034, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0034
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x027B
-#endif
-},
-	{0x0035, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0035
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x02A7
-#endif
-},
-	{0x0037, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0037
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x02D4
-#endif
-},
-	{0x0038, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0038
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x02ED
-#endif
-},
-	{0x0039, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0039
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0309
-#endif
-},
-	{0x003D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_003D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0321
-#endif
-},
-	{0x003E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_003E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x033B
-#endif
-},
-	{0x003F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_003F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x034E
-#endif
-},
-	{0x0040, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0040
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0371
-#endif
-},
-	{0x0046, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0046
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0384
-#endif
-},
-	{0x0047, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0047
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x03B1
-#endif
-},
-	{0x0048, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0048
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x03DE
-#endif
-},
-	{0x0049, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0049
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x040B
-#endif
-},
-	{0x004A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_004A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0438
-#endif
-},
-	{0x004B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_004B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0465
-#endif
-},
-	{0x004C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_004C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0492
-#endif
-},
-	{0x0050, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, false, 32
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0050
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x04BF
-#endif
-},
-	{0x0051, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 32
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0051
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x04E0
-#endif
-},
-	{0x0052, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, false, 32
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0052
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0506
-#endif
-},
-	{0x0053, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 32
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0053
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x053F
-#endif
-},
-	{0x0054, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, false, 32
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0054
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0564
-#endif
-},
-	{0x0055, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, false, 32
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0055
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0592
-#endif
-},
-	{0x0056, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, false, 32
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0056
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x05C3
-#endif
-},
-	{0x0057, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, false, 32
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0057
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x05EA
-#endif
-},
-	{0x0058, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, false, 32
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0058
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0617
-#endif
-},
-	{0x0059, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 32
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0059
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x063D
-#endif
-},
-	{0x005B, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_005B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x064F
-#endif
-},
-	{0x0065, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0065
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0664
-#endif
-},
-	{0x0066, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0066
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0677
-#endif
-},
-	{0x0067, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0067
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0693
-#endif
-},
-	{0x0068, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0068
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x06AF
-#endif
-},
-	{0x0069, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0069
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x06CB
-#endif
-},
-	{0x006A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_006A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x06E7
-#endif
-},
-	{0x006B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_006B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0704
-#endif
-},
-	{0x006C, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_006C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0720
-#endif
-},
-	{0x006D, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_006D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0749
-#endif
-},
-	{0x006E, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_006E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x077B
-#endif
-},
-	{0x006F, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_006F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x07AD
-#endif
-},
-	{0x0070, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0070
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x07DF
-#endif
-},
-	{0x0071, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0071
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0811
-#endif
-},
-	{0x0072, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0072
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0844
-#endif
-},
-	{0x0073, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0073
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x085D
-#endif
-},
-	{0x0074, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0074
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0883
-#endif
-},
-	{0x0075, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0075
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x08B2
+extern const char ISO14819_2_EventStrings[] PROGMEM;
 #endif
-},
-	{0x0076, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0076
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x08E1
-#endif
-},
-	{0x0077, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0077
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0910
-#endif
-},
-	{0x0078, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0078
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x093F
-#endif
-},
-	{0x0079, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0079
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x096F
-#endif
-},
-	{0x007A, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_007A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0985
-#endif
-},
-	{0x007B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_007B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x09AC
-#endif
-},
-	{0x007C, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_007C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x09C3
-#endif
-},
-	{0x007D, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_007D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x09F3
-#endif
-},
-	{0x007E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_007E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0A20
-#endif
-},
-	{0x007F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_007F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0A36
-#endif
-},
-	{0x0080, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0080
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0A51
-#endif
-},
-	{0x0081, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0081
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0A63
-#endif
-},
-	{0x0082, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0082
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0A7F
-#endif
-},
-	{0x0083, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0083
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0A9C
-#endif
-},
-	{0x0084, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0084
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0ACE
-#endif
-},
-	{0x0085, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0085
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0B01
-#endif
-},
-	{0x0086, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0086
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0B26
-#endif
-},
-	{0x0087, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0087
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0B55
-#endif
-},
-	{0x0088, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0088
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0B64
-#endif
-},
-	{0x0089, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0089
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0B90
-#endif
-},
-	{0x008A, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_008A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0BC5
-#endif
-},
-	{0x008B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_008B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0C02
-#endif
-},
-	{0x008C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_008C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0C2C
-#endif
-},
-	{0x008D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 3
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_008D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0C55
-#endif
-},
-	{0x008E, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_008E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0C82
-#endif
-},
-	{0x008F, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_008F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0CB7
-#endif
-},
-	{0x00C8, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00C8
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0CF6
-#endif
-},
-	{0x00C9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 3
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00C9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0D19
-#endif
-},
-	{0x00CA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00CA
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0D2A
-#endif
-},
-	{0x00CB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00CB
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0D43
-#endif
-},
-	{0x00CC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00CC
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0D72
-#endif
-},
-	{0x00CD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00CD
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0D9E
-#endif
-},
-	{0x00CE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00CE
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0DCD
-#endif
-},
-	{0x00CF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00CF
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0DEC
-#endif
-},
-	{0x00D0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00D0
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0E0F
-#endif
-},
-	{0x00D1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 3
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00D1
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0E3C
-#endif
-},
-	{0x00D2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00D2
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0E63
-#endif
-},
-	{0x00D3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 4
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00D3
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0E75
-#endif
-},
-	{0x00D4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 4
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00D4
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0E91
-#endif
-},
-	{0x00D5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 3
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00D5
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0EB4
-#endif
-},
-	{0x00D6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 4
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00D6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0EC9
-#endif
-},
-	{0x00D7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00D7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0EDA
-#endif
-},
-	{0x00D8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00D8
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0EFF
-#endif
-},
-	{0x00D9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00D9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0F2D
-#endif
-},
-	{0x00DA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00DA
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0F5B
-#endif
-},
-	{0x00DB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00DB
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0F89
-#endif
-},
-	{0x00DC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00DC
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0FB7
-#endif
-},
-	{0x00DD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00DD
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0FE6
-#endif
-},
-	{0x00DE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00DE
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1015
-#endif
-},
-	{0x00DF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00DF
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1037
-#endif
-},
-	{0x00E0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00E0
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1062
-#endif
-},
-	{0x00E1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00E1
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x108D
-#endif
-},
-	{0x00E2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00E2
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x10B8
-#endif
-},
-	{0x00E3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00E3
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x10E3
-#endif
-},
-	{0x00E4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00E4
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x110F
-#endif
-},
-	{0x00E5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00E5
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x113B
-#endif
-},
-	{0x00E6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00E6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x115A
-#endif
-},
-	{0x00E7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00E7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1182
-#endif
-},
-	{0x00E8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00E8
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x11AA
-#endif
-},
-	{0x00E9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00E9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x11D2
-#endif
-},
-	{0x00EA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00EA
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x11FA
-#endif
-},
-	{0x00EB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00EB
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1223
-#endif
-},
-	{0x00EC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00EC
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x124B
-#endif
-},
-	{0x00ED, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00ED
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x126B
+extern const TRDSTMCEventListEntry ISO14819_2_Events[ISO14819_2_EVENTS_COUNT] PROGMEM;
+#if defined(WITH_RDS_TMC_DIRECT_INDEX)
+extern const uint16_t ISO14819_2_EventIndex[2048] PROGMEM;
 #endif
-},
-	{0x00EE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00EE
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1294
-#endif
-},
-	{0x00EF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00EF
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x12BD
-#endif
-},
-	{0x00F0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00F0
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x12E3
-#endif
-},
-	{0x00F1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00F1
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1307
-#endif
-},
-	{0x00F2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00F2
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x132C
-#endif
-},
-	{0x00F3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00F3
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1352
-#endif
-},
-	{0x00F4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00F4
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1376
-#endif
-},
-	{0x00F5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00F5
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x139E
-#endif
-},
-	{0x00F6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00F6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x13C2
-#endif
-},
-	{0x00F7, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00F7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x13E8
-#endif
-},
-	{0x00F8, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00F8
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x13FE
-#endif
-},
-	{0x00F9, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00F9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x141D
-#endif
-},
-	{0x00FA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00FA
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1438
-#endif
-},
-	{0x00FB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00FB
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1479
-#endif
-},
-	{0x00FC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00FC
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x14C3
-#endif
-},
-	{0x00FD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00FD
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x150D
-#endif
-},
-	{0x00FE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00FE
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1557
-#endif
-},
-	{0x00FF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00FF
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x15A1
-#endif
-},
-	{0x0100, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0100
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x15EC
-#endif
-},
-	{0x0101, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0101
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1637
-#endif
-},
-	{0x0102, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0102
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1675
-#endif
-},
-	{0x0103, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0103
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x16BC
-#endif
-},
-	{0x0104, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0104
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1703
-#endif
-},
-	{0x0105, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0105
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x174A
-#endif
-},
-	{0x0106, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0106
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1791
-#endif
-},
-	{0x0107, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0107
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x17D9
-#endif
-},
-	{0x0108, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0108
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1821
-#endif
-},
-	{0x0109, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0109
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x185C
-#endif
-},
-	{0x010A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_010A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x18A0
-#endif
-},
-	{0x010B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_010B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x18E4
-#endif
-},
-	{0x010C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_010C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1928
-#endif
-},
-	{0x010D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_010D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x196C
-#endif
-},
-	{0x010E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_010E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x19B1
-#endif
-},
-	{0x010F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_010F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x19F5
-#endif
-},
-	{0x0110, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0110
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1A31
-#endif
-},
-	{0x0112, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0112
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1A76
-#endif
-},
-	{0x0113, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0113
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1AB8
-#endif
-},
-	{0x0114, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0114
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1AEA
-#endif
-},
-	{0x0115, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0115
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1B25
-#endif
-},
-	{0x0116, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0116
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1B5C
-#endif
-},
-	{0x0117, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0117
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1B82
-#endif
-},
-	{0x0118, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0118
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1BB1
-#endif
-},
-	{0x0119, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0119
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1BE0
-#endif
-},
-	{0x011A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_011A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1C0F
-#endif
-},
-	{0x011B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_011B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1C3E
-#endif
-},
-	{0x011C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_011C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1C6E
-#endif
-},
-	{0x011D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_011D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1C9E
-#endif
-},
-	{0x011E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_011E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1CC1
-#endif
-},
-	{0x011F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_011F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1CED
-#endif
-},
-	{0x0120, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0120
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1D19
-#endif
-},
-	{0x0121, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0121
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1D45
-#endif
-},
-	{0x0122, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0122
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1D71
-#endif
-},
-	{0x0123, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0123
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1D9E
-#endif
-},
-	{0x0124, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0124
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1DCB
-#endif
-},
-	{0x0125, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0125
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1DEB
-#endif
-},
-	{0x0126, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0126
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1E14
-#endif
-},
-	{0x0127, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0127
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1E3D
-#endif
-},
-	{0x0128, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0128
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1E66
-#endif
-},
-	{0x0129, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0129
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1E8F
-#endif
-},
-	{0x012A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_012A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1EB9
-#endif
-},
-	{0x012B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_012B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1EE2
-#endif
-},
-	{0x012C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_012C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1F03
-#endif
-},
-	{0x012D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_012D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1F2D
-#endif
-},
-	{0x012E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_012E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1F57
-#endif
-},
-	{0x012F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_012F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1F7E
-#endif
-},
-	{0x0130, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0130
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1F9B
-#endif
-},
-	{0x0131, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0131
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1FC1
-#endif
-},
-	{0x0132, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0132
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1FE8
-#endif
-},
-	{0x0133, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0133
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x200D
-#endif
-},
-	{0x0134, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0134
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2036
-#endif
-},
-	{0x0135, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0135
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x205B
-#endif
-},
-	{0x0136, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0136
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2082
-#endif
-},
-	{0x0137, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0137
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2099
-#endif
-},
-	{0x0138, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0138
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x20B9
-#endif
-},
-	{0x0139, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0139
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x20D5
-#endif
-},
-	{0x013A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_013A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2105
-#endif
-},
-	{0x013B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_013B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x213F
-#endif
-},
-	{0x013C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_013C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x216C
-#endif
-},
-	{0x013D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_013D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x21A3
-#endif
-},
-	{0x013E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_013E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x21CD
-#endif
-},
-	{0x013F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_013F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2200
-#endif
-},
-	{0x0140, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0140
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x222B
-#endif
-},
-	{0x0141, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0141
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x225F
-#endif
-},
-	{0x0142, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0142
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2293
-#endif
-},
-	{0x0143, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0143
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x22C3
-#endif
-},
-	{0x0144, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0144
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x22EB
-#endif
-},
-	{0x0145, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0145
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x231B
-#endif
-},
-	{0x0146, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0146
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x234C
-#endif
-},
-	{0x0147, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0147
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x237B
-#endif
-},
-	{0x0148, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0148
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x23AE
-#endif
-},
-	{0x0149, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0149
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x23DD
-#endif
-},
-	{0x014A, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_014A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x240E
-#endif
-},
-	{0x014B, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_014B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x242F
-#endif
-},
-	{0x014C, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_014C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2459
-#endif
-},
-	{0x014D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 3
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_014D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x247F
-#endif
-},
-	{0x014E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 3
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_014E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2490
-#endif
-},
-	{0x014F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_014F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x24A2
-#endif
-},
-	{0x0150, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0150
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x24C4
-#endif
-},
-	{0x0151, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 3
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0151
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x24E2
-#endif
-},
-	{0x0152, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0152
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x24FD
-#endif
-},
-	{0x0153, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0153
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x251F
-#endif
-},
-	{0x0154, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0154
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x253A
-#endif
-},
-	{0x0155, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0155
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2555
-#endif
-},
-	{0x0156, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 3
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0156
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x257D
-#endif
-},
-	{0x0157, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 3
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0157
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2599
-#endif
-},
-	{0x0158, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 3
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0158
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x25B2
-#endif
-},
-	{0x0159, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 3
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0159
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x25CE
-#endif
-},
-	{0x015A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 4
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_015A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x25E9
-#endif
-},
-	{0x015B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 24
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_015B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2602
-#endif
-},
-	{0x015C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_015C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x261D
-#endif
-},
-	{0x015D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_015D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x264B
-#endif
-},
-	{0x015E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_015E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2676
-#endif
-},
-	{0x015F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_015F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x269E
-#endif
-},
-	{0x0160, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0160
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x26C1
-#endif
-},
-	{0x0161, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0161
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x270B
-#endif
-},
-	{0x0162, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0162
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2752
-#endif
-},
-	{0x0163, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0163
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2796
-#endif
-},
-	{0x0164, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0164
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x27CB
-#endif
-},
-	{0x0165, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0165
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x27FA
-#endif
-},
-	{0x0166, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0166
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2826
-#endif
-},
-	{0x0167, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0167
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x284F
-#endif
-},
-	{0x0168, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0168
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2869
-#endif
-},
-	{0x0169, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0169
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2898
-#endif
-},
-	{0x016A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_016A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x28D1
-#endif
-},
-	{0x016B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_016B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x28FD
-#endif
-},
-	{0x016C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_016C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2933
-#endif
-},
-	{0x016D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_016D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x295C
-#endif
-},
-	{0x016E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_016E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x298E
-#endif
-},
-	{0x016F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_016F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x29B8
-#endif
-},
-	{0x0170, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0170
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x29EB
-#endif
-},
-	{0x0171, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0171
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2A1B
-#endif
-},
-	{0x0172, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0172
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2A41
-#endif
-},
-	{0x0173, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0173
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2A70
-#endif
-},
-	{0x0174, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0174
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2AA0
-#endif
-},
-	{0x0175, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0175
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2ACE
-#endif
-},
-	{0x0176, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0176
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2AFC
-#endif
-},
-	{0x0177, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0177
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2B2C
-#endif
-},
-	{0x0178, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0178
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2B4C
-#endif
-},
-	{0x0179, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0179
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2B75
-#endif
-},
-	{0x017A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_017A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2B9A
-#endif
-},
-	{0x017B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_017B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2BBD
-#endif
-},
-	{0x017C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_017C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2BF0
-#endif
-},
-	{0x017D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_017D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2C2D
-#endif
-},
-	{0x017E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_017E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2C5D
-#endif
-},
-	{0x017F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_017F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2C97
-#endif
-},
-	{0x0181, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0181
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2CC4
-#endif
-},
-	{0x0183, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0183
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2CF2
-#endif
-},
-	{0x0184, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0184
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2D26
-#endif
-},
-	{0x0186, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0186
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2D4A
-#endif
-},
-	{0x0187, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 3
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0187
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2D73
-#endif
-},
-	{0x0188, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0188
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2D97
-#endif
-},
-	{0x0189, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 4
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0189
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2DBA
-#endif
-},
-	{0x018A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 4
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_018A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2DDE
-#endif
-},
-	{0x018B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 4
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_018B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2E09
-#endif
-},
-	{0x018C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 4
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_018C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2E16
-#endif
-},
-	{0x018D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 4
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_018D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2E27
-#endif
-},
-	{0x018F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 8
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_018F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2E4C
-#endif
-},
-	{0x0191, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0191
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2E5E
-#endif
-},
-	{0x0192, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0192
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2E65
-#endif
-},
-	{0x0193, RDS_TMC_QUANTIFIER_TONNES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0193
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2E6D
-#endif
-},
-	{0x0194, RDS_TMC_QUANTIFIER_TONNES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0194
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2E91
-#endif
-},
-	{0x0195, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0195
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2EC0
-#endif
-},
-	{0x0196, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 8
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0196
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2ED3
-#endif
-},
-	{0x0197, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 7
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0197
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2EF2
-#endif
-},
-	{0x0198, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 7
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0198
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2F10
-#endif
-},
-	{0x0199, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 7
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0199
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2F22
-#endif
-},
-	{0x019A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_019A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2F39
-#endif
-},
-	{0x019B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_019B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2F5A
-#endif
-},
-	{0x019C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_019C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2F84
-#endif
-},
-	{0x019D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_019D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2FAE
-#endif
-},
-	{0x019E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_019E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2FD8
-#endif
-},
-	{0x019F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_019F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3002
-#endif
-},
-	{0x01A0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01A0
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x302D
-#endif
-},
-	{0x01A1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01A1
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3058
-#endif
-},
-	{0x01A2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01A2
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3076
-#endif
-},
-	{0x01A3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01A3
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x309D
-#endif
-},
-	{0x01A4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01A4
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x30C4
-#endif
-},
-	{0x01A5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01A5
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x30EB
-#endif
-},
-	{0x01A6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01A6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3112
-#endif
-},
-	{0x01A7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01A7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x313A
-#endif
-},
-	{0x01A8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01A8
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3162
-#endif
-},
-	{0x01A9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01A9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x317D
-#endif
-},
-	{0x01AA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01AA
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x31A1
-#endif
-},
-	{0x01AB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01AB
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x31C5
-#endif
-},
-	{0x01AC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01AC
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x31E9
-#endif
-},
-	{0x01AD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01AD
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x320D
-#endif
-},
-	{0x01AE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01AE
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3232
-#endif
-},
-	{0x01AF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01AF
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3256
-#endif
-},
-	{0x01B0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01B0
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3272
-#endif
-},
-	{0x01B1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01B1
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3297
-#endif
-},
-	{0x01B2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01B2
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x32BC
-#endif
-},
-	{0x01B3, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01B3
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x32DE
-#endif
-},
-	{0x01B4, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01B4
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x32F8
-#endif
-},
-	{0x01B5, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01B5
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x331B
-#endif
-},
-	{0x01B6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01B6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x333A
-#endif
-},
-	{0x01B7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01B7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x335C
-#endif
-},
-	{0x01B8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01B8
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3387
-#endif
-},
-	{0x01B9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01B9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x33B2
-#endif
-},
-	{0x01BA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01BA
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x33DD
-#endif
-},
-	{0x01BB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01BB
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3408
-#endif
-},
-	{0x01BC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01BC
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3434
-#endif
-},
-	{0x01BD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01BD
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3460
-#endif
-},
-	{0x01BE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01BE
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x347F
-#endif
-},
-	{0x01BF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01BF
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x34A7
-#endif
-},
-	{0x01C0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01C0
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x34CF
-#endif
-},
-	{0x01C1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01C1
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x34F7
-#endif
-},
-	{0x01C2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01C2
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x351F
-#endif
-},
-	{0x01C3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01C3
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3548
-#endif
-},
-	{0x01C4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01C4
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3571
-#endif
-},
-	{0x01C5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01C5
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x358D
-#endif
-},
-	{0x01C6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01C6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x35B2
-#endif
-},
-	{0x01C7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01C7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x35D7
-#endif
-},
-	{0x01C8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01C8
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x35FC
-#endif
-},
-	{0x01C9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01C9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3621
-#endif
-},
-	{0x01CA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01CA
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3647
-#endif
-},
-	{0x01CB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01CB
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x366C
-#endif
-},
-	{0x01CC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01CC
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3689
-#endif
-},
-	{0x01CD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01CD
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x36AF
-#endif
-},
-	{0x01CE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01CE
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x36D5
-#endif
-},
-	{0x01CF, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01CF
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x36F8
-#endif
-},
-	{0x01D0, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01D0
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3713
-#endif
-},
-	{0x01D1, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01D1
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3737
-#endif
-},
-	{0x01D2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 7
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01D2
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3757
-#endif
-},
-	{0x01D3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01D3
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x376B
-#endif
-},
-	{0x01D4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01D4
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3774
-#endif
-},
-	{0x01D5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01D5
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3786
-#endif
-},
-	{0x01D6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01D6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3793
-#endif
-},
-	{0x01D7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 8
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01D7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x37A1
-#endif
-},
-	{0x01D8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 8
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01D8
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x37C0
-#endif
-},
-	{0x01D9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 8
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01D9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x37E0
-#endif
-},
-	{0x01DA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 7
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01DA
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x37EE
-#endif
-},
-	{0x01DB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 7
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01DB
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x380C
-#endif
-},
-	{0x01DC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 7
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01DC
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x382B
-#endif
-},
-	{0x01DD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 7
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01DD
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3838
-#endif
-},
-	{0x01DE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 7
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01DE
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x384B
-#endif
-},
-	{0x01DF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 6
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01DF
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3869
-#endif
-},
-	{0x01E0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 6
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01E0
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3885
-#endif
-},
-	{0x01E1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 6
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01E1
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x38AC
-#endif
-},
-	{0x01E2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 6
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01E2
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x38D2
-#endif
-},
-	{0x01E3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 6
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01E3
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x38E7
-#endif
-},
-	{0x01E4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 6
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01E4
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3904
-#endif
-},
-	{0x01E5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 7
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01E5
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3917
-#endif
-},
-	{0x01E6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 6
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01E6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3936
-#endif
-},
-	{0x01E7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 6
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01E7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3953
-#endif
-},
-	{0x01E8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 6
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01E8
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x397B
-#endif
-},
-	{0x01E9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 6
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01E9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x39A2
-#endif
-},
-	{0x01EA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 6
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01EA
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x39B8
-#endif
-},
-	{0x01EB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 6
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01EB
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x39D6
-#endif
-},
-	{0x01EC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01EC
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x39EA
-#endif
-},
-	{0x01ED, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01ED
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x39FC
-#endif
-},
-	{0x01EE, RDS_TMC_QUANTIFIER_TONNES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01EE
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3A09
-#endif
-},
-	{0x01EF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01EF
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3A2C
-#endif
-},
-	{0x01F0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01F0
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3A56
-#endif
-},
-	{0x01F1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01F1
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3A7D
-#endif
-},
-	{0x01F2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01F2
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3AA1
-#endif
-},
-	{0x01F3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01F3
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3ACC
-#endif
-},
-	{0x01F4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01F4
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3AF4
-#endif
-},
-	{0x01F5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01F5
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3B08
-#endif
-},
-	{0x01F6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01F6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3B22
-#endif
-},
-	{0x01F7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01F7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3B3D
-#endif
-},
-	{0x01F8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01F8
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3B56
-#endif
-},
-	{0x01F9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01F9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3B6B
-#endif
-},
-	{0x01FA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01FA
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3B7C
-#endif
-},
-	{0x01FB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01FB
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3B8F
-#endif
-},
-	{0x01FC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01FC
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3BAA
-#endif
-},
-	{0x01FD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01FD
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3BC6
-#endif
-},
-	{0x01FE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01FE
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3BE0
-#endif
-},
-	{0x01FF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01FF
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3BF6
-#endif
-},
-	{0x0200, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0200
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3C08
-#endif
-},
-	{0x0201, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0201
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3C1C
-#endif
-},
-	{0x0202, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0202
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3C3A
-#endif
-},
-	{0x0203, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0203
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3C6A
-#endif
-},
-	{0x0204, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0204
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3C9B
-#endif
-},
-	{0x0205, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0205
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3CCE
-#endif
-},
-	{0x0206, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0206
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3CD9
-#endif
-},
-	{0x0207, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0207
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3CE6
-#endif
-},
-	{0x0208, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0208
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3D03
-#endif
-},
-	{0x0209, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0209
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3D18
-#endif
-},
-	{0x020A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_020A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3D3E
-#endif
-},
-	{0x020B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_020B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3D6D
-#endif
-},
-	{0x020C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_020C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3D9C
-#endif
-},
-	{0x020D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_020D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3DCB
-#endif
-},
-	{0x020E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_020E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3DFA
-#endif
-},
-	{0x020F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_020F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3E2A
-#endif
-},
-	{0x0210, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0210
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3E5A
-#endif
-},
-	{0x0211, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0211
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3E7D
-#endif
-},
-	{0x0212, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0212
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3EA9
-#endif
-},
-	{0x0213, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0213
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3ED5
-#endif
-},
-	{0x0214, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0214
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3F01
-#endif
-},
-	{0x0215, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0215
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3F2D
-#endif
-},
-	{0x0216, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0216
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3F5A
-#endif
-},
-	{0x0217, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0217
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3F87
-#endif
-},
-	{0x0218, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0218
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3FA7
-#endif
-},
-	{0x0219, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0219
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3FD0
-#endif
-},
-	{0x021A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_021A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3FF9
-#endif
-},
-	{0x021B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_021B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4022
-#endif
-},
-	{0x021C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_021C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x404B
-#endif
-},
-	{0x021D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_021D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4075
-#endif
-},
-	{0x021E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_021E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x409E
-#endif
-},
-	{0x021F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_021F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x40BF
-#endif
-},
-	{0x0220, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0220
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x40E9
-#endif
-},
-	{0x0221, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0221
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4112
-#endif
-},
-	{0x0222, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0222
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4138
-#endif
-},
-	{0x0223, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0223
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x417C
-#endif
-},
-	{0x0224, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0224
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x41CA
-#endif
-},
-	{0x0225, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0225
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x420B
-#endif
-},
-	{0x0226, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0226
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4256
-#endif
-},
-	{0x0227, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0227
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4294
-#endif
-},
-	{0x0228, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0228
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x42DB
-#endif
-},
-	{0x0229, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0229
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x431A
-#endif
-},
-	{0x022A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_022A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4362
-#endif
-},
-	{0x022B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_022B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x43AA
-#endif
-},
-	{0x022C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_022C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x43EF
-#endif
-},
-	{0x022D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_022D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4434
-#endif
-},
-	{0x022E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_022E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4483
-#endif
-},
-	{0x022F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_022F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x44C5
-#endif
-},
-	{0x0230, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0230
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4511
-#endif
-},
-	{0x0231, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0231
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4550
-#endif
-},
-	{0x0232, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0232
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4598
-#endif
-},
-	{0x0233, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0233
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x45D8
-#endif
-},
-	{0x0234, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0234
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4621
-#endif
-},
-	{0x0235, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0235
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x466A
-#endif
-},
-	{0x0236, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0236
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x46B0
-#endif
-},
-	{0x0237, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0237
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x46F7
-#endif
-},
-	{0x0238, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0238
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4748
-#endif
-},
-	{0x0239, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0239
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x478C
-#endif
-},
-	{0x023A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_023A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x47DA
-#endif
-},
-	{0x023B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_023B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x481B
-#endif
-},
-	{0x023C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_023C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4865
-#endif
-},
-	{0x023D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_023D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x48A7
-#endif
-},
-	{0x023E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_023E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x48F2
-#endif
-},
-	{0x023F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_023F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x493D
-#endif
-},
-	{0x0240, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0240
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4985
-#endif
-},
-	{0x0241, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0241
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x49A4
-#endif
-},
-	{0x0242, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0242
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x49CC
-#endif
-},
-	{0x0243, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0243
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x49F4
-#endif
-},
-	{0x0244, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0244
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4A1C
-#endif
-},
-	{0x0245, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0245
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4A44
-#endif
-},
-	{0x0246, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0246
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4A6D
-#endif
-},
-	{0x0247, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0247
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4A96
-#endif
-},
-	{0x0248, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0248
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4AB2
-#endif
-},
-	{0x0249, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0249
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4AD7
-#endif
-},
-	{0x024A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_024A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4AFC
-#endif
-},
-	{0x024B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_024B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4B21
-#endif
-},
-	{0x024C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_024C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4B46
-#endif
-},
-	{0x024D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_024D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4B6C
-#endif
-},
-	{0x024E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_024E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4B92
-#endif
-},
-	{0x024F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_024F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4BAB
-#endif
-},
-	{0x0250, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0250
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4BCD
-#endif
-},
-	{0x0251, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0251
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4BEF
-#endif
-},
-	{0x0252, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0252
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4C11
-#endif
-},
-	{0x0253, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0253
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4C33
-#endif
-},
-	{0x0254, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0254
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4C56
-#endif
-},
-	{0x0255, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0255
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4C78
-#endif
-},
-	{0x0256, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0256
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4C92
-#endif
-},
-	{0x0257, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0257
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4CB5
-#endif
-},
-	{0x0258, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0258
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4CD8
-#endif
-},
-	{0x0259, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0259
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4CF8
-#endif
-},
-	{0x025A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_025A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4D34
-#endif
-},
-	{0x025B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_025B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4D71
-#endif
-},
-	{0x025C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_025C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4DB0
-#endif
-},
-	{0x025D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_025D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4DD1
-#endif
-},
-	{0x025E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_025E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4DFC
-#endif
-},
-	{0x025F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_025F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4E1A
-#endif
-},
-	{0x0260, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0260
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4E42
-#endif
-},
-	{0x0261, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0261
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4E5D
-#endif
-},
-	{0x0262, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0262
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4E81
-#endif
-},
-	{0x0263, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0263
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4E9D
-#endif
-},
-	{0x0264, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0264
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4EC2
-#endif
-},
-	{0x0265, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0265
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4EE7
-#endif
-},
-	{0x0266, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0266
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4F09
-#endif
-},
-	{0x0267, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0267
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4F3A
-#endif
-},
-	{0x0268, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0268
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4F89
-#endif
-},
-	{0x0269, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0269
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4FB7
-#endif
-},
-	{0x026A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_026A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4FEF
-#endif
-},
-	{0x026B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_026B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x501A
-#endif
-},
-	{0x026C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_026C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x504E
-#endif
-},
-	{0x026D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_026D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x507A
-#endif
-},
-	{0x026E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_026E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x50AF
-#endif
-},
-	{0x026F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_026F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x50E4
-#endif
-},
-	{0x0270, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0270
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5116
-#endif
-},
-	{0x0271, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0271
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x512C
-#endif
-},
-	{0x0272, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0272
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x513E
-#endif
-},
-	{0x0273, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0273
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5163
-#endif
-},
-	{0x0274, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0274
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5192
-#endif
-},
-	{0x0275, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0275
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x51CB
-#endif
-},
-	{0x0276, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0276
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5203
-#endif
-},
-	{0x0277, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0277
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5208
-#endif
-},
-	{0x0278, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 8
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0278
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5215
-#endif
-},
-	{0x0279, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 7
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0279
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5224
-#endif
-},
-	{0x027A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 6
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_027A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5232
-#endif
-},
-	{0x027B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_027B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x524C
-#endif
-},
-	{0x027C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_027C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x526E
-#endif
-},
-	{0x027D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_027D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x528A
-#endif
-},
-	{0x027E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_027E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x52A0
-#endif
-},
-	{0x027F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_027F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x52B4
-#endif
-},
-	{0x0280, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0280
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x52C8
-#endif
-},
-	{0x0281, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0281
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x52E1
-#endif
-},
-	{0x0282, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0282
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x52F1
-#endif
-},
-	{0x0283, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0283
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5308
-#endif
-},
-	{0x0284, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0284
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x531D
-#endif
-},
-	{0x0285, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0285
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5332
-#endif
-},
-	{0x0286, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0286
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x534C
-#endif
-},
-	{0x0287, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 10
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0287
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x535D
-#endif
-},
-	{0x0288, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 10
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0288
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5383
-#endif
-},
-	{0x0289, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 10
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0289
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x53A3
-#endif
-},
-	{0x028A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 10
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_028A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x53C4
-#endif
-},
-	{0x028B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_028B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x53FD
-#endif
-},
-	{0x028C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_028C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x542C
-#endif
-},
-	{0x028D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_028D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5458
-#endif
-},
-	{0x028E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_028E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5481
-#endif
-},
-	{0x028F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_028F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x54A9
-#endif
-},
-	{0x0290, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0290
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x54CE
-#endif
-},
-	{0x0291, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0291
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x54F0
-#endif
-},
-	{0x0292, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0292
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5507
-#endif
-},
-	{0x0293, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 10
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0293
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x551A
-#endif
-},
-	{0x0294, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0294
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5542
-#endif
-},
-	{0x0295, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0295
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x555B
-#endif
-},
-	{0x0296, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0296
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5578
-#endif
-},
-	{0x0297, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 6
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0297
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5599
-#endif
-},
-	{0x0298, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0298
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x55B2
-#endif
-},
-	{0x0299, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0299
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x55C5
-#endif
-},
-	{0x029A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_029A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x55DC
-#endif
-},
-	{0x029F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 10
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_029F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x55FD
-#endif
-},
-	{0x02A0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 6
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02A0
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x563A
-#endif
-},
-	{0x02A1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 7
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02A1
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x564C
-#endif
-},
-	{0x02A3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 23
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02A3
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x565E
-#endif
-},
-	{0x02A4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 6
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02A4
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5674
-#endif
-},
-	{0x02A6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02A6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5685
-#endif
-},
-	{0x02A7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02A7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x569F
-#endif
-},
-	{0x02A8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02A8
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x56BA
-#endif
-},
-	{0x02A9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 23
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02A9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x56D7
-#endif
-},
-	{0x02BD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02BD
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x56E8
-#endif
-},
-	{0x02BE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02BE
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x56FF
-#endif
-},
-	{0x02BF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 11
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02BF
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x571C
-#endif
-},
-	{0x02C0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02C0
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x573A
-#endif
-},
-	{0x02C1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02C1
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x575C
-#endif
-},
-	{0x02C2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 13
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02C2
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5782
-#endif
-},
-	{0x02C3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02C3
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x57A1
-#endif
-},
-	{0x02C4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 11
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02C4
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x57C9
-#endif
-},
-	{0x02C5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 11
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02C5
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x57EF
-#endif
-},
-	{0x02C6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02C6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x580E
-#endif
-},
-	{0x02C7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02C7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5839
-#endif
-},
-	{0x02C8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02C8
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x586D
-#endif
-},
-	{0x02C9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02C9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x58A1
-#endif
-},
-	{0x02CA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02CA
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x58D5
-#endif
-},
-	{0x02CB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02CB
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5909
-#endif
-},
-	{0x02CC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02CC
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x593E
-#endif
-},
-	{0x02CD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02CD
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5973
-#endif
-},
-	{0x02CE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02CE
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x599B
-#endif
-},
-	{0x02CF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02CF
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x59CC
-#endif
-},
-	{0x02D0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02D0
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x59FD
-#endif
-},
-	{0x02D1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02D1
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5A2E
-#endif
-},
-	{0x02D2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02D2
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5A5F
-#endif
-},
-	{0x02D3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02D3
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5A91
-#endif
-},
-	{0x02D4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02D4
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5AC3
-#endif
-},
-	{0x02D5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02D5
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5AE8
-#endif
-},
-	{0x02D6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02D6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5B16
-#endif
-},
-	{0x02D7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02D7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5B44
-#endif
-},
-	{0x02D8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02D8
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5B72
-#endif
-},
-	{0x02D9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02D9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5BA0
-#endif
-},
-	{0x02DA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02DA
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5BCF
-#endif
-},
-	{0x02DB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02DB
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5BFD
-#endif
-},
-	{0x02DC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02DC
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5C23
-#endif
-},
-	{0x02DD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02DD
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5C52
-#endif
-},
-	{0x02DE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02DE
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5C81
-#endif
-},
-	{0x02DF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02DF
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5CAD
-#endif
-},
-	{0x02E0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02E0
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5CD2
-#endif
-},
-	{0x02E1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02E1
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5CFC
-#endif
-},
-	{0x02E2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02E2
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5D27
-#endif
-},
-	{0x02E3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02E3
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5D50
-#endif
-},
-	{0x02E4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02E4
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5D7D
-#endif
-},
-	{0x02E5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02E5
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5DA6
-#endif
-},
-	{0x02E6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02E6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5DD1
-#endif
-},
-	{0x02E7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02E7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5E07
-#endif
-},
-	{0x02E8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02E8
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5E42
-#endif
-},
-	{0x02E9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02E9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5E7E
-#endif
-},
-	{0x02EA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02EA
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5EBC
-#endif
-},
-	{0x02EB, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02EB
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5EDF
-#endif
-},
-	{0x02EC, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02EC
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5EF6
-#endif
-},
-	{0x02ED, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02ED
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5F16
-#endif
-},
-	{0x02EE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02EE
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5F32
-#endif
-},
-	{0x02EF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02EF
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5F68
-#endif
-},
-	{0x02F0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02F0
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5FA7
-#endif
-},
-	{0x02F1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02F1
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5FE6
-#endif
-},
-	{0x02F2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02F2
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6025
-#endif
-},
-	{0x02F3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02F3
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6064
-#endif
-},
-	{0x02F4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02F4
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x60A4
-#endif
-},
-	{0x02F5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02F5
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x60E4
-#endif
-},
-	{0x02F6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02F6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6117
-#endif
-},
-	{0x02F7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02F7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6153
-#endif
-},
-	{0x02F8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02F8
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x618F
-#endif
-},
-	{0x02F9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02F9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x61CB
-#endif
-},
-	{0x02FA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02FA
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6207
-#endif
-},
-	{0x02FB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02FB
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6244
-#endif
-},
-	{0x02FC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02FC
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6281
-#endif
-},
-	{0x02FD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02FD
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x62B1
-#endif
-},
-	{0x02FE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02FE
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x62EA
-#endif
-},
-	{0x02FF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02FF
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6323
-#endif
-},
-	{0x0300, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0300
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x635C
-#endif
-},
-	{0x0301, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0301
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6395
-#endif
-},
-	{0x0302, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0302
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x63CF
-#endif
-},
-	{0x0303, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0303
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6408
-#endif
-},
-	{0x0304, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0304
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6439
-#endif
-},
-	{0x0305, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0305
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6473
-#endif
-},
-	{0x0306, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0306
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x64AD
-#endif
-},
-	{0x0307, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0307
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x64E4
-#endif
-},
-	{0x0308, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0308
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6525
-#endif
-},
-	{0x0309, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0309
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6567
-#endif
-},
-	{0x030A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_030A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x65AA
-#endif
-},
-	{0x030B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_030B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x65EF
-#endif
-},
-	{0x030C, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_030C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x661D
-#endif
-},
-	{0x030D, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_030D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x663B
-#endif
-},
-	{0x030E, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_030E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6662
-#endif
-},
-	{0x030F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_030F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6685
-#endif
-},
-	{0x0310, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0310
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x66B8
-#endif
-},
-	{0x0311, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0311
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x66F5
-#endif
-},
-	{0x0312, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0312
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6725
-#endif
-},
-	{0x0313, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0313
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x675F
-#endif
-},
-	{0x0314, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0314
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x678C
-#endif
-},
-	{0x0315, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0315
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x67C2
-#endif
-},
-	{0x0316, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0316
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x67F0
-#endif
-},
-	{0x0317, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0317
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6827
-#endif
-},
-	{0x0318, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0318
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x685E
-#endif
-},
-	{0x0319, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0319
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6892
-#endif
-},
-	{0x031A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_031A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x68C4
-#endif
-},
-	{0x031B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_031B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x68F7
-#endif
-},
-	{0x031C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_031C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6928
-#endif
-},
-	{0x031D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_031D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x695D
-#endif
-},
-	{0x031E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_031E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x698E
-#endif
-},
-	{0x031F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_031F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x69C1
-#endif
-},
-	{0x0320, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 11
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0320
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x69F3
-#endif
-},
-	{0x0321, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 11
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0321
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6A05
-#endif
-},
-	{0x0322, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0322
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6A17
-#endif
-},
-	{0x0323, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0323
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6A38
-#endif
-},
-	{0x0324, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 23
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0324
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6A57
-#endif
-},
-	{0x0325, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 11
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0325
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6A85
-#endif
-},
-	{0x0326, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 11
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0326
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6AAC
-#endif
-},
-	{0x0327, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 11
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0327
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6AC9
-#endif
-},
-	{0x0328, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 11
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0328
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6AE4
-#endif
-},
-	{0x0329, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 11
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0329
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6B07
-#endif
-},
-	{0x032A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 11
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_032A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6B2C
-#endif
-},
-	{0x032B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 11
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_032B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6B41
-#endif
-},
-	{0x032C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_032C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6B51
-#endif
-},
-	{0x032D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_032D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6B85
-#endif
-},
-	{0x032E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_032E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6BB6
-#endif
-},
-	{0x032F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_032F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6BE4
-#endif
-},
-	{0x0330, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0330
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6C0F
-#endif
-},
-	{0x0331, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0331
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6C3E
-#endif
-},
-	{0x0332, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0332
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6C66
-#endif
-},
-	{0x0333, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0333
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6CA5
-#endif
-},
-	{0x0334, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0334
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6CE1
-#endif
-},
-	{0x0335, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0335
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6D1A
-#endif
-},
-	{0x0336, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0336
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6D4C
-#endif
-},
-	{0x0337, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0337
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6D82
-#endif
-},
-	{0x0338, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 13
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0338
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6DB1
-#endif
-},
-	{0x0339, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0339
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6DD8
-#endif
-},
-	{0x033A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_033A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6E1A
-#endif
-},
-	{0x033B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_033B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6E66
-#endif
-},
-	{0x033C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_033C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6EA5
-#endif
-},
-	{0x033D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_033D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6EEE
-#endif
-},
-	{0x033E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_033E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6F2A
-#endif
-},
-	{0x033F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_033F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6F6F
-#endif
-},
-	{0x0340, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0340
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6FAC
-#endif
-},
-	{0x0341, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0341
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6FF2
-#endif
-},
-	{0x0342, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0342
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7038
-#endif
-},
-	{0x0343, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0343
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x707B
-#endif
-},
-	{0x0344, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0344
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x70BC
-#endif
-},
-	{0x0345, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0345
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x70FE
-#endif
-},
-	{0x0346, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0346
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x713E
-#endif
-},
-	{0x0347, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0347
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x717E
-#endif
-},
-	{0x0348, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0348
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x71C0
-#endif
-},
-	{0x0349, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0349
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x71DD
-#endif
-},
-	{0x034A, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_034A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7203
-#endif
-},
-	{0x034B, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_034B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7225
-#endif
-},
-	{0x034C, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_034C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7240
-#endif
-},
-	{0x034D, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_034D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7264
-#endif
-},
-	{0x034E, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_034E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7284
-#endif
-},
-	{0x034F, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_034F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x72A7
-#endif
-},
-	{0x0350, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0350
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x72D3
-#endif
-},
-	{0x0351, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0351
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x72FB
-#endif
-},
-	{0x0352, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0352
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7320
-#endif
-},
-	{0x0353, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0353
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x734E
-#endif
-},
-	{0x0354, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 13
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0354
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7378
-#endif
-},
-	{0x0355, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 11
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0355
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7395
-#endif
-},
-	{0x0356, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 11
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0356
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x73B4
-#endif
-},
-	{0x0357, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 11
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0357
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x73CD
-#endif
-},
-	{0x0358, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 13
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0358
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x73E3
-#endif
-},
-	{0x0359, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 13
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0359
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7408
-#endif
-},
-	{0x035A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 13
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_035A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x742A
-#endif
-},
-	{0x035B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 13
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_035B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7455
-#endif
-},
-	{0x035C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 13
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_035C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7477
-#endif
-},
-	{0x035D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 13
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_035D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x74A3
-#endif
-},
-	{0x035E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 13
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_035E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x74B7
-#endif
-},
-	{0x0381, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_XURGENT, false, false, true, 13
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0381
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x74D5
-#endif
-},
-	{0x0382, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0382
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7503
-#endif
-},
-	{0x0383, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0383
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7521
-#endif
-},
-	{0x0384, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0384
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x754D
-#endif
-},
-	{0x0385, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0385
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x755F
-#endif
-},
-	{0x0386, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0386
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x757E
-#endif
-},
-	{0x0387, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0387
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x75A4
-#endif
-},
-	{0x0388, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0388
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x75B9
-#endif
-},
-	{0x0389, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0389
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x75C6
-#endif
-},
-	{0x038A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_038A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x75D8
-#endif
-},
-	{0x038B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_038B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x75F2
-#endif
-},
-	{0x038C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_038C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x75FB
-#endif
-},
-	{0x038D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_038D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x760C
-#endif
-},
-	{0x038E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_038E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7619
-#endif
-},
-	{0x038F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_038F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7630
-#endif
-},
-	{0x0390, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0390
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x763B
-#endif
-},
-	{0x0391, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0391
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x764A
-#endif
-},
-	{0x0392, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0392
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7654
-#endif
-},
-	{0x0393, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0393
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x765E
-#endif
-},
-	{0x0394, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0394
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7670
-#endif
-},
-	{0x0395, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0395
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x768F
-#endif
-},
-	{0x0396, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0396
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x769A
-#endif
-},
-	{0x0397, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0397
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x76B2
-#endif
-},
-	{0x0398, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0398
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x76C3
-#endif
-},
-	{0x0399, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0399
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x76CC
-#endif
-},
-	{0x039A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 13
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_039A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x76D9
-#endif
-},
-	{0x039B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 13
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_039B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x76EC
-#endif
-},
-	{0x039C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 4
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_039C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7708
-#endif
-},
-	{0x039D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_039D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7717
-#endif
-},
-	{0x039E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_039E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x772F
-#endif
-},
-	{0x039F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_039F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x774C
-#endif
-},
-	{0x03A0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03A0
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7774
-#endif
-},
-	{0x03A1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03A1
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7791
-#endif
-},
-	{0x03A2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03A2
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x77B8
-#endif
-},
-	{0x03A3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03A3
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x77D2
-#endif
-},
-	{0x03A4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03A4
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x77F6
-#endif
-},
-	{0x03A5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03A5
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x780D
-#endif
-},
-	{0x03A6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03A6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x782D
-#endif
-},
-	{0x03A7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03A7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7845
-#endif
-},
-	{0x03A8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03A8
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7866
-#endif
-},
-	{0x03A9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03A9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7887
-#endif
-},
-	{0x03AA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03AA
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x78A5
-#endif
-},
-	{0x03AB, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03AB
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x78BC
-#endif
-},
-	{0x03AC, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03AC
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x78D2
-#endif
-},
-	{0x03AD, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03AD
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x78F1
-#endif
-},
-	{0x03AE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03AE
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x790C
-#endif
-},
-	{0x03AF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03AF
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7929
-#endif
-},
-	{0x03B0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03B0
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7942
-#endif
-},
-	{0x03B1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03B1
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x797B
-#endif
-},
-	{0x03B2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03B2
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7993
-#endif
-},
-	{0x03B3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03B3
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x79B1
-#endif
-},
-	{0x03B4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03B4
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x79CE
-#endif
-},
-	{0x03B5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03B5
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x79EC
-#endif
-},
-	{0x03B6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03B6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7A05
-#endif
-},
-	{0x03B7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03B7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7A2F
-#endif
-},
-	{0x03B8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03B8
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7A6B
-#endif
-},
-	{0x03B9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03B9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7AA8
-#endif
-},
-	{0x03BA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03BA
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7AE7
-#endif
-},
-	{0x03BB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03BB
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7B0B
-#endif
-},
-	{0x03BC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03BC
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7B2A
-#endif
-},
-	{0x03BD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03BD
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7B47
-#endif
-},
-	{0x03BE, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03BE
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7B6B
-#endif
-},
-	{0x03BF, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03BF
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7B89
-#endif
-},
-	{0x03C0, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03C0
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7BB0
-#endif
-},
-	{0x03C1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03C1
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7BD3
-#endif
-},
-	{0x03C2, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03C2
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7BEA
-#endif
-},
-	{0x03C3, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03C3
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7C00
-#endif
-},
-	{0x03C4, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03C4
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7C1F
-#endif
-},
-	{0x03C5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03C5
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7C3A
-#endif
-},
-	{0x03C6, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03C6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7C55
-#endif
-},
-	{0x03C7, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03C7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7C6F
-#endif
-},
-	{0x03C8, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03C8
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7C92
-#endif
-},
-	{0x03C9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03C9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7CB1
-#endif
-},
-	{0x03CA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03CA
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7CCB
-#endif
-},
-	{0x03CB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03CB
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7CDB
-#endif
-},
-	{0x03CC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03CC
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7CED
-#endif
-},
-	{0x03CD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03CD
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7D03
-#endif
-},
-	{0x03CE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03CE
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7D17
-#endif
-},
-	{0x03CF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03CF
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7D26
-#endif
-},
-	{0x03D0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03D0
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7D33
-#endif
-},
-	{0x03D1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03D1
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7D3D
-#endif
-},
-	{0x03D2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03D2
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7D48
-#endif
-},
-	{0x03D3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03D3
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7D52
-#endif
-},
-	{0x03D4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03D4
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7D5D
-#endif
-},
-	{0x03D5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03D5
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7D88
-#endif
-},
-	{0x03D6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03D6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7DBA
-#endif
-},
-	{0x03D7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03D7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7DDD
-#endif
-},
-	{0x03D8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03D8
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7E06
-#endif
-},
-	{0x03D9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03D9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7E23
-#endif
-},
-	{0x03DA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03DA
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7E44
-#endif
-},
-	{0x03DB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03DB
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7E59
-#endif
-},
-	{0x03DC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03DC
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7E78
-#endif
-},
-	{0x03DD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03DD
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7EA0
-#endif
-},
-	{0x03DE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03DE
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7EBC
-#endif
-},
-	{0x03DF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03DF
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7ED3
-#endif
-},
-	{0x03E0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03E0
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7EE8
-#endif
-},
-	{0x03E1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03E1
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7EFB
-#endif
-},
-	{0x03E2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03E2
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7F18
-#endif
-},
-	{0x03E3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03E3
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7F2F
-#endif
-},
-	{0x03E4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03E4
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7F4A
-#endif
-},
-	{0x03E5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03E5
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7F85
-#endif
-},
-	{0x03E6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03E6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7FAC
-#endif
-},
-	{0x03E7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03E7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7FBE
-#endif
-},
-	{0x03E8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03E8
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7FD0
-#endif
-},
-	{0x03E9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03E9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7FEA
-#endif
-},
-	{0x03EA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03EA
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8021
-#endif
-},
-	{0x03EB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03EB
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8037
-#endif
-},
-	{0x03EC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03EC
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x805F
-#endif
-},
-	{0x03ED, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03ED
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x806B
-#endif
-},
-	{0x03EE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03EE
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x807A
-#endif
-},
-	{0x03EF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03EF
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8098
-#endif
-},
-	{0x03F0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03F0
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x80C0
-#endif
-},
-	{0x03F1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03F1
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x80E4
-#endif
-},
-	{0x03F2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03F2
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x810C
-#endif
-},
-	{0x03F3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03F3
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8138
-#endif
-},
-	{0x03F4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03F4
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8158
-#endif
-},
-	{0x03F5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03F5
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8183
-#endif
-},
-	{0x03F6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03F6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x81A9
-#endif
-},
-	{0x03F7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03F7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x81CE
-#endif
-},
-	{0x03F8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03F8
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x81F2
-#endif
-},
-	{0x03F9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03F9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8218
-#endif
-},
-	{0x03FA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03FA
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x823C
-#endif
-},
-	{0x03FB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03FB
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8270
-#endif
-},
-	{0x03FC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03FC
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x82A5
-#endif
-},
-	{0x03FD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03FD
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x82D4
-#endif
-},
-	{0x03FE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03FE
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8316
-#endif
-},
-	{0x03FF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03FF
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8359
-#endif
-},
-	{0x0400, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0400
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x839E
-#endif
-},
-	{0x0401, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0401
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x83C2
-#endif
-},
-	{0x0402, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0402
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x83D4
-#endif
-},
-	{0x0403, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0403
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x83E7
-#endif
-},
-	{0x0404, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0404
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8403
-#endif
-},
-	{0x0405, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0405
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8428
-#endif
-},
-	{0x0406, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0406
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8449
-#endif
-},
-	{0x0407, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0407
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8460
-#endif
-},
-	{0x0408, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0408
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8479
-#endif
-},
-	{0x0409, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0409
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x848A
-#endif
-},
-	{0x040A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 4
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_040A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x849F
-#endif
-},
-	{0x040B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_040B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x84B6
-#endif
-},
-	{0x040C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_040C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x84DB
-#endif
-},
-	{0x040D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_040D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8507
-#endif
-},
-	{0x040E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_040E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8548
-#endif
-},
-	{0x040F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_040F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x857F
-#endif
-},
-	{0x0410, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0410
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x85AC
-#endif
-},
-	{0x0411, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0411
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x85CF
-#endif
-},
-	{0x0412, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0412
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x85E4
-#endif
-},
-	{0x0413, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0413
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x85F7
-#endif
-},
-	{0x0414, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0414
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8607
-#endif
-},
-	{0x0415, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0415
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8613
-#endif
-},
-	{0x0416, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 34
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0416
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8622
-#endif
-},
-	{0x0417, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0417
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8649
-#endif
-},
-	{0x0418, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0418
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x866F
-#endif
-},
-	{0x0419, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 34
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0419
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x869F
-#endif
-},
-	{0x041A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_041A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x86CE
-#endif
-},
-	{0x041B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 34
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_041B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x86FC
-#endif
-},
-	{0x041C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 34
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_041C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8729
-#endif
-},
-	{0x041D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 34
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_041D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x875A
-#endif
-},
-	{0x041E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_041E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8789
-#endif
-},
-	{0x041F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_041F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x87AF
-#endif
-},
-	{0x0420, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0420
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x87C3
-#endif
-},
-	{0x0421, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0421
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x87DB
-#endif
-},
-	{0x0422, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0422
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x87EF
-#endif
-},
-	{0x0423, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0423
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8806
-#endif
-},
-	{0x0424, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0424
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x882D
-#endif
-},
-	{0x0425, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0425
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x885E
-#endif
-},
-	{0x0426, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0426
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8899
-#endif
-},
-	{0x0427, RDS_TMC_QUANTIFIER_TONNES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0427
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x88ED
-#endif
-},
-	{0x0428, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0428
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8915
-#endif
-},
-	{0x0429, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0429
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8955
-#endif
-},
-	{0x042A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 4
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_042A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8971
-#endif
-},
-	{0x042B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 13
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_042B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x899E
-#endif
-},
-	{0x042C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 13
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_042C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x89B7
-#endif
-},
-	{0x042D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_042D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x89D3
-#endif
-},
-	{0x042E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_042E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x89E7
-#endif
-},
-	{0x042F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 34
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_042F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x89F4
-#endif
-},
-	{0x0430, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 34
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0430
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8A17
-#endif
-},
-	{0x0431, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0431
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8A29
-#endif
-},
-	{0x0432, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0432
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8A73
-#endif
-},
-	{0x0433, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0433
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8AA4
-#endif
-},
-	{0x0437, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 15
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0437
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8AE3
-#endif
-},
-	{0x0438, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 15
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0438
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8B07
-#endif
-},
-	{0x0439, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 15
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0439
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8B1F
-#endif
-},
-	{0x043A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 15
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_043A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8B34
-#endif
-},
-	{0x043B, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 15
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_043B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8B4E
-#endif
-},
-	{0x043C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_043C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8B67
-#endif
-},
-	{0x043D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_043D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8B72
-#endif
-},
-	{0x043E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_043E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8B7E
-#endif
-},
-	{0x0442, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0442
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8B99
-#endif
-},
-	{0x044D, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_044D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8BB2
-#endif
-},
-	{0x044E, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_044E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8BC6
-#endif
-},
-	{0x044F, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_044F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8BF7
-#endif
-},
-	{0x0450, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0450
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8C28
-#endif
-},
-	{0x0451, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0451
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8C36
-#endif
-},
-	{0x0452, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0452
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8C62
-#endif
-},
-	{0x0453, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0453
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8C82
-#endif
-},
-	{0x0454, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0454
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8CA3
-#endif
-},
-	{0x0455, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0455
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8CCC
-#endif
-},
-	{0x0456, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0456
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8CDC
-#endif
-},
-	{0x0457, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0457
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8D09
-#endif
-},
-	{0x0458, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0458
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8D36
-#endif
-},
-	{0x0459, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0459
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8D40
-#endif
-},
-	{0x045A, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_045A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8D68
-#endif
-},
-	{0x045B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 15
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_045B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8D8B
-#endif
-},
-	{0x045C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 15
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_045C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8D97
-#endif
-},
-	{0x045D, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_045D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8D9D
-#endif
-},
-	{0x045E, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_045E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8DC2
-#endif
-},
-	{0x045F, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_045F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8DE4
-#endif
-},
-	{0x0460, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0460
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8E06
-#endif
-},
-	{0x0461, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0461
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8E28
-#endif
-},
-	{0x0462, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0462
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8E4A
-#endif
-},
-	{0x0463, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0463
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8E6C
-#endif
-},
-	{0x0464, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0464
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8E93
-#endif
-},
-	{0x0465, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0465
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8EB3
-#endif
-},
-	{0x0466, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0466
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8EE6
-#endif
-},
-	{0x0467, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 15
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0467
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8F01
-#endif
-},
-	{0x0468, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0468
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8F13
-#endif
-},
-	{0x0469, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 33
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0469
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8F3B
-#endif
-},
-	{0x046A, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_046A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8F5C
-#endif
-},
-	{0x046B, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 33
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_046B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8F80
-#endif
-},
-	{0x046C, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_046C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8F9D
-#endif
-},
-	{0x046D, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 33
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_046D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8FC6
-#endif
-},
-	{0x046E, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_046E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8FE8
-#endif
-},
-	{0x046F, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_046F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9013
-#endif
-},
-	{0x0470, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0470
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9038
-#endif
-},
-	{0x0471, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0471
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x905F
-#endif
-},
-	{0x0472, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 33
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0472
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9080
-#endif
-},
-	{0x0473, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 33
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0473
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x90A2
-#endif
-},
-	{0x0474, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 33
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0474
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x90B4
-#endif
-},
-	{0x0475, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 33
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0475
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x90CF
-#endif
-},
-	{0x0477, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 34
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0477
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x90E6
-#endif
-},
-	{0x047F, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 33
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_047F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9117
-#endif
-},
-	{0x0480, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0480
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x913A
-#endif
-},
-	{0x0481, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0481
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9157
-#endif
-},
-	{0x0482, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0482
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9170
-#endif
-},
-	{0x0483, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0483
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x918A
-#endif
-},
-	{0x0484, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0484
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x91AC
-#endif
-},
-	{0x0485, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0485
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x91CB
-#endif
-},
-	{0x0486, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0486
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x91E4
-#endif
-},
-	{0x0487, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0487
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9200
-#endif
-},
-	{0x0488, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0488
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9220
-#endif
-},
-	{0x048D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_048D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x923A
-#endif
-},
-	{0x048E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_048E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9250
-#endif
-},
-	{0x0492, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0492
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9266
-#endif
-},
-	{0x0493, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0493
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9283
-#endif
-},
-	{0x0494, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0494
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x929C
-#endif
-},
-	{0x0495, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0495
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x92B8
-#endif
-},
-	{0x0496, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0496
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x92EA
-#endif
-},
-	{0x0497, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0497
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9321
-#endif
-},
-	{0x0498, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0498
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9345
-#endif
-},
-	{0x0499, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0499
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9395
-#endif
-},
-	{0x049A, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_049A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x93C8
-#endif
-},
-	{0x049B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_049B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x93FC
-#endif
-},
-	{0x049C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_049C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x941B
-#endif
-},
-	{0x04A6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 17
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04A6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x943D
-#endif
-},
-	{0x04A7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 17
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04A7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9449
-#endif
-},
-	{0x04B1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 17
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04B1
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9462
-#endif
-},
-	{0x04B2, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 17
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04B2
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x946C
-#endif
-},
-	{0x04B3, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 17
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04B3
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9487
-#endif
-},
-	{0x04B4, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 17
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04B4
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9492
-#endif
-},
-	{0x04B5, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 17
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04B5
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x94A9
-#endif
-},
-	{0x04B6, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 36
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04B6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x94BB
-#endif
-},
-	{0x04B7, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 36
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04B7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x94CF
-#endif
-},
-	{0x04B8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 36
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04B8
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x94E0
-#endif
-},
-	{0x04B9, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 17
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04B9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x94ED
-#endif
-},
-	{0x04BA, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 17
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04BA
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x94FE
-#endif
-},
-	{0x04BB, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 17
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04BB
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x950E
-#endif
-},
-	{0x04BC, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04BC
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x953E
-#endif
-},
-	{0x04BD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 17
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04BD
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9576
-#endif
-},
-	{0x04BE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 17
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04BE
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x958A
-#endif
-},
-	{0x04BF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, true, true, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04BF
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x959C
-#endif
-},
-	{0x04C0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 36
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04C0
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x95C8
-#endif
-},
-	{0x04C1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 17
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04C1
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x95E0
-#endif
-},
-	{0x04C2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 36
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04C2
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x95F6
-#endif
-},
-	{0x04C3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 36
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04C3
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x960E
-#endif
-},
-	{0x04E3, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 36
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04E3
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9620
-#endif
-},
-	{0x04E4, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 36
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04E4
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x963E
-#endif
-},
-	{0x04E5, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 36
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04E5
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9659
-#endif
-},
-	{0x04E6, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 36
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04E6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9664
-#endif
-},
-	{0x04E7, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 36
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04E7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x967B
-#endif
-},
-	{0x04E8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 36
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04E8
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x968D
-#endif
-},
-	{0x0514, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 33
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0514
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x96AC
-#endif
-},
-	{0x0515, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0515
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x96E1
-#endif
-},
-	{0x0516, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0516
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9706
-#endif
-},
-	{0x0517, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0517
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x972D
-#endif
-},
-	{0x0518, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0518
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9754
-#endif
-},
-	{0x0519, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0519
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9773
-#endif
-},
-	{0x051A, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_051A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9795
-#endif
-},
-	{0x051B, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_051B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x97AD
-#endif
-},
-	{0x051C, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_051C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x97D3
-#endif
-},
-	{0x051D, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_051D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x97FB
-#endif
-},
-	{0x051E, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_051E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9823
-#endif
-},
-	{0x051F, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 35
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_051F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x984B
-#endif
-},
-	{0x0520, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0520
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9878
-#endif
-},
-	{0x0521, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0521
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x98A4
-#endif
-},
-	{0x0522, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0522
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x98B8
-#endif
-},
-	{0x0523, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 33
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0523
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x98CA
-#endif
-},
-	{0x0524, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0524
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x98E8
-#endif
-},
-	{0x0525, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 33
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0525
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9907
-#endif
-},
-	{0x0526, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0526
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9928
-#endif
-},
-	{0x0527, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0527
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9943
-#endif
-},
-	{0x0528, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0528
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x995F
-#endif
-},
-	{0x0529, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0529
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x997B
-#endif
-},
-	{0x052A, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_052A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9998
-#endif
-},
-	{0x052B, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_052B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x99BD
-#endif
-},
-	{0x052C, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_052C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x99E5
-#endif
-},
-	{0x052D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_052D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9A0D
-#endif
-},
-	{0x052E, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_052E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9A1B
-#endif
-},
-	{0x052F, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 33
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_052F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9A41
-#endif
-},
-	{0x0530, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 35
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0530
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9A60
-#endif
-},
-	{0x0531, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 35
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0531
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9A86
-#endif
-},
-	{0x0532, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 35
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0532
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9AAC
-#endif
-},
-	{0x0533, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 35
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0533
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9AD2
-#endif
-},
-	{0x0534, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0534
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9AFD
-#endif
-},
-	{0x0535, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 35
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0535
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9B08
-#endif
-},
-	{0x0536, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 35
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0536
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9B21
-#endif
-},
-	{0x0537, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 35
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0537
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9B48
-#endif
-},
-	{0x0538, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 35
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0538
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9B71
-#endif
-},
-	{0x0539, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0539
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9B97
-#endif
-},
-	{0x053A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_053A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9BCF
-#endif
-},
-	{0x053B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 35
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_053B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9BF3
-#endif
-},
-	{0x053C, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_053C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9C08
-#endif
-},
-	{0x0541, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0541
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9C35
-#endif
-},
-	{0x0542, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 16
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0542
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9C42
-#endif
-},
-	{0x0547, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0547
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9C59
-#endif
-},
-	{0x0548, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0548
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9C75
-#endif
-},
-	{0x0549, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0549
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9C93
-#endif
-},
-	{0x054A, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_054A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9CB2
-#endif
-},
-	{0x054B, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_054B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9CD1
-#endif
-},
-	{0x054C, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_054C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9CF0
-#endif
-},
-	{0x054D, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_054D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9D0F
-#endif
-},
-	{0x054E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 37
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_054E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9D33
-#endif
-},
-	{0x054F, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_054F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9D45
-#endif
-},
-	{0x0550, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0550
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9D60
-#endif
-},
-	{0x0551, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0551
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9D84
-#endif
-},
-	{0x0552, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0552
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9D95
-#endif
-},
-	{0x0554, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0554
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9DC1
-#endif
-},
-	{0x0555, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0555
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9DD9
-#endif
-},
-	{0x0579, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0579
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9DEE
-#endif
-},
-	{0x057A, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_057A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9E0A
-#endif
-},
-	{0x057B, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_057B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9E2D
-#endif
-},
-	{0x057C, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_057C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9E4B
-#endif
-},
-	{0x057D, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_057D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9E69
-#endif
-},
-	{0x057E, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_057E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9E87
-#endif
-},
-	{0x057F, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_057F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9EA5
-#endif
-},
-	{0x0580, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0580
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9EC8
-#endif
-},
-	{0x05A9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05A9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9EEB
-#endif
-},
-	{0x05AA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05AA
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9F0A
-#endif
-},
-	{0x05AB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05AB
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9F27
-#endif
-},
-	{0x05AC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05AC
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9F2D
-#endif
-},
-	{0x05AD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05AD
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9F38
-#endif
-},
-	{0x05AE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05AE
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9F4A
-#endif
-},
-	{0x05AF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05AF
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9F54
-#endif
-},
-	{0x05B0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05B0
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9F66
-#endif
-},
-	{0x05B1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05B1
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9F71
-#endif
-},
-	{0x05B2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05B2
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9F7F
-#endif
-},
-	{0x05B3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05B3
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9F8A
-#endif
-},
-	{0x05B4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05B4
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9F99
-#endif
-},
-	{0x05B5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05B5
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9FA9
-#endif
-},
-	{0x05B6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05B6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9FB2
-#endif
-},
-	{0x05B7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05B7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9FBF
-#endif
-},
-	{0x05B8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05B8
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9FCB
-#endif
-},
-	{0x05B9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05B9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9FD8
-#endif
-},
-	{0x05BA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05BA
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9FEA
-#endif
-},
-	{0x05BB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05BB
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9FFF
-#endif
-},
-	{0x05BC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05BC
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA015
-#endif
-},
-	{0x05BD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05BD
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA01D
-#endif
-},
-	{0x05BE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05BE
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA028
-#endif
-},
-	{0x05BF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 13
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05BF
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA033
-#endif
-},
-	{0x05C0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 13
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05C0
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA051
-#endif
-},
-	{0x05C1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 13
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05C1
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA063
-#endif
-},
-	{0x05C2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 13
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05C2
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA077
-#endif
-},
-	{0x05C3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05C3
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA08B
-#endif
-},
-	{0x05C4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 19
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05C4
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA092
-#endif
-},
-	{0x05C5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 19
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05C5
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA0A4
-#endif
-},
-	{0x05C6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 19
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05C6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA0B6
-#endif
-},
-	{0x05C7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_XURGENT, false, true, true, 19
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05C7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA0C9
-#endif
-},
-	{0x05C8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 19
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05C8
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA0E4
-#endif
-},
-	{0x05C9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_XURGENT, false, true, true, 19
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05C9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA0F4
-#endif
-},
-	{0x05CA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 13
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05CA
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA105
-#endif
-},
-	{0x05CB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 13
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05CB
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA11F
-#endif
-},
-	{0x05CC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 13
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05CC
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA13B
-#endif
-},
-	{0x05CD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05CD
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA157
-#endif
-},
-	{0x05CE, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05CE
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA177
-#endif
-},
-	{0x05CF, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05CF
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA196
-#endif
-},
-	{0x05D0, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05D0
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA1BE
-#endif
-},
-	{0x05D1, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05D1
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA1E2
-#endif
-},
-	{0x05D2, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05D2
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA201
-#endif
-},
-	{0x05D3, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05D3
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA229
-#endif
-},
-	{0x05D4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 19
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05D4
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA24D
-#endif
-},
-	{0x05D5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05D5
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA266
-#endif
-},
-	{0x05D6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 19
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05D6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA27D
-#endif
-},
-	{0x05D7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05D7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA288
-#endif
-},
-	{0x05D8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05D8
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA2A2
-#endif
-},
-	{0x05D9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05D9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA2BD
-#endif
-},
-	{0x05DA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 13
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05DA
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA2DB
-#endif
-},
-	{0x05DB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 13
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05DB
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA2F3
-#endif
-},
-	{0x05DC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_XURGENT, false, false, true, 19
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05DC
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA30D
-#endif
-},
-	{0x05DD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05DD
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA329
-#endif
-},
-	{0x05DE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05DE
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA335
-#endif
-},
-	{0x05DF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05DF
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA34A
-#endif
-},
-	{0x05E0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05E0
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA34F
-#endif
-},
-	{0x05E1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05E1
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA358
-#endif
-},
-	{0x05E2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05E2
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA363
-#endif
-},
-	{0x05E3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05E3
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA368
-#endif
-},
-	{0x05E4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05E4
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA36F
-#endif
-},
-	{0x05E5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05E5
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA380
-#endif
-},
-	{0x05E6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05E6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA38F
-#endif
-},
-	{0x05E7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05E7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA396
-#endif
-},
-	{0x05E8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05E8
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA39C
-#endif
-},
-	{0x05E9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05E9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA3A2
-#endif
-},
-	{0x05EA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05EA
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA3B0
-#endif
-},
-	{0x05EB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 19
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05EB
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA3C3
-#endif
-},
-	{0x05EC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 19
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05EC
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA3D2
-#endif
-},
-	{0x05ED, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05ED
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA3DD
-#endif
-},
-	{0x05EE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05EE
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA3FD
-#endif
-},
-	{0x05EF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05EF
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA427
-#endif
-},
-	{0x05F0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05F0
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA444
-#endif
-},
-	{0x05F1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05F1
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA46B
-#endif
-},
-	{0x05F2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05F2
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA485
-#endif
-},
-	{0x05F3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05F3
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA4A8
-#endif
-},
-	{0x05F4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05F4
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA4C3
-#endif
-},
-	{0x05F5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05F5
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA4E7
-#endif
-},
-	{0x05F6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05F6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA50B
-#endif
-},
-	{0x05F7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05F7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA52C
-#endif
-},
-	{0x05F8, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05F8
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA546
-#endif
-},
-	{0x05F9, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05F9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA55F
-#endif
-},
-	{0x05FA, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05FA
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA581
-#endif
-},
-	{0x05FB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05FB
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA59F
-#endif
-},
-	{0x05FC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05FC
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA5C2
-#endif
-},
-	{0x05FD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05FD
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA5EF
-#endif
-},
-	{0x05FE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05FE
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA60F
-#endif
-},
-	{0x05FF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05FF
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA639
-#endif
-},
-	{0x0600, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0600
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA656
-#endif
-},
-	{0x0601, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0601
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA67C
-#endif
-},
-	{0x0602, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0602
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA69A
-#endif
-},
-	{0x0603, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0603
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA6C1
-#endif
-},
-	{0x0604, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0604
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA6E8
-#endif
-},
-	{0x0605, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0605
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA70C
-#endif
-},
-	{0x0606, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0606
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA729
-#endif
-},
-	{0x0607, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0607
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA745
-#endif
-},
-	{0x0608, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0608
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA76A
-#endif
-},
-	{0x0609, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0609
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA78B
-#endif
-},
-	{0x060A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_060A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA7A4
-#endif
-},
-	{0x060B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_060B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA7C7
-#endif
-},
-	{0x060C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_060C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA7DD
-#endif
-},
-	{0x060D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_060D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA7FD
-#endif
-},
-	{0x060E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_060E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA810
-#endif
-},
-	{0x060F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_060F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA82C
-#endif
-},
-	{0x0610, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0610
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA840
-#endif
-},
-	{0x0611, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0611
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA85D
-#endif
-},
-	{0x0612, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0612
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA87A
-#endif
-},
-	{0x0613, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0613
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA894
-#endif
-},
-	{0x0614, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0614
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA8A7
-#endif
-},
-	{0x0615, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0615
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA8B9
-#endif
-},
-	{0x0616, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0616
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA8D4
-#endif
-},
-	{0x0617, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0617
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA8EB
-#endif
-},
-	{0x0618, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0618
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA900
-#endif
-},
-	{0x0619, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0619
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA914
-#endif
-},
-	{0x061A, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_061A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA931
-#endif
-},
-	{0x061B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_061B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA94A
-#endif
-},
-	{0x061C, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_061C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA95F
-#endif
-},
-	{0x061D, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_061D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA973
-#endif
-},
-	{0x061E, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_061E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA990
-#endif
-},
-	{0x061F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_061F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA9A9
-#endif
-},
-	{0x0620, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0620
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA9C5
-#endif
-},
-	{0x0621, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0621
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA9E0
-#endif
-},
-	{0x0622, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0622
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAA04
-#endif
-},
-	{0x0623, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0623
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAA24
-#endif
-},
-	{0x0624, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0624
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAA47
-#endif
-},
-	{0x0625, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0625
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAA74
-#endif
-},
-	{0x0626, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0626
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAA94
-#endif
-},
-	{0x0627, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0627
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAABE
-#endif
-},
-	{0x0628, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0628
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAADB
-#endif
-},
-	{0x0629, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0629
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAB01
-#endif
-},
-	{0x062A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_062A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAB1F
-#endif
-},
-	{0x062B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_062B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAB46
-#endif
-},
-	{0x062C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_062C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAB6A
-#endif
-},
-	{0x062D, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_062D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAB87
-#endif
-},
-	{0x062E, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_062E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xABA3
-#endif
-},
-	{0x062F, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_062F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xABC8
-#endif
-},
-	{0x0630, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0630
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xABE9
-#endif
-},
-	{0x0631, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0631
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAC08
-#endif
-},
-	{0x0632, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0632
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAC1A
-#endif
-},
-	{0x0633, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 19
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0633
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAC41
-#endif
-},
-	{0x0634, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 19
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0634
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAC5C
-#endif
-},
-	{0x0635, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0635
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAC76
-#endif
-},
-	{0x0636, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0636
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAC88
-#endif
-},
-	{0x0637, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0637
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAC9D
-#endif
-},
-	{0x0638, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0638
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xACCB
-#endif
-},
-	{0x0639, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0639
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xACDB
-#endif
-},
-	{0x063A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_063A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xACE9
-#endif
-},
-	{0x063B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_063B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xACF9
-#endif
-},
-	{0x063C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_063C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAD03
-#endif
-},
-	{0x063D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_063D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAD0B
-#endif
-},
-	{0x0641, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0641
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAD17
-#endif
-},
-	{0x0642, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0642
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAD23
-#endif
-},
-	{0x0643, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0643
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAD3B
-#endif
-},
-	{0x0644, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0644
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAD53
-#endif
-},
-	{0x0645, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0645
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAD69
-#endif
-},
-	{0x0646, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0646
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAD80
-#endif
-},
-	{0x0647, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0647
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAD98
-#endif
-},
-	{0x0648, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0648
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xADAD
-#endif
-},
-	{0x0649, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0649
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xADBE
-#endif
-},
-	{0x064A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_064A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xADDD
-#endif
-},
-	{0x064B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_064B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAE0B
-#endif
-},
-	{0x064C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_064C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAE39
-#endif
-},
-	{0x064D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_064D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAE65
-#endif
-},
-	{0x064E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_064E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAE92
-#endif
-},
-	{0x064F, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, true, false, 21
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_064F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAEC0
-#endif
-},
-	{0x0650, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 21
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0650
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAEDD
-#endif
-},
-	{0x0651, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 21
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0651
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAEF4
-#endif
-},
-	{0x0652, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 21
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0652
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAF11
-#endif
-},
-	{0x0653, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 21
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0653
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAF41
-#endif
-},
-	{0x0654, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0654
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAF59
-#endif
-},
-	{0x0655, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0655
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAF6B
-#endif
-},
-	{0x0656, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0656
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAF82
-#endif
-},
-	{0x0657, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0657
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAF9A
-#endif
-},
-	{0x0658, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0658
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAFB2
-#endif
-},
-	{0x0659, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0659
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAFCA
-#endif
-},
-	{0x065A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_065A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAFE2
-#endif
-},
-	{0x065B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_065B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAFFA
-#endif
-},
-	{0x065C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_065C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB012
-#endif
-},
-	{0x065D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_065D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB02B
-#endif
-},
-	{0x065E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_065E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB043
-#endif
-},
-	{0x065F, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_065F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB05B
-#endif
-},
-	{0x0660, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0660
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB071
-#endif
-},
-	{0x0661, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 21
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0661
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB08E
-#endif
-},
-	{0x0662, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 21
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0662
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB0AB
-#endif
-},
-	{0x0663, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 21
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0663
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB0B9
-#endif
-},
-	{0x0664, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 21
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0664
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB0E8
-#endif
-},
-	{0x0665, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 21
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0665
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB11F
-#endif
-},
-	{0x0666, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 21
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0666
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB148
-#endif
-},
-	{0x0667, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 21
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0667
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB16F
-#endif
-},
-	{0x0668, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 21
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0668
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB195
-#endif
-},
-	{0x0669, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 21
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0669
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB1BA
-#endif
-},
-	{0x066A, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_066A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB1E4
-#endif
-},
-	{0x066B, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_066B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB206
-#endif
-},
-	{0x066C, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 21
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_066C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB21C
-#endif
-},
-	{0x066D, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 21
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_066D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB24F
-#endif
-},
-	{0x066E, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, true, false, 22
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_066E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB276
-#endif
-},
-	{0x066F, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, true, false, 22
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_066F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB2A0
-#endif
-},
-	{0x0670, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0670
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB2BE
-#endif
-},
-	{0x0671, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 21
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0671
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB2CD
-#endif
-},
-	{0x0672, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0672
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB2FC
-#endif
-},
-	{0x0673, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 21
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0673
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB311
-#endif
-},
-	{0x0674, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 21
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0674
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB33E
-#endif
-},
-	{0x0675, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0675
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB355
-#endif
-},
-	{0x0676, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0676
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB36A
-#endif
-},
-	{0x0677, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, true, false, 21
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0677
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB384
-#endif
-},
-	{0x0678, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, true, false, 22
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0678
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB3A9
-#endif
-},
-	{0x0679, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 21
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0679
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB3BB
-#endif
-},
-	{0x067A, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 21
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_067A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB3E0
-#endif
-},
-	{0x067B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 21
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_067B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB404
-#endif
-},
-	{0x067C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 21
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_067C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB423
-#endif
-},
-	{0x067D, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 21
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_067D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB44C
-#endif
-},
-	{0x067E, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 22
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_067E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB473
-#endif
-},
-	{0x067F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_067F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB490
-#endif
-},
-	{0x0680, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 18
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0680
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB4AD
-#endif
-},
-	{0x0690, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, false, 38
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0690
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB4C7
-#endif
-},
-	{0x0691, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 38
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0691
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB4E7
-#endif
-},
-	{0x0692, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 38
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0692
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB513
-#endif
-},
-	{0x0693, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, false, 38
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0693
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB541
-#endif
-},
-	{0x0694, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 38
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0694
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB56C
-#endif
-},
-	{0x0695, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 38
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0695
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB596
-#endif
-},
-	{0x0696, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 38
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0696
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB5C3
-#endif
-},
-	{0x0697, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 38
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0697
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB5EB
-#endif
-},
-	{0x0698, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 38
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0698
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB629
-#endif
-},
-	{0x0699, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 38
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0699
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB649
-#endif
-},
-	{0x069A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 38
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_069A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB66E
-#endif
-},
-	{0x069B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 38
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_069B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB687
-#endif
-},
-	{0x069F, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 22
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_069F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB699
-#endif
-},
-	{0x06A0, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 22
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06A0
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB6B0
-#endif
-},
-	{0x06A4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06A4
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB6C8
-#endif
-},
-	{0x06A5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_XURGENT, false, true, true, 23
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06A5
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB6F0
-#endif
-},
-	{0x06A6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 23
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06A6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB715
-#endif
-},
-	{0x06A7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 23
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06A7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB737
-#endif
-},
-	{0x06A8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 23
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06A8
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB749
-#endif
-},
-	{0x06A9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 23
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06A9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB761
-#endif
-},
-	{0x06AA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 23
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06AA
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB78B
-#endif
-},
-	{0x06AB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_XURGENT, false, false, false, 23
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06AB
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB7A3
-#endif
-},
-	{0x06AC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_XURGENT, false, true, false, 23
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06AC
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB7C6
-#endif
-},
-	{0x06AD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06AD
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB7EF
-#endif
-},
-	{0x06AE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 23
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06AE
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB816
-#endif
-},
-	{0x06AF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 23
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06AF
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB83A
-#endif
-},
-	{0x06B0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 12
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06B0
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB85C
-#endif
-},
-	{0x06B8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 21
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06B8
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB869
-#endif
-},
-	{0x06B9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 21
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06B9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB881
-#endif
-},
-	{0x06C3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 24
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06C3
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB8A9
-#endif
-},
-	{0x06C4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 24
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06C4
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB8C7
-#endif
-},
-	{0x06C5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 24
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06C5
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB8E1
-#endif
-},
-	{0x06C6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 24
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06C6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB8FB
-#endif
-},
-	{0x06C7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 24
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06C7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB918
-#endif
-},
-	{0x06C8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 23
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06C8
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB93D
-#endif
-},
-	{0x06C9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 24
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06C9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB972
-#endif
-},
-	{0x06CA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 24
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06CA
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB989
-#endif
-},
-	{0x06CB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 24
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06CB
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB9A9
-#endif
-},
-	{0x06CC, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06CC
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB9C9
-#endif
-},
-	{0x06CD, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06CD
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB9F9
-#endif
-},
-	{0x06D7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 24
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06D7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBA22
-#endif
-},
-	{0x06D8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 24
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06D8
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBA38
-#endif
-},
-	{0x06D9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 24
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06D9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBA4A
-#endif
-},
-	{0x06DA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 24
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06DA
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBA5C
-#endif
-},
-	{0x06DB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 24
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06DB
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBA71
-#endif
-},
-	{0x06DC, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06DC
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBA80
-#endif
-},
-	{0x06DD, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06DD
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBA9B
-#endif
-},
-	{0x06DE, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06DE
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBABF
-#endif
-},
-	{0x06DF, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06DF
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBADF
-#endif
-},
-	{0x06E0, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06E0
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBAFA
-#endif
-},
-	{0x06E1, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06E1
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBB17
-#endif
-},
-	{0x06E2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 24
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06E2
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBB37
-#endif
-},
-	{0x06E3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 24
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06E3
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBB58
-#endif
-},
-	{0x06E4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 24
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06E4
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBB6A
-#endif
-},
-	{0x06E5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 23
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06E5
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBB87
-#endif
-},
-	{0x06E6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 24
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06E6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBBB4
-#endif
-},
-	{0x06E7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 24
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06E7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBBCC
-#endif
-},
-	{0x06E8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 23
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06E8
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBBF1
-#endif
-},
-	{0x06E9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 23
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06E9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBC38
-#endif
-},
-	{0x06EA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 24
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06EA
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBC57
-#endif
-},
-	{0x06EB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 13
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06EB
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBC66
-#endif
-},
-	{0x06F4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, false, 39
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06F4
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBC76
-#endif
-},
-	{0x06F5, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, true, false, 39
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06F5
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBC98
-#endif
-},
-	{0x06F6, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, true, true, 39
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06F6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBCBD
-#endif
-},
-	{0x06F7, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, true, true, 39
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06F7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBCF4
-#endif
-},
-	{0x06F8, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, true, true, 39
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06F8
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBD25
-#endif
-},
-	{0x06F9, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, true, true, 39
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06F9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBD54
-#endif
-},
-	{0x06FA, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, true, true, 39
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06FA
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBD8B
-#endif
-},
-	{0x06FB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 39
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06FB
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBDC0
-#endif
-},
-	{0x06FC, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, true, true, 39
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06FC
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBDE3
-#endif
-},
-	{0x06FD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 39
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06FD
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBE12
-#endif
-},
-	{0x06FE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 39
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06FE
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBE2B
-#endif
-},
-	{0x0709, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 25
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0709
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBE3D
-#endif
-},
-	{0x070A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 25
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_070A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBE5C
-#endif
-},
-	{0x070B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 25
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_070B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBE7D
-#endif
-},
-	{0x070C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 25
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_070C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBEA4
-#endif
-},
-	{0x070D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 25
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_070D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBECC
-#endif
-},
-	{0x070E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 25
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_070E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBEFC
-#endif
-},
-	{0x070F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_070F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBF13
-#endif
-},
-	{0x0710, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0710
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBF4F
-#endif
-},
-	{0x0711, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0711
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBF95
-#endif
-},
-	{0x0712, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0712
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBFCE
-#endif
-},
-	{0x0713, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0713
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC011
-#endif
-},
-	{0x0714, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0714
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC047
-#endif
-},
-	{0x0715, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0715
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC086
-#endif
-},
-	{0x0716, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0716
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC0BD
-#endif
-},
-	{0x0717, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0717
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC0FD
-#endif
-},
-	{0x0718, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0718
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC13D
-#endif
-},
-	{0x0719, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0719
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC17A
-#endif
-},
-	{0x071A, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_071A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC1A2
-#endif
-},
-	{0x071B, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_071B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC1D3
-#endif
-},
-	{0x071C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_071C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC200
-#endif
-},
-	{0x071D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_071D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC22B
-#endif
-},
-	{0x071E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_071E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC260
-#endif
-},
-	{0x071F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_071F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC288
-#endif
-},
-	{0x0720, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0720
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC2BA
-#endif
-},
-	{0x0721, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0721
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC2DF
-#endif
-},
-	{0x0722, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0722
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC30D
-#endif
-},
-	{0x0723, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0723
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC333
-#endif
-},
-	{0x0724, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0724
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC362
-#endif
-},
-	{0x0725, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0725
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC391
-#endif
-},
-	{0x0726, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0726
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC3BD
-#endif
-},
-	{0x0727, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0727
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC3E1
-#endif
-},
-	{0x0728, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0728
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC40E
-#endif
-},
-	{0x0729, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 25
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0729
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC437
-#endif
-},
-	{0x072A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 25
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_072A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC451
-#endif
-},
-	{0x072B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 25
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_072B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC474
-#endif
-},
-	{0x072C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 25
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_072C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC48D
-#endif
-},
-	{0x072D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 25
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_072D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC4B1
-#endif
-},
-	{0x072E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 25
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_072E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC4C3
-#endif
-},
-	{0x072F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 25
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_072F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC4EA
-#endif
-},
-	{0x0730, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 25
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0730
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC507
-#endif
-},
-	{0x0731, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 25
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0731
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC52A
-#endif
-},
-	{0x0732, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 25
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0732
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC555
-#endif
-},
-	{0x0733, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 25
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0733
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC576
-#endif
-},
-	{0x0734, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 25
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0734
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC5A4
-#endif
-},
-	{0x0735, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 25
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0735
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC5DA
-#endif
-},
-	{0x0736, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 25
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0736
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC60C
-#endif
-},
-	{0x0737, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 25
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0737
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC646
-#endif
-},
-	{0x0738, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 25
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0738
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC672
-#endif
-},
-	{0x0739, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 25
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0739
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC691
-#endif
-},
-	{0x073A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 25
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_073A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC6B0
-#endif
-},
-	{0x073B, RDS_TMC_QUANTIFIER_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 26
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_073B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC6D7
-#endif
-},
-	{0x073C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 26
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_073C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC6F2
-#endif
-},
-	{0x073E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_073E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC70F
-#endif
-},
-	{0x073F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_073F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC735
-#endif
-},
-	{0x0740, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0740
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC75B
-#endif
-},
-	{0x0741, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 26
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0741
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC787
-#endif
-},
-	{0x0742, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0742
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC799
-#endif
-},
-	{0x0745, RDS_TMC_QUANTIFIER_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 26
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0745
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC7B1
-#endif
-},
-	{0x0746, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 26
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0746
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC7CD
-#endif
-},
-	{0x0747, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 25
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0747
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC7EB
-#endif
-},
-	{0x0748, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 25
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0748
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC814
-#endif
-},
-	{0x0749, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 25
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0749
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC843
-#endif
-},
-	{0x074A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 25
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_074A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC888
-#endif
-},
-	{0x074B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 25
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_074B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC8D0
-#endif
-},
-	{0x074C, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_074C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC900
-#endif
-},
-	{0x074D, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_074D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC930
-#endif
-},
-	{0x074E, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_074E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC969
-#endif
-},
-	{0x074F, RDS_TMC_QUANTIFIER_TONNES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 26
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_074F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC99E
-#endif
-},
-	{0x0750, RDS_TMC_QUANTIFIER_TONNES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 26
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0750
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC9BD
-#endif
-},
-	{0x0751, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 26
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0751
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC9DF
-#endif
-},
-	{0x0752, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 26
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0752
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCA03
-#endif
-},
-	{0x0753, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 25
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0753
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCA26
-#endif
-},
-	{0x0754, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0754
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCA5E
-#endif
-},
-	{0x0755, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0755
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCA90
-#endif
-},
-	{0x0756, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0756
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCACB
-#endif
-},
-	{0x0757, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 25
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0757
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCB02
-#endif
-},
-	{0x0758, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0758
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCB3C
-#endif
-},
-	{0x0759, RDS_TMC_QUANTIFIER_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 26
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0759
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCB75
-#endif
-},
-	{0x075A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 26
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_075A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCB91
-#endif
-},
-	{0x075B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 27
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_075B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCBAF
-#endif
-},
-	{0x075C, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_075C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCBC1
-#endif
-},
-	{0x075D, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_075D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCC03
-#endif
-},
-	{0x075E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 27
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_075E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCC41
-#endif
-},
-	{0x075F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 27
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_075F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCC64
-#endif
-},
-	{0x0760, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0760
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCC8A
-#endif
-},
-	{0x0761, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0761
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCC93
-#endif
-},
-	{0x0762, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0762
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCC9C
-#endif
-},
-	{0x0763, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0763
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCCA5
-#endif
-},
-	{0x0764, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0764
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCCAE
-#endif
-},
-	{0x0765, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0765
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCCB7
-#endif
-},
-	{0x0766, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0766
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCCC0
-#endif
-},
-	{0x0767, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0767
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCCC9
-#endif
-},
-	{0x0768, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0768
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCCD2
-#endif
-},
-	{0x0769, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0769
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCCDB
-#endif
-},
-	{0x076A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_076A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCD01
-#endif
-},
-	{0x076B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_076B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCD27
-#endif
-},
-	{0x076C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_076C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCD4D
-#endif
-},
-	{0x076D, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, true, false, 22
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_076D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCD73
-#endif
-},
-	{0x076E, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, true, false, 22
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_076E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCD87
-#endif
-},
-	{0x076F, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 28
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_076F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCDAE
-#endif
-},
-	{0x0770, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 28
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0770
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCDC1
-#endif
-},
-	{0x0771, RDS_TMC_QUANTIFIER_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0771
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCDD9
-#endif
-},
-	{0x0772, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 21
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0772
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCE05
-#endif
-},
-	{0x0773, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 31
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0773
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCE30
-#endif
-},
-	{0x0774, RDS_TMC_QUANTIFIER_MHZ, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 29
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0774
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCE3D
-#endif
-},
-	{0x0775, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, true, false, 29
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0775
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCE5B
-#endif
-},
-	{0x0776, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, true, true, false, 29
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0776
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCEB3
-#endif
-},
-	{0x0777, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 29
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0777
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCF08
-#endif
-},
-	{0x0779, RDS_TMC_QUANTIFIER_KHZ, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 29
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0779
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCF1A
-#endif
-},
-	{0x077A, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 30
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_077A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCF38
-#endif
-},
-	{0x077B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 31
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_077B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCF5C
-#endif
-},
-	{0x077C, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 30
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_077C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCF9E
-#endif
-},
-	{0x077D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 25
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_077D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCFDC
-#endif
-},
-	{0x077E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 28
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_077E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD00C
-#endif
-},
-	{0x0780, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0780
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD011
-#endif
-},
-	{0x0781, RDS_TMC_QUANTIFIER_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0781
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD035
-#endif
-},
-	{0x0782, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, true, 28
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0782
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD053
-#endif
-},
-	{0x0783, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 28
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0783
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD06E
-#endif
-},
-	{0x0784, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 28
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0784
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD091
-#endif
-},
-	{0x0785, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0785
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD0AC
-#endif
-},
-	{0x0786, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 28
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0786
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD0DE
-#endif
-},
-	{0x0787, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 27
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0787
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD0FA
-#endif
-},
-	{0x0788, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 27
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0788
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD110
-#endif
-},
-	{0x0789, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, true, true, 29
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0789
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD134
-#endif
-},
-	{0x078A, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 30
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_078A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD17C
-#endif
-},
-	{0x078B, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, true, true, 29
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_078B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD1A6
-#endif
-},
-	{0x078C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 30
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_078C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD1F0
-#endif
-},
-	{0x078E, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_078E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD228
-#endif
-},
-	{0x0792, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0792
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD25A
-#endif
-},
-	{0x0793, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 30
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0793
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD284
-#endif
-},
-	{0x0794, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 30
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0794
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD2B4
-#endif
-},
-	{0x0795, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 30
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0795
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD2F7
-#endif
-},
-	{0x0796, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 30
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0796
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD337
-#endif
-},
-	{0x0797, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 30
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0797
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD382
-#endif
-},
-	{0x0798, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 30
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0798
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD3C2
-#endif
-},
-	{0x0799, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 30
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0799
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD3EF
-#endif
-},
-	{0x079A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 30
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_079A
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD421
-#endif
-},
-	{0x079B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 30
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_079B
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD450
-#endif
-},
-	{0x079C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 30
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_079C
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD48A
-#endif
-},
-	{0x079D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 30
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_079D
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD4C1
-#endif
-},
-	{0x079E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 30
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_079E
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD4F6
-#endif
-},
-	{0x079F, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 30
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_079F
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD51A
-#endif
-},
-	{0x07A0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 30
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07A0
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD54A
-#endif
-},
-	{0x07A1, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 30
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07A1
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD574
-#endif
-},
-	{0x07A2, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, true, true, 30
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07A2
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD5A0
-#endif
-},
-	{0x07A3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 29
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07A3
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD5C7
-#endif
-},
-	{0x07A4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 30
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07A4
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD5F5
-#endif
-},
-	{0x07A5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 30
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07A5
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD625
-#endif
-},
-	{0x07A9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07A9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD66C
-#endif
-},
-	{0x07AA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 10
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07AA
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD6A1
-#endif
-},
-	{0x07AB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 10
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07AB
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD6C9
-#endif
-},
-	{0x07AC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 30
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07AC
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD6F7
-#endif
-},
-	{0x07AD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 30
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07AD
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD71E
-#endif
-},
-	{0x07AE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 30
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07AE
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD73F
-#endif
-},
-	{0x07AF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 30
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07AF
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD76F
-#endif
-},
-	{0x07B3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07B3
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD799
-#endif
-},
-	{0x07B4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07B4
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD7B2
-#endif
-},
-	{0x07B5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07B5
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD7D5
-#endif
-},
-	{0x07B6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07B6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD7FE
-#endif
-},
-	{0x07B7, RDS_TMC_QUANTIFIER_TONNES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07B7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD81F
-#endif
-},
-	{0x07B8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07B8
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD852
-#endif
-},
-	{0x07B9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07B9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD868
-#endif
-},
-	{0x07BA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07BA
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD8A3
-#endif
-},
-	{0x07BB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07BB
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD8D1
-#endif
-},
-	{0x07BC, RDS_TMC_QUANTIFIER_TONNES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07BC
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD905
-#endif
-},
-	{0x07BD, RDS_TMC_QUANTIFIER_TONNES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07BD
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD937
-#endif
-},
-	{0x07BE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 6
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07BE
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD985
-#endif
-},
-	{0x07BF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 25
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07BF
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD994
-#endif
-},
-	{0x07C1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07C1
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD9A2
-#endif
-},
-	{0x07C2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07C2
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD9C0
-#endif
-},
-	{0x07C6, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07C6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD9E7
-#endif
-},
-	{0x07C7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 13
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07C7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDA02
-#endif
-},
-	{0x07C9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 28
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07C9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDA28
-#endif
-},
-	{0x07CA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 28
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07CA
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDA4C
-#endif
-},
-	{0x07CB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 28
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07CB
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDA6E
-#endif
-},
-	{0x07CE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 7
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07CE
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDA92
-#endif
-},
-	{0x07CF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 8
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07CF
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDAB8
-#endif
-},
-	{0x07D0, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, true, true, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07D0
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDADF
-#endif
-},
-	{0x07D6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 10
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07D6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDB03
-#endif
-},
-	{0x07D7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 10
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07D7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDB36
-#endif
-},
-	{0x07DD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07DD
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDB61
-#endif
-},
-	{0x07E5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 21
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07E5
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDB73
-#endif
-},
-	{0x07E6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 21
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07E6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDBA7
-#endif
-},
-	{0x07EC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 4
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07EC
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDBBF
-#endif
-},
-	{0x07ED, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 10
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07ED
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDBD1
-#endif
-},
-	{0x07EE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 13
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07EE
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDBE3
-#endif
-},
-	{0x07F0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 35
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07F0
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDBF5
-#endif
-},
-	{0x07F1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 19
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07F1
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDC07
-#endif
-},
-	{0x07F2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 21
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07F2
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDC19
-#endif
-},
-	{0x07F3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 22
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07F3
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDC2B
-#endif
-},
-	{0x07F6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 28
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07F6
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDC3D
-#endif
-},
-	{0x07F7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 30
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07F7
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDC4F
-#endif
-},
-	{0x07F8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 31
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07F8
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDC61
-#endif
-},
-	{0x07F9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, true, true, 31
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07F9
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDC73
-#endif
-},
-	{0x07FA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 13
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07FA
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDC85
-#endif
-},
-	{0x07FB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07FB
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDCA5
-#endif
-},
-	{0x07FC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07FC
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDCB1
-#endif
-},
-	{0x07FD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07FD
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDCC8
-#endif
-},
-	{0x07FE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 9
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07FE
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDCD5
-#endif
-},
-	{0x07FF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, true, true, 31
-#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07FF
-#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDD00
+
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_COMPRESSED)
+#define ISO14819_2_EVENT_PHRASES_COUNT 1224
+#define ISO14819_2_EVENT_PHRASES_DEPTH 12
+
+extern const byte ISO14819_2_EventPhrases[ISO14819_2_EVENT_PHRASES_COUNT * 3] PROGMEM;
 #endif
-},
-};
 
 #endif
 #endif
\ No newline at end of file
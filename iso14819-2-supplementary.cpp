@@ -0,0 +1,521 @@
+/*
+ * ISO 14819-2 code file: supplementary information entries
+ * DO NOT EDIT: automatically generated by gentables.py from CSV files
+ */
+
+#include "iso14819-2.h"
+
+#ifdef WITH_RDS_TMC_SUPPLEMENTARY
+
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+const char ISO14819_2_SupplementaryStrings[] PROGMEM =
+	"\x2F" "heavy lorries are recommended to avoid the area\0"
+	"\x0C" "follow signs\0"
+	"\x16" "follow diversion signs\0"
+	"\x16" "diversion in operation\0"
+	"\x1F" "no suitable diversion available\0"
+	"\x22" "diversion is no longer recommended\0"
+	"\x1A" "for exceptional loads only\0"
+	"\x17" "for heavy vehicles only\0"
+	"\x20" "for cars and light vehicles only\0"
+	"\x12" "snowploughs in use\0"
+	"\x18" "gritting vehicles in use\0"
+	"\x0F" "drive carefully\0"
+	"\x12" "keep your distance\0"
+	"\x0F" "observe signals\0"
+	"\x12" "overtake with care\0"
+	"\x18" "cross junction with care\0"
+	"\x0D" "no overtaking\0"
+	"\x0E" "use headlights\0"
+	"\x0E" "use fog lights\0"
+	"\x19" "do not leave your vehicle\0"
+	"\x11" "switch off engine\0"
+	"\x2C" "close all windows. Turn off heater and vents\0"
+	"\x10" "test your brakes\0"
+	"\x1C" "winter equipment recommended\0"
+	"\x17" "snow chains recommended\0"
+	"\x15" "snow chains mandatory\0"
+	"\x10" "keep to the left\0"
+	"\x11" "keep to the right\0"
+	"\x19" "use hard shoulder as lane\0"
+	"\x21" "do not drive on the hard shoulder\0"
+	"\x19" "in the opposite direction\0"
+	"\x15" "in the opposing lanes\0"
+	"\x16" "in the overtaking lane\0"
+	"\x13" "in the crawler lane\0"
+	"\x11" "in the right lane\0"
+	"\x12" "in the middle lane\0"
+	"\x10" "in the left lane\0"
+	"\x0E" "on the roadway\0"
+	"\x18" "police directing traffic\0"
+	"\x14" "police in attendance\0"
+	"\x21" "extra police patrols in operation\0"
+	"\x24" "rescue and recovery work in progress\0"
+	"\x14" "look out for flagman\0"
+	"\x16" "why not park-and-ride?\0"
+	"\x1D" "why not try public transport?\0"
+	"\x23" "only travel if absolutely necessary\0"
+	"\x1A" "increased risk of accident\0"
+	"\x0A" "on bridges\0"
+	"\x0F" "in shaded areas\0"
+	"\x1B" "entering or leaving tunnels\0"
+	"\x0E" "winter closure\0"
+	"\x19" "batch service in progress\0"
+	"\x09" "the north\0"
+	"\x0E" "the north-east\0"
+	"\x08" "the east\0"
+	"\x0E" "the south-east\0"
+	"\x09" "the south\0"
+	"\x0E" "the south-west\0"
+	"\x08" "the west\0"
+	"\x0E" "the north-west\0"
+	"\x20" "follow special diversion markers\0"
+	"\x1D" "do not follow diversion signs\0"
+	"\x16" "follow local diversion\0"
+	"\x21" "compulsory diversion in operation\0"
+	"\x20" "for petrol-engined vehicles only\0"
+	"\x20" "for diesel-engined vehicles only\0"
+	"\x15" "for LPG vehicles only\0"
+	"\x2F" "local drivers are recommended to avoid the area\0"
+	"\x30" "for 4-wheel-drive with snow tyres or chains only\0"
+	"\x0D" "in the median\0"
+	"\x0D" "for cars only\0"
+	"\x17" "for light vehicles only\0"
+	"\x26" "for vehicles with catalytic converters\0"
+	"\x29" "for vehicles without catalytic converters\0"
+	"\x1B" "for cars with trailers only\0"
+	"\x1B" "for cars with caravans only\0"
+	"\x1F" "for vehicles with trailers only\0"
+	"\x16" "for heavy lorries only\0"
+	"\x0E" "for buses only\0"
+	"\x1D" "for articulated vehicles only\0"
+	"\x1C" "for high-sided vehicles only\0"
+	"\x18" "for hazardous loads only\0"
+	"\x17" "for abnormal loads only\0"
+	"\x26" "with even-numbered registration plates\0"
+	"\x25" "with odd-numbered registration plates\0"
+	"\x10" "for all vehicles\0"
+	"\x13" "for through traffic\0"
+	"\x11" "for rail services\0"
+	"\x12" "on the underground\0"
+	"\x06" "danger\0"
+	"\x13" "repairs in progress\0"
+	"\x16" "pilot car in operation\0"
+	"\x1B" "emergency vehicles at scene\0"
+	"\x2B" "traffic being directed around accident area\0"
+	"\x13" "danger of explosion\0"
+	"\x0E" "danger of fire\0"
+	"\x10" "radiation hazard\0"
+	"\x0A" "toxic leak\0"
+	"\x19" "firemen directing traffic\0"
+	"\x20" "police speed checks in operation\0"
+	"\x1E" "mandatory speed limit in force\0"
+	"\x27" "speed limit in force for heavy vehicles\0"
+	"\x11" "reduce your speed\0"
+	"\x14" "observe speed limits\0"
+	"\x19" "observe recommended speed\0"
+	"\x14" "snow chains required\0"
+	"\x1C" "snow chains or tyres reqired\0"
+	"\x1D" "helicopter rescue in progress\0"
+	"\x22" "several accidents have taken place\0"
+	"\x1A" "drive with extreme caution\0"
+	"\x12" "approach with care\0"
+	"\x22" "increase normal following distance\0"
+	"\x1D" "do not allow unnecessary gaps\0"
+	"\x25" "follow the vehicle in front, smoothly\0"
+	"\x1F" "do not slow down unneccessarily\0"
+	"\x0D" "observe signs\0"
+	"\x19" "use hazard warning lights\0"
+	"\x0A" "no smoking\0"
+	"\x0F" "no naked flames\0"
+	"\x2B" "switch off mobile phones and two-way radios\0"
+	"\x20" "allow emergency vehicles to pass\0"
+	"\x23" "clear a lane for emergency vehicles\0"
+	"\x24" "pull over to the edge of the roadway\0"
+	"\x17" "wait for escort vehicle\0"
+	"\x24" "in emergency, wait for police patrol\0"
+	"\x17" "stop at next safe place\0"
+	"\x32" "clear a lane for snowploughs and gritting vehicles\0"
+	"\x0E" "use right lane\0"
+	"\x0D" "use left lane\0"
+	"\x1D" "heavy vehicles use right lane\0"
+	"\x1C" "heavy vehicles use left lane\0"
+	"\x19" "stop at next service area\0"
+	"\x0C" "on the right\0"
+	"\x0D" "in the centre\0"
+	"\x0B" "on the left\0"
+	"\x0F" "in the bus lane\0"
+	"\x13" "in the carpool lane\0"
+	"\x14" "on the hard shoulder\0"
+	"\x15" "in the emergency lane\0"
+	"\x1B" "on the opposite carriageway\0"
+	"\x19" "in the heavy vehicle lane\0"
+	"\x11" "in the local lane\0"
+	"\x0B" "due to heat\0"
+	"\x0C" "due to frost\0"
+	"\x11" "for ferry service\0"
+	"\x0C" "for roads in\0"
+	"\x1B" "in the through traffic lane\0"
+	"\x13" "in the express lane\0"
+	"\x1D" "in the connecting carriageway\0"
+	"\x1B" "in the parallel carriageway\0"
+	"\x26" "in the right-hand parallel carriageway\0"
+	"\x25" "in the left-hand parallel carriageway\0"
+	"\x0A" "in tunnels\0"
+	"\x0D" "on slip roads\0"
+	"\x11" "at high altitudes\0"
+	"\x12" "in low-lying areas\0"
+	"\x19" "around a bend in the road\0"
+	"\x18" "over the crest of a hill\0"
+	"\x12" "in the city centre\0"
+	"\x16" "in the inner city area\0"
+	"\x18" "in the slow vehicle lane\0"
+	"\x13" "in the turning lane\0"
+	"\x1A" "due to an earlier accident\0"
+	"\x1E" "due to shear weight of traffic\0"
+	"\x20" "due to large numbers of visitors\0"
+	"\x16" "due to holiday traffic\0"
+	"\x19" "due to technical problems\0"
+	"\x0C" "towards town\0"
+	"\x09" "from town\0"
+	"\x19" "on entry into the country\0"
+	"\x16" "on leaving the country\0"
+	"\x24" "do not throw out any burning objects\0"
+	"\x21" "traffic wardens directing traffic\0"
+	"\x12" "due to falling ice\0"
+	"\x16" "snow tyres recommended\0"
+	"\x14" "snow tyres mandatory\0"
+	"\x19" "use through traffic lanes\0"
+	"\x17" "use local traffic lanes\0"
+	"\x22" "use left-hand parallel carriageway\0"
+	"\x23" "use right-hand parallel carriageway\0"
+	"\x16" "use heavy vehicle lane\0"
+	"\x1A" "due to an earlier incident\0"
+	"\x13" "why not ride share?\0"
+	"\x19" "is this your no-ride day?\0"
+	"\x17" "due to an earlier event\0"
+	"\x17" "please use rail service\0"
+	"\x1E" "please use underground service\0"
+	"\x17" "please use tram service\0"
+	"\x16" "please use bus service\0"
+	"\x12" "for a limited time\0"
+	"\x2A" "your parking ticket covers the return ride\0"
+	"\x13" "avoid the rush hour\0"
+	"\x13" "for holiday traffic\0"
+	"\x0D" "for residents\0"
+	"\x0D" "several times\0"
+	"\x13" "during the day time\0"
+	"\x17" "during off-peak periods\0"
+	"\x10" "during the night\0"
+	"\x14" "until further notice\0"
+	"\x0C" "for arrivals\0"
+	"\x0E" "for departures\0"
+	"\x0B" "access only\0"
+	"\x04" "only\0"
+	"\x06" "except\0"
+	"\x19" "for long distance traffic\0"
+	"\x11" "for local traffic\0"
+	"\x14" "for regional traffic\0"
+	"\x12" "unconfirmed report\0"
+	"\x17" "on manual payment lanes\0"
+	"\x13" "sorry for any delay\0"
+	"\x19" "for roads leading towards\0"
+	"\x0E" "for roads from\0"
+	"\x24" "we are grateful for your cooperation\0"
+	"\x3E" "Traffic queue length decreasing at an average rate of 10 km/hr\0"
+	"\x3E" "Traffic queue length decreasing at an average rate of 20 km/hr\0"
+	"\x3E" "Traffic queue length decreasing at an average rate of 30 km/hr\0"
+	"\x3E" "Traffic queue length decreasing at an average rate of 40 km/hr\0"
+	"\x2E" "leave your vehicle. Proceed to next save place\0"
+	"\x0C" "for visitors\0"
+	"\x15" "in the roadworks area\0"
+	"\x04" "from\0"
+	"\x02" "to\0"
+	"\x02" "in\0"
+	"\x1F" "Traffic queue length increasing\0"
+	"\x3E" "Traffic queue length increasing at an average rate of 10 km/hr\0"
+	"\x3E" "Traffic queue length increasing at an average rate of 20 km/hr\0"
+	"\x3E" "Traffic queue length increasing at an average rate of 30 km/hr\0"
+	"\x3E" "Traffic queue length increasing at an average rate of 40 km/hr\0"
+	"\x15" "very frequent service\0"
+	"\x10" "frequent service\0"
+	"\x17" "fairly frequent service\0"
+	"\x0F" "regular service\0"
+	"\x1F" "Traffic queue length decreasing\0"
+	;
+#endif
+
+const TRDSTMCSupplementaryEntry ISO14819_2_Supplementary[ISO14819_2_SUPPLEMENTARY_COUNT] PROGMEM = {
+	{0x01, 0x0000},
+	{0x02, 0x0031},
+	{0x03, 0x003F},
+	{0x04, 0x0057},
+	{0x05, 0x006F},
+	{0x06, 0x0090},
+	{0x07, 0x00B4},
+	{0x08, 0x00D0},
+	{0x09, 0x00E9},
+	{0x0A, 0x010B},
+	{0x0B, 0x011F},
+	{0x0C, 0x0139},
+	{0x0D, 0x014A},
+	{0x0E, 0x015E},
+	{0x0F, 0x016F},
+	{0x10, 0x0183},
+	{0x11, 0x019D},
+	{0x12, 0x01AC},
+	{0x13, 0x01BC},
+	{0x14, 0x01CC},
+	{0x15, 0x01E7},
+	{0x16, 0x01FA},
+	{0x17, 0x0228},
+	{0x18, 0x023A},
+	{0x19, 0x0258},
+	{0x1A, 0x0271},
+	{0x1B, 0x0288},
+	{0x1C, 0x029A},
+	{0x1D, 0x02AD},
+	{0x1E, 0x02C8},
+	{0x1F, 0x02EB},
+	{0x20, 0x0306},
+	{0x21, 0x031D},
+	{0x22, 0x0335},
+	{0x23, 0x034A},
+	{0x24, 0x035D},
+	{0x25, 0x0371},
+	{0x26, 0x0383},
+	{0x27, 0x0393},
+	{0x28, 0x03AD},
+	{0x29, 0x03C3},
+	{0x2A, 0x03E6},
+	{0x2B, 0x040C},
+	{0x2C, 0x0422},
+	{0x2D, 0x043A},
+	{0x2E, 0x0459},
+	{0x2F, 0x047E},
+	{0x30, 0x049A},
+	{0x31, 0x04A6},
+	{0x32, 0x04B7},
+	{0x33, 0x04D4},
+	{0x34, 0x04E4},
+	{0x35, 0x04FF},
+	{0x36, 0x050A},
+	{0x37, 0x051A},
+	{0x38, 0x0524},
+	{0x39, 0x0534},
+	{0x3A, 0x053F},
+	{0x3B, 0x054F},
+	{0x3C, 0x0559},
+	{0x3D, 0x0569},
+	{0x3E, 0x058B},
+	{0x3F, 0x05AA},
+	{0x40, 0x05C2},
+	{0x41, 0x05E5},
+	{0x42, 0x0607},
+	{0x43, 0x0629},
+	{0x44, 0x0640},
+	{0x45, 0x0671},
+	{0x46, 0x06A3},
+	{0x47, 0x06B2},
+	{0x48, 0x06C1},
+	{0x49, 0x06DA},
+	{0x4A, 0x0702},
+	{0x4B, 0x072D},
+	{0x4C, 0x074A},
+	{0x4D, 0x0767},
+	{0x4E, 0x0788},
+	{0x4F, 0x07A0},
+	{0x50, 0x07B0},
+	{0x51, 0x07CF},
+	{0x52, 0x07ED},
+	{0x53, 0x0807},
+	{0x54, 0x0820},
+	{0x55, 0x0848},
+	{0x56, 0x086F},
+	{0x58, 0x0881},
+	{0x59, 0x0896},
+	{0x5A, 0x08A9},
+	{0x5B, 0x08BD},
+	{0x5C, 0x08C5},
+	{0x5D, 0x08DA},
+	{0x5E, 0x08F2},
+	{0x5F, 0x090F},
+	{0x60, 0x093C},
+	{0x61, 0x0951},
+	{0x62, 0x0961},
+	{0x63, 0x0973},
+	{0x64, 0x097F},
+	{0x65, 0x099A},
+	{0x66, 0x09BC},
+	{0x67, 0x09DC},
+	{0x68, 0x0A05},
+	{0x69, 0x0A18},
+	{0x6A, 0x0A2E},
+	{0x6B, 0x0A49},
+	{0x6C, 0x0A5F},
+	{0x6D, 0x0A7D},
+	{0x6E, 0x0A9C},
+	{0x6F, 0x0AC0},
+	{0x70, 0x0ADC},
+	{0x71, 0x0AF0},
+	{0x72, 0x0B14},
+	{0x73, 0x0B33},
+	{0x74, 0x0B5A},
+	{0x75, 0x0B7B},
+	{0x76, 0x0B8A},
+	{0x77, 0x0BA5},
+	{0x78, 0x0BB1},
+	{0x79, 0x0BC2},
+	{0x7A, 0x0BEF},
+	{0x7B, 0x0C11},
+	{0x7C, 0x0C36},
+	{0x7D, 0x0C5C},
+	{0x7E, 0x0C75},
+	{0x80, 0x0C9B},
+	{0x81, 0x0CB4},
+	{0x83, 0x0CE8},
+	{0x84, 0x0CF8},
+	{0x85, 0x0D07},
+	{0x86, 0x0D26},
+	{0x88, 0x0D44},
+	{0x8D, 0x0D5F},
+	{0x8E, 0x0D6D},
+	{0x8F, 0x0D7C},
+	{0x90, 0x0D89},
+	{0x91, 0x0D9A},
+	{0x92, 0x0DAF},
+	{0x93, 0x0DC5},
+	{0x94, 0x0DDC},
+	{0x95, 0x0DF9},
+	{0x96, 0x0E14},
+	{0x97, 0x0E27},
+	{0x98, 0x0E34},
+	{0x99, 0x0E42},
+	{0x9A, 0x0E55},
+	{0x9B, 0x0E63},
+	{0x9C, 0x0E80},
+	{0x9D, 0x0E95},
+	{0x9E, 0x0EB4},
+	{0x9F, 0x0ED1},
+	{0xA0, 0x0EF9},
+	{0xA1, 0x0F20},
+	{0xA2, 0x0F2C},
+	{0xA3, 0x0F3B},
+	{0xA4, 0x0F4E},
+	{0xA5, 0x0F62},
+	{0xA6, 0x0F7D},
+	{0xA7, 0x0F97},
+	{0xA8, 0x0FAB},
+	{0xA9, 0x0FC3},
+	{0xAA, 0x0FDD},
+	{0xAB, 0x0FF2},
+	{0xAC, 0x100E},
+	{0xAD, 0x102E},
+	{0xAE, 0x1050},
+	{0xAF, 0x1068},
+	{0xB0, 0x1083},
+	{0xB1, 0x1091},
+	{0xB2, 0x109C},
+	{0xB3, 0x10B7},
+	{0xB4, 0x10CF},
+	{0xB5, 0x10F5},
+	{0xB9, 0x1118},
+	{0xBF, 0x112C},
+	{0xC0, 0x1144},
+	{0xC3, 0x115A},
+	{0xC4, 0x1175},
+	{0xC5, 0x118E},
+	{0xC6, 0x11B2},
+	{0xC7, 0x11D7},
+	{0xC8, 0x11EF},
+	{0xC9, 0x120B},
+	{0xCA, 0x1220},
+	{0xCB, 0x123B},
+	{0xCC, 0x1254},
+	{0xCD, 0x126D},
+	{0xCE, 0x128D},
+	{0xCF, 0x12A6},
+	{0xD0, 0x12BE},
+	{0xD1, 0x12D2},
+	{0xD2, 0x12FE},
+	{0xD3, 0x1313},
+	{0xD4, 0x1328},
+	{0xD5, 0x1337},
+	{0xD6, 0x1346},
+	{0xD7, 0x135B},
+	{0xD8, 0x1374},
+	{0xD9, 0x1386},
+	{0xDA, 0x139C},
+	{0xDB, 0x13AA},
+	{0xDC, 0x13BA},
+	{0xDD, 0x13C7},
+	{0xDE, 0x13CD},
+	{0xDF, 0x13D5},
+	{0xE0, 0x13F0},
+	{0xE1, 0x1403},
+	{0xE2, 0x1419},
+	{0xE3, 0x142D},
+	{0xE7, 0x1446},
+	{0xE8, 0x145B},
+	{0xE9, 0x1476},
+	{0xEA, 0x1486},
+	{0xEB, 0x14AC},
+	{0xEC, 0x14EC},
+	{0xED, 0x152C},
+	{0xEE, 0x156C},
+	{0xEF, 0x15AC},
+	{0xF0, 0x15DC},
+	{0xF1, 0x15EA},
+	{0xF2, 0x1601},
+	{0xF3, 0x1607},
+	{0xF4, 0x160B},
+	{0xF5, 0x160F},
+	{0xF6, 0x1630},
+	{0xF7, 0x1670},
+	{0xF8, 0x16B0},
+	{0xF9, 0x16F0},
+	{0xFA, 0x1730},
+	{0xFB, 0x1747},
+	{0xFC, 0x1759},
+	{0xFD, 0x1772},
+	{0xFF, 0x1783},
+};
+
+#if defined(WITH_RDS_TMC_DIRECT_INDEX)
+const uint8_t ISO14819_2_SupplementaryIndex[256] PROGMEM = {
+	0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+	0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+	0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+	0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E,
+	0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
+	0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E,
+	0x2F, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+	0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E,
+	0x3F, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+	0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E,
+	0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0xFF,
+	0x56, 0x57, 0x58, 0x59, 0x5A, 0x5B, 0x5C, 0x5D,
+	0x5E, 0x5F, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65,
+	0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D,
+	0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75,
+	0x76, 0x77, 0x78, 0x79, 0x7A, 0x7B, 0x7C, 0xFF,
+	0x7D, 0x7E, 0xFF, 0x7F, 0x80, 0x81, 0x82, 0xFF,
+	0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0x84, 0x85, 0x86,
+	0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E,
+	0x8F, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+	0x97, 0x98, 0x99, 0x9A, 0x9B, 0x9C, 0x9D, 0x9E,
+	0x9F, 0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6,
+	0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xFF, 0xFF,
+	0xFF, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAE,
+	0xAF, 0xFF, 0xFF, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4,
+	0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC,
+	0xBD, 0xBE, 0xBF, 0xC0, 0xC1, 0xC2, 0xC3, 0xC4,
+	0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xCB, 0xCC,
+	0xCD, 0xCE, 0xCF, 0xD0, 0xFF, 0xFF, 0xFF, 0xD1,
+	0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9,
+	0xDA, 0xDB, 0xDC, 0xDD, 0xDE, 0xDF, 0xE0, 0xE1,
+	0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xFF, 0xE8,
+};
+#endif
+
+#endif
@@ -40,7 +40,8 @@
  * attention and make an informed and deliberate choice about their
  * configuration.
  */
-#if !(defined(WITH_RDS_TMC_ALLIN_FLASH) || defined(WITH_RDS_TMC_ALLIN_EEPROM))
+#if !(defined(WITH_RDS_TMC_ALLIN_FLASH) || defined(WITH_RDS_TMC_ALLIN_EEPROM) ||\
+      defined(WITH_RDS_TMC_ALLIN_FILE))
 # warning No ISO 14819-2 string tables storage configuration specified, using\
  defaults which may not be what you want!
 # define WITH_RDS_TMC_ALLIN_FLASH
@@ -54,6 +55,14 @@
 # define WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH
 #endif
 
+/* Hosted builds may instead leave all tables out and map them from a table
+ * file at runtime, see RDSTMCTables.h.
+ */
+#if defined(WITH_RDS_TMC_ALLIN_FILE) && !(defined(__i386__) || \
+ defined(__x86_64__))
+# error ISO 14819-2 table files are only supported in hosted builds!
+#endif
+
 #if defined(WITH_RDS_TMC_ALLIN_EEPROM)
 # define WITH_RDS_TMC_EVENTS
 # define WITH_RDS_TMC_SUPPLEMENTARY
@@ -62,6 +71,15 @@
 # define WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM
 #endif
 
+/* Hosted builds have memory to spare, so trade 4.5KiB for O(1) lookups of
+ * event and supplementary information records by code.
+ */
+#if (defined(__i386__) || defined(__x86_64__)) && \
+ defined(WITH_RDS_TMC_EVENTS) && defined(WITH_RDS_TMC_SUPPLEMENTARY) && \
+ !defined(WITHOUT_RDS_TMC_DIRECT_INDEX)
+# define WITH_RDS_TMC_DIRECT_INDEX
+#endif
+
 /* Sanity check string table configuration */
 #if defined(WITH_RDS_TMC_EVENT_STRING_POINTERS) && \
  !defined(WITH_RDS_TMC_EVENTS)
@@ -111,6 +129,35 @@
 #define RDS_TMC_URGENCY_URGENT 0x1
 #define RDS_TMC_URGENCY_XURGENT 0x2
 
+/* Event and supplementary information strings live in one pool per table
+ * (either in FLASH or in the external EEPROM), each as a length byte followed
+ * by the NUL-terminated text. Records refer to them by the offset of said
+ * length byte, see gentables.py.
+ */
+#if defined(WITH_RDS_TMC_EVENT_STRING_POINTERS)
+# if defined(WITH_RDS_TMC_EVENT_STRINGS_COMPRESSED)
+#  define RDS_TMC_EVENT_STRING(plain, packed) , packed
+# else
+#  define RDS_TMC_EVENT_STRING(plain, packed) , plain
+# endif
+#else
+# define RDS_TMC_EVENT_STRING(plain, packed)
+#endif
+
+/* With WITH_RDS_TMC_EVENT_STRINGS_COMPRESSED, the event string pool (be it in
+ * FLASH or in the external EEPROM, from iso14819-2-events-compressed.eeprom)
+ * holds phrase-compressed texts, about a quarter the size, which need
+ * RDSTranslator::expandTMCText() to turn them back into text. Each byte of a
+ * compressed text is one of:
+ *   0x20 - 0x7E: a literal character;
+ *   0x01 - 0x1F, 0x7F - 0xDF: phrase 0 - 127, in that order;
+ *   0xE0 - 0xFF: the high bits of phrase 128 and up, the next byte has the low
+ *                eight.
+ * Phrases in turn expand to two symbols, see gentables.py.
+ */
+#define RDS_TMC_PHRASE_SHORT_CODES 0x80
+#define RDS_TMC_PHRASE_LONG_PREFIX 0xE0
+
 #if defined(WITH_RDS_TMC_EVENTS)
 typedef struct __attribute__ ((__packed__)) {
   uint16_t code:12;
@@ -122,15 +169,15 @@ typedef struct __attribute__ ((__packed__)) {
   uint8_t bidirectional:1;
   byte updateClass;
 # if defined(WITH_RDS_TMC_EVENT_STRING_POINTERS)
-  const char * const description;
+  uint16_t description;
 # endif
 } TRDSTMCEventListEntry;
 #endif
 
 #if defined(WITH_RDS_TMC_SUPPLEMENTARY)
-typedef struct {
+typedef struct __attribute__ ((__packed__)) {
   byte code;
-  const char * const description;
+  uint16_t description;
 } TRDSTMCSupplementaryEntry;
 #endif
 